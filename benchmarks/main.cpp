@@ -0,0 +1,391 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TGUI.hpp>
+#include <TGUI/Backend/Null.hpp>
+
+#include <functional>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <chrono>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// tgui-bench measures how much time the gui itself spends per frame for a few typical scenes.
+// The NULL backend is used, so no time is spent in a window system or in a graphics driver.
+//
+// Afterwards a few microbenchmarks measure the text layout functions on a large string.
+// The memory used by the glyph atlas of the font and the amount of glyphs in it are printed for each scene, passing --sdf
+// makes the font store its glyphs as distance fields to compare both modes.
+//
+// Usage: tgui-bench [--frames N] [--sdf] [scene or microbenchmark names...]
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const unsigned int windowWidth = 1280;
+    const unsigned int windowHeight = 720;
+
+    struct Scene
+    {
+        const char* name;
+        std::function<void(tgui::Gui&)> create;
+        std::function<void(tgui::Gui&, unsigned int frame)> generateEvents;
+    };
+
+    struct Microbenchmark
+    {
+        const char* name;
+        std::function<void(const tgui::String& text)> run;
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    std::uint64_t elapsedNs(Clock::time_point start, Clock::time_point end)
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    // Moves the mouse over the window in a pattern that visits the whole window without staying at the same spot
+    void moveMouse(tgui::Gui& gui, unsigned int frame)
+    {
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseMoved;
+        event.mouseMove.x = static_cast<int>((frame * 37) % windowWidth);
+        event.mouseMove.y = static_cast<int>((frame * 23) % windowHeight);
+        gui.handleEvent(event);
+    }
+
+    // Scrolls down during 50 frames and then back up during 50 frames
+    void scrollMouseWheel(tgui::Gui& gui, unsigned int frame)
+    {
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseWheelScrolled;
+        event.mouseWheel.delta = ((frame / 50) % 2 == 0) ? -1.f : 1.f;
+        event.mouseWheel.x = static_cast<int>(windowWidth / 2);
+        event.mouseWheel.y = static_cast<int>(windowHeight / 2);
+        gui.handleEvent(event);
+    }
+
+    std::vector<Scene> createScenes()
+    {
+        std::vector<Scene> scenes;
+
+        scenes.push_back({"buttons-10k",
+            [](tgui::Gui& gui) {
+                for (unsigned int i = 0; i < 10000; ++i)
+                {
+                    auto button = tgui::Button::create("Button " + tgui::String(i));
+                    button->setPosition({(i % 100) * 12.8f, (i / 100) * 7.2f});
+                    button->setSize({60, 20});
+                    gui.add(button);
+                }
+            },
+            moveMouse
+        });
+
+        scenes.push_back({"listview-100k",
+            [](tgui::Gui& gui) {
+                auto listView = tgui::ListView::create();
+                listView->setSize({"100%", "100%"});
+                listView->addColumn("Id", 100);
+                listView->addColumn("Name", 300);
+                listView->addColumn("Description", 600);
+
+                std::vector<std::vector<tgui::String>> items;
+                items.reserve(100000);
+                for (unsigned int i = 0; i < 100000; ++i)
+                    items.push_back({tgui::String(i), "Item " + tgui::String(i), "Description of item number " + tgui::String(i)});
+                listView->addMultipleItems(items);
+                gui.add(listView);
+            },
+            moveMouse
+        });
+
+        scenes.push_back({"textarea-5mb",
+            [](tgui::Gui& gui) {
+                const tgui::String line = U"The quick brown fox jumps over the lazy dog. Lorem ipsum dolor sit amet, consectetur.\n";
+                tgui::String text;
+                const std::size_t lineCount = (5 * 1024 * 1024) / line.length();
+                text.reserve(lineCount * line.length());
+                for (std::size_t i = 0; i < lineCount; ++i)
+                    text += line;
+
+                auto textArea = tgui::TextArea::create();
+                textArea->setSize({"100%", "100%"});
+                textArea->setText(text);
+                gui.add(textArea);
+            },
+            moveMouse
+        });
+
+        scenes.push_back({"treeview-deep",
+            [](tgui::Gui& gui) {
+                auto treeView = tgui::TreeView::create();
+                treeView->setSize({"100%", "100%"});
+
+                // 8 levels deep with 3 children per node
+                std::vector<tgui::String> hierarchy;
+                const std::function<void(unsigned int)> addChildren = [&](unsigned int depth) {
+                    for (unsigned int i = 0; i < 3; ++i)
+                    {
+                        hierarchy.push_back("Level " + tgui::String(depth) + " item " + tgui::String(i));
+                        treeView->addItem(hierarchy, false);
+                        if (depth + 1 < 8)
+                            addChildren(depth + 1);
+                        hierarchy.pop_back();
+                    }
+                };
+                addChildren(0);
+                treeView->expandAll();
+                gui.add(treeView);
+            },
+            moveMouse
+        });
+
+        scenes.push_back({"textsizes-64",
+            [](tgui::Gui& gui) {
+                // Texts that are scaled with the window typically use many different character sizes
+                for (unsigned int i = 0; i < 64; ++i)
+                {
+                    auto label = tgui::Label::create("The quick brown fox jumps over the lazy dog 0123456789");
+                    label->setTextSize(8 + i);
+                    label->setPosition({(i % 2) * 640.f, (i / 2) * 22.f});
+                    gui.add(label);
+                }
+            },
+            moveMouse
+        });
+
+        scenes.push_back({"scrollablepanel-200",
+            [](tgui::Gui& gui) {
+                auto panel = tgui::ScrollablePanel::create({"100%", "100%"});
+                for (unsigned int i = 0; i < 200; ++i)
+                {
+                    tgui::Widget::Ptr widget;
+                    switch (i % 4)
+                    {
+                    case 0:
+                        widget = tgui::Button::create("Button " + tgui::String(i));
+                        break;
+                    case 1:
+                        widget = tgui::Label::create("Label " + tgui::String(i));
+                        break;
+                    case 2:
+                        widget = tgui::EditBox::create();
+                        std::static_pointer_cast<tgui::EditBox>(widget)->setText("Edit box " + tgui::String(i));
+                        break;
+                    default:
+                        widget = tgui::CheckBox::create("Check box " + tgui::String(i));
+                        break;
+                    }
+
+                    widget->setPosition({(i % 4) * 300.f + 10, (i / 4) * 60.f + 10});
+                    panel->add(widget);
+                }
+                gui.add(panel);
+            },
+            [](tgui::Gui& gui, unsigned int frame) {
+                moveMouse(gui, frame);
+                scrollMouseWheel(gui, frame);
+            }
+        });
+
+        return scenes;
+    }
+
+    std::vector<Microbenchmark> createMicrobenchmarks()
+    {
+        std::vector<Microbenchmark> microbenchmarks;
+
+        microbenchmarks.push_back({"linewidth-1mb",
+            [](const tgui::String& text) {
+                // getLineWidth stops at the first newline, so measure the text as a single line
+                tgui::String line = text;
+                std::replace(line.begin(), line.end(), U'\n', U' ');
+                tgui::Text::getLineWidth(line, tgui::Font::getGlobalFont(), 16);
+            }
+        });
+
+        microbenchmarks.push_back({"wordwrap-1mb",
+            [](const tgui::String& text) {
+                tgui::Text::wordWrap(400, text, tgui::Font::getGlobalFont(), 16, false);
+            }
+        });
+
+        microbenchmarks.push_back({"textlayout-1mb",
+            [](const tgui::String& text) {
+                tgui::Text layoutText;
+                layoutText.setFont(tgui::Font::getGlobalFont());
+                layoutText.setCharacterSize(16);
+                layoutText.setString(text);
+                layoutText.getSize();
+                layoutText.findCharacterPos(text.length());
+            }
+        });
+
+        return microbenchmarks;
+    }
+
+    void runMicrobenchmark(const Microbenchmark& microbenchmark, const tgui::String& text, unsigned int iterations)
+    {
+        // The first run loads the glyphs, it is not representative for the other runs
+        microbenchmark.run(text);
+
+        const auto start = Clock::now();
+        for (unsigned int i = 0; i < iterations; ++i)
+            microbenchmark.run(text);
+        const auto end = Clock::now();
+
+        std::cout << std::left << std::setw(22) << microbenchmark.name << std::right
+                  << std::setw(12) << elapsedNs(start, end) / iterations / 1000 << std::endl;
+    }
+
+    void runScene(const Scene& scene, unsigned int frameCount, bool distanceField)
+    {
+        tgui::Gui gui({windowWidth, windowHeight});
+        gui.setDrawingUpdatesTime(false);
+
+        // Every scene gets a new backend and thus a new font, so the atlas only contains the glyphs used in the scene
+        const auto font = std::dynamic_pointer_cast<tgui::BackendFontFreetype>(tgui::Font::getGlobalFont().getBackendFont());
+        if (font)
+            font->setDistanceFieldEnabled(distanceField);
+
+        const auto setupStart = Clock::now();
+        scene.create(gui);
+        const auto setupEnd = Clock::now();
+
+        // The first frame creates the textures for the glyphs, it is not representative for the other frames
+        gui.draw();
+
+        // Amount of glyph pixels that are uploaded to the font texture in the measured frames
+        const std::size_t uploadedBytesStart = font ? font->getUploadedTextureBytes() : 0;
+
+        std::uint64_t updateTimeNs = 0;
+        std::uint64_t eventsNs = 0;
+        std::uint64_t drawNs = 0;
+        for (unsigned int frame = 0; frame < frameCount; ++frame)
+        {
+            const auto frameStart = Clock::now();
+            gui.updateTime();
+            const auto updateTimeEnd = Clock::now();
+            scene.generateEvents(gui, frame);
+            const auto eventsEnd = Clock::now();
+            gui.draw();
+            const auto drawEnd = Clock::now();
+
+            updateTimeNs += elapsedNs(frameStart, updateTimeEnd);
+            eventsNs += elapsedNs(updateTimeEnd, eventsEnd);
+            drawNs += elapsedNs(eventsEnd, drawEnd);
+        }
+
+        const std::size_t uploadedBytes = (font ? font->getUploadedTextureBytes() : 0) - uploadedBytesStart;
+
+        const auto atlasStats = font ? font->getAtlasStatistics() : tgui::BackendFontFreetype::AtlasStatistics{};
+        const auto& stats = gui.getStatistics();
+        std::cout << std::left << std::setw(22) << scene.name << std::right
+                  << std::setw(12) << elapsedNs(setupStart, setupEnd) / 1000000
+                  << std::setw(14) << updateTimeNs / frameCount
+                  << std::setw(14) << eventsNs / frameCount
+                  << std::setw(14) << drawNs / frameCount
+                  << std::setw(10) << stats.drawCalls
+                  << std::setw(10) << stats.vertices
+                  << std::setw(10) << stats.indices
+                  << std::setw(10) << stats.textureBinds
+                  << std::setw(10) << stats.clipChanges
+                  << std::setw(14) << uploadedBytes / frameCount
+                  << std::setw(10) << atlasStats.bytesInUse / 1024
+                  << std::setw(10) << atlasStats.glyphs
+                  << std::endl;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    unsigned int frameCount = 100;
+    bool distanceField = false;
+    std::vector<std::string> selectedScenes;
+    for (int i = 1; i < argc; ++i)
+    {
+        if ((std::strcmp(argv[i], "--frames") == 0) && (i + 1 < argc))
+            frameCount = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+        else if (std::strcmp(argv[i], "--sdf") == 0)
+            distanceField = true;
+        else
+            selectedScenes.push_back(argv[i]);
+    }
+
+    std::cout << std::left << std::setw(22) << "scene" << std::right
+              << std::setw(12) << "setup ms"
+              << std::setw(14) << "update ns/f"
+              << std::setw(14) << "events ns/f"
+              << std::setw(14) << "draw ns/f"
+              << std::setw(10) << "draws"
+              << std::setw(10) << "vertices"
+              << std::setw(10) << "indices"
+              << std::setw(10) << "textures"
+              << std::setw(10) << "clips"
+              << std::setw(14) << "font B/f"
+              << std::setw(10) << "atlas KB"
+              << std::setw(10) << "glyphs"
+              << std::endl;
+
+    for (const auto& scene : createScenes())
+    {
+        if (!selectedScenes.empty() && (std::find(selectedScenes.begin(), selectedScenes.end(), scene.name) == selectedScenes.end()))
+            continue;
+
+        runScene(scene, frameCount, distanceField);
+    }
+
+    // The microbenchmarks lay out 1 MB of text consisting of lines with typical words
+    const tgui::String line = U"The quick brown fox jumps over the lazy dog. Lorem ipsum dolor sit amet, consectetur.\n";
+    tgui::String text;
+    text.reserve(1024 * 1024);
+    while (text.length() + line.length() <= 1024 * 1024)
+        text += line;
+
+    bool headerPrinted = false;
+    tgui::Gui gui({windowWidth, windowHeight}); // Makes sure that the backend and the global font exist
+    for (const auto& microbenchmark : createMicrobenchmarks())
+    {
+        if (!selectedScenes.empty() && (std::find(selectedScenes.begin(), selectedScenes.end(), microbenchmark.name) == selectedScenes.end()))
+            continue;
+
+        if (!headerPrinted)
+        {
+            std::cout << std::endl << std::left << std::setw(22) << "microbenchmark" << std::right << std::setw(12) << "us/run" << std::endl;
+            headerPrinted = true;
+        }
+
+        runMicrobenchmark(microbenchmark, text, 5);
+    }
+
+    return 0;
+}
@@ -31,6 +31,8 @@
 #include <TGUI/Global.hpp>
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -83,6 +85,19 @@ namespace tgui
         bool loadFromMemory(const void* data, std::size_t sizeInBytes);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font from memory that may be shared with other fonts
+        ///
+        /// @param data         Pointer to the file data in memory, which may not be changed while any font is using it
+        /// @param sizeInBytes  Size of the data to load, in bytes
+        ///
+        /// @return True if the font was loaded successfully, false otherwise
+        ///
+        /// Backends that can't share the data with other fonts make a copy of it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool loadFromSharedMemory(std::shared_ptr<const std::uint8_t> data, std::size_t sizeInBytes);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether a font contains a certain glyph
         ///
@@ -109,6 +124,41 @@ namespace tgui
         virtual FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs in advance so that they don't have to be loaded while drawing text
+        ///
+        /// @param codePointRanges  Ranges of unicode code points to load, both the first and last code point are included
+        /// @param characterSizes   Character sizes for which the glyphs should be loaded
+        /// @param bold             Load the bold version or the regular one?
+        /// @param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+        ///
+        /// The default implementation calls getGlyph for every character that exists in the font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void preloadGlyphs(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges,
+                                   const std::vector<unsigned int>& characterSizes, bool bold = false, float outlineThickness = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the advances and kerning of all characters in a string at once
+        ///
+        /// @param codePoints     Unicode code points of the characters in the string
+        /// @param count          Amount of characters in the string
+        /// @param characterSize  Size of the characters
+        /// @param bold           Are the glyphs bold or regular?
+        /// @param advances       Array of count elements in which the advance of each character will be stored
+        /// @param kernings       Array of count elements in which the kerning between each character and the previous one will
+        ///                       be stored
+        ///
+        /// The values are the ones that the text layout uses: a tab is 4 times as wide as a space, a newline has no advance and
+        /// carriage returns are ignored (both their advance and kerning are 0 and they aren't the previous character of the
+        /// next character). The first character has no kerning.
+        ///
+        /// The default implementation calls getGlyph and getKerning for every character.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void getAdvances(const char32_t* codePoints, std::size_t count, unsigned int characterSize, bool bold,
+                                 float* advances, float* kernings);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -172,6 +222,42 @@ namespace tgui
         virtual std::shared_ptr<BackendTexture> getTexture(unsigned int characterSize) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a value that changes whenever glyphs of the given character size are removed from or moved inside
+        ///        their texture
+        ///
+        /// @param characterSize  Size of the characters
+        ///
+        /// @return Value that only changes when the texture coordinates of previously returned glyphs are no longer valid
+        ///
+        /// Texts that cache their vertices compare this value with the one from when they requested their glyphs, and request
+        /// the glyphs again when it changed. Fonts that never remove glyphs from their texture always return 0.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::uint64_t getGlyphGeneration(unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the font which sheets of its texture contain the glyphs of a text that is being drawn
+        ///
+        /// @param characterSize  Size of the characters
+        /// @param sheets         Bitmask with the bit of FontGlyph::sheet set for every glyph in the text
+        ///
+        /// Texts call this function every time they are drawn, so that fonts that have to remove glyphs from their texture
+        /// can keep the glyphs that are still being drawn. Fonts that never remove glyphs from their texture ignore it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void markSheetsDrawn(unsigned int characterSize, std::uint64_t sheets);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the fonts that are used to render characters that don't exist in this font
+        ///
+        /// @param fonts  Fonts that are searched in order for characters that are missing in this font
+        ///
+        /// Fallback fonts are only supported by the FreeType font backend, other font backends ignore them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setFallbackFonts(const std::vector<std::shared_ptr<BackendFont>>& fonts);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
@@ -28,6 +28,9 @@
 
 #include <TGUI/Backend/Font/BackendFont.hpp>
 #include <unordered_map>
+#include <vector>
+#include <array>
+#include <mutex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -42,10 +45,22 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Font implementations that uses FreeType directly to load glyphs
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    class BackendFontFreetype : public BackendFont
+    class TGUI_API BackendFontFreetype : public BackendFont
     {
     public:
 
+        /// @brief Statistics about the glyph atlas, returned by getAtlasStatistics
+        struct AtlasStatistics
+        {
+            std::size_t pages = 0;         //!< Amount of pages that currently exist (one per character size, or one for all distance field glyphs)
+            std::size_t sheets = 0;        //!< Amount of sheets in all pages together (a page gets more sheets when it is full)
+            std::size_t bytesInUse = 0;    //!< Amount of bytes used by the pixels of all pages
+            std::size_t evictedGlyphs = 0; //!< Amount of glyphs that were removed to make room for new glyphs when no sheet could be added
+            std::size_t evictedPages = 0;  //!< Amount of pages that were removed to stay within the memory budget
+            std::size_t glyphs = 0;        //!< Amount of glyphs that are currently stored in all pages together
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Destructor that cleans up the FreeType resources
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,12 +79,27 @@ namespace tgui
         using BackendFont::loadFromMemory;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font from memory that may be shared with other fonts
+        ///
+        /// @param data         Pointer to the file data in memory, which may not be changed while any font is using it
+        /// @param sizeInBytes  Size of the data to load, in bytes
+        ///
+        /// @return True if the font was loaded successfully, false otherwise
+        ///
+        /// The data isn't copied, every font that is loaded from it opens its own face on the same data.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadFromSharedMemory(std::shared_ptr<const std::uint8_t> data, std::size_t sizeInBytes) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether a font contains a certain glyph
         ///
         /// @param codePoint  Character to check
         ///
-        /// @return Does the font contain this character?
+        /// @return Does the font or one of its fallback fonts contain this character?
+        ///
+        /// The characters in the font are looked up in a coverage table, which is built when it is first needed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool hasGlyph(char32_t codePoint) const override;
 
@@ -90,6 +120,25 @@ namespace tgui
         virtual FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs in advance so that they don't have to be loaded while drawing text
+        ///
+        /// @param codePointRanges  Ranges of unicode code points to load, both the first and last code point are included
+        /// @param characterSizes   Character sizes for which the glyphs should be loaded
+        /// @param bold             Load the bold version or the regular one?
+        /// @param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+        ///
+        /// The glyphs are rasterized on multiple threads, each with their own FreeType face. The results are placed in the
+        /// glyph atlas afterwards on the calling thread. Characters that don't exist in the font and glyphs that were already
+        /// loaded are skipped.
+        ///
+        /// This function may be called from a different thread than the one that draws the gui (e.g. while a splash screen
+        /// is being shown), all functions of this font can safely be called while the glyphs are being loaded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphs(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges,
+                           const std::vector<unsigned int>& characterSizes, bool bold = false, float outlineThickness = 0) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -107,6 +156,24 @@ namespace tgui
         virtual float getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the advances and kerning of all characters in a string at once
+        ///
+        /// @param codePoints     Unicode code points of the characters in the string
+        /// @param count          Amount of characters in the string
+        /// @param characterSize  Size of the characters
+        /// @param bold           Are the glyphs bold or regular?
+        /// @param advances       Array of count elements in which the advance of each character will be stored
+        /// @param kernings       Array of count elements in which the kerning between each character and the previous one will
+        ///                       be stored
+        ///
+        /// The metrics are loaded without rasterizing the glyphs and are cached per character size and style, with a direct
+        /// lookup table for ASCII characters. The kerning of character pairs is cached as well.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getAdvances(const char32_t* codePoints, std::size_t count, unsigned int characterSize, bool bold,
+                         float* advances, float* kernings) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the line spacing
         ///
@@ -149,10 +216,35 @@ namespace tgui
         /// @param characterSize  Size of the characters that should be part of the texture
         ///
         /// @return Texture to render text glyphs with
+        ///
+        /// Every character size has its own page in the glyph atlas, so this function returns a different texture for each size.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::shared_ptr<BackendTexture> getTexture(unsigned int characterSize) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the font which sheets of its texture contain the glyphs of a text that is being drawn
+        ///
+        /// @param characterSize  Size of the characters
+        /// @param sheets         Bitmask with the bit of FontGlyph::sheet set for every glyph in the text
+        ///
+        /// When a new glyph doesn't fit in the atlas anymore, the sheet in which no glyphs were drawn for the longest time is
+        /// cleared to make room for it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markSheetsDrawn(unsigned int characterSize, std::uint64_t sheets) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a value that changes whenever glyphs of the given character size are removed from or moved inside
+        ///        their texture
+        ///
+        /// @param characterSize  Size of the characters
+        ///
+        /// @return Generation of the page that contains the glyphs, or 0 if no glyphs are loaded for the character size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint64_t getGlyphGeneration(unsigned int characterSize) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
@@ -165,23 +257,270 @@ namespace tgui
         void setSmooth(bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the fonts that are used to render characters that don't exist in this font
+        ///
+        /// @param fonts  Fonts that are searched in order for characters that are missing in this font
+        ///
+        /// Each fallback font gets its own FreeType face that is opened on the data of the font, together with a coverage
+        /// table that stores which characters it contains. Finding the font that contains a character is thus a lookup in
+        /// these tables, without querying FreeType. Glyphs from the fallback fonts are placed in the pages of this font, so
+        /// texts that mix characters from different fonts still use a single texture per character size. They are kept in
+        /// separate sheets of the page though, so that they never evict the glyphs of this font.
+        ///
+        /// Kerning is only applied between characters that come from the same font. The line spacing and underline are
+        /// always those of this font. Fonts that don't use the FreeType backend are ignored.
+        /// Changing the fallback fonts removes all glyphs from the atlas.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFallbackFonts(const std::vector<std::shared_ptr<BackendFont>>& fonts) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of pixel data that was sent to the texture since the font was loaded
+        ///
+        /// @return Amount of bytes that were uploaded to the texture
+        ///
+        /// When new glyphs are loaded, only the rows of the texture that contain them are uploaded. The entire texture is only
+        /// uploaded when it is created or when it had to grow. Comparing the value before and after drawing a frame gives the
+        /// amount of bytes that was uploaded during that frame.
+        /// The texture only contains alpha values, so every uploaded pixel takes a single byte.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getUploadedTextureBytes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of memory that the pages of the glyph atlas may use together
+        ///
+        /// @param bytes  Memory budget in bytes (each pixel in a page takes a single byte)
+        ///
+        /// When a page has to grow or a page for a new character size is needed while the budget has been reached, then the
+        /// page that wasn't used for the longest time is removed. Texts using glyphs from that page will load them again
+        /// when they are drawn. A full page only gets an extra sheet when it fits in the budget, or when pages of other
+        /// character sizes that weren't drawn since any sheet of the full page can be removed. The default budget is 8 MB.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMemoryBudget(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of memory that the pages of the glyph atlas may use together
+        ///
+        /// @return Memory budget in bytes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMemoryBudget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum width and height of a single page in the glyph atlas
+        ///
+        /// @param size  Maximum size of a page, which should be a power of 2
+        ///
+        /// Pages start small and double in size when they are full until they reach this size (or the maximum texture size
+        /// of the renderer). When a page that reached its maximum size is full, a sheet with the same size is added below it
+        /// in the texture, as long as the memory budget and the maximum texture size of the renderer allow it. Otherwise the
+        /// sheet in which no glyphs were drawn for the longest time is cleared. The default maximum page size is 1024.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaximumPageSize(unsigned int size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum width and height of a single page in the glyph atlas
+        ///
+        /// @return Maximum size of a page
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getMaximumPageSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether glyphs are stored as signed distance fields
+        ///
+        /// @param enabled  True to render glyphs from distance fields, false to rasterize them separately for every size
+        ///
+        /// In distance field mode, glyphs are only rasterized once at a reference size of 48 pixels. The distance to the edge
+        /// of the glyph is stored in the atlas instead of its coverage, which allows the renderer to reconstruct crisp edges
+        /// at any scale. All character sizes then share a single page, which uses a lot less memory and avoids loading the
+        /// same glyphs again for every size. Character sizes below 8 are still rasterized normally.
+        ///
+        /// Hinting isn't applied to glyphs drawn from distance fields, so small texts may look slightly blurrier. The advance
+        /// and kerning of the characters don't change, so lines are laid out and wrapped identically in both modes.
+        /// Only the OpenGL3, GLES2 and software renderers can draw distance fields. Distance field mode is disabled by default.
+        ///
+        /// Changing this setting removes all glyphs from the atlas.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceFieldEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs are stored as signed distance fields
+        ///
+        /// @return Is distance field mode enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDistanceFieldEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the pages of the glyph atlas
+        ///
+        /// @return Amount of pages, the memory they use and how many glyphs and pages were evicted since the font was loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AtlasStatistics getAtlasStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the default font uses the glyphs that were rasterized in advance
+        ///
+        /// @param enabled  Should fonts that are loaded from now on use the prebaked glyphs when they contain the default font?
+        ///
+        /// The printable ASCII and Latin-1 characters of the default font (DejaVu Sans) are rasterized at the most common
+        /// character sizes when TGUI is built, together with their metrics and the kerning between ASCII characters
+        /// (see include/TGUI/DefaultFontAtlas.hpp, which is generated by the tgui-bake-default-font target).
+        /// When a font is loaded with exactly the same data, these glyphs are copied into the atlas when a prebaked character
+        /// size is first used and FreeType isn't initialized until a glyph or size is needed that wasn't prebaked.
+        ///
+        /// Prebaked glyphs are enabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setPrebakedDefaultFontEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the default font uses the glyphs that were rasterized in advance
+        ///
+        /// @return Are prebaked glyphs used for the default font?
+        ///
+        /// @see setPrebakedDefaultFontEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isPrebakedDefaultFontEnabled();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         struct Glyph
         {
-            float     advance = 0;   //!< Offset to move horizontally to the next character
-            float     lsbDelta = 0;  //!< Left offset after forced autohint. Internally used by getKerning()
-            float     rsbDelta = 0;  //!< Right offset after forced autohint. Internally used by getKerning()
-            FloatRect bounds;        //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
-            IntRect   textureRect;   //!< Texture coordinates of the glyph inside the font's texture
+            float         advance = 0;   //!< Offset to move horizontally to the next character
+            float         lsbDelta = 0;  //!< Left offset after forced autohint. Internally used by getKerning()
+            float         rsbDelta = 0;  //!< Right offset after forced autohint. Internally used by getKerning()
+            FloatRect     bounds;        //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
+            IntRect       textureRect;   //!< Texture coordinates of the glyph inside the texture of its page
+            unsigned int  sheet = 0;     //!< Index of the sheet in the page that contains the glyph
+        };
+
+        struct RasterizedGlyph
+        {
+            Glyph                     glyph;      //!< Metrics of the glyph (the texture rect isn't filled in yet)
+            unsigned int              width = 0;  //!< Width of the bitmap
+            unsigned int              height = 0; //!< Height of the bitmap
+            std::vector<std::uint8_t> pixels;     //!< Alpha values of the bitmap, without padding between rows
+        };
+
+        struct Row
+        {
+            Row(unsigned int rowTop, unsigned int rowHeight) : width(0), top(rowTop), height(rowHeight) {}
+
+            unsigned int width;  //!< Current width of the row
+            unsigned int top;    //!< Y position of the row into the texture
+            unsigned int height; //!< Height of the row
+        };
+
+        struct GlyphMetrics
+        {
+            float        advance = 0;    //!< Offset to move horizontally to the next character
+            float        lsbDelta = 0;   //!< Left offset after forced autohint
+            float        rsbDelta = 0;   //!< Right offset after forced autohint
+            unsigned int glyphIndex = 0; //!< Index of the glyph in the font, used for looking up the kerning
+            std::size_t  faceIndex = 0;  //!< 0 when the glyph is from this font, otherwise the index of the fallback font plus 1
+            bool         loaded = false; //!< Whether the metrics were already loaded
+        };
+
+        struct MetricsTable
+        {
+            unsigned int                                characterSize = 0; //!< Character size to which the metrics belong
+            std::array<GlyphMetrics, 128>               asciiGlyphs;  //!< Metrics of the ASCII characters, indexed by code point
+            std::unordered_map<char32_t, GlyphMetrics>  otherGlyphs;  //!< Metrics of all other characters
+            std::vector<float>                          asciiKerning; //!< Kerning per pair of ASCII characters (NaN when not loaded yet)
+            std::unordered_map<std::uint64_t, float>    kerningPairs; //!< Kerning of other pairs (when the font has kerning)
+        };
+
+        struct GlyphCoverage
+        {
+            bool contains(char32_t codePoint) const
+            {
+                const std::size_t block = codePoint >> 8;
+                if ((block >= blocks.size()) || (blocks[block] == 0))
+                    return false;
+
+                const std::size_t bit = codePoint & 0xFF;
+                return ((bitmaps[blocks[block] - 1u][bit >> 6] >> (bit & 63)) & 1) != 0;
+            }
+
+            std::vector<std::uint16_t>                blocks;  //!< Per block of 256 code points, the index in bitmaps plus 1 (0 when the block is empty)
+            std::vector<std::array<std::uint64_t, 4>> bitmaps; //!< One bit per code point, for the blocks that contain at least one glyph
+        };
+
+        struct FallbackFace
+        {
+            std::shared_ptr<const std::uint8_t> fileContents;      //!< Data of the fallback font, shared with the font it was taken from
+            std::size_t                         fileSize = 0;      //!< Size of the data in bytes
+            FT_Library                          library = nullptr; //!< FreeType library that owns the face
+            FT_Face                             face = nullptr;    //!< Face that was opened on the data
+            FT_Stroker                          stroker = nullptr; //!< Used for rendering outlines of the glyphs from this face
+            GlyphCoverage                       coverage;          //!< Characters that exist in the fallback font
+        };
+
+        struct Sheet
+        {
+            std::vector<Row> rows;             //!< Rows in which the glyphs are placed
+            unsigned int     top = 0;          //!< Y position of the sheet in the texture of its page
+            unsigned int     nextRow = 0;      //!< Y position of the next new row (the first sheet starts with 2 rows of pixels for underlining)
+            std::uint64_t    lastUsed = 0;     //!< Value of the use counter when a glyph in the sheet was last placed, requested or drawn
+            bool             fallback = false; //!< Does the sheet contain glyphs from fallback fonts instead of from this font?
+        };
+
+        struct Page
+        {
+            std::unordered_map<std::uint64_t, Glyph> glyphs; //!< Glyphs that were loaded for the character size of the page
+            std::vector<Sheet>              sheets;          //!< Parts of the page with the same size, stacked vertically in the texture
+            std::unique_ptr<std::uint8_t[]> pixels;          //!< Alpha values of all pixels in the page
+            unsigned int                    textureSize = 0; //!< Width of the page and height of each of its sheets
+            std::shared_ptr<BackendTexture> texture;         //!< Texture with the pixels, or nullptr if it still has to be created
+            unsigned int                    dirtyRowsTop = 0;    //!< First row of the pixels that changed since the texture was updated
+            unsigned int                    dirtyRowsBottom = 0; //!< Row below the last changed row of the pixels
+            std::uint64_t                   generation = 0;  //!< Changes whenever glyphs are removed from the page or moved inside it
+            std::uint64_t                   lastUsed = 0;    //!< Value of the use counter when the page was last used
+            bool                            distanceField = false; //!< Whether the pixels are distances instead of coverage values
         };
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Loads a glyph with freetype
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Glyph loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
+        Glyph loadGlyph(Page& page, char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Renders a glyph to a bitmap. Only the given freetype objects are accessed, so this can be called from any thread as
+        // long as no other thread uses the same objects. The stroker is created when it is needed and it is still nullptr.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool rasterizeGlyph(FT_Library library, FT_Face face, FT_Stroker& stroker, char32_t codePoint,
+                                   unsigned int characterSize, bool bold, float outlineThickness, RasterizedGlyph& result);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the coverage values of a rasterized glyph with a signed distance field. The bitmap grows on all sides.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void convertToDistanceField(RasterizedGlyph& rasterizedGlyph);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the coverage table with all characters that the face contains
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void buildCoverage(FT_Face face, GlyphCoverage& coverage);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the bitmap of a rasterized glyph into the page and returns the glyph with its texture rect.
+        // The fallback parameter is true when the glyph was taken from one of the fallback fonts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Glyph placeGlyph(Page& page, const RasterizedGlyph& rasterizedGlyph, bool fallback);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,13 +530,121 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Reserves space in the texture to place the glyph
+        // Returns the table with cached metrics for the given character size and style, creating it if it doesn't exist yet
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        IntRect findAvailableGlyphRect(unsigned int width, unsigned int height);
+        MetricsTable& getMetricsTable(unsigned int characterSize, bool bold);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Sets the character size on which the freetype operations are performed
+        // Returns the metrics of a glyph without rasterizing it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const GlyphMetrics& getGlyphMetrics(MetricsTable& table, char32_t codePoint, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the kerning between two characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getCachedKerning(MetricsTable& table, char32_t first, char32_t second, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the prebaked glyphs of the default font into a new page, if they exist for the character size of the page
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addPrebakedGlyphs(Page& page, unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills a new metrics table with the prebaked metrics of the default font, if they exist for the size and style
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addPrebakedMetrics(MetricsTable& table, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether glyphs of the given character size are scaled from the distance fields at the reference size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool usesDistanceField(unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the page for the given character size, creating it if it doesn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Page& getPage(unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reserves space in a sheet of the page to place the glyph. Returns false if there is no space left in the sheet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool findAvailableGlyphRect(const Page& page, Sheet& sheet, unsigned int width, unsigned int height, IntRect& rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Doubles the width and the height of all sheets in a page. The glyphs in sheets other than the first one are moved.
+        // Returns false if the page can't grow without exceeding the maximum page size or budget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool growPage(Page& page);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a sheet below the other sheets of a page, for either the glyphs of this font or those of the fallback fonts.
+        // Returns false if the texture would become too large, if the sheet doesn't fit in the memory budget or if the
+        // fallback fonts would get more sheets than this font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addSheet(Page& page, bool fallback);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all glyphs from a sheet so that new glyphs can be placed in it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void evictSheet(Page& page, unsigned int sheetIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the least recently used pages until the extra bytes fit in the memory budget. Only pages that weren't used
+        // since the use counter had the given value are removed.
+        // Returns false if the budget can't be met without removing the page that should be kept or a more recent page.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool evictPages(std::size_t extraBytes, const Page* pageToKeep, std::uint64_t usedBefore);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of bytes used by the pixels of all pages
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getBytesInUse() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns 0 when the character should be taken from this font, or the index of the fallback font that contains it plus 1.
+        // Characters that exist in none of the fonts are taken from this font, which renders them as its missing glyph.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findFaceIndex(char32_t codePoint) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the face of this font when the index is 0, or the face of a fallback font otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FT_Face getFace(std::size_t faceIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the coverage table of this font, building it when this is the first time it is needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const GlyphCoverage& getCoverage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Destroys the faces of the fallback fonts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearFallbackFaces();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the FreeType face if this didn't happen yet. Fonts that use prebaked glyphs only create it when needed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadFace() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the FreeType face if needed and sets the character size on which the freetype operations are performed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool setCurrentSize(unsigned int characterSize);
 
@@ -211,30 +658,34 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        struct Row
-        {
-            Row(unsigned int rowTop, unsigned int rowHeight) : width(0), top(rowTop), height(rowHeight) {}
+        mutable FT_Library m_library = nullptr; // Handle to the freetype library (created lazily when prebaked glyphs are used)
+        mutable FT_Face    m_face    = nullptr; // Contains the font (typeface and style)
+        FT_Stroker         m_stroker = nullptr; // Used for rendering outlines
 
-            unsigned int width;  //!< Current width of the row
-            unsigned int top;    //!< Y position of the row into the texture
-            unsigned int height; //!< Height of the row
-        };
+        std::unordered_map<unsigned int, float> m_cachedLineSpacing;
 
-        FT_Library  m_library = nullptr;  // Handle to the freetype library
-        FT_Face     m_face    = nullptr;  // Contains the font (typeface and style)
-        FT_Stroker  m_stroker = nullptr;  // Used for rendering outlines
+        mutable GlyphCoverage m_coverage; // Characters that exist in this font (built lazily)
+        std::vector<FallbackFace> m_fallbackFaces;
 
-        std::unordered_map<unsigned int, float> m_cachedLineSpacing;
+        std::shared_ptr<const std::uint8_t> m_fileContents; // Array shared with other fonts and with the threads that rasterize glyphs in preloadGlyphs
+        std::size_t m_fileSize = 0;
+
+        mutable std::mutex m_mutex; // Locked by all public functions, so that glyphs can be preloaded on another thread
 
-        std::unordered_map<std::uint64_t, Glyph> m_glyphs;
-        unsigned int     m_nextRow = 3; //!< Y position of the next new row in the texture (first 2 rows contain pixels for underlining)
-        std::vector<Row> m_rows;
+        std::unordered_map<unsigned int, Page> m_pages; // Pages of the glyph atlas, per character size
+        std::unordered_map<std::uint64_t, MetricsTable> m_metricsTables; // Glyph metrics and kerning, per character size and style
+        std::size_t m_memoryBudget = 8 * 1024 * 1024;
+        unsigned int m_maximumPageSize = 1024;
+        unsigned int m_maximumTextureSize = 0; // Maximum texture size of the renderer, or 0 when it wasn't queried yet
+        std::uint64_t m_useCounter = 0;        // Increased each time a page or sheet is used, to find the least recently used ones
+        std::uint64_t m_generationCounter = 0; // Source of unique page generations, so that a recreated page never reuses one
+        std::size_t m_evictedGlyphs = 0;
+        std::size_t m_evictedPages = 0;
+        std::size_t m_uploadedTextureBytes = 0;
+        bool m_distanceFieldEnabled = false;
+        bool m_usesPrebakedGlyphs = false; // Whether the loaded font is the default font for which glyphs were prebaked
 
-        std::unique_ptr<std::uint8_t[]> m_fileContents;
-        std::unique_ptr<std::uint8_t[]> m_pixels;
-        std::shared_ptr<BackendTexture> m_texture;
-        unsigned int m_textureSize = 0;
-        bool m_textureUpToDate = false;
+        static bool m_prebakedDefaultFontEnabled;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -72,6 +72,17 @@ namespace tgui
             /// @param window  The GLFW window that will be used by the gui
             /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
             void setWindow(GLFWwindow* window);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        protected:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Asks EGL how many frames ago the back buffer of the window was drawn to
+            ///
+            /// @return Age of the back buffer, or 0 when its contents are undefined
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            unsigned int queryBackBufferAge() const override;
         };
     }
 }
@@ -0,0 +1,72 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_NULL_INCLUDE_HPP
+#define TGUI_BACKEND_NULL_INCLUDE_HPP
+
+#include <TGUI/Config.hpp>
+#if !TGUI_HAS_BACKEND_NULL
+    #error "TGUI wasn't build with the NULL backend"
+#endif
+
+#include <TGUI/Backend/Window/Null/BackendNull.hpp>
+#include <TGUI/Backend/Renderer/Null/BackendRendererNull.hpp>
+#include <TGUI/Backend/Font/FreeType/BackendFontFreeType.hpp>
+
+namespace tgui
+{
+    // NULL can't be used as name because it is a macro
+    inline namespace NULL_BACKEND
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gui class for the NULL backend (no window or rendering, using FreeType for fonts)
+        ///
+        /// Text is still layed out with real fonts, so widgets behave exactly like they would with any other backend.
+        /// The render target only keeps statistics of what would have been drawn (see BackendRenderTargetNull).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Gui : public BackendGuiNull
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Constructor that immediately sets the size of the imaginary window on which the gui is drawn
+            ///
+            /// @param windowSize  Size of the window, in pixels
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Gui(Vector2u windowSize = {800, 600});
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns information about what would have been drawn during the last call to draw()
+            ///
+            /// @return Statistics of the last frame
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const BackendRenderTargetNull::Statistics& getStatistics() const;
+        };
+    }
+}
+
+#endif // TGUI_BACKEND_NULL_INCLUDE_HPP
@@ -38,8 +38,15 @@
 namespace tgui
 {
     class Widget;
+    class Container;
     class RootContainer;
 
+    namespace priv
+    {
+        struct RecordedDrawCommands;
+        struct ShapeTessellationCache;
+    }
+
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Base class for render targets
@@ -54,6 +61,16 @@ namespace tgui
         virtual ~BackendRenderTarget() = default;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counters that show how often widgets could reuse their recorded draw commands in retained mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct RetainedModeStatistics
+        {
+            std::size_t cacheHits = 0;   //!< Number of widgets that were drawn by replaying their recorded draw commands
+            std::size_t cacheMisses = 0; //!< Number of widgets that had to be drawn again because their appearance changed
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Select the color that will be used by clearScreen
         /// @param color  Background color of the window
@@ -85,6 +102,18 @@ namespace tgui
         virtual void drawGui(const std::shared_ptr<RootContainer>& root) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the gui, but only inside the given parts of the view
+        ///
+        /// @param root   Root container that holds all widgets in the gui
+        /// @param rects  Parts of the view that have to be redrawn
+        ///
+        /// Each rectangle is cleared with the clear color before the widgets below it are drawn again. The contents of the
+        /// render target outside these rectangles is left untouched, so it must still contain the previously drawn gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGuiPartially(const std::shared_ptr<RootContainer>& root, const std::vector<FloatRect>& rects);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws a widget, if the widget is visible
         ///
@@ -207,6 +236,87 @@ namespace tgui
                                      const int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether widgets should remember their draw commands and replay them while they remain unchanged
+        ///
+        /// @param enabled  Should retained mode be used?
+        ///
+        /// In retained mode, the drawWidget function records the geometry that a widget produces. As long as the widget isn't
+        /// invalidated (by changing its properties, renderer, size, text or by interacting with it) and it is drawn at the same
+        /// location, the recorded commands are replayed instead of letting the widget generate everything again.
+        ///
+        /// Retained mode is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRetainedModeEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether widgets remember their draw commands and replay them while they remain unchanged
+        ///
+        /// @return Is retained mode enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRetainedModeEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many widgets were replayed from their recorded commands and how many had to be drawn again
+        ///
+        /// @return Cache hits and misses since the last call to resetRetainedModeStatistics
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const RetainedModeStatistics& getRetainedModeStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the counters that are returned by getRetainedModeStatistics
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetRetainedModeStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render target can draw to a texture instead of to the window
+        ///
+        /// @return Can beginOffscreenRendering be called?
+        ///
+        /// When this returns false, containers for which render caching is enabled are drawn directly to the window.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isOffscreenRenderingSupported() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redirects everything that is drawn to a texture, until endOffscreenRendering is called
+        ///
+        /// @param texture  Texture to draw to. A new texture is created when the pointer is empty or when the existing texture
+        ///                 doesn't have the correct size, so the same pointer should be passed every time to reuse the texture.
+        /// @param size     Size of the area that is going to be drawn, in the coordinates that widgets are drawn with
+        ///
+        /// @return True if drawing was redirected, false if no texture could be created (e.g. because it would be too large)
+        ///
+        /// The texture is cleared to transparent and the top-left corner of the area is placed at position (0,0). The texture
+        /// has the same amount of pixels per unit as the window, so that its contents looks identical when drawn on the window.
+        /// The texture contains premultiplied alpha, so it can only be drawn with drawOffscreenTexture.
+        ///
+        /// @warning Every call to beginOffscreenRendering that returns true must have a matching call to endOffscreenRendering.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool beginOffscreenRendering(std::shared_ptr<BackendTexture>& texture, Vector2f size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops drawing to the texture that was passed to beginOffscreenRendering
+        ///
+        /// Drawing continues on the window, or on the previous texture when offscreen rendering was nested.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endOffscreenRendering();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a texture that was filled between calls to beginOffscreenRendering and endOffscreenRendering
+        ///
+        /// @param states   Render states to use for drawing
+        /// @param texture  Texture that was passed to beginOffscreenRendering
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void drawOffscreenTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -221,6 +331,75 @@ namespace tgui
         virtual void updateClipping(FloatRect clipRect, FloatRect clipViewport) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the widgets inside the root container, called by drawGui after the render state has been set up
+        ///
+        /// @param root  Root container that holds all widgets in the gui
+        ///
+        /// When drawGuiPartially is being called, the widgets are only drawn inside the requested areas.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRootContainer(const std::shared_ptr<RootContainer>& root);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the area inside the current clipping rectangle with the clear color
+        ///
+        /// This is used when only part of the gui is redrawn. The default implementation does nothing.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void clearClippingArea();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a texture to which can be drawn, called from beginOffscreenRendering
+        ///
+        /// @param size  Size of the texture in pixels
+        ///
+        /// @return The new texture, or nullptr if offscreen rendering isn't possible. The default implementation returns nullptr.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::shared_ptr<BackendTexture> createOffscreenTexture(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the texture that is being drawn to, called from beginOffscreenRendering and endOffscreenRendering
+        ///
+        /// @param texture  Texture that was created with createOffscreenTexture, or nullptr to draw to the window again
+        /// @param clear    Should the texture be cleared to transparent?
+        ///
+        /// The view, viewport and target size have already been changed when this function is called, the clipping is
+        /// updated directly after this function returns. Queued geometry still has to be drawn on the previous target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setOffscreenTexture(const std::shared_ptr<BackendTexture>& texture, bool clear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of pixels needed to draw an area of the given size with the current view
+        ///
+        /// @param size  Size of the area in the coordinates that widgets are drawn with
+        ///
+        /// @return Size of the texture that is created by beginOffscreenRendering for the given area
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2u getOffscreenTextureSize(Vector2f size) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a container for which render caching is enabled, called from drawWidget
+        ///
+        /// @param states     Render states to use for drawing
+        /// @param container  Container to draw
+        ///
+        /// The container is only drawn to its texture when something inside it changed, otherwise only the texture is drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRenderCachedContainer(const RenderStates& states, Container& container);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the precomputed points and indices that are used by drawCircle and drawRoundedRectangle
+        ///
+        /// @return Cache that is created when the first shape is drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        priv::ShapeTessellationCache& getShapeTessellationCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -229,6 +408,27 @@ namespace tgui
         Vector2f  m_targetSize;
 
         std::vector<std::pair<FloatRect, FloatRect>> m_clipLayers;
+
+        bool m_retainedModeEnabled = false;
+        RetainedModeStatistics m_retainedModeStatistics;
+
+        const std::vector<FloatRect>* m_partialRedrawRects = nullptr; // Only set while drawGuiPartially is executing
+
+        // State of the render target from before beginOffscreenRendering was called, restored by endOffscreenRendering
+        struct OffscreenState
+        {
+            FloatRect viewRect;
+            FloatRect viewport;
+            Vector2f targetSize;
+            std::vector<std::pair<FloatRect, FloatRect>> clipLayers;
+            std::shared_ptr<BackendTexture> texture;
+        };
+
+        std::vector<OffscreenState> m_offscreenStates;
+        std::shared_ptr<BackendTexture> m_offscreenTexture; // Texture that is being drawn to, or nullptr when drawing to the window
+
+        // Shared with the render targets that record draw commands in retained mode
+        std::shared_ptr<priv::ShapeTessellationCache> m_shapeTessellationCache;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +44,14 @@ namespace tgui
         /// Type of the data that is passed to BackendRenderTarget where the actual rendering happens
         using TextVertexData = std::vector<std::pair<std::shared_ptr<BackendTexture>, std::shared_ptr<std::vector<Vertex>>>>;
 
+        /// @brief Statistics about the glyph run cache, returned by getGlyphRunCacheStatistics
+        struct GlyphRunCacheStatistics
+        {
+            std::size_t entries = 0; //!< Amount of laid out strings that are currently stored in the cache
+            std::size_t hits = 0;    //!< Amount of times that a text could reuse vertices from the cache
+            std::size_t misses = 0;  //!< Amount of times that a text had to create its vertices
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Virtual destructor
@@ -153,16 +161,30 @@ namespace tgui
         /// @brief Returns the font of the text
         /// @return text font
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        std::shared_ptr<BackendFont> getFont() const;
+        std::shared_ptr<BackendFont> getFont() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the top-left position of the character at the provided index
         /// @param index  Index of the character for which the position should be returned
+        ///
+        /// The positions of all characters are calculated the first time this function is called, they are reused until the
+        /// string, font, character size or style of the text changes.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Vector2f findCharacterPos(std::size_t index) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the character in front of which a caret would be placed when clicking on a position
+        /// @param position  Position relative to the top-left of the text
+        /// @return Index of the character that is closest to the position, or the length of the string when the position is
+        ///         closer to the end of the line
+        ///
+        /// This function uses the same character positions as findCharacterPos.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::size_t findCharacterIndex(Vector2f position) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the information that is needed to render this text
         /// @return Data that contains the textures and vertices used by this text
@@ -170,6 +192,44 @@ namespace tgui
         TextVertexData getVertexData();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of laid out strings that are kept in the glyph run cache
+        ///
+        /// @param maxEntries  Maximum amount of entries in the cache, or 0 to disable the cache
+        ///
+        /// Texts that have the same string, font, character size, style and outline share their vertices through this cache,
+        /// so that e.g. a list with thousands of identical items only creates the vertices for that string once.
+        /// Texts that only differ in color reuse the laid out vertices and only change the colors in their own copy of them.
+        /// When the cache is full, the string that wasn't used for the longest time is removed from it.
+        /// Only strings of up to 256 characters are cached. The cache is shared by all texts and keeps 1024 entries by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setGlyphRunCacheCapacity(std::size_t maxEntries);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of laid out strings that are kept in the glyph run cache
+        ///
+        /// @return Maximum amount of entries in the cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getGlyphRunCacheCapacity();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of entries in the glyph run cache and how often it was used
+        ///
+        /// @return Statistics of the cache since it was last cleared
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static GlyphRunCacheStatistics getGlyphRunCacheStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all entries from the glyph run cache and resets its hit and miss counters
+        ///
+        /// Texts that are currently using vertices from the cache will keep them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearGlyphRunCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -179,6 +239,18 @@ namespace tgui
         void updateVertices();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the positions of all characters if they weren't calculated yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCharacterPositions() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the vertices if they are shared with the glyph run cache, so that they can be changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unshareVertices();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Helper function used by updateVertices to add vertices for a glyph
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -196,6 +268,7 @@ namespace tgui
 
         std::shared_ptr<BackendFont> m_font;
         BackendTexture* m_lastFontTexture = nullptr;
+        std::uint64_t m_lastGlyphGeneration = 0;
 
         String m_string;
         unsigned int m_characterSize = getGlobalTextSize();
@@ -208,6 +281,13 @@ namespace tgui
         std::shared_ptr<std::vector<Vertex>> m_vertices;
         std::shared_ptr<std::vector<Vertex>> m_outlineVertices;
         bool m_verticesNeedUpdate = true;
+        bool m_verticesShared = false; // Vertices are stored in the glyph run cache and may not be modified
+        std::uint64_t m_usedSheets = 0; // Bitmask of the sheets in the font texture that contain the glyphs of the text
+
+        // Positions in front of every character and behind the last one, which are only calculated when they are needed.
+        // The vector is empty when the positions have to be calculated again.
+        mutable std::vector<Vector2f> m_characterPositions;
+        mutable std::vector<std::size_t> m_lineStarts; // Index of the first character on each line
     };
 }
 
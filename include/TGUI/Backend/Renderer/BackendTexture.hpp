@@ -28,6 +28,7 @@
 
 #include <TGUI/Font.hpp>
 #include <TGUI/String.hpp>
+#include <TGUI/Rect.hpp>
 #include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -69,6 +70,37 @@ namespace tgui
         virtual bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 8-bit alpha values, the color of every pixel will be white
+        ///
+        /// @param size         Width and height of the image to create
+        /// @param alphaPixels  Pointer to array of size.x*size.y bytes with alpha values, or nullptr to create an empty texture
+        /// @param smooth       Should the smooth filter be enabled or not?
+        ///
+        /// Renderers that support single-channel textures will only use a quarter of the memory of an RGBA texture.
+        /// Other renderers will store the texture as RGBA internally.
+        /// After calling this function, the pixels that are passed to updateRegion also have to be alpha values.
+        ///
+        /// @warning Like loadTextureOnly, this function won't store the pixels and isTransparentPixel thus won't work
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the pixels in a part of the texture, without uploading the rest of the texture again
+        ///
+        /// @param region  Part of the texture to change, which has to lie completely inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels,
+        ///                or region.width*region.height bytes with alpha values if isAlphaTexture() returns true
+        ///
+        /// @return True if the texture was updated, false if the texture has to be loaded again to change its pixels
+        ///
+        /// If the texture was loaded with the load function, then the stored pixels are updated as well.
+        /// Derived classes that override this function have to call the function of this base class.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updateRegion(UIntRect region, const std::uint8_t* pixels);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
@@ -76,6 +108,34 @@ namespace tgui
         Vector2u getSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the texture was loaded with loadAlphaTextureOnly
+        ///
+        /// @return True if the texture only contains alpha values, false if it contains RGBA pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAlphaTexture() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the alpha values of the texture contain a signed distance field
+        ///
+        /// @param distanceField  True if the alpha values are distances to the edge of a shape instead of coverage values
+        ///
+        /// Distance fields are used by fonts to draw glyphs at any size from a single texture. A value of 128 lies on the edge
+        /// of the shape, higher values are inside it. Renderers that support this reconstruct sharp edges from the distances,
+        /// other renderers draw the distance field as-is. This flag is only used for alpha textures and isn't reset by loading.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceField(bool distanceField);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the alpha values of the texture contain a signed distance field
+        ///
+        /// @return True if the texture contains distances to the edge of a shape, false if it contains normal alpha values
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDistanceField() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the smooth filter is enabled or not
         ///
@@ -113,9 +173,25 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Converts alpha values to white RGBA pixels, for textures that can't store alpha textures natively
+        ///
+        /// @param alphaPixels  Pointer to array of pixelCount bytes with alpha values
+        /// @param pixelCount   Amount of pixels to convert
+        ///
+        /// @return Array of pixelCount*4 bytes with RGBA pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<std::uint8_t[]> convertAlphaToPixels(const std::uint8_t* alphaPixels, std::size_t pixelCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         Vector2u m_imageSize;
         std::unique_ptr<std::uint8_t[]> m_pixels;
         bool m_isSmooth = true;
+        bool m_isAlphaTexture = false;
+        bool m_isDistanceField = false;
     };
 }
 
@@ -28,6 +28,8 @@
 
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #include <TGUI/Backend/Renderer/GLES2/BackendTextureGLES2.hpp>
+#include <cstdint>
+#include <array>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -40,6 +42,18 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about how the draw calls of the last frame were batched
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct BatchStatistics
+        {
+            std::size_t batchedCalls = 0; //!< Amount of drawVertexArray calls that were added to a batch
+            std::size_t flushes = 0;      //!< Amount of times a batch was flushed, each flush corresponds to one draw call in OpenGL ES
+            std::size_t vertices = 0;     //!< Total amount of vertices that were send to the GPU
+            std::size_t indices = 0;      //!< Total amount of indices that were send to the GPU
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +111,68 @@ namespace tgui
                              const int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether draw calls are batched together
+        ///
+        /// @param enabled  Should vertices be collected in a single buffer until the texture or clipping changes?
+        ///
+        /// When batching is enabled, the vertices are transformed on the CPU and added to a single stream. This stream is only
+        /// send to the GPU when the texture or scissor rectangle changes, when the frame ends or when the batch reaches the
+        /// limit of what can be addressed with 16-bit indices (which is all that OpenGL ES 2.0 guarantees to support).
+        ///
+        /// Batching is disabled by default.
+        ///
+        /// @warning This function can't be called while the gui is being drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether draw calls are batched together
+        ///
+        /// @return Are vertices collected in a single buffer until the texture or clipping changes?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about how the draw calls were batched while drawing the last frame
+        ///
+        /// @return Batch statistics of the last call to drawGui
+        ///
+        /// The statistics are only gathered while batching is enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const BatchStatistics& getBatchStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Asks EGL which earlier frame the back buffer of the current draw surface still contains
+        ///
+        /// @return 1 when the surface preserves its contents, the age reported by EGL_EXT_buffer_age if the extension is
+        ///         available, or 0 when the contents of the back buffer are undefined
+        ///
+        /// The value can be passed to BackendGui::setBackBufferAge when partial redraw is enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int queryBackBufferAge();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render target can draw to a texture instead of to the window
+        ///
+        /// @return Always returns true, a framebuffer object is used to draw to textures
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isOffscreenRenderingSupported() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a texture that was filled between calls to beginOffscreenRendering and endOffscreenRendering
+        ///
+        /// @param states   Render states to use for drawing
+        /// @param texture  Texture that was passed to beginOffscreenRendering
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawOffscreenTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -112,6 +188,31 @@ namespace tgui
         void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the area inside the current clipping rectangle with the clear color
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearClippingArea() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a texture to which can be drawn, called from beginOffscreenRendering
+        ///
+        /// @param size  Size of the texture in pixels
+        ///
+        /// @return Texture of type BackendTextureGLES2
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendTexture> createOffscreenTexture(Vector2u size) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the texture that is being drawn to, called from beginOffscreenRendering and endOffscreenRendering
+        ///
+        /// @param texture  Texture that was created with createOffscreenTexture, or nullptr to draw to the window again
+        /// @param clear    Should the texture be cleared to transparent?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setOffscreenTexture(const std::shared_ptr<BackendTexture>& texture, bool clear) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Calls glEnableVertexAttribArray and glVertexAttribPointer.
         // Called only once when using a VAO (GLES 3.x), but on every draw when using GLES 2.0
@@ -125,6 +226,26 @@ namespace tgui
         void createBuffers();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds vertices to the batch, flushing the batch first if the new vertices wouldn't fit anymore.
+        // Returns false if the vertices could not be batched because there are too many of them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addToBatch(const Transform& transform, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sends the queued vertices to the GPU in a single draw call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Binds the texture for the next draw call, or the empty texture if a nullptr is passed.
+        // Also tells the shader whether the texture only contains alpha values and whether they form a distance field.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindTexture(const std::shared_ptr<BackendTextureGLES2>& texture);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -140,9 +261,25 @@ namespace tgui
 
         Transform m_projectionTransform;
         int m_projectionMatrixShaderUniformLocation = 0;
+        int m_alphaTextureShaderUniformLocation = -1;
+        bool m_alphaTextureBound = false;
+        int m_distanceFieldShaderUniformLocation = -1;
+        bool m_distanceFieldBound = false;
         int m_positionShaderLocation = 0;
         int m_colorShaderLocation = 1;
         int m_texCoordShaderLocation = 2;
+
+        std::array<int, 4> m_scissor = {{0, 0, 0, 0}};
+
+        bool m_batchingEnabled = false;
+        std::vector<Vertex> m_batchVertices;
+        std::vector<std::uint16_t> m_batchIndices;
+        BatchStatistics m_batchStatistics;
+
+        // Framebuffer that is used to draw to offscreen textures, and the framebuffer that was bound before it
+        unsigned int m_offscreenFramebuffer = 0;
+        int m_windowFramebuffer = 0;
+        bool m_offscreenFramebufferBound = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
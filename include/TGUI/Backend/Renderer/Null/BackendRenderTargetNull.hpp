@@ -0,0 +1,163 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_RENDER_TARGET_NULL_HPP
+#define TGUI_BACKEND_RENDER_TARGET_NULL_HPP
+
+#include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render target that accepts all draw calls without drawing anything
+    ///
+    /// It keeps statistics about what would have been drawn during the last call to drawGui.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendRenderTargetNull : public BackendRenderTarget
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about the draw calls that were made in the last call to drawGui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Statistics
+        {
+            std::size_t drawCalls = 0;        //!< Amount of times drawVertexArray was called
+            std::size_t vertices = 0;         //!< Total amount of vertices that were passed to drawVertexArray
+            std::size_t indices = 0;          //!< Total amount of indices that were passed to drawVertexArray
+            std::size_t textureBinds = 0;     //!< Amount of draw calls that used a different texture than the previous draw call
+            std::size_t clipChanges = 0;      //!< Amount of times the clipping area was changed
+            std::size_t offscreenPasses = 0;  //!< Amount of times something was drawn to an offscreen texture (e.g. a render cached container)
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Select the color that will be used by clearScreen
+        /// @param color  Background color of the window
+        ///
+        /// This function does nothing as the null render target doesn't have any pixels.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setClearColor(const Color& color) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Clears the screen, called at the beginning of each frame when gui.mainLoop() is called
+        ///
+        /// This function does nothing as the null render target doesn't have any pixels.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearScreen() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the gui and all of its widgets
+        ///
+        /// @param root  Root container that holds all widgets in the gui
+        ///
+        /// The statistics are reset at the start of this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGui(const std::shared_ptr<RootContainer>& root) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a vertex array. This is called by the other draw functions.
+        ///
+        /// @param states       Render states to use for drawing
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the vertex array
+        /// @param indices      Pointer to first element in array of indices
+        /// @param indexCount   Amount of elements in the indices array
+        /// @param texture      Texture to use, or nullptr when drawing colored triangles
+        ///
+        /// Nothing is drawn, the function only updates the statistics.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                             const int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about what was drawn during the last call to drawGui
+        ///
+        /// @return Statistics of the last frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Statistics& getStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render target can draw to a texture instead of to the window
+        ///
+        /// @return Always returns true, drawing to a texture is simulated just like drawing to the window
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isOffscreenRenderingSupported() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
+        ///
+        /// @param clipRect      View rectangle to apply
+        /// @param clipViewport  Viewport to apply
+        ///
+        /// Both rectangles may be empty when nothing that will be drawn is going to be visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a texture to which can be drawn, called from beginOffscreenRendering
+        ///
+        /// @param size  Size of the texture in pixels
+        ///
+        /// @return Texture without pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendTexture> createOffscreenTexture(Vector2u size) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the texture that is being drawn to, called from beginOffscreenRendering and endOffscreenRendering
+        ///
+        /// @param texture  Texture that was created with createOffscreenTexture, or nullptr to draw to the window again
+        /// @param clear    Should the texture be cleared to transparent?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setOffscreenTexture(const std::shared_ptr<BackendTexture>& texture, bool clear) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        Statistics m_statistics;
+        const BackendTexture* m_lastTexture = nullptr;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_RENDER_TARGET_NULL_HPP
@@ -57,6 +57,30 @@ namespace tgui
         bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 8-bit alpha values, the color of every pixel will be white
+        ///
+        /// @param size         Width and height of the image to create
+        /// @param alphaPixels  Pointer to array of size.x*size.y bytes with alpha values, or nullptr to create an empty texture
+        /// @param smooth       Should the smooth filter be enabled or not?
+        ///
+        /// The texture is stored with a single red channel that is swizzled to white with an alpha value.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the pixels in a part of the texture, without uploading the rest of the texture again
+        ///
+        /// @param region  Part of the texture to change, which has to lie completely inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels,
+        ///                or region.width*region.height bytes with alpha values if isAlphaTexture() returns true
+        ///
+        /// @return True if the texture was updated, false if the texture hasn't been loaded yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateRegion(UIntRect region, const std::uint8_t* pixels) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the smooth filter is enabled or not
         ///
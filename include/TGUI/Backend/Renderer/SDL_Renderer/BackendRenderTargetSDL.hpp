@@ -28,6 +28,7 @@
 
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #include <TGUI/Backend/Renderer/SDL_Renderer/BackendTextureSDL.hpp>
+#include <array>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -40,6 +41,18 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about how the draw calls of the last frame were batched
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct BatchStatistics
+        {
+            std::size_t batchedCalls = 0; //!< Amount of drawVertexArray calls that were added to a batch
+            std::size_t flushes = 0;      //!< Amount of times a batch was flushed, each flush corresponds to one SDL_RenderGeometry call
+            std::size_t vertices = 0;     //!< Total amount of vertices that were passed to SDL
+            std::size_t indices = 0;      //!< Total amount of indices that were passed to SDL
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +110,25 @@ namespace tgui
                              const int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about how the draw calls were batched while drawing the last frame
+        ///
+        /// @return Batch statistics of the last call to drawGui
+        ///
+        /// Consecutive vertex arrays that use the same texture and clipping rectangle are merged into a single call to
+        /// SDL_RenderGeometry. The batch is flushed when the texture or clipping changes, or when the frame ends.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const BatchStatistics& getBatchStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render target can draw to a texture instead of to the window
+        ///
+        /// @return True if the SDL renderer supports render targets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isOffscreenRenderingSupported() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -111,11 +143,55 @@ namespace tgui
         void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the area inside the current clipping rectangle with the clear color
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearClippingArea() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a texture to which can be drawn, called from beginOffscreenRendering
+        ///
+        /// @param size  Size of the texture in pixels
+        ///
+        /// @return Texture of type BackendTextureSDL, or nullptr if SDL failed to create a target texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendTexture> createOffscreenTexture(Vector2u size) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the texture that is being drawn to, called from beginOffscreenRendering and endOffscreenRendering
+        ///
+        /// @param texture  Texture that was created with createOffscreenTexture, or nullptr to draw to the window again
+        /// @param clear    Should the texture be cleared to transparent?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setOffscreenTexture(const std::shared_ptr<BackendTexture>& texture, bool clear) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the queued vertices to SDL in a single SDL_RenderGeometry call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         SDL_Renderer* m_renderer = nullptr;
         Transform m_projectionTransform;
+
+        // The clipping rectangle that was last passed to SDL, with a width of -1 when it isn't known
+        std::array<int, 4> m_clipRect = {{0, 0, -1, -1}};
+
+        // Scratch buffers that are reused for every batch, so that no memory has to be allocated while drawing
+        std::vector<Vertex> m_batchVertices;
+        std::vector<int> m_batchIndices;
+        std::shared_ptr<BackendTexture> m_batchTexture;
+        BatchStatistics m_batchStatistics;
+
+        // Render target that was set on the SDL renderer before we started drawing to an offscreen texture
+        SDL_Texture* m_windowTarget = nullptr;
+        bool m_offscreenTargetSet = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
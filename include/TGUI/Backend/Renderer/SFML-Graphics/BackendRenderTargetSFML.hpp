@@ -107,6 +107,23 @@ namespace tgui
                              const int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render target can draw to a texture instead of to the window
+        ///
+        /// @return Always returns true, sf::RenderTexture is used to draw to textures
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isOffscreenRenderingSupported() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a texture that was filled between calls to beginOffscreenRendering and endOffscreenRendering
+        ///
+        /// @param states   Render states to use for drawing
+        /// @param texture  Texture that was passed to beginOffscreenRendering
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawOffscreenTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -121,6 +138,31 @@ namespace tgui
         void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the area inside the current clipping rectangle with the clear color
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearClippingArea() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a texture to which can be drawn, called from beginOffscreenRendering
+        ///
+        /// @param size  Size of the texture in pixels
+        ///
+        /// @return Texture that contains an sf::RenderTexture, or nullptr if SFML failed to create the render texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendTexture> createOffscreenTexture(Vector2u size) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the texture that is being drawn to, called from beginOffscreenRendering and endOffscreenRendering
+        ///
+        /// @param texture  Texture that was created with createOffscreenTexture, or nullptr to draw to the window again
+        /// @param clear    Should the texture be cleared to transparent?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setOffscreenTexture(const std::shared_ptr<BackendTexture>& texture, bool clear) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Converts tgui::RenderStates to sf::RenderStates
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,6 +173,7 @@ namespace tgui
     protected:
 
         sf::RenderTarget* m_target = nullptr;
+        sf::RenderTarget* m_windowTarget = nullptr; // Target that was used before drawing to an offscreen texture started
 
         Color m_clearColor;
     };
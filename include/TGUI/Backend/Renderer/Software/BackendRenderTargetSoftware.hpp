@@ -0,0 +1,213 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_RENDER_TARGET_SOFTWARE_HPP
+#define TGUI_BACKEND_RENDER_TARGET_SOFTWARE_HPP
+
+#include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
+#include <TGUI/Backend/Renderer/Software/BackendTextureSoftware.hpp>
+#include <array>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render target implementation that rasterizes the triangles on the CPU into a memory buffer
+    ///
+    /// The size of the buffer is the target size that is passed to setView. The pixels can be accessed with getPixels
+    /// after the gui has been drawn.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendRenderTargetSoftware : public BackendRenderTarget
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Select the color that will be used by clearScreen
+        /// @param color  Background color of the window
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setClearColor(const Color& color) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Clears the screen, called at the beginning of each frame when gui.mainLoop() is called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearScreen() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the render target about which part of the window is used for rendering
+        ///
+        /// @param view        Defines which part of the gui is being shown
+        /// @param viewport    Defines which part of the window is being rendered to
+        /// @param targetSize  Size of the window, which is also the size of the pixel buffer
+        ///
+        /// The contents of the pixel buffer are lost when the target size changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setView(FloatRect view, FloatRect viewport, Vector2f targetSize) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the gui and all of its widgets
+        ///
+        /// @param root  Root container that holds all widgets in the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGui(const std::shared_ptr<RootContainer>& root) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a vertex array. This is called by the other draw functions.
+        ///
+        /// @param states       Render states to use for drawing
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the vertex array
+        /// @param indices      Pointer to first element in array of indices
+        /// @param indexCount   Amount of elements in the indices array
+        /// @param texture      Texture to use, or nullptr when drawing colored triangles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                             const int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pixels to which the gui was drawn
+        ///
+        /// @return Pointer to getSize().x * getSize().y * 4 bytes of RGBA pixels, or nullptr if no target size was set yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::uint8_t* getPixels() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the pixel buffer
+        ///
+        /// @return Width and height of the buffer returned by getPixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2u getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render target can draw to a texture instead of to the pixel buffer
+        ///
+        /// @return Always returns true
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isOffscreenRenderingSupported() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a texture that was filled between calls to beginOffscreenRendering and endOffscreenRendering
+        ///
+        /// @param states   Render states to use for drawing
+        /// @param texture  Texture that was passed to beginOffscreenRendering
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawOffscreenTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
+        ///
+        /// @param clipRect      View rectangle to apply
+        /// @param clipViewport  Viewport to apply
+        ///
+        /// Both rectangles may be empty when nothing that will be drawn is going to be visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the area inside the current clipping rectangle with the clear color
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearClippingArea() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a texture to which can be drawn, called from beginOffscreenRendering
+        ///
+        /// @param size  Size of the texture in pixels
+        ///
+        /// @return Texture of type BackendTextureSoftware
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendTexture> createOffscreenTexture(Vector2u size) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the texture that is being drawn to, called from beginOffscreenRendering and endOffscreenRendering
+        ///
+        /// @param texture  Texture that was created with createOffscreenTexture, or nullptr to draw to the pixel buffer again
+        /// @param clear    Should the texture be cleared to transparent?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setOffscreenTexture(const std::shared_ptr<BackendTexture>& texture, bool clear) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the transformation from view coordinates to pixels after the view or viewport changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateProjectionTransform();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Overwrites all pixels inside the rectangle (left, top, right, bottom) with the clear color
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void fillArea(const std::array<int, 4>& area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rasterizes a single triangle of which the vertices are already in pixel coordinates
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawTriangle(const Vertex& vertex0, const Vertex& vertex1, const Vertex& vertex2, const BackendTextureSoftware* texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        std::vector<std::uint8_t> m_pixels;
+        Vector2u m_size;
+        Color m_clearColor;
+        Transform m_projectionTransform;
+
+        // The area of the pixel buffer in which can be drawn, stored as left, top, right and bottom
+        std::array<int, 4> m_clipRect = {{0, 0, 0, 0}};
+
+        // Scratch buffer that is reused for every draw call, so that no memory has to be allocated while drawing
+        std::vector<Vertex> m_transformedVertices;
+
+        // While drawing to an offscreen texture, the pixels of the texture are swapped into m_pixels
+        std::shared_ptr<BackendTextureSoftware> m_offscreenPixelsOwner;
+        std::vector<std::uint8_t> m_windowPixels;
+        Vector2u m_windowSize;
+
+        // Offscreen textures contain premultiplied alpha, so they are blended differently than other textures
+        bool m_drawingPremultipliedTexture = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_RENDER_TARGET_SOFTWARE_HPP
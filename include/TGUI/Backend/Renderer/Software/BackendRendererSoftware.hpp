@@ -0,0 +1,69 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_RENDERER_SOFTWARE_HPP
+#define TGUI_BACKEND_RENDERER_SOFTWARE_HPP
+
+#include <TGUI/Backend/Renderer/BackendRenderer.hpp>
+#include <TGUI/Backend/Renderer/Software/BackendTextureSoftware.hpp>
+#include <TGUI/Backend/Renderer/Software/BackendRenderTargetSoftware.hpp>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Backend renderer that rasterizes everything on the CPU, without requiring a GPU or a display
+    ///
+    /// The gui is drawn into a memory buffer by BackendRenderTargetSoftware. This can e.g. be used to take screenshots on a
+    /// machine without graphics driver, or to display the gui by copying the pixels to some other output.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendRendererSoftware : public BackendRenderer
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new empty texture object
+        /// @return Shared pointer to a new texture object
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendTexture> createTexture() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Get the maximum allowed texture size
+        ///
+        /// @return Maximum width and height that you should try to use in a single texture
+        ///
+        /// Textures are stored in memory, so there is no real limit. This function returns the same limit as most GPUs have.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getMaximumTextureSize() override;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_RENDERER_SOFTWARE_HPP
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_TEXTURE_SOFTWARE_HPP
+#define TGUI_BACKEND_TEXTURE_SOFTWARE_HPP
+
+#include <TGUI/Backend/Renderer/BackendTexture.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Texture implementation that keeps its pixels in memory, to be used by BackendRenderTargetSoftware
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendTextureSoftware : public BackendTexture
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 32-bits RGBA pixels, but don't take ownership of the pixels
+        ///
+        /// @param size   Width and height of the image to create
+        /// @param pixels Pointer to array of size.x*size.y*4 bytes with RGBA pixels, or nullptr to create an empty texture
+        /// @param smooth Should the smooth filter be enabled or not?
+        ///
+        /// @warning Unlike the load function, loadTextureOnly won't store the pixels and isTransparentPixel thus won't work
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 8-bit alpha values, the color of every pixel will be white
+        ///
+        /// @param size         Width and height of the image to create
+        /// @param alphaPixels  Pointer to array of size.x*size.y bytes with alpha values, or nullptr to create an empty texture
+        /// @param smooth       Should the smooth filter be enabled or not?
+        ///
+        /// Only a single byte is stored per pixel, the render target takes care of treating the color as white.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the pixels in a part of the texture, without copying the rest of the texture again
+        ///
+        /// @param region  Part of the texture to change, which has to lie completely inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels,
+        ///                or region.width*region.height bytes with alpha values if isAlphaTexture() returns true
+        ///
+        /// @return True if the texture was updated, false if the texture hasn't been loaded yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateRegion(UIntRect region, const std::uint8_t* pixels) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to the pixels that are sampled when the texture is drawn
+        ///
+        /// @return Pointer to getSize().x * getSize().y * 4 bytes of RGBA pixels (or getSize().x * getSize().y alpha values if
+        ///         isAlphaTexture() returns true), or nullptr if the texture wasn't loaded yet
+        ///
+        /// Unlike getPixels, these pixels are always available, also when the texture was loaded with loadTextureOnly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::uint8_t* getInternalPixels() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Exchanges the pixels that are sampled when the texture is drawn with the contents of another buffer
+        ///
+        /// @param pixels  Buffer to swap with, which should contain getSize().x * getSize().y * 4 bytes when swapping back
+        ///
+        /// This is used by BackendRenderTargetSoftware to draw directly into the texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void swapInternalPixels(std::vector<std::uint8_t>& pixels);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        std::vector<std::uint8_t> m_texturePixels;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_TEXTURE_SOFTWARE_HPP
@@ -79,6 +79,14 @@ namespace tgui
             /// @brief Shows the drawn content with SDL_GL_SwapWindow
             /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
             void presentScreen() override;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Asks EGL how many frames ago the back buffer of the window was drawn to
+            ///
+            /// @return Age of the back buffer, or 0 when its contents are undefined
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            unsigned int queryBackBufferAge() const override;
         };
     }
 }
@@ -32,6 +32,7 @@
 #include <TGUI/Event.hpp>
 #include <TGUI/Cursor.hpp>
 #include <chrono>
+#include <deque>
 #include <stack>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -549,6 +550,117 @@ namespace tgui
         void setDrawingUpdatesTime(bool drawUpdatesTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether widgets that didn't change since the previous frame are drawn from recorded draw commands
+        ///
+        /// @param enabled  Should retained mode be used when drawing the gui?
+        ///
+        /// In retained mode, each widget remembers the geometry that it produced. As long as its properties, renderer, size
+        /// and text remain the same and the user doesn't interact with it, the recorded geometry is reused in the next frame.
+        /// This makes drawing a static screen with many widgets a lot cheaper on the CPU.
+        ///
+        /// Retained mode is disabled by default.
+        ///
+        /// @see BackendRenderTarget::setRetainedModeEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRetainedModeEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether widgets that didn't change since the previous frame are drawn from recorded draw commands
+        ///
+        /// @return Is retained mode enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRetainedModeEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many widgets could be replayed from their recorded draw commands during the last draw call
+        ///
+        /// @return Number of cache hits and misses while drawing the last frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BackendRenderTarget::RetainedModeStatistics getRetainedModeStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the gui only redraws the parts of the screen that changed since the previous frame
+        ///
+        /// @param enabled  Should draw() only clear and redraw the damaged areas?
+        ///
+        /// When enabled, widgets report which area of the screen they invalidated. The draw function combines these areas into
+        /// a few rectangles and only clears and redraws the widgets below them. Everything outside these rectangles is left
+        /// untouched, so the render target has to still contain an earlier frame. By default the gui assumes that it contains
+        /// the previous frame (e.g. when the gui is drawn to a texture), call setBackBufferAge when drawing to a window whose
+        /// back buffer is older or undefined. You should also no longer clear the screen yourself before calling draw().
+        ///
+        /// The main loop only relies on the contents of the back buffer when the window system reports that they are preserved
+        /// or how old they are (EGL_BUFFER_PRESERVED or EGL_EXT_buffer_age with the GLES2 backends), otherwise it redraws the
+        /// entire screen whenever something changed.
+        ///
+        /// Partial redraw is disabled by default.
+        ///
+        /// @see getDamagedRects
+        /// @see setBackBufferAge
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPartialRedrawEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the gui only redraws the parts of the screen that changed since the previous frame
+        ///
+        /// @return Is partial redraw enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isPartialRedrawEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the gui which earlier frame the render target still contains, for when partial redraw is enabled
+        ///
+        /// @param age  How many frames ago the contents of the render target were drawn, or 0 if the contents are undefined
+        ///
+        /// When the window system swaps between several back buffers, the buffer that is drawn to doesn't contain the previous
+        /// frame but an older one. The gui remembers the damaged areas of the last few frames and redraws all areas that changed
+        /// since the frame that the buffer contains. If the age is 0 or too high, the entire screen is redrawn.
+        ///
+        /// The age should be set before every call to draw() (e.g. by querying EGL_BUFFER_AGE_EXT). It is 1 by default, which
+        /// means that the render target contains the previous frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBackBufferAge(unsigned int age);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns which earlier frame the render target still contains, for when partial redraw is enabled
+        ///
+        /// @return How many frames ago the contents of the render target were drawn, or 0 if the contents are undefined
+        ///
+        /// @see setBackBufferAge
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getBackBufferAge() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks part of the screen as damaged, so that it gets redrawn in the next frame when partial redraw is enabled
+        ///
+        /// @param rect  Area that has to be redrawn, in the coordinate system of the view
+        ///
+        /// Widgets call this function automatically. You only need to call it yourself when the contents of the render target
+        /// was changed by something else than the gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRect(FloatRect rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the parts of the window that were redrawn during the last call to draw()
+        ///
+        /// @return Rectangles in pixels, relative to the top-left corner of the window
+        ///
+        /// The rectangles can be passed to the window system when presenting the frame, so that only the parts of the window
+        /// that changed have to be updated. The list is empty when nothing changed. When partial redraw is disabled, the list
+        /// always contains the entire viewport.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<IntRect>& getDamagedRects() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Updates the internal clock (for timers, animations and blinking edit cursors)
         ///
@@ -601,6 +713,20 @@ namespace tgui
         virtual void updateContainerSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Collects the areas that changed since the previous frame and combines them into a small number of rectangles.
+        // The m_damagedRects member is updated and the same rectangles are returned in the coordinate system of the view.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<FloatRect> updateDamagedRects();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Asks the window system how many frames ago the back buffer of the window was drawn to, which is used by the main loop
+        // when partial redraw is enabled. Returns 0 when this isn't known, in which case everything is redrawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual unsigned int queryBackBufferAge() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -627,8 +753,16 @@ namespace tgui
         FloatRect m_lastView;
 
         bool m_drawUpdatesTime = true;
+        bool m_retainedModeEnabled = false;
         bool m_tabKeyUsageEnabled = true;
 
+        bool m_partialRedrawEnabled = false;
+        bool m_fullRedrawRequired = true;
+        std::vector<FloatRect> m_invalidatedRects; // Areas reported since the last draw, in view coordinates
+        std::vector<IntRect> m_damagedRects; // Areas that were redrawn during the last draw, in pixels
+        std::deque<std::vector<IntRect>> m_damageHistory; // Areas that changed in the previous frames, most recent frame first
+        unsigned int m_backBufferAge = 1;
+
         Cursor::Type m_requestedMouseCursor = Cursor::Type::Arrow;
         std::stack<Cursor::Type> m_overrideMouseCursors;
 
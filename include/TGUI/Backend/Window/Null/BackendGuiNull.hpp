@@ -0,0 +1,118 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_GUI_NULL_HPP
+#define TGUI_BACKEND_GUI_NULL_HPP
+
+#include <TGUI/Backend/Window/BackendGui.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Gui that isn't attached to any window
+    ///
+    /// Events have to be passed to the handleEvent function manually, they are never generated by the backend itself.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendGuiNull : public BackendGui
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /// @warning setGuiWindow has to be called by the subclass that inherits from this base class before the gui is used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BackendGuiNull() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the imaginary window on which the gui is drawn
+        ///
+        /// @param size  New size of the window, in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWindowSize(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the imaginary window on which the gui is drawn
+        ///
+        /// @return Size of the window, in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2u getWindowSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Give the gui control over the main loop
+        ///
+        /// @param clearColor  background color of the window
+        ///
+        /// As there is no window that can be closed, the loop only ends when stopMainLoop is called (e.g. from a timer or
+        /// a signal handler of a widget).
+        ///
+        /// You can consider this function to execute something similar (but not identical) to the following code:
+        /// @code
+        /// while (!stopped)
+        /// {
+        ///     gui.draw();
+        ///     waitForNextTimer();
+        ///     gui.updateTime();
+        /// }
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mainLoop(Color clearColor = {240, 240, 240}) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes the mainLoop function return after the current iteration
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopMainLoop();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the size of the imaginary window on which the gui should be drawn and attaches the gui to the backend
+        ///
+        /// @param windowSize  Size of the window, in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGuiWindow(Vector2u windowSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        bool m_mainLoopStopRequested = false;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_GUI_NULL_HPP
@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_NULL_HPP
+#define TGUI_BACKEND_NULL_HPP
+
+#include <TGUI/Backend/Window/Backend.hpp>
+#include <TGUI/Backend/Window/Null/BackendGuiNull.hpp>
+#include <unordered_set>
+#include <array>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Backend that doesn't have any window, events have to be passed to the gui manually
+    ///
+    /// This backend is meant for running the gui without a display, e.g. in automated tests or benchmarks.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendNull : public Backend
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the backend that a new gui object has been created.
+        /// @param gui  Newly created gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void attachGui(BackendGui* gui) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the backend that a gui object is being destroyed.
+        /// @param gui  Gui object that is about to be deconstructed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void detatchGui(BackendGui* gui) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the look of a certain mouse cursor by using a bitmap
+        ///
+        /// @param type    Cursor that should make use of the bitmap
+        /// @param pixels  Pointer to an array with 4*size.x*size.y elements, representing the pixels in 32-bit RGBA format
+        /// @param size    Size of the cursor
+        /// @param hotspot Pixel coordinate within the cursor image which will be located exactly at the mouse pointer position
+        ///
+        /// This function does nothing, as there is no mouse cursor without a window.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMouseCursorStyle(Cursor::Type type, const std::uint8_t* pixels, Vector2u size, Vector2u hotspot) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the look of a certain mouse cursor back to the system theme
+        ///
+        /// @param type  Cursor that should no longer use a custom bitmap
+        ///
+        /// This function does nothing, as there is no mouse cursor without a window.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetMouseCursorStyle(Cursor::Type type) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the mouse cursor when the mouse is on top of the window to which the gui is attached
+        ///
+        /// @param gui   The gui that represents the window for which the mouse cursor should be changed
+        /// @param type  Which cursor to use
+        ///
+        /// This function does nothing, as there is no mouse cursor without a window.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMouseCursor(BackendGui* gui, Cursor::Type type) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks the state for one of the modifier keys
+        ///
+        /// @param modifierKey  The modifier key of which the state is being queried
+        ///
+        /// @return Whether queries modifier key is being pressed
+        ///
+        /// @see setKeyboardModifierPressed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isKeyboardModifierPressed(Event::KeyModifier modifierKey) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the state of one of the modifier keys
+        ///
+        /// @param modifierKey  The modifier key of which the state should change
+        /// @param pressed      Should isKeyboardModifierPressed report that the key is being pressed?
+        ///
+        /// As there is no keyboard, the modifier keys are never pressed unless they are set with this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setKeyboardModifierPressed(Event::KeyModifier modifierKey, bool pressed);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::unordered_set<BackendGui*> m_guis;
+        std::array<bool, 4> m_modifierKeysPressed = {{false, false, false, false}};
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_NULL_HPP
@@ -419,6 +419,35 @@ namespace tgui
         void setFocused(bool focused) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the container is drawn to a texture that is reused for as long as nothing inside it changes
+        ///
+        /// @param renderCached  Should the container and its child widgets be drawn to an offscreen texture?
+        ///
+        /// When enabled, the container and all widgets inside it are drawn to a texture once. In later frames, only that
+        /// texture is drawn, until the container or one of the widgets inside it changes. This is useful for containers with
+        /// many widgets that rarely change (e.g. a settings panel or a toolbar).
+        ///
+        /// Only the area inside the size of the container is drawn to the texture, anything that a child widget draws outside
+        /// of it is cut off. The texture is drawn without rotation or scaling, so the container shouldn't be rotated or
+        /// scaled while render caching is enabled. If the render target doesn't support offscreen rendering then the widgets
+        /// are drawn directly instead.
+        ///
+        /// Render caching is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCached(bool renderCached);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the container is drawn to a texture that is reused for as long as nothing inside it changes
+        ///
+        /// @return Is the container drawn to an offscreen texture?
+        ///
+        /// @see setRenderCached
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRenderCached() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Inform the container about a mouse move event
         /// @param pos  Mouse position
@@ -653,6 +682,12 @@ namespace tgui
         void loadWidgetsImpl(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the texture of this container and of all render cached containers that contain it as outdated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRenderCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -668,8 +703,15 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Texture to which the container is drawn when render caching is enabled
+        bool m_renderCached = false;
+        bool m_renderCacheValid = false;
+        std::shared_ptr<BackendTexture> m_renderCacheTexture;
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
+        friend class Widget; // Widgets invalidate the render cache of the containers they are in
+        friend class BackendRenderTarget; // Render target draws the container to its render cache
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,4888 @@
+// Glyphs of the default font (DejaVu Sans) that were rasterized with FreeType in advance.
+// The glyphs are derived from the font and thus fall under the license that can be found in DefaultFont.hpp.
+//
+// This file is generated by the tgui-bake-default-font target, don't edit it manually.
+
+#ifndef TGUI_DEFAULT_FONT_ATLAS_HPP
+#define TGUI_DEFAULT_FONT_ATLAS_HPP
+
+#include <cstddef>
+
+namespace tgui
+{
+namespace defaultFontAtlas
+{
+    struct GlyphMetrics
+    {
+        short          advance;    //!< Offset to move horizontally to the next character
+        short          lsbDelta;   //!< Left offset after forced autohint
+        short          rsbDelta;   //!< Right offset after forced autohint
+        unsigned short glyphIndex; //!< Index of the glyph in the font (0 when the font doesn't contain the character)
+    };
+
+    struct GlyphBitmap
+    {
+        char32_t       codePoint;    //!< Character of which this is the bitmap
+        short          left;         //!< Left position of the bitmap, relative to the pen position
+        short          top;          //!< Top position of the bitmap, relative to the baseline
+        unsigned short width;        //!< Width of the bitmap
+        unsigned short height;       //!< Height of the bitmap
+        unsigned int   pixelsOffset; //!< Index of the first alpha value of the bitmap in the pixels array
+    };
+
+    struct CharacterSize
+    {
+        unsigned int         characterSize;      //!< Character size for which the glyphs were rasterized
+        float                lineSpacing;        //!< Line spacing at this character size
+        float                underlinePosition;  //!< Offset of the underline below the baseline
+        float                underlineThickness; //!< Thickness of the underline
+        const GlyphMetrics*  metrics;            //!< Metrics of the first 256 code points, indexed by code point
+        const GlyphBitmap*   glyphs;             //!< Rasterized glyphs, in the order in which they are placed in the atlas
+        std::size_t          glyphCount;         //!< Amount of rasterized glyphs
+        const unsigned char* pixels;             //!< Alpha values of all rasterized glyphs
+        const signed char*   asciiKerning;       //!< Kerning of every pair of ASCII characters (128x128 values)
+    };
+
+    // The prebaked glyphs are only used for a font of which the size and header match the font that was baked
+    static const std::size_t fontFileSize = 720856;
+    static const unsigned char fontFileHeader[256] = {
+0,1,0,0,0,19,1,0,0,4,0,48,70,70,84,77,96,220,152,54,0,0,1,60,0,0,0,28,71,68,69,70,131,92,125,80,0,0,1,88,0,0,2,148,71,80,79,83,40,255,158,147,0,0,3,236,0,0,152,52,71,83,85,66,
+24,176,110,135,0,0,156,32,0,0,21,142,79,83,47,50,249,33,114,45,0,0,177,176,0,0,0,86,99,109,97,112,196,83,249,96,0,0,178,8,0,0,21,250,99,118,116,32,0,105,29,57,0,0,200,4,0,0,1,254,102,112,103,109,
+113,52,118,106,0,0,202,4,0,0,0,171,103,97,115,112,0,7,0,7,0,0,202,176,0,0,0,12,103,108,121,102,137,235,201,189,0,0,202,188,0,8,21,64,104,101,97,100,251,205,200,149,0,8,223,252,0,0,0,54,104,104,101,97,
+12,184,29,135,0,8,224,52,0,0,0,36,104,109,116,120,51,87,91,25,0,8,224,88,0,0,92,216,107,101,114,110,134,90,99,119,0,9,61,48,0,0,61,224,108,111,99,97,87,202,32,0,0,9,123,16,0,0,92,220,109,97,120,112,
+    };
+
+    static const GlyphMetrics metrics12[256] = {
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {4, 0, 0, 3},
+        {5, -2, 13, 4},
+        {5, 20, -8, 5},
+        {10, 0, -4, 6},
+        {8, 10, 2, 7},
+        {12, -12, 23, 8},
+        {9, -6, -15, 9},
+        {3, 20, -8, 10},
+        {5, 12, 32, 11},
+        {5, -21, -1, 12},
+        {7, -11, 22, 13},
+        {10, 17, -18, 14},
+        {4, -28, -10, 15},
+        {5, -26, 27, 16},
+        {3, 28, -18, 17},
+        {4, 0, -3, 18},
+        {8, 0, 0, 19},
+        {8, 0, 0, 20},
+        {8, 0, 0, 21},
+        {8, 0, 0, 22},
+        {8, 0, 0, 23},
+        {8, 0, 0, 24},
+        {8, 0, 0, 25},
+        {8, 0, 0, 26},
+        {8, 0, 0, 27},
+        {8, 0, 0, 28},
+        {4, -28, -25, 29},
+        {4, -28, -25, 30},
+        {10, 17, 14, 31},
+        {10, 17, -18, 32},
+        {10, 17, 14, 33},
+        {6, 29, 12, 34},
+        {12, -3, 12, 35},
+        {8, 0, -13, 36},
+        {8, 21, 12, 37},
+        {8, -11, -31, 38},
+        {9, 21, 21, 39},
+        {7, 21, -13, 40},
+        {7, 21, 30, 41},
+        {9, -11, 3, 42},
+        {9, 21, -10, 43},
+        {3, 21, -11, 44},
+        {4, -22, -11, 45},
+        {8, 21, 32, 46},
+        {6, 21, -20, 47},
+        {10, 21, -9, 48},
+        {8, 21, -10, 49},
+        {10, -11, 22, 50},
+        {6, 21, -24, 51},
+        {10, -11, 22, 52},
+        {7, 21, -31, 53},
+        {8, -3, 23, 54},
+        {7, 6, -6, 55},
+        {9, 13, -1, 56},
+        {8, 0, -13, 57},
+        {12, 0, 9, 58},
+        {8, 0, -14, 59},
+        {7, 15, -3, 60},
+        {9, -29, 21, 61},
+        {5, 12, 28, 62},
+        {4, 0, -3, 63},
+        {5, -18, -1, 64},
+        {10, 0, -4, 65},
+        {6, 0, 0, 66},
+        {6, 0, 0, 67},
+        {7, -8, -4, 68},
+        {8, 16, 24, 69},
+        {7, -12, 27, 70},
+        {8, -12, -4, 71},
+        {8, -12, 25, 72},
+        {4, 30, 12, 73},
+        {8, -12, -4, 74},
+        {7, 16, 1, 75},
+        {3, 18, -7, 76},
+        {3, 18, -7, 77},
+        {7, 16, 15, 78},
+        {3, 18, -7, 79},
+        {11, 16, 1, 80},
+        {7, 16, 1, 81},
+        {8, -12, 24, 82},
+        {8, 16, 24, 83},
+        {8, -12, -4, 84},
+        {5, 16, 16, 85},
+        {7, -9, 29, 86},
+        {4, 17, -31, 87},
+        {7, 11, -4, 88},
+        {7, 0, -7, 89},
+        {10, 0, 12, 90},
+        {7, 0, -7, 91},
+        {7, 0, -7, 92},
+        {7, -31, -1, 93},
+        {7, 31, -14, 94},
+        {5, -20, 31, 95},
+        {7, 25, -20, 96},
+        {10, 17, 14, 97},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {7, 0, -13, 0},
+        {4, 0, 0, 98},
+        {5, -2, 13, 99},
+        {8, 11, -2, 100},
+        {8, -16, -12, 101},
+        {7, 31, -18, 102},
+        {7, 25, -14, 103},
+        {5, -20, 31, 104},
+        {7, -19, 31, 105},
+        {5, 27, -15, 106},
+        {13, -12, 24, 107},
+        {6, -29, 19, 108},
+        {8, -5, 24, 109},
+        {10, -3, -17, 110},
+        {5, -26, 27, 111},
+        {13, -12, 24, 112},
+        {6, 0, 0, 113},
+        {6, 19, -7, 114},
+        {10, 17, -18, 115},
+        {5, 1, 21, 116},
+        {4, 12, -31, 117},
+        {6, 0, 0, 118},
+        {7, 11, -6, 119},
+        {8, -27, -18, 120},
+        {3, 28, -18, 121},
+        {6, 0, 0, 122},
+        {5, -1, 17, 123},
+        {5, 28, -28, 124},
+        {7, 8, -27, 125},
+        {11, 17, -9, 126},
+        {12, 17, 15, 127},
+        {11, 30, -9, 128},
+        {6, 0, -19, 129},
+        {8, 0, -13, 130},
+        {8, 0, -13, 131},
+        {8, 0, -13, 132},
+        {8, 0, -13, 133},
+        {8, -31, -21, 134},
+        {8, -22, -29, 135},
+        {11, 28, -13, 136},
+        {8, -11, -31, 137},
+        {7, 21, -13, 138},
+        {7, 21, -13, 139},
+        {7, 21, -13, 140},
+        {7, 21, 8, 141},
+        {3, 21, -11, 142},
+        {3, 21, -11, 143},
+        {3, 21, -11, 144},
+        {4, -44, -8, 145},
+        {9, 25, 21, 146},
+        {8, 21, -10, 147},
+        {10, -11, 22, 148},
+        {10, -11, 22, 149},
+        {10, -11, 22, 150},
+        {10, -11, 22, 151},
+        {10, -11, 22, 152},
+        {10, 0, -4, 153},
+        {10, -11, 22, 154},
+        {9, 13, -1, 155},
+        {9, 13, -1, 156},
+        {9, 13, -1, 157},
+        {9, 13, -1, 158},
+        {7, 15, -3, 159},
+        {6, 21, -26, 160},
+        {8, 16, 31, 161},
+        {7, -8, -4, 162},
+        {7, -8, -4, 163},
+        {7, -8, -4, 164},
+        {7, -8, -4, 165},
+        {7, -8, -4, 166},
+        {7, -8, -4, 167},
+        {12, -8, 26, 168},
+        {7, -12, 27, 169},
+        {8, -12, 25, 170},
+        {8, -12, 25, 171},
+        {8, -12, 25, 172},
+        {8, -12, 25, 173},
+        {3, 18, -7, 174},
+        {3, 18, -7, 175},
+        {3, 18, -7, 176},
+        {3, 13, -11, 177},
+        {8, -12, 24, 178},
+        {7, 16, 1, 179},
+        {8, -12, 24, 180},
+        {8, -12, 24, 181},
+        {8, -12, 24, 182},
+        {8, -12, 24, 183},
+        {8, -12, 24, 184},
+        {10, 17, -18, 185},
+        {8, -12, 24, 186},
+        {7, 11, -4, 187},
+        {7, 11, -4, 188},
+        {7, 11, -4, 189},
+        {7, 11, -4, 190},
+        {7, 0, -7, 191},
+        {8, 16, 24, 192},
+        {7, -2, 14, 193},
+    };
+    static const GlyphBitmap glyphs12[] = {
+        {32, 0, 0, 0, 0, 0},
+        {33, 1, -9, 2, 9, 0},
+        {34, 0, -9, 4, 3, 18},
+        {35, 0, -9, 10, 9, 30},
+        {36, 0, -10, 7, 12, 120},
+        {37, 0, -9, 11, 9, 204},
+        {38, 0, -9, 9, 9, 303},
+        {39, 0, -9, 2, 3, 384},
+        {40, 0, -10, 4, 11, 390},
+        {41, 1, -10, 3, 11, 434},
+        {42, 0, -9, 7, 5, 467},
+        {43, 1, -8, 8, 8, 502},
+        {44, 1, -2, 2, 3, 566},
+        {45, 1, -4, 3, 1, 572},
+        {46, 0, -1, 2, 1, 575},
+        {47, 0, -9, 5, 11, 577},
+        {48, 0, -9, 7, 9, 632},
+        {49, 0, -9, 6, 9, 695},
+        {50, 1, -9, 6, 9, 749},
+        {51, 1, -9, 6, 9, 803},
+        {52, 0, -9, 8, 9, 857},
+        {53, 1, -9, 6, 9, 929},
+        {54, 0, -9, 7, 9, 983},
+        {55, 1, -9, 6, 9, 1046},
+        {56, 0, -9, 7, 9, 1100},
+        {57, 0, -9, 7, 9, 1163},
+        {58, 1, -6, 2, 6, 1226},
+        {59, 1, -7, 2, 8, 1238},
+        {60, 1, -8, 8, 8, 1254},
+        {61, 1, -6, 8, 4, 1318},
+        {62, 1, -8, 8, 8, 1350},
+        {63, 0, -9, 5, 9, 1414},
+        {64, 0, -9, 11, 11, 1459},
+        {65, 0, -9, 9, 9, 1580},
+        {66, 0, -9, 7, 9, 1661},
+        {67, 0, -9, 8, 9, 1724},
+        {68, 0, -9, 8, 9, 1796},
+        {69, 0, -9, 7, 9, 1868},
+        {70, 0, -9, 6, 9, 1931},
+        {71, 0, -9, 8, 9, 1985},
+        {72, 0, -9, 8, 9, 2057},
+        {73, 0, -9, 2, 9, 2129},
+        {74, -1, -9, 4, 12, 2147},
+        {75, 0, -9, 8, 9, 2195},
+        {76, 0, -9, 7, 9, 2267},
+        {77, 0, -9, 9, 9, 2330},
+        {78, 0, -9, 7, 9, 2411},
+        {79, 0, -9, 9, 9, 2474},
+        {80, 0, -9, 6, 9, 2555},
+        {81, 0, -9, 9, 11, 2609},
+        {82, 0, -9, 8, 9, 2708},
+        {83, 0, -9, 7, 9, 2780},
+        {84, 0, -9, 7, 9, 2843},
+        {85, 0, -9, 8, 9, 2906},
+        {86, 0, -9, 9, 9, 2978},
+        {87, 0, -9, 12, 9, 3059},
+        {88, 0, -9, 8, 9, 3167},
+        {89, -1, -9, 9, 9, 3239},
+        {90, 1, -9, 7, 9, 3320},
+        {91, 0, -10, 4, 11, 3383},
+        {92, 0, -9, 5, 11, 3427},
+        {93, 1, -10, 3, 11, 3482},
+        {94, 1, -10, 8, 4, 3515},
+        {95, -1, 2, 8, 1, 3547},
+        {96, 1, -11, 3, 3, 3555},
+        {97, 0, -7, 6, 7, 3564},
+        {98, 0, -10, 7, 10, 3606},
+        {99, 0, -7, 6, 7, 3676},
+        {100, 0, -10, 7, 10, 3718},
+        {101, 0, -7, 7, 7, 3788},
+        {102, -1, -10, 6, 10, 3837},
+        {103, 0, -7, 7, 10, 3897},
+        {104, 0, -10, 6, 10, 3967},
+        {105, 0, -10, 2, 10, 4027},
+        {106, -1, -10, 3, 13, 4047},
+        {107, 0, -10, 7, 10, 4086},
+        {108, 0, -10, 2, 10, 4156},
+        {109, 0, -7, 10, 7, 4176},
+        {110, 0, -7, 6, 7, 4246},
+        {111, 0, -7, 7, 7, 4288},
+        {112, 0, -7, 7, 10, 4337},
+        {113, 0, -7, 7, 10, 4407},
+        {114, 0, -8, 5, 8, 4477},
+        {115, 0, -7, 6, 7, 4517},
+        {116, 0, -9, 5, 9, 4559},
+        {117, 0, -7, 6, 7, 4604},
+        {118, 0, -7, 7, 7, 4646},
+        {119, 0, -7, 10, 7, 4695},
+        {120, 0, -7, 7, 7, 4765},
+        {121, 0, -7, 7, 10, 4814},
+        {122, 1, -7, 6, 7, 4884},
+        {123, 1, -10, 5, 12, 4926},
+        {124, 1, -10, 2, 13, 4986},
+        {125, 1, -10, 5, 12, 5012},
+        {126, 1, -6, 8, 4, 5072},
+        {160, 0, 0, 0, 0, 5104},
+        {161, 1, -9, 2, 9, 5104},
+        {162, 0, -9, 7, 11, 5122},
+        {163, 1, -9, 6, 9, 5199},
+        {164, 0, -7, 7, 7, 5253},
+        {165, 0, -9, 7, 9, 5302},
+        {166, 1, -9, 2, 11, 5365},
+        {167, 0, -9, 6, 11, 5387},
+        {168, 0, -9, 4, 1, 5453},
+        {169, 1, -9, 10, 9, 5457},
+        {170, 1, -9, 4, 6, 5547},
+        {171, 1, -7, 6, 7, 5571},
+        {172, 1, -5, 8, 4, 5613},
+        {173, 1, -4, 3, 1, 5645},
+        {174, 1, -9, 10, 9, 5648},
+        {175, 1, -9, 4, 1, 5738},
+        {176, 0, -9, 5, 4, 5742},
+        {177, 1, -8, 8, 8, 5762},
+        {178, 0, -9, 4, 5, 5826},
+        {179, 0, -9, 4, 5, 5846},
+        {180, 2, -11, 3, 3, 5866},
+        {181, 0, -7, 7, 10, 5875},
+        {182, 1, -9, 6, 11, 5945},
+        {183, 0, -5, 2, 1, 6011},
+        {184, 1, 0, 3, 3, 6013},
+        {185, 0, -9, 5, 5, 6022},
+        {186, 0, -9, 5, 6, 6047},
+        {187, 1, -7, 6, 7, 6077},
+        {188, 0, -10, 11, 10, 6119},
+        {189, 0, -10, 12, 10, 6229},
+        {190, 0, -9, 11, 9, 6349},
+        {191, 0, -9, 6, 9, 6448},
+        {192, 0, -12, 9, 12, 6502},
+        {193, 0, -12, 9, 12, 6610},
+        {194, 0, -12, 9, 12, 6718},
+        {195, 0, -12, 9, 12, 6826},
+        {196, 0, -11, 9, 11, 6934},
+        {197, 0, -12, 9, 12, 7033},
+        {198, -1, -9, 12, 9, 7141},
+        {199, 0, -9, 8, 12, 7249},
+        {200, 0, -12, 7, 12, 7345},
+        {201, 0, -12, 7, 12, 7429},
+        {202, 0, -12, 7, 12, 7513},
+        {203, 0, -11, 7, 11, 7597},
+        {204, 0, -12, 3, 12, 7674},
+        {205, 0, -12, 3, 12, 7710},
+        {206, -1, -12, 5, 12, 7746},
+        {207, 0, -11, 4, 11, 7806},
+        {208, -1, -9, 9, 9, 7850},
+        {209, 0, -12, 7, 12, 7931},
+        {210, 0, -12, 9, 12, 8015},
+        {211, 0, -12, 9, 12, 8123},
+        {212, 0, -12, 9, 12, 8231},
+        {213, 0, -12, 9, 12, 8339},
+        {214, 0, -11, 9, 11, 8447},
+        {215, 1, -8, 8, 8, 8546},
+        {216, 0, -10, 10, 11, 8610},
+        {217, 0, -12, 8, 12, 8720},
+        {218, 0, -12, 8, 12, 8816},
+        {219, 0, -12, 8, 12, 8912},
+        {220, 0, -11, 8, 11, 9008},
+        {221, -1, -12, 9, 12, 9096},
+        {222, 0, -9, 6, 9, 9204},
+        {223, 0, -10, 7, 10, 9258},
+        {224, 0, -10, 6, 10, 9328},
+        {225, 0, -10, 6, 10, 9388},
+        {226, 0, -10, 6, 10, 9448},
+        {227, 0, -10, 6, 10, 9508},
+        {228, 0, -10, 6, 10, 9568},
+        {229, 0, -11, 6, 11, 9628},
+        {230, 0, -7, 11, 7, 9694},
+        {231, 0, -7, 6, 10, 9771},
+        {232, 0, -10, 7, 10, 9831},
+        {233, 0, -10, 7, 10, 9901},
+        {234, 0, -10, 7, 10, 9971},
+        {235, 0, -10, 7, 10, 10041},
+        {236, -1, -10, 4, 10, 10111},
+        {237, 0, -10, 4, 10, 10151},
+        {238, -1, -10, 5, 10, 10191},
+        {239, -1, -10, 5, 10, 10241},
+        {240, 0, -10, 7, 10, 10291},
+        {241, 0, -10, 6, 10, 10361},
+        {242, 0, -10, 7, 10, 10421},
+        {243, 0, -10, 7, 10, 10491},
+        {244, 0, -10, 7, 10, 10561},
+        {245, 0, -10, 7, 10, 10631},
+        {246, 0, -10, 7, 10, 10701},
+        {247, 1, -7, 8, 5, 10771},
+        {248, 0, -8, 8, 9, 10811},
+        {249, 0, -10, 6, 10, 10883},
+        {250, 0, -10, 6, 10, 10943},
+        {251, 0, -10, 6, 10, 11003},
+        {252, 0, -10, 6, 10, 11063},
+        {253, 0, -10, 7, 13, 11123},
+        {254, 0, -10, 7, 13, 11214},
+        {255, 0, -10, 7, 13, 11305},
+    };
+    static const unsigned char pixels12[] = {
+40,252,40,252,40,252,40,252,40,252,40,252,0,0,0,0,38,240,40,252,40,248,40,252,40,248,40,252,40,248,0,0,0,0,202,37,34,206,0,0,0,0,0,5,233,1,85,156,0,0,0,0,0,49,191,0,137,106,0,0,0,97,240,246,
+248,240,252,243,240,33,0,0,0,195,48,30,208,1,0,0,18,240,241,253,240,247,247,240,112,0,0,0,88,153,0,175,68,0,0,0,0,0,139,103,0,224,17,0,0,0,0,0,190,53,19,221,0,0,0,0,0,0,40,248,0,0,0,0,
+0,40,248,0,0,0,0,108,232,255,236,206,70,13,251,102,248,8,52,46,28,255,58,248,0,0,0,0,188,224,251,97,28,0,0,5,101,252,173,243,105,0,0,40,248,0,76,229,23,62,40,248,4,132,201,19,186,231,255,231,184,39,0,0,
+40,248,0,0,0,0,0,40,248,0,0,0,0,97,233,221,59,0,0,27,180,0,0,8,245,57,101,204,0,0,165,42,0,0,31,255,2,46,238,0,71,136,0,0,0,5,237,60,104,195,7,189,10,0,0,0,0,73,202,190,43,128,79,70,
+193,185,40,0,0,0,0,36,171,5,236,44,94,192,0,0,0,0,174,32,31,253,0,46,238,0,0,0,86,122,0,8,245,56,104,204,0,0,13,188,6,0,0,97,233,222,59,0,0,98,229,240,190,4,0,0,0,16,252,61,4,65,3,0,
+0,0,15,249,30,0,0,0,0,0,0,7,205,198,10,0,0,0,0,0,160,139,138,187,7,0,187,85,17,253,24,1,162,177,12,230,23,20,255,22,0,4,183,218,147,0,0,191,171,18,10,117,255,145,0,0,22,165,235,229,162,48,230,108,
+40,252,40,252,40,252,0,0,174,72,0,50,207,0,0,153,115,0,0,227,52,0,18,255,13,0,35,255,1,0,18,255,13,0,0,228,51,0,0,154,114,0,0,51,206,0,0,0,174,72,118,128,0,12,231,17,0,164,108,0,99,183,0,58,
+230,0,45,246,0,58,230,0,99,183,0,162,110,12,231,18,117,130,0,1,0,40,252,0,1,0,52,160,86,252,68,168,23,0,17,203,255,175,5,0,50,159,86,252,68,165,22,1,0,40,252,0,1,0,0,0,40,248,0,0,0,0,0,0,
+40,248,0,0,0,0,0,0,40,248,0,0,0,0,0,0,40,248,0,0,0,0,240,240,242,255,240,240,240,240,0,0,40,248,0,0,0,0,0,0,40,248,0,0,0,0,0,0,40,248,0,0,0,0,40,252,69,198,132,82,244,244,244,38,
+240,0,0,26,228,0,0,0,100,156,0,0,0,174,82,0,0,5,236,13,0,0,67,189,0,0,0,141,115,0,0,0,215,40,0,0,33,222,0,0,0,108,148,0,0,0,182,74,0,0,0,118,9,0,0,0,0,8,159,241,234,124,0,0,
+140,193,18,34,222,89,0,236,64,0,0,109,187,25,255,16,0,0,61,231,37,255,1,0,0,45,244,25,255,15,0,0,60,231,0,236,63,0,0,108,187,0,141,191,18,33,221,89,0,8,160,242,235,125,0,25,181,236,248,0,0,23,103,83,
+248,0,0,0,0,40,248,0,0,0,0,40,248,0,0,0,0,40,248,0,0,0,0,40,248,0,0,0,0,40,248,0,0,0,8,46,248,8,8,0,255,255,255,255,255,137,214,243,228,151,15,134,50,6,18,171,169,0,0,0,0,56,233,0,
+0,0,0,123,187,0,0,0,73,238,46,0,0,80,236,61,0,0,94,237,58,0,0,109,238,55,0,0,0,255,251,244,244,244,236,70,211,239,237,182,37,25,26,0,5,118,202,0,0,0,6,117,238,0,37,240,254,253,117,0,0,0,24,152,
+59,0,0,0,0,59,214,0,0,0,0,63,238,82,34,1,30,193,172,112,225,245,229,156,19,0,0,0,1,198,252,0,0,0,0,0,103,194,252,0,0,0,0,23,219,59,252,0,0,0,0,166,99,40,252,0,0,0,70,198,1,40,252,0,
+0,8,216,48,0,40,252,0,0,40,252,232,232,235,255,232,54,3,24,24,24,60,252,24,5,0,0,0,0,40,252,0,0,40,255,244,244,244,87,40,252,0,0,0,0,40,252,0,0,0,0,40,255,230,225,144,10,15,48,3,33,197,145,0,
+0,0,0,64,226,0,0,0,0,63,226,66,28,0,31,197,147,121,230,246,226,140,10,0,0,88,214,245,224,79,0,73,214,49,1,24,34,0,204,68,0,0,0,0,7,253,106,224,227,149,11,34,255,154,12,22,188,147,24,255,17,0,0,61,
+226,0,233,16,0,0,61,227,0,134,151,10,19,185,149,0,6,150,238,234,154,12,244,244,244,244,250,242,0,0,0,0,188,152,0,0,0,34,254,50,0,0,0,134,204,0,0,0,4,231,102,0,0,0,81,243,12,0,0,0,183,154,0,0,
+0,30,253,52,0,0,0,129,206,0,0,0,0,58,194,239,234,173,28,6,239,115,4,12,154,188,27,255,8,0,0,53,235,0,169,119,7,15,158,155,0,70,234,252,255,190,8,9,242,121,7,15,158,164,29,255,8,0,0,53,236,1,226,117,
+5,12,155,189,0,49,191,239,237,178,32,0,29,177,238,229,117,0,0,197,151,9,20,187,86,19,255,16,0,0,60,185,20,255,17,0,0,62,231,0,200,154,12,23,189,244,0,30,175,233,216,121,225,0,0,0,0,0,113,163,0,43,14,4,
+69,226,42,0,118,236,245,199,59,0,37,236,0,0,0,0,0,0,0,0,38,240,37,236,0,0,0,0,0,0,0,0,40,252,69,198,132,82,0,0,0,0,0,0,1,21,0,0,0,0,34,129,224,119,0,10,94,191,237,151,56,0,156,238,
+182,86,7,0,0,0,200,232,134,40,0,0,0,0,0,41,138,230,202,108,19,0,0,0,0,3,75,171,243,99,0,0,0,0,0,0,18,42,240,240,240,240,240,240,240,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,244,
+244,244,244,244,244,244,23,0,0,0,0,0,0,0,243,177,80,5,0,0,0,0,16,104,199,233,142,45,0,0,0,0,0,39,134,227,204,66,0,0,0,8,87,183,240,88,1,61,155,238,186,89,8,0,222,218,123,28,0,0,0,0,60,0,
+0,0,0,0,0,0,72,203,242,209,52,99,59,3,119,207,0,0,0,61,230,0,0,8,200,139,0,0,164,183,4,0,17,255,22,0,0,39,252,0,0,0,3,23,0,0,0,38,240,0,0,0,0,0,66,179,232,234,190,86,0,0,0,0,
+124,224,91,17,5,63,203,158,1,0,75,232,27,0,0,0,0,11,213,93,0,199,106,0,69,216,221,114,240,94,199,14,254,26,4,236,89,4,136,248,49,237,34,255,2,30,254,2,0,50,248,59,215,15,254,27,4,236,88,4,136,248,139,124,
+0,204,111,0,70,217,223,125,223,135,5,0,79,238,39,0,0,0,0,0,3,0,0,0,128,235,102,21,2,45,176,67,0,0,0,0,68,181,233,236,184,69,0,0,0,0,0,192,239,7,0,0,0,0,0,32,253,238,85,0,0,0,0,0,
+126,197,142,180,0,0,0,0,0,220,106,51,251,23,0,0,0,60,251,20,0,216,113,0,0,0,155,181,0,0,126,208,0,0,9,241,244,232,232,239,255,47,0,89,238,30,24,24,24,194,141,0,184,141,0,0,0,0,86,232,4,40,255,244,
+244,238,183,35,40,252,0,0,8,143,194,40,252,0,0,0,51,238,40,252,0,0,10,146,182,40,255,240,240,254,233,36,40,252,0,0,10,146,181,40,252,0,0,0,51,238,40,252,0,0,8,143,195,40,255,244,244,238,182,36,0,0,60,187,
+242,236,196,83,0,66,238,98,15,2,62,160,0,205,113,0,0,0,0,0,16,255,29,0,0,0,0,0,35,255,4,0,0,0,0,0,16,255,29,0,0,0,0,0,0,205,112,0,0,0,0,0,0,66,237,96,14,2,58,159,0,0,61,188,
+243,237,195,80,40,255,244,243,227,165,42,0,40,252,0,1,27,128,241,43,40,252,0,0,0,0,152,167,40,252,0,0,0,0,73,226,40,252,0,0,0,0,48,243,40,252,0,0,0,0,73,226,40,252,0,0,0,0,151,167,40,252,0,1,
+26,125,241,45,40,255,244,244,228,166,44,0,40,255,244,244,244,244,80,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,255,240,240,240,240,37,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,
+0,0,0,0,40,255,244,244,244,244,106,40,255,244,244,244,202,40,252,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,0,40,255,240,240,240,108,40,252,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,
+0,0,0,73,199,245,232,187,70,0,77,236,85,11,4,66,140,0,210,104,0,0,0,0,0,18,255,26,0,0,0,0,0,36,255,4,0,0,228,241,240,18,255,26,0,0,0,40,248,0,212,102,0,0,0,40,248,0,79,235,83,10,4,93,
+248,0,0,76,200,245,232,189,70,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,255,240,240,240,240,242,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,
+248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,40,252,40,252,40,252,40,252,40,252,40,252,40,252,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,
+0,40,252,0,0,40,251,0,0,55,231,0,4,147,175,38,242,192,34,40,252,0,0,1,154,212,23,40,252,0,3,161,206,20,0,40,252,4,168,201,16,0,0,40,252,175,195,14,0,0,0,40,254,244,108,0,0,0,0,40,252,64,243,91,
+0,0,0,40,252,0,69,244,86,0,0,40,252,0,0,75,244,79,0,40,252,0,0,0,81,244,73,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,
+0,0,0,0,0,40,252,0,0,0,0,0,40,252,8,8,8,8,2,40,255,255,255,255,255,64,40,255,203,0,0,0,8,239,248,40,252,220,43,0,0,89,216,248,40,252,126,139,0,0,186,121,248,40,252,31,229,3,28,232,45,248,40,252,
+0,190,75,123,145,40,248,40,252,0,94,171,219,49,40,248,40,252,0,10,241,209,0,40,248,40,252,0,0,51,39,0,40,248,40,252,0,0,0,0,0,40,248,40,255,154,0,0,40,248,40,253,233,24,0,40,248,40,252,139,134,0,40,248,
+40,252,27,233,12,40,248,40,252,0,159,114,40,248,40,252,0,42,225,45,248,40,252,0,0,179,134,248,40,252,0,0,61,239,248,40,252,0,0,0,199,248,0,0,61,192,243,240,175,38,0,0,64,239,95,11,18,124,234,30,0,203,116,0,
+0,0,0,164,154,17,255,30,0,0,0,0,75,223,36,255,4,0,0,0,0,49,243,17,255,30,0,0,0,0,75,223,0,204,116,0,0,0,0,164,156,0,66,239,94,11,17,124,235,32,0,0,63,194,244,241,177,40,0,40,255,244,241,196,
+44,40,252,0,3,137,197,40,252,0,0,50,237,40,252,0,4,138,195,40,255,240,236,191,42,40,252,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,0,0,0,61,192,243,240,174,36,0,0,64,239,95,11,18,
+124,232,28,0,203,116,0,0,0,0,164,151,17,255,30,0,0,0,0,75,221,36,255,4,0,0,0,0,49,242,17,255,30,0,0,0,0,75,223,0,204,116,0,0,0,0,164,163,0,66,239,94,11,17,124,244,45,0,0,63,193,243,255,232,
+59,0,0,0,0,0,0,45,236,81,0,0,0,0,0,0,0,55,120,6,40,255,244,240,196,43,0,0,40,252,0,2,131,194,0,0,40,252,0,0,49,238,0,0,40,252,0,4,135,201,0,0,40,255,240,250,220,42,0,0,40,252,0,12,
+180,77,0,0,40,252,0,0,38,223,6,0,40,252,0,0,0,186,103,0,40,252,0,0,0,83,223,5,0,47,188,239,240,205,77,2,228,112,5,6,59,62,28,255,9,0,0,0,0,3,223,175,78,21,0,0,0,29,148,219,253,189,33,0,
+0,0,0,25,169,191,0,0,0,0,0,52,235,23,127,35,2,16,158,180,15,163,226,245,231,165,25,244,244,245,255,244,244,244,0,0,40,248,0,0,0,0,0,40,248,0,0,0,0,0,40,248,0,0,0,0,0,40,248,0,0,0,0,0,
+40,248,0,0,0,0,0,40,248,0,0,0,0,0,40,248,0,0,0,0,0,40,248,0,0,0,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,
+40,248,35,254,3,0,0,0,45,243,6,252,37,0,0,0,82,210,0,166,178,26,1,41,209,115,0,15,145,224,242,216,117,3,185,130,0,0,0,0,79,232,4,89,223,1,0,0,0,172,141,0,9,241,62,0,0,17,248,47,0,0,155,156,
+0,0,103,208,0,0,0,60,241,9,0,197,113,0,0,0,0,220,88,34,250,23,0,0,0,0,126,182,127,180,0,0,0,0,0,32,250,228,85,0,0,0,0,0,0,192,239,7,0,0,0,121,182,0,0,0,219,182,0,0,0,219,88,59,
+241,3,0,24,224,232,3,0,24,255,26,6,246,51,0,86,159,193,51,0,86,220,0,0,191,113,0,148,98,133,113,0,148,158,0,0,128,175,0,209,37,72,175,0,209,95,0,0,66,235,17,230,0,14,233,17,253,33,0,0,9,250,119,171,
+0,0,207,119,227,0,0,0,0,198,233,110,0,0,147,233,165,0,0,0,0,135,255,50,0,0,86,255,103,0,0,12,224,90,0,0,13,226,84,0,70,235,21,0,151,174,0,0,0,160,167,64,237,25,0,0,0,17,231,236,97,0,0,0,
+0,0,188,246,15,0,0,0,0,92,220,178,152,0,0,0,22,235,65,25,238,62,0,0,170,155,0,0,100,217,7,80,230,16,0,0,0,189,133,14,226,86,0,0,0,135,190,1,0,71,233,19,0,47,240,34,0,0,0,158,163,3,203,112,
+0,0,0,0,16,229,174,198,2,0,0,0,0,0,83,254,40,0,0,0,0,0,0,40,252,0,0,0,0,0,0,0,40,252,0,0,0,0,0,0,0,40,252,0,0,0,0,0,0,0,40,252,0,0,0,0,244,244,244,244,244,249,254,0,
+0,0,0,12,215,129,0,0,0,0,168,186,2,0,0,0,110,227,20,0,0,0,56,244,56,0,0,0,20,227,109,0,0,0,2,186,168,0,0,0,0,130,215,12,0,0,0,0,254,249,244,244,244,244,244,40,255,244,95,40,252,0,0,40,
+252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,38,247,240,93,219,37,0,0,0,145,111,0,0,0,71,185,0,0,0,7,237,11,0,0,0,178,78,0,0,0,104,152,0,
+0,0,29,225,0,0,0,0,211,44,0,0,0,137,119,0,0,0,63,193,0,0,0,4,122,0,133,245,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,131,241,244,0,0,0,99,106,
+0,0,0,0,0,117,228,221,131,0,0,0,95,222,34,26,215,107,0,75,214,29,0,0,22,207,85,30,244,244,244,244,244,244,30,103,40,0,64,200,3,0,122,119,0,102,222,242,191,32,0,73,23,7,165,173,0,0,0,0,54,230,0,92,
+214,242,242,247,13,251,67,1,53,248,21,255,46,9,165,248,0,128,241,224,116,248,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,98,228,235,143,5,40,255,171,14,26,206,119,40,255,35,0,0,80,212,
+40,255,4,0,0,48,239,40,255,35,0,0,80,212,40,255,169,13,25,204,121,40,252,98,228,236,146,6,0,13,153,230,238,156,0,163,180,19,6,59,6,252,37,0,0,0,31,255,4,0,0,0,6,252,36,0,0,0,0,162,178,19,6,59,
+0,14,157,234,237,154,0,0,0,0,0,40,248,0,0,0,0,0,40,248,0,0,0,0,0,40,248,0,17,171,240,217,105,248,0,168,172,13,27,202,248,7,253,34,0,0,80,248,31,255,4,0,0,48,248,7,253,34,0,0,80,248,0,170,
+169,13,26,200,248,0,19,173,241,217,105,248,0,9,144,227,232,147,7,0,152,172,16,15,185,127,4,250,27,0,0,61,215,30,255,240,240,240,241,237,5,251,19,0,0,0,0,0,153,164,20,1,29,71,0,9,137,223,242,213,107,0,0,111,
+234,244,11,0,11,249,39,0,0,0,36,252,0,0,0,45,245,255,244,186,0,0,40,252,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,0,18,173,240,217,104,248,
+0,171,170,13,26,199,248,7,253,33,0,0,79,248,31,255,3,0,0,48,248,7,253,33,0,0,78,248,0,172,167,12,25,198,248,0,20,175,241,217,110,241,0,0,0,0,0,83,212,0,44,47,1,37,210,127,0,59,220,245,228,145,9,40,
+252,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,0,40,252,104,235,220,54,40,255,136,5,132,193,40,255,17,0,49,237,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,38,240,0,0,0,
+0,40,252,40,252,40,252,40,252,40,252,40,252,40,252,0,38,240,0,0,0,0,0,0,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,42,246,0,86,213,122,230,79,40,252,0,0,0,0,0,40,252,0,
+0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,89,223,40,40,252,0,104,217,32,0,40,252,119,210,24,0,0,40,254,235,99,0,0,0,40,252,48,232,78,0,0,40,252,0,51,233,74,0,40,252,0,0,55,234,70,40,252,40,252,
+40,252,40,252,40,252,40,252,40,252,40,252,40,252,40,252,40,252,102,233,226,60,107,234,221,53,40,255,136,5,131,227,134,5,131,191,40,255,17,0,49,255,14,0,49,237,40,252,0,0,40,248,0,0,40,248,40,252,0,0,40,248,0,0,
+40,248,40,252,0,0,40,248,0,0,40,248,40,252,0,0,40,248,0,0,40,248,40,252,104,235,220,54,40,255,136,5,132,193,40,255,17,0,49,237,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,
+0,16,162,234,227,133,4,0,168,175,14,28,208,117,7,253,35,0,0,82,211,31,255,4,0,0,48,238,7,253,35,0,0,81,211,0,169,172,13,27,206,118,0,18,164,235,228,135,5,40,252,98,228,235,143,5,40,255,171,14,26,206,119,40,
+255,35,0,0,80,212,40,255,4,0,0,48,239,40,255,35,0,0,80,212,40,255,169,13,25,204,121,40,252,98,228,236,146,6,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,0,17,171,240,217,105,248,0,168,
+172,13,27,202,248,7,253,34,0,0,80,248,31,255,4,0,0,48,248,7,253,34,0,0,80,248,0,170,169,13,26,200,248,0,19,173,241,217,105,248,0,0,0,0,0,40,248,0,0,0,0,0,40,248,0,0,0,0,0,40,248,0,0,0,
+0,4,40,252,99,226,188,40,255,157,10,9,40,255,26,0,0,40,253,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,0,99,222,243,226,109,17,253,58,0,18,48,16,249,98,13,0,0,0,72,185,241,190,52,0,0,0,
+6,118,219,27,77,11,1,106,216,30,194,241,241,198,53,40,252,0,0,0,40,252,0,0,0,230,255,244,244,49,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,39,252,0,0,0,17,255,30,0,0,0,137,235,240,48,40,252,0,0,
+40,248,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,29,255,6,0,61,248,4,237,88,9,171,248,0,90,233,225,111,248,120,172,0,0,0,145,146,31,246,14,0,3,231,56,0,196,94,0,69,221,0,0,106,183,0,159,
+131,0,0,21,247,28,240,41,0,0,0,183,187,207,0,0,0,0,93,255,117,0,0,97,179,0,0,220,170,0,0,227,48,34,240,2,25,225,229,0,34,239,2,0,227,50,88,154,202,40,97,178,0,0,164,114,150,91,138,103,160,115,0,0,
+101,178,211,28,75,166,223,52,0,0,38,243,220,0,14,238,242,3,0,0,0,231,159,0,0,204,183,0,0,35,238,50,0,26,236,64,0,101,215,10,185,140,0,0,0,178,211,210,7,0,0,0,77,255,101,0,0,0,12,221,156,229,18,0,
+0,157,170,0,154,170,0,79,229,18,0,12,220,91,117,173,0,0,0,147,144,25,245,16,0,4,234,51,0,183,101,0,76,214,0,0,88,193,0,168,121,0,0,8,239,44,244,30,0,0,0,155,210,190,0,0,0,0,60,255,97,0,0,0,
+0,30,246,14,0,0,0,2,144,158,0,0,0,11,244,213,29,0,0,0,205,244,244,244,253,128,0,0,0,65,238,47,0,0,39,235,76,0,0,19,219,111,0,0,6,194,149,0,0,0,163,183,3,0,0,0,255,247,244,244,244,122,0,0,
+142,236,175,0,21,255,40,0,0,39,252,0,0,0,43,250,0,0,1,111,220,0,0,244,249,75,0,0,3,128,204,0,0,0,47,246,0,0,0,40,252,0,0,0,38,253,1,0,0,16,254,52,0,0,0,125,226,172,40,252,40,252,40,252,
+40,252,40,252,40,252,40,252,40,252,40,252,40,252,40,252,40,252,20,126,217,229,106,0,0,0,84,232,0,0,0,40,251,0,0,0,38,253,1,0,0,15,250,68,0,0,0,116,255,200,0,7,242,83,0,0,35,254,4,0,0,40,252,0,
+0,0,43,250,0,0,0,94,226,0,0,213,219,91,0,0,0,0,0,0,0,0,0,1,95,208,233,164,63,22,95,112,172,26,13,103,207,231,161,21,2,0,0,0,0,0,0,0,38,240,0,0,0,0,40,252,40,252,40,252,40,252,40,252,
+40,252,0,0,0,21,135,0,0,0,0,0,40,248,0,0,0,8,147,234,255,235,106,0,155,189,63,248,13,50,5,251,43,40,248,0,0,31,255,4,40,248,0,0,9,254,28,40,248,0,0,0,180,154,41,248,0,22,0,26,193,236,254,220,
+133,0,0,0,57,249,28,0,0,0,0,38,236,0,0,0,0,80,220,242,202,0,4,239,80,1,49,0,31,253,2,0,0,0,40,248,0,0,0,168,242,255,240,240,41,0,40,248,0,0,0,0,40,248,0,0,0,0,40,248,0,0,0,244,
+245,255,244,244,244,112,42,0,0,0,60,90,85,233,178,235,181,219,50,2,211,103,6,146,172,0,27,255,7,0,51,235,0,1,210,108,9,150,162,0,86,233,181,236,173,230,52,118,42,0,0,0,68,80,156,125,0,0,0,174,107,20,227,28,
+0,66,208,3,0,108,165,3,209,60,0,114,194,242,159,234,192,78,0,0,81,253,35,0,0,142,240,242,255,240,240,97,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,40,252,40,252,40,252,40,252,40,252,0,
+0,40,252,40,252,40,252,40,252,40,252,0,112,233,241,177,0,20,254,43,6,65,0,9,227,92,0,0,0,0,103,250,183,40,0,14,247,51,102,240,89,23,255,33,0,86,231,0,146,211,31,127,186,0,0,109,246,204,15,0,0,0,96,230,
+0,0,64,3,93,222,0,0,186,236,217,72,0,38,240,38,236,0,0,16,138,220,239,210,116,4,0,0,20,215,157,30,1,43,184,185,5,0,168,172,57,200,236,192,9,210,117,11,250,48,233,102,3,28,2,83,212,34,255,37,254,4,0,0,
+0,49,241,11,251,48,234,103,3,27,2,89,212,0,169,173,60,201,237,190,10,209,118,0,20,214,159,41,8,51,186,183,5,0,0,15,139,220,241,210,116,4,0,82,171,171,71,48,177,177,189,183,20,0,201,196,6,50,223,99,200,158,199,144,
+192,192,171,0,0,32,0,0,32,0,56,219,5,156,115,86,209,57,189,164,4,229,79,101,242,27,0,29,204,109,114,218,33,0,12,180,0,77,116,0,0,3,0,0,3,167,244,244,244,244,244,245,248,0,0,0,0,0,0,40,252,0,0,0,
+0,0,0,40,252,0,0,0,0,0,0,18,118,244,244,244,0,0,16,138,220,239,210,116,4,0,0,20,215,157,30,1,43,184,185,5,0,168,211,247,239,225,113,5,210,117,11,250,84,248,0,77,234,0,83,212,34,255,47,255,245,236,83,0,
+49,241,11,251,84,248,9,178,107,0,89,212,0,169,205,197,0,17,185,34,209,118,0,20,214,159,41,8,51,186,183,5,0,0,15,139,220,241,210,116,4,0,183,244,244,183,0,95,226,212,58,15,250,44,88,215,17,252,47,91,219,0,104,229,
+215,63,0,0,40,248,0,0,0,0,0,0,40,248,0,0,0,0,0,0,40,248,0,0,0,0,240,240,242,255,240,240,240,240,0,0,40,248,0,0,0,0,0,0,40,248,0,0,0,0,0,0,0,0,0,0,0,0,244,244,244,244,244,244,
+244,244,74,169,190,105,1,0,3,192,0,0,134,82,0,134,105,0,104,234,180,165,77,167,182,117,0,0,6,184,0,110,214,100,0,0,7,193,104,170,180,99,0,45,101,5,206,61,128,117,0,40,252,0,0,40,248,0,40,252,0,0,40,248,
+0,40,252,0,0,40,248,0,40,252,0,0,40,248,0,40,254,5,0,54,248,0,40,255,92,4,153,252,14,40,252,157,236,128,206,179,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,0,120,226,254,245,248,91,
+255,255,252,40,248,155,255,255,252,40,248,131,255,255,252,40,248,23,217,255,252,40,248,0,7,90,252,40,248,0,0,40,252,40,248,0,0,40,252,40,248,0,0,40,252,40,248,0,0,40,252,40,248,0,0,18,114,18,112,38,240,0,21,90,
+20,30,213,81,218,151,33,175,213,0,0,0,0,192,0,0,0,0,192,0,0,0,0,192,0,0,10,172,235,172,13,32,181,181,181,32,170,45,0,43,169,192,0,0,0,191,170,45,0,45,169,32,183,185,183,32,129,192,192,192,129,32,0,32,
+0,0,0,221,56,114,156,5,0,57,230,87,131,188,16,0,143,229,8,199,101,127,208,59,201,114,0,180,12,115,77,0,0,2,0,2,0,0,0,0,25,43,0,0,0,0,24,11,0,0,82,167,252,0,0,0,5,194,11,0,0,0,40,252,
+0,0,0,108,107,0,0,0,0,40,252,0,0,14,200,5,0,0,0,0,40,252,0,0,135,90,0,14,42,0,57,174,211,168,37,199,1,0,165,248,0,0,0,0,0,162,73,0,97,93,248,0,0,0,0,49,191,0,28,141,67,249,24,0,
+0,0,187,57,0,59,212,218,254,162,0,0,50,155,0,0,0,0,33,205,0,0,1,7,0,0,0,0,0,7,0,0,0,89,197,252,0,0,0,0,83,155,0,0,0,0,40,252,0,0,0,11,209,20,0,0,0,0,40,252,0,0,0,138,
+107,0,0,0,0,0,40,252,0,0,42,202,3,0,0,0,0,57,174,211,168,26,191,60,110,170,190,91,0,0,0,0,0,93,163,0,0,0,67,226,0,0,0,0,15,218,24,0,0,16,191,71,0,0,0,0,148,115,0,0,39,175,46,0,
+0,0,0,46,206,5,0,0,170,245,244,244,3,139,232,231,126,0,0,2,187,21,0,0,17,0,87,227,0,0,108,115,0,0,0,0,227,255,127,0,23,200,5,0,0,0,14,0,94,234,0,162,71,0,19,54,0,171,235,224,108,61,176,0,
+1,164,248,0,0,0,0,4,203,34,0,104,82,248,0,0,0,0,115,133,0,35,136,67,249,24,0,0,27,215,11,0,69,212,218,254,162,0,0,129,84,0,0,0,0,33,205,0,0,0,38,236,0,0,0,0,0,0,0,0,0,0,40,247,
+0,0,0,0,62,226,0,0,0,14,208,127,0,0,0,176,166,1,0,0,20,255,16,0,0,0,10,247,85,13,84,81,0,88,225,242,187,46,0,0,15,116,3,0,0,0,0,0,0,0,111,136,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,192,239,7,0,0,0,0,0,32,253,238,85,0,0,0,0,0,126,197,142,180,0,0,0,0,0,220,106,51,251,23,0,0,0,60,251,20,0,216,113,0,0,0,155,181,0,0,126,208,0,0,9,241,244,232,232,239,255,47,0,
+89,238,30,24,24,24,194,141,0,184,141,0,0,0,0,86,232,4,0,0,0,0,98,37,0,0,0,0,0,0,86,157,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,239,7,0,0,0,0,0,32,253,238,85,0,0,0,0,
+0,126,197,142,180,0,0,0,0,0,220,106,51,251,23,0,0,0,60,251,20,0,216,113,0,0,0,155,181,0,0,126,208,0,0,9,241,244,232,232,239,255,47,0,89,238,30,24,24,24,194,141,0,184,141,0,0,0,0,86,232,4,0,0,
+0,84,109,0,0,0,0,0,0,73,153,107,121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,239,7,0,0,0,0,0,32,253,238,85,0,0,0,0,0,126,197,142,180,0,0,0,0,0,220,106,51,251,23,0,0,0,60,251,
+20,0,216,113,0,0,0,155,181,0,0,126,208,0,0,9,241,244,232,232,239,255,47,0,89,238,30,24,24,24,194,141,0,184,141,0,0,0,0,86,232,4,0,0,109,218,43,185,1,0,0,0,0,165,35,169,128,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,192,239,7,0,0,0,0,0,32,253,238,85,0,0,0,0,0,126,197,142,180,0,0,0,0,0,220,106,51,251,23,0,0,0,60,251,20,0,216,113,0,0,0,155,181,0,0,126,208,0,0,9,241,244,232,232,
+239,255,47,0,89,238,30,24,24,24,194,141,0,184,141,0,0,0,0,86,232,4,0,0,37,236,37,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,255,35,0,0,0,0,0,0,173,239,127,0,0,0,0,0,17,247,103,220,
+0,0,0,0,0,105,201,7,242,58,0,0,0,0,198,120,0,169,151,0,0,0,36,255,39,0,88,238,6,0,0,130,255,232,232,236,255,82,0,1,222,125,24,24,24,165,175,0,61,246,18,0,0,0,54,249,19,0,0,0,146,232,99,0,
+0,0,0,0,25,255,88,232,0,0,0,0,0,7,235,94,190,0,0,0,0,0,0,145,255,97,0,0,0,0,0,2,227,238,181,0,0,0,0,0,65,253,93,251,20,0,0,0,0,156,189,3,234,106,0,0,0,7,239,102,0,151,196,0,
+0,0,82,251,20,0,64,254,32,0,0,173,253,232,232,233,255,121,0,15,248,92,24,24,24,136,212,0,99,226,3,0,0,0,26,251,46,0,0,0,6,234,246,255,244,244,244,244,80,0,0,0,89,224,41,252,0,0,0,0,0,0,0,0,
+193,128,40,252,0,0,0,0,0,0,0,41,253,32,40,252,0,0,0,0,0,0,0,145,189,0,40,255,240,240,240,240,37,0,9,238,91,0,40,252,0,0,0,0,0,0,97,253,241,240,242,252,0,0,0,0,0,0,201,129,0,0,40,252,
+0,0,0,0,0,48,246,20,0,0,40,255,244,244,244,244,106,0,0,60,187,242,236,196,83,0,66,238,98,15,2,62,160,0,205,113,0,0,0,0,0,16,255,29,0,0,0,0,0,35,255,4,0,0,0,0,0,16,255,29,0,0,0,0,
+0,0,205,112,0,0,0,0,0,0,66,237,96,14,2,58,159,0,0,61,188,255,244,196,83,0,0,0,0,46,134,0,0,0,0,0,12,16,200,0,0,0,0,0,117,246,132,0,0,0,0,83,52,0,0,0,0,0,26,197,21,0,0,0,
+0,0,0,0,0,0,40,255,244,244,244,244,80,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,255,240,240,240,240,37,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,255,
+244,244,244,244,106,0,0,0,40,93,0,0,0,0,13,195,37,0,0,0,0,0,0,0,0,0,40,255,244,244,244,244,80,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,255,240,240,240,240,37,40,252,0,
+0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,255,244,244,244,244,106,0,0,26,128,40,0,0,0,8,178,66,183,18,0,0,0,0,0,0,0,0,40,255,244,244,244,244,80,40,252,0,0,0,0,0,40,252,0,0,
+0,0,0,40,252,0,0,0,0,0,40,255,240,240,240,240,37,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,255,244,244,244,244,106,0,37,232,37,232,0,0,0,0,0,0,0,0,0,40,255,244,244,244,
+244,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,255,240,240,240,198,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,255,244,244,244,244,26,97,35,0,42,190,8,
+0,0,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,0,57,75,24,194,19,0,0,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,252,0,40,
+252,0,0,40,127,20,0,18,182,69,174,5,0,0,0,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,37,236,
+37,232,0,0,0,0,0,0,255,32,0,0,255,32,0,0,255,32,0,0,255,32,0,0,255,32,0,0,255,32,0,0,255,32,0,0,255,32,0,0,255,32,0,40,255,244,244,227,165,42,0,0,40,252,0,1,27,131,241,43,0,40,252,0,
+0,0,0,154,167,0,40,252,0,0,0,0,74,226,78,242,255,240,225,0,0,48,243,0,40,252,0,0,0,0,74,226,0,40,252,0,0,0,0,154,167,0,40,252,0,1,26,127,242,45,0,40,255,244,244,228,166,44,0,0,0,115,201,38,
+144,0,0,0,151,50,185,58,0,0,0,0,0,0,0,0,40,255,154,0,0,40,248,40,253,233,24,0,40,248,40,252,139,134,0,40,248,40,252,27,233,12,40,248,40,252,0,159,114,40,248,40,252,0,42,225,45,248,40,252,0,0,179,134,
+248,40,252,0,0,61,239,248,40,252,0,0,0,199,248,0,0,0,61,214,6,0,0,0,0,0,0,0,134,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,192,243,240,175,38,0,0,64,239,95,11,18,124,234,30,0,203,116,0,
+0,0,0,164,154,17,255,30,0,0,0,0,75,223,36,255,4,0,0,0,0,49,243,17,255,30,0,0,0,0,75,223,0,204,116,0,0,0,0,164,156,0,66,239,94,11,17,124,235,32,0,0,63,194,244,241,177,40,0,0,0,0,0,25,
+225,27,0,0,0,0,0,0,164,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,192,243,240,175,38,0,0,64,239,95,11,18,124,234,30,0,203,116,0,0,0,0,164,154,17,255,30,0,0,0,0,75,223,36,255,4,0,0,0,
+0,49,243,17,255,30,0,0,0,0,75,223,0,204,116,0,0,0,0,164,156,0,66,239,94,11,17,124,235,32,0,0,63,194,244,241,177,40,0,0,0,0,18,215,200,4,0,0,0,0,0,160,74,113,120,0,0,0,0,0,0,0,0,0,
+0,0,0,0,61,192,243,240,175,38,0,0,64,239,95,11,18,124,234,30,0,203,116,0,0,0,0,164,154,17,255,30,0,0,0,0,75,223,36,255,4,0,0,0,0,49,243,17,255,30,0,0,0,0,75,223,0,204,116,0,0,0,0,164,
+156,0,66,239,94,11,17,124,235,32,0,0,63,194,244,241,177,40,0,0,0,0,171,197,22,193,0,0,0,0,13,169,52,182,106,0,0,0,0,0,0,0,0,0,0,0,0,0,61,192,243,240,175,38,0,0,64,239,95,11,18,124,234,30,
+0,203,116,0,0,0,0,164,154,17,255,30,0,0,0,0,75,223,36,255,4,0,0,0,0,49,243,17,255,30,0,0,0,0,75,223,0,204,116,0,0,0,0,164,156,0,66,239,94,11,17,124,235,32,0,0,63,194,244,241,177,40,0,0,
+0,37,232,0,37,232,0,0,0,0,0,0,0,0,0,0,0,0,0,61,192,243,240,175,38,0,0,64,239,95,11,18,124,234,30,0,203,116,0,0,0,0,164,154,17,255,30,0,0,0,0,75,223,36,255,4,0,0,0,0,49,243,17,255,
+30,0,0,0,0,75,223,0,204,116,0,0,0,0,164,156,0,66,239,94,11,17,124,235,32,0,0,63,194,244,241,177,40,0,1,49,0,0,0,0,47,3,33,235,72,0,0,61,236,44,0,62,237,65,54,235,72,0,0,0,71,237,234,81,
+0,0,0,0,41,233,235,49,0,0,0,35,228,96,83,231,43,0,26,224,105,0,0,91,229,34,7,83,0,0,0,0,79,12,0,0,0,0,0,0,0,0,12,0,0,0,57,188,241,234,175,78,189,0,0,61,236,90,9,23,174,255,72,0,
+0,201,114,0,0,26,205,159,154,0,16,254,29,0,11,197,56,62,214,0,33,255,3,2,176,87,0,48,241,0,7,253,25,143,124,0,0,78,223,0,0,197,190,161,0,0,0,170,155,0,0,101,255,101,9,18,128,234,30,0,14,196,82,194,
+239,239,173,37,0,0,0,15,0,0,0,0,0,0,0,0,0,0,6,201,93,0,0,0,0,0,0,31,218,21,0,0,0,0,0,0,0,0,0,0,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,
+40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,35,254,3,0,0,0,45,243,6,252,37,0,0,0,82,210,0,166,178,26,1,41,209,115,0,15,145,224,242,216,117,3,0,0,0,0,140,159,0,0,0,0,0,52,210,10,0,0,
+0,0,0,0,0,0,0,0,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,35,254,3,0,0,0,45,243,6,252,37,0,0,0,82,210,
+0,166,178,26,1,41,209,115,0,15,145,224,242,216,117,3,0,0,0,142,231,96,0,0,0,0,64,183,17,200,32,0,0,0,0,0,0,0,0,0,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,
+40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,35,254,3,0,0,0,45,243,6,252,37,0,0,0,82,210,0,166,178,26,1,41,209,115,0,15,145,224,242,216,117,3,0,0,37,232,37,232,0,0,0,0,0,0,0,0,0,0,
+40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,40,252,0,0,0,0,40,248,35,254,3,0,0,0,45,243,6,252,37,0,0,0,82,210,0,166,178,26,1,41,209,115,
+0,15,145,224,242,216,117,3,0,0,0,0,58,73,0,0,0,0,0,0,25,195,18,0,0,0,0,0,0,0,0,0,0,0,0,14,226,86,0,0,0,135,190,1,0,71,233,19,0,47,240,34,0,0,0,158,163,3,203,112,0,0,0,0,
+16,229,174,198,2,0,0,0,0,0,83,254,40,0,0,0,0,0,0,40,252,0,0,0,0,0,0,0,40,252,0,0,0,0,0,0,0,40,252,0,0,0,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,0,40,252,0,0,0,0,
+40,255,240,236,190,42,40,252,0,4,137,195,40,252,0,0,50,237,40,252,0,4,137,195,40,255,240,236,191,42,40,252,0,0,0,0,40,252,0,0,0,0,0,52,200,241,213,65,0,1,226,102,1,96,233,6,30,254,5,23,139,249,36,40,
+252,4,219,104,3,0,40,252,29,255,23,0,0,40,252,0,183,220,59,0,40,252,0,3,107,237,107,40,252,0,0,0,74,234,40,252,33,12,1,110,206,40,252,105,239,240,196,48,0,24,214,13,0,0,0,0,89,133,0,0,0,0,0,98,
+1,0,0,102,222,242,191,32,0,73,23,7,165,173,0,0,0,0,54,230,0,92,214,242,242,247,13,251,67,1,53,248,21,255,46,9,165,248,0,128,241,224,116,248,0,0,0,49,198,2,0,0,0,181,41,0,0,0,20,81,0,0,0,102,
+222,242,191,32,0,74,24,7,165,173,0,0,0,0,54,230,0,86,206,228,229,247,12,250,60,0,54,248,22,255,48,9,165,248,0,128,241,224,116,248,0,0,56,239,17,0,0,0,174,91,130,0,0,12,83,0,93,0,0,102,222,242,191,32,
+0,73,23,7,165,173,0,0,0,0,54,230,0,92,214,242,242,247,13,251,67,1,53,248,21,255,46,9,165,248,0,128,241,224,116,248,0,14,223,104,162,8,0,55,106,140,157,0,0,0,0,0,0,0,0,102,222,242,191,32,0,73,23,7,
+165,173,0,0,0,0,54,230,0,92,214,242,242,247,13,251,67,1,53,248,21,255,46,9,165,248,0,128,241,224,116,248,0,38,236,38,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,223,242,191,32,0,75,21,8,165,173,0,0,
+0,0,54,230,0,92,214,242,242,247,13,251,67,1,53,248,21,255,46,9,165,248,0,128,241,224,116,248,0,0,134,235,124,0,0,0,246,88,235,0,0,0,134,235,124,0,0,0,0,0,0,0,0,102,222,242,191,32,0,74,26,5,141,173,
+0,0,0,0,22,230,0,88,211,241,240,247,13,251,69,2,22,248,21,255,48,6,144,248,0,124,240,229,104,248,0,101,218,243,213,69,119,229,236,155,9,0,33,8,1,107,252,169,16,15,185,132,0,66,205,241,242,255,24,0,0,61,216,4,
+236,98,4,47,255,240,240,240,241,237,30,255,5,0,85,255,16,0,0,0,0,9,247,73,17,202,222,163,20,1,31,70,0,98,234,234,120,17,159,236,242,211,104,0,13,153,230,238,156,0,163,180,19,6,59,6,252,37,0,0,0,31,255,4,
+0,0,0,6,252,36,0,0,0,0,162,178,19,6,59,0,14,157,236,255,154,0,0,0,0,190,19,0,0,9,4,173,75,0,0,50,244,219,25,0,0,141,141,0,0,0,0,0,0,150,98,0,0,0,0,0,0,0,0,0,0,9,144,227,
+232,148,8,0,152,175,17,16,187,131,4,250,29,0,0,63,216,30,255,216,216,216,219,226,5,251,22,0,0,0,0,0,153,167,21,1,29,71,0,9,137,223,242,213,107,0,0,0,0,154,128,0,0,0,0,110,139,0,0,0,0,0,0,0,
+0,0,0,9,144,227,232,147,7,0,152,172,16,15,185,127,4,250,27,0,0,61,215,30,255,240,240,240,241,237,5,251,19,0,0,0,0,0,153,164,20,1,29,71,0,9,137,223,242,213,107,0,0,5,192,188,3,0,0,0,135,85,93,130,
+0,0,0,0,0,0,0,0,0,9,144,227,232,147,7,0,152,172,16,15,185,127,4,250,27,0,0,61,215,30,255,240,240,240,241,237,5,251,19,0,0,0,0,0,153,164,20,1,29,71,0,9,137,223,242,213,107,0,3,236,0,38,236,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,144,227,231,147,7,0,152,175,19,10,163,127,4,250,28,0,0,30,215,30,255,240,240,240,240,237,5,251,19,0,0,0,0,0,153,164,20,1,29,72,0,9,137,223,242,214,110,62,
+212,9,0,0,117,145,0,0,0,110,11,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,32,223,31,1,189,70,0,34,86,0,0,40,252,0,0,40,252,0,0,40,252,0,0,40,
+252,0,0,40,252,0,0,40,252,0,0,40,252,0,0,0,86,249,45,0,8,202,69,185,0,43,63,0,85,23,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,0,0,40,252,0,
+0,38,240,0,213,30,0,0,0,0,0,0,0,0,0,0,0,4,248,0,0,0,4,248,0,0,0,4,248,0,0,0,4,248,0,0,0,4,248,0,0,0,4,248,0,0,0,4,248,0,0,0,0,148,196,49,137,45,0,24,117,248,220,42,
+0,0,65,69,25,226,104,0,0,13,159,237,248,247,39,0,160,183,21,5,170,155,6,252,38,0,0,74,223,30,255,4,0,0,48,239,5,251,36,0,0,82,207,0,159,175,14,28,208,105,0,13,156,233,226,123,2,0,8,218,120,146,27,0,
+45,112,130,173,0,0,0,0,0,0,0,40,252,104,235,220,54,40,255,136,5,132,193,40,255,17,0,49,237,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,0,2,164,120,0,0,0,0,0,3,165,
+84,0,0,0,0,0,0,0,0,0,0,16,162,234,227,133,4,0,168,175,14,28,208,117,7,253,35,0,0,82,211,31,255,4,0,0,48,238,7,253,35,0,0,81,211,0,169,172,13,27,206,118,0,18,164,235,228,135,5,0,0,0,1,170,
+117,0,0,0,0,132,121,0,0,0,0,0,0,0,0,0,0,16,162,234,227,133,4,0,168,175,14,28,208,117,7,253,35,0,0,82,211,31,255,4,0,0,48,238,7,253,35,0,0,81,211,0,169,172,13,27,206,118,0,18,164,235,228,135,
+5,0,0,13,203,180,1,0,0,0,160,68,106,120,0,0,0,0,0,0,0,0,0,16,162,234,227,133,4,0,168,175,14,28,208,117,7,253,35,0,0,82,211,31,255,4,0,0,48,238,7,253,35,0,0,81,211,0,169,172,13,27,206,118,
+0,18,164,235,228,135,5,0,0,170,213,28,193,0,0,5,172,52,198,109,0,0,0,0,0,0,0,0,0,16,162,234,227,133,4,0,168,175,14,28,208,117,7,253,35,0,0,82,211,31,255,4,0,0,48,238,7,253,35,0,0,81,211,0,
+169,172,13,27,206,118,0,18,164,235,228,135,5,0,3,236,0,38,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,162,234,226,133,4,0,168,179,17,20,190,117,7,253,37,0,0,51,211,31,255,4,0,0,16,238,7,253,
+36,0,0,50,211,0,169,176,16,19,187,118,0,18,164,235,227,135,5,0,0,38,236,0,0,0,0,0,0,0,0,0,0,0,0,240,240,240,240,240,240,240,240,0,0,0,0,0,0,0,0,0,0,37,232,0,0,0,0,0,0,0,0,0,
+0,39,1,0,16,161,233,232,147,194,9,0,168,173,12,56,254,129,0,7,253,37,6,186,116,214,0,32,255,2,156,86,47,239,0,10,253,136,133,0,83,211,0,0,176,226,12,28,208,119,0,30,193,167,237,227,135,5,0,10,31,0,0,0,
+0,0,0,0,33,213,9,0,0,0,0,101,126,0,0,0,0,0,100,0,0,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,29,255,6,0,61,248,4,237,88,9,171,248,0,90,233,225,111,248,0,
+0,0,53,197,2,0,0,0,186,38,0,0,0,24,77,0,0,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,29,255,6,0,61,248,4,237,88,9,171,248,0,90,233,225,111,248,0,0,65,237,15,
+0,0,0,182,92,127,0,0,19,77,0,93,0,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,29,255,6,0,61,248,4,237,88,9,171,248,0,90,233,225,111,248,0,38,236,38,236,0,0,0,0,
+0,0,0,0,0,0,0,0,0,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,40,252,0,0,40,248,29,255,6,0,61,248,4,237,88,9,171,248,0,90,233,225,111,248,0,0,0,0,107,37,0,0,0,0,119,147,0,
+0,0,0,12,106,1,0,0,117,173,0,0,0,147,144,25,245,16,0,4,234,51,0,183,101,0,76,214,0,0,88,193,0,168,121,0,0,8,239,44,244,30,0,0,0,155,210,190,0,0,0,0,60,255,97,0,0,0,0,30,246,14,0,0,
+0,2,144,158,0,0,0,11,244,213,29,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,98,228,235,143,5,40,255,171,14,26,206,119,40,255,35,0,0,80,212,40,255,4,0,0,48,239,40,
+255,35,0,0,80,212,40,255,169,13,25,204,121,40,252,98,228,236,146,6,40,252,0,0,0,0,0,40,252,0,0,0,0,0,40,252,0,0,0,0,0,0,38,240,38,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,110,177,
+0,0,0,225,63,21,243,14,0,53,229,2,0,179,91,0,137,144,0,0,86,176,0,220,56,0,0,8,232,61,224,0,0,0,0,156,214,137,0,0,0,0,63,255,49,0,0,0,0,34,218,0,0,0,0,2,145,122,0,0,0,3,244,204,
+15,0,0,0,
+    };
+    static const signed char asciiKerning12[128 * 128] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,0,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+-1,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,0,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,1,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,-1,-1,-2,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,-1,0,0,-1,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,1,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,1,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,1,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,1,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,1,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,1,1,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,1,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,-1,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,0,-1,0,0,0,0,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-2,-1,0,0,0,0,
+-1,-2,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,-1,-1,0,0,0,0,0,-1,0,0,-1,0,0,0,-2,0,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,-1,0,-1,-1,-1,0,-1,0,0,0,-2,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,0,-1,-1,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+-1,-1,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,-1,-1,-1,0,-1,0,-1,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,-1,0,0,0,-1,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,1,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,-1,0,-1,-1,0,-1,0,1,0,0,0,0,0,0,1,0,0,0,1,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,-1,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,-1,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,-1,0,-1,-1,-1,0,0,-1,0,0,0,0,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,1,0,1,0,1,1,1,1,0,0,1,0,0,0,1,0,0,0,0,0,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,0,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,1,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,0,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,1,
+0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,-2,0,-2,1,0,0,0,0,0,0,0,0,-2,0,0,-1,-2,0,-2,0,-2,0,-2,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,1,
+0,-1,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,1,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,-1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,-1,1,1,1,0,1,1,0,1,1,1,1,-1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,1,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,-2,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,1,
+0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,-2,1,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,-1,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,0,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,0,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,-1,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,-1,0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,0,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,-1,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,0,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,0,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,1,1,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,1,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+-1,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,1,0,1,0,0,0,0,0,0,1,0,0,0,1,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,1,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+    };
+
+    static const GlyphMetrics metrics13[256] = {
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {4, 0, 0, 3},
+        {5, 11, 0, 4},
+        {5, 29, -17, 5},
+        {11, 0, 7, 6},
+        {8, 18, -6, 7},
+        {13, -5, 17, 8},
+        {10, 1, -22, 9},
+        {3, 29, -18, 10},
+        {5, 21, 16, 11},
+        {5, -5, -10, 12},
+        {7, 6, 5, 13},
+        {10, 24, -24, 14},
+        {4, -17, -19, 15},
+        {5, -23, 24, 16},
+        {4, -26, -27, 17},
+        {4, 0, -24, 18},
+        {8, 0, 0, 19},
+        {8, 0, 0, 20},
+        {8, 0, 0, 21},
+        {8, 0, 0, 22},
+        {8, 0, 0, 23},
+        {8, 0, 0, 24},
+        {8, 0, 0, 25},
+        {8, 0, 0, 26},
+        {8, 0, 0, 27},
+        {8, 0, 0, 28},
+        {5, -17, 29, 29},
+        {5, -17, 29, 30},
+        {10, 24, -24, 31},
+        {10, 24, -24, 32},
+        {10, 24, -24, 33},
+        {7, -20, 5, 34},
+        {13, 4, 5, 35},
+        {9, 0, 7, 36},
+        {8, 31, 4, 37},
+        {9, -4, 0, 38},
+        {10, 31, 14, 39},
+        {8, 31, 20, 40},
+        {7, 31, 3, 41},
+        {10, -4, -6, 42},
+        {9, 31, -19, 43},
+        {3, 31, -19, 44},
+        {4, -22, -19, 45},
+        {8, 31, 0, 46},
+        {7, 31, 18, 47},
+        {10, 31, -18, 48},
+        {9, 31, -18, 49},
+        {10, -4, 16, 50},
+        {8, 31, 34, 51},
+        {10, -4, 16, 52},
+        {9, 31, 22, 53},
+        {8, 4, 17, 54},
+        {8, 6, -5, 55},
+        {9, 21, -9, 56},
+        {9, 0, 7, 57},
+        {13, 0, 9, 58},
+        {9, 0, 6, 59},
+        {8, -30, -23, 60},
+        {10, -27, 17, 61},
+        {5, 21, 11, 62},
+        {4, 0, -24, 63},
+        {5, -1, -10, 64},
+        {11, 0, 7, 65},
+        {7, 0, 32, 66},
+        {7, 0, 32, 67},
+        {8, -1, -13, 68},
+        {8, 25, 18, 69},
+        {7, -5, -6, 70},
+        {8, -5, -12, 71},
+        {8, -5, 19, 72},
+        {5, -24, -1, 73},
+        {8, -5, -12, 74},
+        {8, 25, -7, 75},
+        {3, 27, -16, 76},
+        {3, 27, -16, 77},
+        {7, 25, -13, 78},
+        {3, 27, -16, 79},
+        {13, 25, -7, 80},
+        {8, 25, -7, 81},
+        {8, -5, 18, 82},
+        {8, 25, 18, 83},
+        {8, -5, -12, 84},
+        {5, 25, -1, 85},
+        {7, -3, 23, 86},
+        {5, 26, 16, 87},
+        {8, 20, -12, 88},
+        {8, 0, 20, 89},
+        {11, 0, 24, 90},
+        {8, 0, 20, 91},
+        {8, 0, 20, 92},
+        {7, -28, -4, 93},
+        {9, -13, 31, 94},
+        {5, -9, 21, 95},
+        {9, -19, 24, 96},
+        {10, 24, -24, 97},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {8, 0, 13, 0},
+        {4, 0, 0, 98},
+        {5, 11, 0, 99},
+        {8, 19, -21, 100},
+        {8, -12, -17, 101},
+        {8, -23, -28, 102},
+        {9, -19, 31, 103},
+        {5, -9, 21, 104},
+        {7, -14, 25, 105},
+        {7, -28, -24, 106},
+        {13, 0, 12, 107},
+        {7, -24, 14, 108},
+        {8, 0, 18, 109},
+        {11, -22, -26, 110},
+        {5, -23, 24, 111},
+        {13, 0, 12, 112},
+        {7, 0, 32, 113},
+        {6, 28, -16, 114},
+        {10, 24, -24, 115},
+        {5, 18, 16, 116},
+        {5, 31, 28, 117},
+        {7, 0, 32, 118},
+        {8, 20, -14, 119},
+        {8, 13, -27, 120},
+        {4, -26, -27, 121},
+        {7, 0, 32, 122},
+        {5, 11, 6, 123},
+        {6, 32, 32, 124},
+        {8, 14, 32, 125},
+        {12, 31, -18, 126},
+        {12, 31, 8, 127},
+        {13, -13, -18, 128},
+        {7, 7, 29, 129},
+        {9, 0, 7, 130},
+        {9, 0, 7, 131},
+        {9, 0, 7, 132},
+        {9, 0, 7, 133},
+        {10, -15, 27, 134},
+        {9, -6, 18, 135},
+        {13, -5, 21, 136},
+        {9, -4, 0, 137},
+        {8, 31, 20, 138},
+        {8, 31, 20, 139},
+        {8, 31, 20, 140},
+        {8, 31, -6, 141},
+        {3, 31, -19, 142},
+        {3, 31, -19, 143},
+        {3, 31, -19, 144},
+        {6, -41, 54, 145},
+        {11, -29, 14, 146},
+        {9, 31, -18, 147},
+        {10, -4, 16, 148},
+        {10, -4, 16, 149},
+        {10, -4, 16, 150},
+        {10, -4, 16, 151},
+        {10, -4, 16, 152},
+        {11, 0, 7, 153},
+        {10, -4, 16, 154},
+        {9, 21, -9, 155},
+        {9, 21, -9, 156},
+        {9, 21, -9, 157},
+        {9, 21, -9, 158},
+        {8, -30, -23, 159},
+        {8, 31, 33, 160},
+        {8, 25, 25, 161},
+        {8, -1, -13, 162},
+        {8, -1, -13, 163},
+        {8, -1, -13, 164},
+        {8, -1, -13, 165},
+        {8, -1, -13, 166},
+        {8, -1, -13, 167},
+        {13, -1, 19, 168},
+        {7, -5, -6, 169},
+        {8, -5, 19, 170},
+        {8, -5, 19, 171},
+        {8, -5, 19, 172},
+        {8, -5, 19, 173},
+        {3, 27, -16, 174},
+        {3, 27, -16, 175},
+        {3, 27, -16, 176},
+        {4, 16, 30, 177},
+        {8, -5, 18, 178},
+        {8, 25, -7, 179},
+        {8, -5, 18, 180},
+        {8, -5, 18, 181},
+        {8, -5, 18, 182},
+        {8, -5, 18, 183},
+        {8, -5, 18, 184},
+        {10, 24, -24, 185},
+        {8, -5, 18, 186},
+        {8, 20, -12, 187},
+        {8, 20, -12, 188},
+        {8, 20, -12, 189},
+        {8, 20, -12, 190},
+        {8, 0, 20, 191},
+        {8, 25, 18, 192},
+        {8, 11, 2, 193},
+    };
+    static const GlyphBitmap glyphs13[] = {
+        {32, 0, 0, 0, 0, 0},
+        {33, 1, -9, 3, 9, 0},
+        {34, 0, -9, 5, 3, 27},
+        {35, 1, -9, 9, 9, 42},
+        {36, 0, -10, 8, 12, 123},
+        {37, 0, -9, 13, 9, 219},
+        {38, 0, -9, 10, 9, 336},
+        {39, 0, -9, 3, 3, 426},
+        {40, 0, -10, 4, 11, 435},
+        {41, 1, -10, 4, 11, 479},
+        {42, 0, -9, 7, 5, 523},
+        {43, 1, -8, 8, 8, 558},
+        {44, 1, -2, 3, 3, 622},
+        {45, 1, -4, 3, 1, 631},
+        {46, 1, -1, 3, 1, 634},
+        {47, 0, -9, 5, 11, 637},
+        {48, 0, -9, 8, 9, 692},
+        {49, 1, -9, 6, 9, 764},
+        {50, 1, -9, 7, 9, 818},
+        {51, 0, -9, 8, 9, 881},
+        {52, 0, -9, 8, 9, 953},
+        {53, 1, -9, 7, 9, 1025},
+        {54, 0, -9, 8, 9, 1088},
+        {55, 1, -9, 6, 9, 1160},
+        {56, 0, -9, 8, 9, 1214},
+        {57, 0, -9, 8, 9, 1286},
+        {58, 1, -6, 3, 6, 1358},
+        {59, 1, -7, 3, 8, 1376},
+        {60, 1, -8, 8, 8, 1400},
+        {61, 1, -6, 8, 4, 1464},
+        {62, 1, -8, 8, 8, 1496},
+        {63, 1, -9, 6, 9, 1560},
+        {64, 0, -9, 13, 11, 1614},
+        {65, 0, -9, 9, 9, 1757},
+        {66, 0, -9, 8, 9, 1838},
+        {67, 0, -9, 9, 9, 1910},
+        {68, 0, -9, 10, 9, 1991},
+        {69, 0, -9, 7, 9, 2081},
+        {70, 0, -9, 7, 9, 2144},
+        {71, 0, -9, 10, 9, 2207},
+        {72, 0, -9, 9, 9, 2297},
+        {73, 0, -9, 3, 9, 2378},
+        {74, -1, -9, 5, 12, 2405},
+        {75, 0, -9, 9, 9, 2465},
+        {76, 0, -9, 7, 9, 2546},
+        {77, 0, -9, 10, 9, 2609},
+        {78, 0, -9, 9, 9, 2699},
+        {79, 0, -9, 10, 9, 2780},
+        {80, 0, -9, 8, 9, 2870},
+        {81, 0, -9, 10, 11, 2942},
+        {82, 0, -9, 9, 9, 3052},
+        {83, 0, -9, 8, 9, 3133},
+        {84, 0, -9, 8, 9, 3205},
+        {85, 0, -9, 9, 9, 3277},
+        {86, 0, -9, 9, 9, 3358},
+        {87, 0, -9, 13, 9, 3439},
+        {88, 0, -9, 9, 9, 3556},
+        {89, 0, -9, 9, 9, 3637},
+        {90, 1, -9, 8, 9, 3718},
+        {91, 0, -10, 4, 11, 3790},
+        {92, 0, -9, 5, 11, 3834},
+        {93, 1, -10, 4, 11, 3889},
+        {94, 1, -10, 9, 4, 3933},
+        {95, -1, 2, 8, 1, 3969},
+        {96, 1, -11, 4, 3, 3977},
+        {97, 0, -7, 8, 7, 3989},
+        {98, 0, -10, 8, 10, 4045},
+        {99, 0, -7, 7, 7, 4125},
+        {100, 0, -10, 8, 10, 4174},
+        {101, 0, -7, 8, 7, 4254},
+        {102, 0, -10, 6, 10, 4310},
+        {103, 0, -7, 8, 10, 4370},
+        {104, 0, -10, 8, 10, 4450},
+        {105, 0, -10, 3, 10, 4530},
+        {106, -1, -10, 4, 13, 4560},
+        {107, 0, -10, 8, 10, 4612},
+        {108, 0, -10, 3, 10, 4692},
+        {109, 0, -7, 13, 7, 4722},
+        {110, 0, -7, 8, 7, 4813},
+        {111, 0, -7, 8, 7, 4869},
+        {112, 0, -7, 8, 10, 4925},
+        {113, 0, -7, 8, 10, 5005},
+        {114, 0, -8, 6, 8, 5085},
+        {115, 0, -7, 7, 7, 5133},
+        {116, -1, -9, 6, 9, 5182},
+        {117, 0, -7, 8, 7, 5236},
+        {118, 0, -7, 8, 7, 5292},
+        {119, 0, -7, 11, 7, 5348},
+        {120, 0, -7, 8, 7, 5425},
+        {121, 0, -7, 8, 10, 5481},
+        {122, 1, -7, 6, 7, 5561},
+        {123, 1, -10, 6, 12, 5603},
+        {124, 1, -10, 3, 13, 5675},
+        {125, 1, -10, 6, 12, 5714},
+        {126, 1, -6, 8, 4, 5786},
+        {160, 0, 0, 0, 0, 5818},
+        {161, 1, -9, 3, 9, 5818},
+        {162, 0, -9, 7, 11, 5845},
+        {163, 1, -9, 6, 9, 5922},
+        {164, 0, -7, 8, 7, 5976},
+        {165, 0, -9, 8, 9, 6032},
+        {166, 1, -9, 3, 11, 6104},
+        {167, 0, -9, 7, 11, 6137},
+        {168, 1, -9, 6, 1, 6214},
+        {169, 1, -9, 11, 9, 6220},
+        {170, 1, -9, 5, 6, 6319},
+        {171, 1, -7, 6, 7, 6349},
+        {172, 1, -5, 10, 4, 6391},
+        {173, 1, -4, 3, 1, 6431},
+        {174, 1, -9, 11, 9, 6434},
+        {175, 1, -9, 5, 1, 6533},
+        {176, 0, -9, 6, 4, 6538},
+        {177, 1, -8, 8, 8, 6562},
+        {178, 0, -9, 4, 5, 6626},
+        {179, 0, -9, 4, 5, 6646},
+        {180, 2, -11, 4, 3, 6666},
+        {181, 0, -7, 8, 10, 6678},
+        {182, 0, -9, 8, 11, 6758},
+        {183, 1, -5, 3, 1, 6846},
+        {184, 1, 0, 3, 3, 6849},
+        {185, 0, -9, 5, 5, 6858},
+        {186, 0, -9, 5, 6, 6883},
+        {187, 1, -7, 6, 7, 6913},
+        {188, 0, -10, 12, 10, 6955},
+        {189, 0, -10, 12, 10, 7075},
+        {190, 0, -9, 13, 9, 7195},
+        {191, 0, -9, 6, 9, 7312},
+        {192, 0, -12, 9, 12, 7366},
+        {193, 0, -12, 9, 12, 7474},
+        {194, 0, -12, 9, 12, 7582},
+        {195, 0, -12, 9, 12, 7690},
+        {196, 0, -11, 10, 11, 7798},
+        {197, 0, -12, 9, 12, 7908},
+        {198, 0, -9, 12, 9, 8016},
+        {199, 0, -9, 9, 12, 8124},
+        {200, 0, -12, 7, 12, 8232},
+        {201, 0, -12, 7, 12, 8316},
+        {202, 0, -12, 7, 12, 8400},
+        {203, 0, -11, 8, 11, 8484},
+        {204, -1, -12, 4, 12, 8572},
+        {205, 0, -12, 3, 12, 8620},
+        {206, -1, -12, 5, 12, 8656},
+        {207, 0, -11, 6, 11, 8716},
+        {208, 0, -9, 11, 9, 8782},
+        {209, 0, -12, 9, 12, 8881},
+        {210, 0, -12, 10, 12, 8989},
+        {211, 0, -12, 10, 12, 9109},
+        {212, 0, -12, 10, 12, 9229},
+        {213, 0, -12, 10, 12, 9349},
+        {214, 0, -11, 10, 11, 9469},
+        {215, 1, -8, 9, 8, 9579},
+        {216, 0, -10, 10, 11, 9651},
+        {217, 0, -12, 9, 12, 9761},
+        {218, 0, -12, 9, 12, 9869},
+        {219, 0, -12, 9, 12, 9977},
+        {220, 0, -11, 9, 11, 10085},
+        {221, 0, -12, 9, 12, 10184},
+        {222, 0, -9, 8, 9, 10292},
+        {223, 0, -10, 8, 10, 10364},
+        {224, 0, -10, 8, 10, 10444},
+        {225, 0, -10, 8, 10, 10524},
+        {226, 0, -10, 8, 10, 10604},
+        {227, 0, -10, 8, 10, 10684},
+        {228, 0, -10, 8, 10, 10764},
+        {229, 0, -11, 8, 11, 10844},
+        {230, 0, -7, 13, 7, 10932},
+        {231, 0, -7, 7, 10, 11023},
+        {232, 0, -10, 8, 10, 11093},
+        {233, 0, -10, 8, 10, 11173},
+        {234, 0, -10, 8, 10, 11253},
+        {235, 0, -10, 8, 10, 11333},
+        {236, -1, -10, 4, 10, 11413},
+        {237, 0, -10, 4, 10, 11453},
+        {238, -1, -10, 5, 10, 11493},
+        {239, -1, -10, 5, 10, 11543},
+        {240, 0, -10, 8, 10, 11593},
+        {241, 0, -10, 8, 10, 11673},
+        {242, 0, -10, 8, 10, 11753},
+        {243, 0, -10, 8, 10, 11833},
+        {244, 0, -10, 8, 10, 11913},
+        {245, 0, -10, 8, 10, 11993},
+        {246, 0, -10, 8, 10, 12073},
+        {247, 1, -7, 8, 5, 12153},
+        {248, 0, -8, 8, 9, 12193},
+        {249, 0, -10, 8, 10, 12265},
+        {250, 0, -10, 8, 10, 12345},
+        {251, 0, -10, 8, 10, 12425},
+        {252, 0, -10, 8, 10, 12505},
+        {253, 0, -10, 8, 13, 12585},
+        {254, 0, -10, 8, 13, 12689},
+        {255, 0, -10, 8, 13, 12793},
+    };
+    static const unsigned char pixels13[] = {
+52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,0,0,0,0,0,0,49,244,7,52,255,60,255,4,52,255,60,255,4,52,255,60,255,4,0,0,0,112,147,0,144,116,0,0,0,0,167,92,0,199,62,0,0,0,0,223,
+37,6,245,11,0,63,240,241,254,240,243,252,240,213,0,0,96,168,0,127,136,0,0,0,0,161,102,0,191,70,0,0,240,240,254,242,241,254,241,240,41,0,44,215,0,76,186,0,0,0,0,127,133,0,159,102,0,0,0,0,0,52,255,4,
+0,0,0,0,0,52,255,4,0,0,0,0,121,235,255,235,205,70,0,23,254,119,255,11,51,46,0,40,255,79,255,4,0,0,0,2,198,227,255,101,31,0,0,0,6,111,255,173,245,115,0,0,0,52,255,4,86,241,0,30,56,52,255,8,
+138,213,0,25,190,232,255,231,189,45,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,103,234,223,65,0,0,7,217,77,0,0,0,16,249,65,111,215,0,0,130,159,0,0,0,0,43,255,13,58,250,0,42,219,15,0,0,
+0,0,11,242,66,113,205,1,194,68,0,0,0,0,0,0,78,203,192,48,102,149,51,180,194,164,27,0,0,0,0,0,24,203,19,233,82,0,132,190,0,0,0,0,0,167,60,40,255,12,0,61,247,0,0,0,0,74,139,0,11,243,99,3,
+144,205,0,0,0,11,182,8,0,0,73,214,243,198,45,0,0,0,87,215,243,225,119,0,0,0,0,22,252,84,0,22,62,0,0,0,0,21,250,45,0,0,0,0,0,0,0,6,199,224,40,0,0,0,0,0,0,162,168,80,231,63,0,0,
+204,103,26,254,31,0,68,238,92,24,243,28,29,255,38,0,0,60,240,212,145,0,0,189,194,37,1,39,191,255,134,0,0,16,143,225,242,210,116,54,239,118,52,255,8,52,255,8,52,255,8,0,0,156,111,0,45,229,6,0,155,137,0,1,
+233,68,0,29,255,26,0,46,255,12,0,29,255,26,0,1,234,68,0,0,156,136,0,0,46,228,6,0,0,156,111,157,111,0,0,30,237,14,0,0,185,110,0,0,116,190,0,0,71,240,0,0,57,255,2,0,71,240,0,0,115,191,0,0,
+184,111,0,29,237,15,0,155,112,0,0,1,0,52,255,8,0,1,90,149,89,255,64,160,60,0,31,217,255,190,14,0,89,149,89,255,64,159,59,1,0,52,255,8,0,1,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,
+0,52,255,4,0,0,0,0,0,52,255,4,0,0,240,240,240,243,255,240,240,240,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,52,255,8,83,206,0,153,82,0,244,244,244,49,244,7,0,0,0,
+220,55,0,0,45,229,1,0,0,125,150,0,0,0,206,70,0,0,30,239,5,0,0,110,165,0,0,0,191,85,0,0,19,244,12,0,0,96,180,0,0,0,176,100,0,0,0,118,20,0,0,0,0,10,160,241,234,128,0,0,0,149,198,19,
+36,226,98,0,4,243,74,0,0,119,197,0,37,255,27,0,0,72,243,0,49,255,12,0,0,57,255,1,37,255,26,0,0,71,243,0,4,243,73,0,0,118,198,0,0,150,196,18,35,225,98,0,0,10,161,242,235,129,0,0,27,182,238,255,
+4,0,25,101,92,255,4,0,0,0,52,255,4,0,0,0,52,255,4,0,0,0,52,255,4,0,0,0,52,255,4,0,0,0,52,255,4,0,0,8,58,255,11,8,0,255,255,255,255,255,137,213,243,229,157,19,0,134,50,5,19,177,181,0,
+0,0,0,0,67,245,0,0,0,0,0,134,199,0,0,0,0,77,243,53,0,0,0,80,238,68,0,0,0,94,237,60,0,0,0,109,237,54,0,0,0,0,255,251,244,244,244,244,3,7,189,231,242,231,168,31,0,3,48,8,0,11,135,207,
+0,0,0,0,0,13,134,248,1,0,0,168,244,255,253,119,0,0,0,0,1,44,165,58,0,0,0,0,0,0,75,223,0,0,0,0,0,0,79,247,1,51,74,11,2,47,211,174,0,54,201,242,243,221,141,14,0,0,0,0,12,221,255,8,
+0,0,0,0,157,183,255,8,0,0,0,81,207,57,255,8,0,0,24,228,45,52,255,8,0,0,182,119,0,52,255,8,0,106,197,3,0,52,255,8,0,180,244,236,236,240,255,236,92,19,28,28,28,74,255,35,10,0,0,0,0,52,255,8,
+0,52,255,244,244,244,87,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,229,227,150,13,0,20,44,2,37,205,157,0,0,0,0,0,76,238,0,0,0,0,0,75,237,0,69,25,0,36,204,156,0,130,231,246,225,143,12,0,
+0,0,93,215,245,224,79,0,0,91,218,52,2,23,34,0,0,222,78,0,0,0,0,0,30,255,111,222,230,159,17,0,48,255,160,13,24,196,163,0,36,255,28,0,0,73,239,0,4,242,27,0,0,73,238,0,0,146,158,10,21,193,159,0,
+0,8,155,238,234,157,14,0,244,244,244,244,250,242,0,0,0,0,188,152,0,0,0,34,254,50,0,0,0,134,204,0,0,0,4,231,102,0,0,0,81,243,12,0,0,0,183,154,0,0,0,30,253,52,0,0,0,129,206,0,0,0,0,62,
+197,240,234,173,31,0,12,243,123,5,13,162,198,0,38,255,19,0,0,64,247,0,0,172,127,7,16,165,158,0,0,69,229,252,255,187,8,0,14,245,129,8,16,165,173,0,41,255,20,0,0,64,247,0,6,234,125,5,13,163,201,0,0,55,
+194,239,237,181,37,0,0,32,179,238,231,123,0,0,1,206,158,10,21,194,94,0,31,255,27,0,0,72,196,0,32,255,28,0,0,73,242,0,1,212,160,12,25,195,255,1,0,37,182,235,212,125,237,0,0,0,0,0,0,125,175,0,0,43,
+13,5,74,233,51,0,0,118,235,245,203,65,0,0,48,240,7,0,0,0,0,0,0,0,0,0,0,0,0,49,244,7,48,240,7,0,0,0,0,0,0,0,0,0,0,0,0,52,255,8,83,206,0,153,82,0,0,0,0,0,0,0,0,25,
+0,0,0,0,14,95,186,244,0,6,78,169,242,184,94,13,153,236,196,107,21,0,0,0,197,239,149,60,1,0,0,0,0,33,123,213,226,140,52,0,0,0,0,0,48,138,227,219,0,0,0,0,0,0,1,63,240,240,240,240,240,240,240,240,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,244,244,244,244,244,244,244,25,0,0,0,0,0,0,0,244,186,95,13,0,0,0,0,13,95,185,243,169,78,6,0,0,0,0,22,108,198,236,152,0,0,0,1,61,150,240,198,
+0,52,140,227,212,123,33,0,219,226,138,48,0,0,0,0,63,1,0,0,0,0,0,0,96,211,242,207,54,0,117,45,3,133,217,0,0,0,0,73,241,0,0,0,11,206,151,0,0,0,175,195,7,0,0,29,255,34,0,0,0,51,255,8,
+0,0,0,4,24,0,0,0,0,49,244,7,0,0,0,0,0,36,148,216,239,224,164,56,0,0,0,0,0,97,239,130,36,3,17,95,226,131,0,0,0,67,245,55,0,0,0,0,0,27,231,84,0,0,203,129,0,78,219,218,117,248,3,111,
+204,0,22,255,42,11,242,99,5,149,255,4,62,248,0,46,255,14,42,255,12,0,61,255,4,91,227,0,25,255,40,11,242,97,4,144,255,42,217,108,0,0,212,128,0,78,220,221,128,228,187,75,0,0,0,78,244,52,0,0,0,0,0,4,
+0,0,0,0,0,113,241,117,29,2,32,142,176,0,0,0,0,0,0,52,166,226,241,210,126,14,0,0,0,0,0,0,124,255,94,0,0,0,0,0,2,223,237,197,0,0,0,0,0,73,251,75,255,44,0,0,0,0,176,178,0,208,146,0,
+0,0,26,251,80,0,110,239,9,0,0,125,233,4,0,18,248,96,0,2,225,249,232,232,232,251,198,0,74,253,51,24,24,24,70,255,45,177,173,0,0,0,0,0,198,148,52,255,244,244,238,184,39,0,52,255,8,0,9,153,206,0,52,255,
+8,0,0,63,249,0,52,255,8,0,12,155,190,0,52,255,240,240,254,230,37,0,52,255,8,0,11,153,189,0,52,255,8,0,0,63,249,0,52,255,8,0,8,151,204,0,52,255,244,244,238,182,38,0,0,0,51,176,236,242,217,137,19,0,
+63,243,121,24,0,30,137,72,0,211,134,0,0,0,0,0,0,26,255,44,0,0,0,0,0,0,47,255,17,0,0,0,0,0,0,27,255,44,0,0,0,0,0,0,0,211,133,0,0,0,0,0,0,0,64,242,118,23,0,28,133,71,0,0,
+51,177,237,242,217,136,18,52,255,244,242,240,207,136,23,0,0,52,255,8,0,3,47,162,233,34,0,52,255,8,0,0,0,1,186,167,0,52,255,8,0,0,0,0,92,235,0,52,255,8,0,0,0,0,62,253,0,52,255,8,0,0,0,0,
+93,235,0,52,255,8,0,0,0,0,185,166,0,52,255,8,0,2,45,159,233,35,0,52,255,244,242,240,208,138,23,0,0,52,255,244,244,244,244,179,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,240,
+240,240,240,131,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,244,244,244,244,205,52,255,244,244,244,244,45,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,240,240,
+240,187,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,0,0,47,170,233,244,225,177,70,0,0,62,242,127,28,1,13,83,152,0,0,210,134,0,0,0,0,0,0,0,27,255,44,
+0,0,0,0,0,0,0,47,255,17,0,0,82,240,241,248,3,27,255,44,0,0,0,0,52,255,4,0,212,134,0,0,0,0,52,255,4,0,65,243,126,27,1,10,110,255,4,0,0,49,172,234,244,224,177,68,0,52,255,8,0,0,0,52,
+255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,240,240,240,240,243,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,
+4,52,255,8,0,0,0,52,255,4,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,0,0,52,255,8,0,0,52,255,8,0,0,52,255,8,0,0,52,255,8,0,0,52,255,8,0,0,
+52,255,8,0,0,52,255,8,0,0,52,255,8,0,0,52,255,7,0,0,67,242,0,0,5,158,185,0,49,241,192,38,0,52,255,8,0,0,80,243,100,0,52,255,8,0,104,242,76,0,0,52,255,8,131,235,56,0,0,0,52,255,165,222,
+38,0,0,0,0,52,255,241,150,0,0,0,0,0,52,255,55,234,150,1,0,0,0,52,255,8,40,228,160,3,0,0,52,255,8,0,33,222,170,5,0,52,255,8,0,0,27,215,180,8,52,255,8,0,0,0,0,52,255,8,0,0,0,0,
+52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,15,8,8,8,5,52,255,255,255,255,255,164,52,255,214,0,0,0,11,244,255,4,52,255,217,53,0,
+0,95,217,255,4,52,255,123,147,0,0,191,122,255,4,52,255,32,231,5,31,227,54,255,4,52,255,8,182,79,125,137,52,255,4,52,255,8,87,173,219,43,52,255,4,52,255,8,8,238,204,0,52,255,4,52,255,8,0,50,38,0,52,255,
+4,52,255,8,0,0,0,0,52,255,4,52,255,202,1,0,0,52,255,4,52,255,235,94,0,0,52,255,4,52,255,106,228,10,0,52,255,4,52,255,10,206,129,0,52,255,4,52,255,8,63,245,28,52,255,4,52,255,8,0,174,164,52,255,
+4,52,255,8,0,34,247,106,255,4,52,255,8,0,0,139,235,255,4,52,255,8,0,0,14,234,255,4,0,0,67,195,244,240,177,41,0,0,0,74,245,102,12,19,131,238,35,0,0,215,130,0,0,0,0,175,165,0,28,255,42,0,0,0,
+0,86,235,0,48,255,16,0,0,0,0,61,254,0,28,255,42,0,0,0,0,86,235,0,0,216,128,0,0,0,0,173,167,0,0,77,244,100,11,18,129,239,37,0,0,0,70,197,244,241,179,43,0,0,52,255,244,243,233,172,32,0,52,255,
+8,0,17,166,197,0,52,255,8,0,0,65,247,0,52,255,8,0,19,167,193,0,52,255,240,239,225,165,28,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,0,0,
+67,195,244,240,176,39,0,0,0,74,245,102,12,19,131,237,33,0,0,215,130,0,0,0,0,175,162,0,28,255,42,0,0,0,0,86,233,0,47,255,16,0,0,0,0,61,253,0,27,255,42,0,0,0,0,86,233,0,0,215,128,0,0,0,
+0,173,168,0,0,74,244,100,11,18,129,242,44,0,0,0,67,196,244,255,216,49,0,0,0,0,0,0,0,48,232,65,0,0,0,0,0,0,0,0,58,117,5,0,52,255,244,243,233,174,33,0,0,52,255,8,0,15,161,195,0,0,52,255,
+8,0,0,64,248,0,0,52,255,8,0,18,165,209,0,0,52,255,240,243,255,213,41,0,0,52,255,8,1,56,233,79,0,0,52,255,8,0,0,101,231,12,0,52,255,8,0,0,4,218,124,0,52,255,8,0,0,0,90,241,19,0,51,190,
+240,239,206,79,0,7,234,122,7,6,56,64,0,40,255,20,0,0,0,0,0,8,230,181,81,24,0,0,0,0,33,152,222,254,195,39,0,0,0,0,0,29,177,203,0,0,0,0,0,0,64,247,0,32,122,33,1,19,167,191,0,21,166,227,
+245,231,168,28,0,244,244,244,246,255,244,244,244,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,0,
+52,255,4,0,0,0,0,0,52,255,4,0,0,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,47,255,13,0,0,0,
+57,253,2,14,255,47,0,0,0,93,221,0,0,175,184,27,1,43,214,125,0,0,17,148,224,242,216,121,4,0,177,162,0,0,0,0,0,191,148,74,246,16,0,0,0,37,254,46,2,225,109,0,0,0,139,198,0,0,125,210,0,0,6,234,
+96,0,0,26,251,55,0,87,239,10,0,0,0,176,157,0,189,146,0,0,0,0,73,244,49,254,44,0,0,0,0,2,224,222,197,0,0,0,0,0,0,123,255,95,0,0,0,111,220,0,0,0,110,255,69,0,0,9,248,73,43,255,31,0,
+0,176,212,136,0,0,68,250,12,0,230,98,0,3,239,84,203,0,0,135,194,0,0,164,165,0,54,215,5,241,17,0,202,127,0,0,96,231,0,121,149,0,183,82,15,252,59,0,0,29,255,42,187,83,0,118,149,79,243,5,0,0,0,217,
+117,244,19,0,52,216,146,180,0,0,0,0,150,231,207,0,0,2,239,231,113,0,0,0,0,82,255,141,0,0,0,177,255,45,0,0,6,208,141,0,0,0,111,225,15,0,43,245,66,0,44,245,63,0,0,0,111,227,24,210,137,0,0,0,
+0,1,185,234,207,6,0,0,0,0,0,121,255,113,0,0,0,0,0,45,245,136,240,30,0,0,0,7,210,133,0,159,192,2,0,0,142,204,5,0,13,222,116,0,67,244,39,0,0,0,60,245,45,57,246,50,0,0,0,85,237,27,0,127,
+215,9,0,27,237,82,0,0,3,197,147,1,187,156,0,0,0,0,33,240,168,218,11,0,0,0,0,0,99,255,54,0,0,0,0,0,0,52,255,8,0,0,0,0,0,0,52,255,8,0,0,0,0,0,0,52,255,8,0,0,0,0,0,0,
+52,255,8,0,0,0,244,244,244,244,244,244,252,253,0,0,0,0,0,53,245,112,0,0,0,0,34,233,142,0,0,0,0,19,217,171,2,0,0,0,8,197,197,8,0,0,0,2,171,217,19,0,0,0,0,143,233,34,0,0,0,0,112,245,
+53,0,0,0,0,0,253,252,244,244,244,244,244,244,52,255,244,137,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,50,248,240,135,216,59,0,0,0,136,
+140,0,0,0,55,220,0,0,0,1,229,45,0,0,0,151,125,0,0,0,70,205,0,0,0,5,239,30,0,0,0,165,110,0,0,0,85,191,0,0,0,12,244,19,0,0,0,100,37,175,246,255,8,0,52,255,8,0,52,255,8,0,52,255,
+8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,172,241,248,7,0,0,0,53,128,39,0,0,0,0,0,55,240,189,230,37,0,0,0,52,234,93,0,116,227,36,0,50,225,69,0,0,0,90,220,
+34,30,244,244,244,244,244,244,152,91,64,0,0,39,222,28,0,0,70,188,2,0,102,211,242,232,165,22,0,0,81,40,2,27,193,169,0,0,0,0,0,0,69,237,0,0,75,195,233,242,243,255,3,18,251,94,9,0,70,255,4,29,255,72,
+0,35,197,255,4,0,111,228,244,202,104,255,4,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,99,225,237,151,7,0,52,255,177,15,29,213,131,0,52,255,46,0,0,92,224,0,52,255,15,
+0,0,60,250,0,52,255,46,0,0,92,224,0,52,255,175,14,28,211,133,0,52,255,99,226,238,153,8,0,0,11,140,222,243,210,47,0,162,199,34,1,40,30,12,254,54,0,0,0,0,42,255,17,0,0,0,0,12,254,53,0,0,0,0,
+0,161,197,33,1,40,29,0,11,143,226,243,209,46,0,0,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,21,178,241,213,109,255,4,0,180,180,14,28,207,255,4,16,255,46,0,0,91,255,4,43,255,
+15,0,0,60,255,4,17,255,46,0,0,90,255,4,0,182,178,14,27,205,255,4,0,23,179,242,213,110,255,4,0,11,147,228,232,150,9,0,0,161,178,17,16,191,137,0,12,254,38,0,0,73,226,0,42,255,240,240,240,241,246,2,13,255,
+31,0,0,0,0,0,0,165,173,23,0,28,72,0,0,12,143,225,242,214,110,0,0,0,113,231,244,64,0,18,252,54,0,0,0,48,255,8,0,0,80,246,255,244,232,0,0,52,255,8,0,0,0,52,255,8,0,0,0,52,255,8,0,0,
+0,52,255,8,0,0,0,52,255,8,0,0,0,52,255,8,0,0,0,23,180,241,213,109,255,4,0,183,176,13,27,204,255,4,17,255,44,0,0,89,255,4,43,255,15,0,0,59,255,4,17,255,44,0,0,89,255,4,0,184,173,13,26,203,
+255,4,0,25,182,242,213,115,251,1,0,0,0,0,0,94,223,0,0,42,47,1,40,215,135,0,0,56,218,245,228,147,10,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,83,216,243,197,
+40,0,52,255,171,20,7,165,192,0,52,255,35,0,0,64,246,0,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,49,244,7,0,0,0,0,0,0,52,255,8,52,255,
+8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,0,49,244,7,0,0,0,0,0,0,0,0,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,55,254,4,0,103,222,0,
+161,225,78,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,45,224,111,0,52,255,8,70,231,81,0,0,52,255,108,229,55,0,0,0,52,255,232,141,0,0,0,0,52,255,41,222,
+132,0,0,0,52,255,8,26,214,145,1,0,52,255,8,0,21,206,157,2,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,84,214,245,204,43,77,213,243,197,38,0,52,
+255,174,21,7,163,221,170,21,7,163,189,0,52,255,36,0,0,63,255,32,0,0,63,245,0,52,255,8,0,0,52,255,4,0,0,52,255,4,52,255,8,0,0,52,255,4,0,0,52,255,4,52,255,8,0,0,52,255,4,0,0,52,255,4,
+52,255,8,0,0,52,255,4,0,0,52,255,4,52,255,83,216,243,197,40,0,52,255,171,20,7,165,192,0,52,255,35,0,0,64,246,0,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,
+0,0,52,255,4,0,19,165,234,227,136,5,0,0,178,181,15,29,213,126,0,15,255,46,0,0,92,222,0,43,255,15,0,0,60,250,0,15,255,46,0,0,92,222,0,0,179,178,14,28,211,127,0,0,20,167,235,228,139,6,0,52,255,99,
+225,237,151,7,0,52,255,177,15,29,213,131,0,52,255,46,0,0,92,224,0,52,255,15,0,0,60,250,0,52,255,46,0,0,92,224,0,52,255,175,14,28,211,133,0,52,255,99,226,238,153,8,0,52,255,8,0,0,0,0,0,52,255,8,
+0,0,0,0,0,52,255,8,0,0,0,0,0,0,21,178,241,213,109,255,4,0,180,180,14,28,207,255,4,16,255,46,0,0,91,255,4,43,255,15,0,0,60,255,4,17,255,46,0,0,90,255,4,0,182,178,14,27,205,255,4,0,23,179,
+242,213,110,255,4,0,0,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,5,0,52,255,93,219,250,4,52,255,175,18,10,0,52,255,42,0,0,0,52,255,10,0,0,0,52,255,8,0,0,
+0,52,255,8,0,0,0,52,255,8,0,0,0,0,105,223,243,226,112,0,27,255,67,0,18,49,0,25,252,108,15,0,0,0,0,79,188,243,194,59,0,0,0,0,8,129,231,0,33,73,10,2,116,227,0,38,196,241,241,200,58,0,0,52,
+255,8,0,0,0,52,255,8,0,0,15,246,255,244,244,106,0,52,255,8,0,0,0,52,255,8,0,0,0,52,255,8,0,0,0,50,255,8,0,0,0,27,255,45,0,0,0,0,139,234,240,105,52,255,8,0,0,52,255,4,52,255,8,0,
+0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,39,255,20,0,0,80,255,4,6,235,126,3,35,203,255,4,0,70,214,244,200,100,255,4,108,207,0,0,0,33,253,32,17,248,48,0,0,129,189,0,0,169,145,0,
+1,224,91,0,0,72,236,6,67,240,9,0,0,2,228,82,163,152,0,0,0,0,134,192,245,54,0,0,0,0,37,255,212,0,0,0,83,217,0,0,131,255,34,0,55,241,4,17,253,30,0,199,218,102,0,123,177,0,0,203,98,14,240,98,
+171,0,191,109,0,0,135,166,79,183,24,237,12,248,41,0,0,67,232,148,114,0,211,124,229,0,0,0,7,246,241,46,0,143,241,161,0,0,0,0,186,233,1,0,74,255,93,0,0,26,233,92,0,0,160,191,3,0,68,242,41,96,232,24,
+0,0,0,128,218,242,66,0,0,0,0,24,249,193,0,0,0,0,2,185,173,230,98,0,0,0,126,214,11,64,242,44,0,65,242,43,0,0,124,215,11,105,209,0,0,0,35,252,31,14,244,53,0,0,134,184,0,0,156,152,0,3,229,83,
+0,0,53,241,10,77,233,5,0,0,0,206,95,176,137,0,0,0,0,104,210,250,37,0,0,0,0,13,243,191,0,0,0,0,0,1,223,90,0,0,0,0,0,92,229,6,0,0,0,0,235,231,74,0,0,0,0,205,244,244,244,253,128,0,
+0,0,65,238,47,0,0,39,235,76,0,0,19,219,111,0,0,6,194,149,0,0,0,163,183,3,0,0,0,255,247,244,244,244,122,0,0,0,148,238,218,0,0,31,255,57,0,0,0,51,255,8,0,0,0,55,255,6,0,0,3,128,230,0,
+0,41,250,247,75,0,0,0,5,143,212,0,0,0,0,60,254,3,0,0,0,52,255,8,0,0,0,50,255,11,0,0,0,25,255,68,0,0,0,0,130,228,214,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,
+52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,26,128,4,19,246,232,112,0,0,0,0,101,242,0,0,0,0,53,255,7,0,0,0,50,255,11,0,0,0,21,252,84,1,0,0,0,111,254,247,0,0,12,243,99,2,0,0,46,255,
+15,0,0,0,52,255,8,0,0,0,55,255,5,0,0,1,111,235,0,0,18,241,220,97,0,0,0,0,0,0,0,0,0,1,91,203,235,185,88,21,53,182,177,32,7,78,182,237,200,81,2,0,0,0,0,0,0,0,49,244,7,0,0,0,
+0,0,0,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,0,0,0,28,140,2,0,0,0,0,52,255,4,0,0,11,153,237,255,239,145,0,167,193,74,255,14,61,14,254,54,52,255,4,0,43,255,15,52,255,4,0,20,
+255,40,52,255,4,0,0,192,160,53,255,4,24,0,32,199,238,255,215,179,0,0,0,69,255,36,0,0,0,0,49,244,3,0,0,0,86,222,243,201,0,10,243,89,1,49,0,43,255,12,0,0,0,52,255,4,0,0,172,243,255,240,240,45,
+0,52,255,4,0,0,0,52,255,4,0,0,0,52,255,4,0,0,244,246,255,244,244,244,0,125,40,0,0,0,49,104,0,101,235,176,235,186,216,62,0,3,214,114,6,154,176,0,0,38,255,18,0,63,245,0,0,4,216,115,10,158,167,0,
+0,101,235,180,236,173,233,66,0,131,39,0,0,0,64,98,7,214,87,0,0,0,136,168,0,58,229,15,0,44,232,22,0,0,147,150,1,196,94,0,0,162,198,244,152,240,192,123,0,0,0,95,255,47,0,0,0,202,240,243,255,240,240,153,
+0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,0,0,0,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,0,103,222,243,221,100,0,
+29,255,62,0,30,53,0,15,230,105,0,0,0,0,0,98,250,187,43,0,0,21,249,60,102,243,101,0,30,254,62,0,96,243,0,0,117,240,117,84,208,0,0,0,43,182,246,49,0,0,0,0,0,127,213,0,1,76,12,3,120,226,0,2,
+183,230,237,195,55,0,49,244,7,49,244,3,0,0,18,142,221,239,210,118,5,0,0,0,25,220,162,31,1,46,188,189,7,0,0,179,182,62,202,236,192,12,216,129,0,19,254,66,238,113,4,27,2,101,224,0,46,255,60,255,14,0,0,0,
+64,252,0,20,254,66,239,111,3,24,2,101,224,0,0,181,182,65,204,236,190,12,217,130,0,0,25,220,164,41,9,54,191,189,7,0,0,0,18,142,221,241,211,119,5,0,0,81,167,174,156,53,32,160,178,176,187,183,39,0,0,213,201,16,
+0,89,228,77,203,180,152,206,147,192,192,192,174,0,0,32,0,0,27,0,56,221,0,113,115,86,223,50,108,163,4,229,119,0,220,27,0,29,208,120,47,202,33,0,12,180,0,50,111,0,0,3,0,0,2,68,244,244,244,244,244,244,245,252,
+7,0,0,0,0,0,0,0,52,255,8,0,0,0,0,0,0,0,52,255,8,0,0,0,0,0,0,0,24,120,3,244,244,244,0,0,18,142,221,239,210,118,5,0,0,0,25,220,162,31,1,46,188,189,7,0,0,179,182,50,248,239,225,128,
+216,129,0,19,254,56,52,255,4,98,245,101,224,0,46,255,19,52,255,245,232,87,64,252,0,20,254,56,52,255,12,173,79,101,224,0,0,181,182,42,204,3,16,178,225,130,0,0,25,220,164,41,9,54,191,189,7,0,0,0,18,142,221,241,
+211,119,5,0,0,156,244,244,244,34,0,101,227,213,63,0,24,253,60,99,227,0,26,254,63,107,231,0,0,111,230,217,70,0,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,240,240,240,243,255,240,
+240,240,0,0,0,52,255,4,0,0,0,0,0,52,255,4,0,0,0,0,0,0,0,0,0,0,244,244,244,244,244,244,244,244,112,169,191,104,1,0,5,199,0,0,146,80,7,159,90,0,158,225,180,165,118,168,182,116,0,0,8,190,0,140,
+217,96,0,0,10,205,146,170,180,96,0,9,125,23,0,149,144,0,74,185,3,0,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,18,0,0,71,255,4,52,255,
+130,5,20,187,255,24,52,255,133,231,225,102,208,206,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,0,36,176,237,255,246,255,4,3,220,255,255,255,60,255,4,38,255,255,255,255,60,255,4,13,249,
+255,255,255,60,255,4,0,96,244,255,255,60,255,4,0,0,16,103,255,60,255,4,0,0,0,52,255,60,255,4,0,0,0,52,255,60,255,4,0,0,0,52,255,60,255,4,0,0,0,52,255,60,255,4,0,0,0,23,116,27,116,1,49,244,
+7,0,34,85,27,35,224,124,219,147,52,175,219,0,0,0,0,200,0,0,0,0,200,0,0,0,0,200,0,0,32,172,237,172,32,34,183,181,182,34,175,48,0,46,174,200,0,0,0,199,175,48,0,48,174,34,184,185,184,34,129,192,192,192,
+132,32,0,0,27,0,0,219,56,0,206,24,0,39,205,86,72,207,21,0,71,228,1,185,105,108,203,29,143,154,1,180,12,0,159,1,0,2,0,0,2,0,0,0,28,44,1,0,0,0,0,36,5,0,0,106,171,255,8,0,0,0,52,193,
+1,0,0,0,52,255,8,0,0,4,202,45,0,0,0,0,52,255,8,0,0,118,138,0,0,0,0,0,52,255,8,0,33,215,11,0,17,44,0,84,176,212,169,42,185,78,0,10,188,255,4,0,0,0,0,92,176,0,0,143,83,255,4,0,
+0,0,19,223,30,0,105,99,77,255,31,0,0,0,161,117,0,0,142,212,220,255,186,0,0,44,184,4,0,0,0,0,43,212,3,0,1,8,0,0,0,0,0,7,0,0,0,116,200,255,8,0,0,0,86,148,0,0,0,0,52,255,8,0,
+0,13,208,17,0,0,0,0,52,255,8,0,0,141,103,0,0,0,0,0,52,255,8,0,44,202,2,0,0,0,0,84,176,212,169,32,193,60,112,170,193,99,0,0,0,0,0,94,164,0,0,0,79,237,0,0,0,0,16,220,26,0,0,20,
+199,77,0,0,0,0,148,120,0,0,42,178,47,0,0,0,0,46,211,6,0,0,174,245,244,244,15,0,197,235,228,128,0,0,0,46,194,4,0,0,0,19,0,102,236,1,0,7,204,44,0,0,0,0,33,244,255,126,0,0,141,118,0,0,
+0,0,6,9,0,110,248,1,65,194,2,0,24,56,0,28,205,237,220,109,16,214,35,0,16,187,255,4,0,0,0,0,0,165,103,0,2,152,72,255,4,0,0,0,0,88,183,0,0,129,83,77,255,31,0,0,0,28,221,26,0,0,165,212,
+220,255,186,0,0,0,144,86,0,0,0,0,0,43,212,3,0,0,49,244,3,0,0,0,0,0,0,0,0,0,52,255,3,0,0,0,71,239,0,0,0,17,213,138,0,0,0,188,174,2,0,0,33,255,28,0,0,0,18,250,99,11,68,106,
+0,90,223,245,200,70,0,0,1,109,36,0,0,0,0,0,0,0,50,199,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,255,94,0,0,0,0,0,2,223,237,197,0,0,0,0,0,73,251,75,255,44,0,0,0,0,176,178,
+0,208,146,0,0,0,26,251,80,0,110,239,9,0,0,125,233,4,0,18,248,96,0,2,225,249,232,232,232,251,198,0,74,253,51,24,24,24,70,255,45,177,173,0,0,0,0,0,198,148,0,0,0,0,52,92,0,0,0,0,0,0,31,203,
+30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,255,94,0,0,0,0,0,2,223,237,197,0,0,0,0,0,73,251,75,255,44,0,0,0,0,176,178,0,208,146,0,0,0,26,251,80,0,110,239,9,0,0,125,233,4,0,18,
+248,96,0,2,225,249,232,232,232,251,198,0,74,253,51,24,24,24,70,255,45,177,173,0,0,0,0,0,198,148,0,0,0,48,128,34,0,0,0,0,0,35,188,61,188,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,255,94,0,
+0,0,0,0,2,223,237,197,0,0,0,0,0,73,251,75,255,44,0,0,0,0,176,178,0,208,146,0,0,0,26,251,80,0,110,239,9,0,0,125,233,4,0,18,248,96,0,2,225,249,232,232,232,251,198,0,74,253,51,24,24,24,70,255,
+45,177,173,0,0,0,0,0,198,148,0,0,65,230,110,84,116,0,0,0,0,133,61,131,188,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,255,94,0,0,0,0,0,2,223,237,197,0,0,0,0,0,73,251,75,255,44,0,0,
+0,0,176,178,0,208,146,0,0,0,26,251,80,0,110,239,9,0,0,125,233,4,0,18,248,96,0,2,225,249,232,232,232,251,198,0,74,253,51,24,24,24,70,255,45,177,173,0,0,0,0,0,198,148,0,0,48,240,7,48,240,3,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,75,255,253,32,0,0,0,0,0,0,176,237,253,130,0,0,0,0,0,25,251,127,175,228,3,0,0,0,0,123,248,23,63,255,76,0,0,0,1,222,160,0,0,206,177,0,0,0,70,255,50,
+0,0,95,252,26,0,0,171,254,232,232,232,235,255,123,0,21,250,103,24,24,24,24,143,222,1,117,228,5,0,0,0,0,27,250,69,0,0,0,152,234,111,0,0,0,0,0,37,255,105,244,0,0,0,0,0,12,235,110,195,0,0,0,0,
+0,0,144,255,96,0,0,0,0,0,4,232,238,188,0,0,0,0,0,79,252,91,254,32,0,0,0,0,177,185,2,231,128,0,0,0,23,251,95,0,144,224,1,0,0,117,247,14,0,54,255,68,0,0,214,251,232,232,232,255,166,0,57,255,
+70,24,24,24,111,247,16,155,197,0,0,0,0,8,233,106,0,0,0,34,253,246,255,244,244,244,244,179,0,0,0,145,194,52,255,8,0,0,0,0,0,0,15,243,88,52,255,8,0,0,0,0,0,0,115,233,6,52,255,8,0,0,0,0,
+0,3,224,133,0,52,255,240,240,240,240,127,0,85,253,30,0,52,255,8,0,0,0,0,0,198,250,240,240,243,255,8,0,0,0,0,54,254,48,0,0,52,255,8,0,0,0,0,168,175,0,0,0,52,255,244,244,244,244,205,0,0,51,176,
+236,242,217,137,19,0,63,243,121,24,0,30,137,72,0,211,134,0,0,0,0,0,0,26,255,44,0,0,0,0,0,0,47,255,17,0,0,0,0,0,0,27,255,44,0,0,0,0,0,0,0,211,133,0,0,0,0,0,0,0,64,242,118,23,
+0,28,133,71,0,0,51,177,241,255,217,138,19,0,0,0,0,2,190,11,0,0,0,0,0,11,3,178,62,0,0,0,0,0,68,246,214,19,0,0,0,0,74,72,0,0,0,0,0,15,194,56,0,0,0,0,0,0,0,0,0,52,255,244,
+244,244,244,179,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,240,240,240,240,131,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,244,244,244,244,205,0,0,0,17,
+119,8,0,0,0,4,183,77,0,0,0,0,0,0,0,0,0,52,255,244,244,244,244,179,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,240,240,240,240,131,52,255,8,0,0,0,0,52,255,8,0,0,
+0,0,52,255,8,0,0,0,0,52,255,244,244,244,244,205,0,0,14,125,68,0,0,0,5,175,72,174,61,0,0,0,0,0,0,0,0,52,255,244,244,244,244,179,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,
+0,52,255,240,240,240,240,131,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,8,0,0,0,0,52,255,244,244,244,244,205,0,48,240,3,48,240,3,0,0,0,0,0,0,0,0,0,52,255,244,244,244,244,244,34,52,255,8,0,
+0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,240,240,240,240,228,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,244,244,244,244,244,61,1,110,35,0,
+0,53,198,12,0,0,0,0,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,57,87,32,202,26,0,0,0,52,255,8,52,255,8,52,255,8,52,255,
+8,52,255,8,52,255,8,52,255,8,52,255,8,52,255,8,0,48,128,28,0,35,187,63,185,15,0,0,0,0,0,0,52,255,8,0,0,52,255,8,0,0,52,255,8,0,0,52,255,8,0,0,52,255,8,0,0,52,255,8,0,0,52,255,
+8,0,0,52,255,8,0,0,52,255,8,0,48,240,7,48,240,3,0,0,0,0,0,0,0,0,244,68,0,0,0,0,244,68,0,0,0,0,244,68,0,0,0,0,244,68,0,0,0,0,244,68,0,0,0,0,244,68,0,0,0,0,244,68,
+0,0,0,0,244,68,0,0,0,0,244,68,0,0,0,52,255,244,243,240,207,137,23,0,0,0,52,255,8,0,3,47,162,233,34,0,0,52,255,8,0,0,0,1,186,167,0,0,52,255,8,0,0,0,0,92,235,0,116,243,255,240,240,82,
+0,0,62,253,0,0,52,255,8,0,0,0,0,93,235,0,0,52,255,8,0,0,0,0,185,166,0,0,52,255,8,0,2,45,159,233,35,0,0,52,255,244,242,240,208,138,23,0,0,0,0,77,231,106,85,118,0,0,0,0,147,52,134,188,
+30,0,0,0,0,0,0,0,0,0,0,0,52,255,202,1,0,0,52,255,4,52,255,235,94,0,0,52,255,4,52,255,106,228,10,0,52,255,4,52,255,10,206,129,0,52,255,4,52,255,8,63,245,28,52,255,4,52,255,8,0,174,164,52,
+255,4,52,255,8,0,34,247,106,255,4,52,255,8,0,0,139,235,255,4,52,255,8,0,0,14,234,255,4,0,0,0,56,213,6,0,0,0,0,0,0,0,0,132,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,195,244,
+240,177,41,0,0,0,74,245,102,12,19,131,238,35,0,0,215,130,0,0,0,0,175,165,0,28,255,42,0,0,0,0,86,235,0,48,255,16,0,0,0,0,61,254,0,28,255,42,0,0,0,0,86,235,0,0,216,128,0,0,0,0,173,167,
+0,0,77,244,100,11,18,129,239,37,0,0,0,70,197,244,241,179,43,0,0,0,0,0,0,25,224,25,0,0,0,0,0,0,0,164,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,195,244,240,177,41,0,0,0,74,245,
+102,12,19,131,238,35,0,0,215,130,0,0,0,0,175,165,0,28,255,42,0,0,0,0,86,235,0,48,255,16,0,0,0,0,61,254,0,28,255,42,0,0,0,0,86,235,0,0,216,128,0,0,0,0,173,167,0,0,77,244,100,11,18,129,
+239,37,0,0,0,70,197,244,241,179,43,0,0,0,0,0,15,213,196,2,0,0,0,0,0,0,153,76,115,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,195,244,240,177,41,0,0,0,74,245,102,12,19,131,238,35,0,0,
+215,130,0,0,0,0,175,165,0,28,255,42,0,0,0,0,86,235,0,48,255,16,0,0,0,0,61,254,0,28,255,42,0,0,0,0,86,235,0,0,216,128,0,0,0,0,173,167,0,0,77,244,100,11,18,129,239,37,0,0,0,70,197,244,
+241,179,43,0,0,0,0,0,161,197,24,188,0,0,0,0,0,4,171,52,186,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,195,244,240,177,41,0,0,0,74,245,102,12,19,131,238,35,0,0,215,130,0,0,0,0,175,165,
+0,28,255,42,0,0,0,0,86,235,0,48,255,16,0,0,0,0,61,254,0,28,255,42,0,0,0,0,86,235,0,0,216,128,0,0,0,0,173,167,0,0,77,244,100,11,18,129,239,37,0,0,0,70,197,244,241,179,43,0,0,0,0,0,
+48,240,52,240,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,195,244,240,177,41,0,0,0,74,245,102,12,19,131,238,35,0,0,215,130,0,0,0,0,175,165,0,28,255,42,0,0,0,0,86,235,0,48,255,16,0,0,0,0,
+61,254,0,28,255,42,0,0,0,0,86,235,0,0,216,128,0,0,0,0,173,167,0,0,77,244,100,11,18,129,239,37,0,0,0,70,197,244,241,179,43,0,0,0,54,0,0,0,0,1,52,0,11,221,134,0,0,2,158,202,3,0,28,218,
+144,5,166,202,17,0,0,0,25,214,224,197,14,0,0,0,0,9,185,246,162,3,0,0,0,11,190,180,23,198,169,4,0,10,197,171,5,0,12,191,176,2,1,93,3,0,0,0,9,88,0,0,0,0,0,0,0,0,0,13,0,0,0,65,
+194,245,229,171,79,196,2,0,71,245,109,16,11,101,255,68,0,0,213,132,0,0,2,141,164,159,0,27,255,42,0,0,141,53,74,224,0,45,255,15,0,131,87,0,60,252,0,15,255,34,113,126,0,0,89,235,0,0,201,188,165,0,0,0,
+180,167,0,0,97,255,107,9,19,133,240,37,0,21,201,80,190,237,241,178,42,0,0,0,16,0,0,0,0,0,0,0,0,0,0,4,197,92,0,0,0,0,0,0,0,29,216,19,0,0,0,0,0,0,0,0,0,0,0,0,52,255,8,0,
+0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,47,255,13,0,0,0,57,253,2,14,255,47,0,0,0,93,221,0,0,175,184,27,1,
+43,214,125,0,0,17,148,224,242,216,121,4,0,0,0,0,0,142,153,0,0,0,0,0,0,50,209,9,0,0,0,0,0,0,0,0,0,0,0,0,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,
+52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,47,255,13,0,0,0,57,253,2,14,255,47,0,0,0,93,221,0,0,175,184,27,1,43,214,125,0,0,17,148,224,242,216,121,4,0,0,0,0,137,231,94,0,
+0,0,0,0,58,184,18,202,28,0,0,0,0,0,0,0,0,0,0,0,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,
+4,47,255,13,0,0,0,57,253,2,14,255,47,0,0,0,93,221,0,0,175,184,27,1,43,214,125,0,0,17,148,224,242,216,121,4,0,0,0,48,240,52,240,3,0,0,0,0,0,0,0,0,0,0,0,52,255,8,0,0,0,52,255,4,
+52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,52,255,8,0,0,0,52,255,4,47,255,13,0,0,0,57,253,2,14,255,47,0,0,0,93,221,0,0,175,184,27,1,43,214,125,0,0,
+17,148,224,242,216,121,4,0,0,0,0,0,57,87,0,0,0,0,0,0,32,202,26,0,0,0,0,0,0,0,0,0,0,0,0,57,246,50,0,0,0,85,237,27,0,127,215,9,0,27,237,82,0,0,3,197,147,1,187,156,0,0,0,0,
+33,240,168,218,11,0,0,0,0,0,99,255,54,0,0,0,0,0,0,52,255,8,0,0,0,0,0,0,52,255,8,0,0,0,0,0,0,52,255,8,0,0,0,0,0,0,52,255,8,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,
+0,0,0,0,52,255,240,239,224,164,28,0,52,255,8,0,19,166,194,0,52,255,8,0,0,65,246,0,52,255,8,0,19,167,194,0,52,255,240,239,225,165,29,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,0,59,204,242,
+210,62,0,0,6,233,111,2,99,230,5,0,42,255,15,25,142,249,33,0,52,255,16,225,109,3,0,0,52,255,49,255,37,0,0,0,52,255,10,194,226,70,0,0,52,255,8,5,115,242,121,0,52,255,8,0,0,86,246,0,52,255,40,11,
+1,121,217,0,52,255,113,238,241,199,53,0,0,17,216,82,0,0,0,0,0,0,35,218,31,0,0,0,0,0,0,53,78,0,0,0,0,102,211,242,232,165,22,0,0,81,40,2,27,193,169,0,0,0,0,0,0,69,237,0,0,75,195,233,
+242,243,255,3,18,251,94,9,0,70,255,4,29,255,72,0,35,197,255,4,0,111,228,244,202,104,255,4,0,0,0,0,142,173,1,0,0,0,0,74,202,10,0,0,0,0,0,106,25,0,0,0,0,102,211,242,232,165,22,0,0,83,41,2,
+27,193,169,0,0,0,0,0,0,70,237,0,0,69,187,223,226,230,255,3,17,249,88,4,0,71,255,4,29,255,75,0,35,197,255,4,0,111,228,244,202,104,255,4,0,0,9,217,180,0,0,0,0,0,139,116,165,88,0,0,0,6,111,1,
+14,104,0,0,0,102,211,242,232,165,22,0,0,81,40,2,27,193,169,0,0,0,0,0,0,69,237,0,0,75,195,233,242,243,255,3,18,251,94,9,0,70,255,4,29,255,72,0,35,197,255,4,0,111,228,244,202,104,255,4,0,5,203,208,
+29,208,2,0,0,46,149,57,199,130,0,0,0,0,0,0,0,0,0,0,0,102,211,242,232,165,22,0,0,81,40,2,27,193,169,0,0,0,0,0,0,69,237,0,0,75,195,233,242,243,255,3,18,251,94,9,0,70,255,4,29,255,72,0,
+35,197,255,4,0,111,228,244,202,104,255,4,0,49,244,3,49,244,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,115,214,242,231,162,20,0,0,87,36,1,29,195,167,0,0,0,0,0,0,70,237,0,0,75,195,233,
+242,243,255,3,18,251,94,9,0,70,255,4,29,255,72,0,35,197,255,4,0,111,228,244,202,104,255,4,0,0,98,225,229,107,0,0,0,0,232,60,103,243,0,0,0,0,99,226,229,107,0,0,0,0,0,0,0,0,0,0,0,102,211,242,
+232,165,22,0,0,82,44,4,15,157,169,0,0,0,0,0,0,15,237,0,0,71,190,231,242,240,255,3,17,250,97,12,0,15,255,4,28,255,77,0,23,164,255,4,0,105,225,244,215,83,252,4,0,102,213,241,232,144,41,178,243,227,141,7,
+0,0,38,16,0,9,129,252,175,17,17,191,132,0,0,48,180,229,242,243,255,34,0,0,73,225,0,5,232,131,17,0,61,255,240,240,240,241,246,2,40,255,19,0,0,113,255,28,0,0,0,0,0,13,245,107,2,58,232,220,172,23,0,28,
+72,0,0,81,217,245,214,88,19,160,236,242,213,110,0,0,11,140,222,243,210,47,0,162,199,34,1,40,30,12,254,54,0,0,0,0,42,255,17,0,0,0,0,12,254,53,0,0,0,0,0,161,197,33,1,40,29,0,11,143,227,255,209,46,
+0,0,0,0,177,13,0,0,0,8,4,163,63,0,0,0,43,244,216,19,0,0,0,133,143,0,0,0,0,0,0,0,147,96,0,0,0,0,0,0,0,0,0,0,0,0,11,147,228,233,152,10,0,0,161,181,18,17,193,140,0,12,254,41,
+0,0,74,228,0,42,255,217,216,216,220,234,2,13,255,33,0,0,0,0,0,0,165,176,24,0,28,72,0,0,12,143,225,242,214,110,0,0,0,0,0,159,122,0,0,0,0,0,109,137,0,0,0,0,0,0,0,0,0,0,0,0,11,147,
+228,232,150,9,0,0,161,178,17,16,191,137,0,12,254,38,0,0,73,226,0,42,255,240,240,240,241,246,2,13,255,31,0,0,0,0,0,0,165,173,23,0,28,72,0,0,12,143,225,242,214,110,0,0,0,3,188,184,2,0,0,0,0,126,
+89,98,120,0,0,0,0,0,0,0,0,0,0,0,11,147,228,232,150,9,0,0,161,178,17,16,191,137,0,12,254,38,0,0,73,226,0,42,255,240,240,240,241,246,2,13,255,31,0,0,0,0,0,0,165,173,23,0,28,72,0,0,12,143,
+225,242,214,110,0,0,0,49,244,53,244,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,147,228,232,150,9,0,0,161,186,23,8,150,137,0,12,254,41,0,0,17,226,0,42,255,240,240,240,240,246,2,13,255,31,
+0,0,0,0,0,0,163,173,24,0,26,75,0,0,11,141,224,242,216,118,0,93,206,7,0,0,135,146,0,0,1,112,16,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,28,228,
+53,3,192,87,0,40,90,0,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,52,255,8,0,0,101,251,57,0,22,211,61,200,4,62,55,0,75,39,0,52,255,8,0,0,52,255,8,0,0,52,
+255,8,0,0,52,255,8,0,0,52,255,8,0,0,52,255,8,0,0,52,255,8,0,49,244,7,179,118,0,0,0,0,0,0,0,0,0,0,0,0,248,4,0,0,0,248,4,0,0,0,248,4,0,0,0,248,4,0,0,0,248,4,0,0,
+0,248,4,0,0,0,248,4,0,0,0,139,194,49,140,41,0,0,23,115,247,218,41,0,0,0,64,70,24,226,106,0,0,0,16,163,238,248,249,43,0,0,172,189,22,5,177,164,0,15,255,49,0,0,83,234,0,42,255,15,0,0,60,251,
+0,14,255,47,0,0,92,219,0,0,171,181,15,29,213,117,0,0,16,161,234,226,129,3,0,0,0,180,218,43,186,20,0,0,21,177,41,190,154,0,0,0,0,0,0,0,0,0,0,52,255,93,211,243,198,40,0,52,255,186,24,7,164,192,
+0,52,255,58,0,0,64,246,0,52,255,32,0,0,52,255,4,52,255,32,0,0,52,255,4,52,255,32,0,0,52,255,4,52,255,32,0,0,52,255,4,0,1,158,121,0,0,0,0,0,0,2,163,79,0,0,0,0,0,0,0,0,0,0,
+0,0,19,165,234,227,136,5,0,0,178,181,15,29,213,126,0,15,255,46,0,0,92,222,0,43,255,15,0,0,60,250,0,15,255,46,0,0,92,222,0,0,179,178,14,28,211,127,0,0,20,167,235,228,139,6,0,0,0,0,1,171,111,0,
+0,0,0,0,127,119,0,0,0,0,0,0,0,0,0,0,0,0,19,165,234,227,136,5,0,0,178,181,15,29,213,126,0,15,255,46,0,0,92,222,0,43,255,15,0,0,60,250,0,15,255,46,0,0,92,222,0,0,179,178,14,28,211,127,
+0,0,20,167,235,228,139,6,0,0,0,10,200,178,1,0,0,0,0,152,71,109,111,0,0,0,0,0,0,0,0,0,0,0,19,165,234,227,136,5,0,0,178,181,15,29,213,126,0,15,255,46,0,0,92,222,0,43,255,15,0,0,60,250,
+0,15,255,46,0,0,92,222,0,0,179,178,14,28,211,127,0,0,20,167,235,228,139,6,0,0,0,163,213,31,188,0,0,0,1,176,52,201,101,0,0,0,0,0,0,0,0,0,0,0,19,165,234,227,136,5,0,0,178,181,15,29,213,126,
+0,15,255,46,0,0,92,222,0,43,255,15,0,0,60,250,0,15,255,46,0,0,92,222,0,0,179,178,14,28,211,127,0,0,20,167,235,228,139,6,0,0,0,236,3,49,244,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,19,165,235,225,136,5,0,0,178,187,20,17,181,126,0,15,255,49,0,0,39,222,0,43,255,15,0,0,4,249,0,15,255,48,0,0,38,222,0,0,179,185,19,16,179,127,0,0,20,167,236,227,139,6,0,0,0,0,49,244,3,0,
+0,0,0,0,0,0,0,0,0,240,240,240,240,240,240,240,240,0,0,0,0,0,0,0,0,0,0,0,48,240,3,0,0,0,0,0,0,0,0,38,2,0,20,167,236,229,145,198,13,0,180,187,20,16,227,132,0,16,255,50,0,137,122,223,
+0,43,255,14,120,85,59,250,0,17,254,129,134,0,94,223,0,0,179,231,13,29,213,131,0,40,200,161,236,230,142,7,0,14,30,0,0,0,0,0,0,0,24,223,72,0,0,0,0,0,0,44,219,26,0,0,0,0,0,0,59,74,0,0,
+0,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,39,255,20,0,0,80,255,4,6,235,126,3,35,203,255,4,0,70,214,244,200,100,255,4,0,0,0,0,151,168,1,
+0,0,0,0,83,196,7,0,0,0,0,0,111,20,0,0,0,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,39,255,20,0,0,80,255,4,6,235,126,3,35,203,255,
+4,0,70,214,244,200,100,255,4,0,0,14,225,170,0,0,0,0,0,154,102,175,81,0,0,0,12,108,0,17,102,0,0,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,
+4,39,255,20,0,0,80,255,4,6,235,126,3,35,203,255,4,0,70,214,244,200,100,255,4,0,49,244,3,49,244,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,
+4,52,255,8,0,0,52,255,4,52,255,8,0,0,52,255,4,39,255,20,0,0,80,255,4,6,235,126,3,35,203,255,4,0,70,214,244,200,100,255,4,0,0,0,0,62,94,0,0,0,0,0,52,205,28,0,0,0,0,0,104,23,0,0,
+0,105,209,0,0,0,35,252,31,14,244,53,0,0,134,184,0,0,156,152,0,3,229,83,0,0,53,241,10,77,233,5,0,0,0,206,95,176,137,0,0,0,0,104,210,250,37,0,0,0,0,13,243,191,0,0,0,0,0,1,223,90,0,0,
+0,0,0,92,229,6,0,0,0,0,235,231,74,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,99,225,237,151,7,0,52,255,177,15,29,213,131,0,52,255,46,0,0,92,224,
+0,52,255,15,0,0,60,250,0,52,255,46,0,0,92,224,0,52,255,175,14,28,211,133,0,52,255,99,226,238,153,8,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,52,255,8,0,0,0,0,0,0,49,244,7,49,244,3,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,170,0,0,0,2,220,97,49,251,29,0,0,76,236,8,0,204,135,0,0,186,137,0,0,103,236,8,40,252,32,0,0,13,244,99,149,177,0,0,0,0,157,214,243,69,0,
+0,0,0,56,255,216,1,0,0,0,0,26,254,109,0,0,0,0,3,143,234,11,0,0,0,33,245,228,73,0,0,0,0,
+    };
+    static const signed char asciiKerning13[128 * 128] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,-1,-1,-2,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,-1,-1,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,-1,-1,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,-1,-1,-1,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,-1,0,-2,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,-1,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-3,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,0,-1,0,0,0,0,0,-1,0,0,-1,0,0,0,0,0,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,-2,-1,-2,-1,0,-2,-1,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,-1,0,-1,-1,0,0,-1,0,0,-1,-1,-3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,0,-1,
+0,-1,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,-1,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,0,-1,-1,0,-2,-1,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,-1,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,
+0,-1,1,-1,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,-2,0,-2,0,0,0,0,1,0,1,0,0,-2,0,0,-1,-2,0,-2,0,-2,0,-2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,1,1,0,0,1,0,-2,-3,0,0,0,0,0,0,0,0,0,0,0,-2,0,1,1,1,0,
+0,-1,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,-1,1,0,0,-1,0,0,1,0,1,1,1,1,1,-1,1,0,1,0,1,-1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,-1,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,-1,-1,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,-1,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,-1,-1,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-3,0,0,0,0,0,0,0,0,0,0,0,-2,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,-1,0,0,0,-1,0,0,-1,0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,-1,-1,-1,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,1,0,1,1,1,0,1,1,0,1,1,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+    };
+
+    static const GlyphMetrics metrics14[256] = {
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {4, 0, 0, 3},
+        {5, 23, -12, 4},
+        {7, -26, -26, 5},
+        {12, 5, -5, 6},
+        {8, 26, -14, 7},
+        {14, 1, 11, 8},
+        {11, 8, 3, 9},
+        {4, -26, -26, 10},
+        {5, 29, -1, 11},
+        {5, 11, -18, 12},
+        {7, 23, -12, 13},
+        {11, 31, -31, 14},
+        {4, -7, -29, 15},
+        {6, -20, 21, 16},
+        {5, -16, 26, 17},
+        {5, 0, 18, 18},
+        {9, 0, 0, 19},
+        {9, 0, 0, 20},
+        {9, 0, 0, 21},
+        {9, 0, 0, 22},
+        {9, 0, 0, 23},
+        {9, 0, 0, 24},
+        {9, 0, 0, 25},
+        {9, 0, 0, 26},
+        {9, 0, 0, 27},
+        {9, 0, 0, 28},
+        {5, -7, 18, 29},
+        {5, -7, 18, 30},
+        {11, 31, -31, 31},
+        {11, 31, -31, 32},
+        {11, 31, -31, 33},
+        {7, -16, -3, 34},
+        {14, 11, -3, 35},
+        {10, 0, 27, 36},
+        {10, -24, -4, 37},
+        {10, 2, 31, 38},
+        {11, -24, 7, 39},
+        {9, -24, -11, 40},
+        {8, -24, -24, 41},
+        {11, 2, -13, 42},
+        {10, -24, -28, 43},
+        {4, -24, -29, 44},
+        {4, -22, -29, 45},
+        {10, -24, 31, 46},
+        {8, -24, -8, 47},
+        {12, -24, -27, 48},
+        {10, -24, -28, 49},
+        {11, 2, 10, 50},
+        {9, -24, 30, 51},
+        {11, 2, 10, 52},
+        {10, -24, 11, 53},
+        {9, 14, 10, 54},
+        {9, 5, -5, 55},
+        {9, 30, -18, 56},
+        {10, 0, 27, 57},
+        {14, 0, 10, 58},
+        {10, 0, 26, 59},
+        {9, -11, 22, 60},
+        {10, -24, 14, 61},
+        {5, 29, -5, 62},
+        {5, 0, 18, 63},
+        {5, 16, -18, 64},
+        {12, 0, 17, 65},
+        {7, -1, 1, 66},
+        {7, 0, 0, 67},
+        {8, 6, -21, 68},
+        {10, -31, 11, 69},
+        {8, 1, 24, 70},
+        {9, 1, -22, 71},
+        {9, 1, 13, 72},
+        {6, -35, 10, 73},
+        {9, 1, -22, 74},
+        {9, -31, -16, 75},
+        {4, -28, -25, 76},
+        {4, -24, -25, 77},
+        {9, -31, 22, 78},
+        {4, -28, -25, 79},
+        {14, -31, -16, 80},
+        {9, -31, -16, 81},
+        {9, 1, 11, 82},
+        {10, -31, 11, 83},
+        {9, 1, -22, 84},
+        {6, -31, -19, 85},
+        {7, 4, 16, 86},
+        {7, -40, 35, 87},
+        {8, 28, -21, 88},
+        {8, 0, -18, 89},
+        {11, 0, -29, 90},
+        {8, 0, -18, 91},
+        {8, 0, -18, 92},
+        {8, -25, 26, 93},
+        {9, 0, 0, 94},
+        {5, 2, 9, 95},
+        {9, 0, 0, 96},
+        {11, 31, -31, 97},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {8, 0, -26, 0},
+        {4, 0, 0, 98},
+        {5, 23, -12, 99},
+        {9, 27, 23, 100},
+        {9, -8, -24, 101},
+        {10, -13, 26, 102},
+        {9, 1, 10, 103},
+        {5, 2, 9, 104},
+        {8, -8, 19, 105},
+        {8, -18, 30, 106},
+        {14, 12, 0, 107},
+        {7, -20, 9, 108},
+        {8, 5, -20, 109},
+        {12, 22, 28, 110},
+        {6, -20, 21, 111},
+        {14, 12, 0, 112},
+        {6, 29, -29, 113},
+        {7, -27, -25, 114},
+        {11, 31, -31, 115},
+        {6, -28, 10, 116},
+        {6, -15, 24, 117},
+        {7, 0, 0, 118},
+        {8, 28, -23, 119},
+        {9, 21, 27, 120},
+        {5, -16, 26, 121},
+        {7, 7, -17, 122},
+        {5, 24, -5, 123},
+        {7, -28, 28, 124},
+        {8, 20, -4, 125},
+        {14, -18, -27, 126},
+        {14, -18, 1, 127},
+        {13, 7, -27, 128},
+        {7, 15, -17, 129},
+        {10, 0, 27, 130},
+        {10, 0, 27, 131},
+        {10, 0, 27, 132},
+        {10, -30, -3, 133},
+        {10, 0, 11, 134},
+        {10, 10, 2, 135},
+        {13, 26, -11, 136},
+        {10, 2, 31, 137},
+        {9, -24, -11, 138},
+        {9, -24, -11, 139},
+        {9, -24, -11, 140},
+        {9, -24, -19, 141},
+        {4, -24, -29, 142},
+        {4, -24, -29, 143},
+        {4, -24, -29, 144},
+        {6, -37, 51, 145},
+        {12, -52, 7, 146},
+        {10, -24, -28, 147},
+        {11, 2, 10, 148},
+        {11, 2, 10, 149},
+        {11, 2, 10, 150},
+        {11, 2, 10, 151},
+        {11, 2, 10, 152},
+        {12, 0, 17, 153},
+        {11, 2, 10, 154},
+        {9, 30, -18, 155},
+        {9, 30, -18, 156},
+        {9, 30, -18, 157},
+        {9, 30, -18, 158},
+        {9, -11, 22, 159},
+        {9, -24, 28, 160},
+        {10, -31, 19, 161},
+        {8, 6, -21, 162},
+        {8, 6, -21, 163},
+        {8, 6, -21, 164},
+        {8, 6, -21, 165},
+        {8, 6, -21, 166},
+        {8, 6, -21, 167},
+        {14, 6, 13, 168},
+        {8, 1, 24, 169},
+        {9, 1, 13, 170},
+        {9, 1, 13, 171},
+        {9, 1, 13, 172},
+        {9, 1, 13, 173},
+        {4, -28, -25, 174},
+        {4, -28, -25, 175},
+        {4, -28, -25, 176},
+        {4, 19, 16, 177},
+        {9, 1, 11, 178},
+        {9, -31, -16, 179},
+        {9, 1, 11, 180},
+        {9, 1, 11, 181},
+        {9, 1, 11, 182},
+        {9, 1, 11, 183},
+        {9, 1, 11, 184},
+        {11, 31, -31, 185},
+        {9, 1, 11, 186},
+        {8, 28, -21, 187},
+        {8, 28, -21, 188},
+        {8, 28, -21, 189},
+        {8, 28, -21, 190},
+        {8, 0, -18, 191},
+        {10, -31, 11, 192},
+        {8, 23, -11, 193},
+    };
+    static const GlyphBitmap glyphs14[] = {
+        {32, 0, 0, 0, 0, 0},
+        {33, 1, -10, 3, 10, 0},
+        {34, 1, -10, 6, 4, 30},
+        {35, 1, -10, 10, 10, 54},
+        {36, 0, -11, 8, 13, 154},
+        {37, 0, -10, 14, 10, 258},
+        {38, 0, -10, 11, 10, 398},
+        {39, 1, -10, 3, 4, 508},
+        {40, 0, -11, 4, 13, 520},
+        {41, 0, -11, 5, 13, 572},
+        {42, 0, -10, 7, 6, 637},
+        {43, 1, -9, 9, 9, 679},
+        {44, 1, -1, 3, 3, 760},
+        {45, 1, -5, 4, 2, 769},
+        {46, 1, -2, 3, 2, 777},
+        {47, 0, -10, 5, 12, 783},
+        {48, 0, -10, 9, 10, 843},
+        {49, 2, -10, 6, 10, 933},
+        {50, 1, -10, 7, 10, 993},
+        {51, 1, -10, 8, 10, 1063},
+        {52, 0, -10, 8, 10, 1143},
+        {53, 1, -10, 8, 10, 1223},
+        {54, 0, -10, 9, 10, 1303},
+        {55, 1, -10, 7, 10, 1393},
+        {56, 0, -10, 8, 10, 1463},
+        {57, 0, -10, 9, 10, 1543},
+        {58, 1, -7, 3, 7, 1633},
+        {59, 1, -7, 3, 9, 1654},
+        {60, 1, -9, 9, 9, 1681},
+        {61, 1, -7, 9, 5, 1762},
+        {62, 1, -9, 9, 9, 1807},
+        {63, 1, -10, 6, 10, 1888},
+        {64, 0, -10, 14, 13, 1948},
+        {65, 0, -10, 10, 10, 2130},
+        {66, 1, -10, 9, 10, 2230},
+        {67, 0, -10, 9, 10, 2320},
+        {68, 1, -10, 10, 10, 2410},
+        {69, 1, -10, 8, 10, 2510},
+        {70, 1, -10, 7, 10, 2590},
+        {71, 0, -10, 11, 10, 2660},
+        {72, 1, -10, 9, 10, 2770},
+        {73, 1, -10, 3, 10, 2860},
+        {74, -1, -10, 5, 13, 2890},
+        {75, 1, -10, 9, 10, 2955},
+        {76, 1, -10, 8, 10, 3045},
+        {77, 1, -10, 11, 10, 3125},
+        {78, 1, -10, 9, 10, 3235},
+        {79, 0, -10, 11, 10, 3325},
+        {80, 1, -10, 8, 10, 3435},
+        {81, 0, -10, 11, 12, 3515},
+        {82, 1, -10, 9, 10, 3647},
+        {83, 0, -10, 9, 10, 3737},
+        {84, 0, -10, 9, 10, 3827},
+        {85, 0, -10, 9, 10, 3917},
+        {86, 0, -10, 10, 10, 4007},
+        {87, 0, -10, 14, 10, 4107},
+        {88, 0, -10, 10, 10, 4247},
+        {89, 0, -10, 9, 10, 4347},
+        {90, 1, -10, 8, 10, 4437},
+        {91, 0, -11, 4, 14, 4517},
+        {92, 0, -10, 5, 12, 4573},
+        {93, 1, -11, 4, 14, 4633},
+        {94, 1, -11, 10, 4, 4689},
+        {95, 0, 2, 7, 2, 4729},
+        {96, 1, -12, 4, 3, 4743},
+        {97, 0, -8, 8, 8, 4755},
+        {98, 1, -11, 9, 11, 4819},
+        {99, 0, -8, 7, 8, 4918},
+        {100, 0, -11, 9, 11, 4974},
+        {101, 0, -8, 9, 8, 5073},
+        {102, 1, -11, 5, 11, 5145},
+        {103, 0, -8, 9, 11, 5200},
+        {104, 1, -11, 8, 11, 5299},
+        {105, 1, -11, 3, 11, 5387},
+        {106, 0, -11, 4, 14, 5420},
+        {107, 1, -11, 8, 11, 5476},
+        {108, 1, -11, 3, 11, 5564},
+        {109, 1, -8, 13, 8, 5597},
+        {110, 1, -8, 8, 8, 5701},
+        {111, 0, -8, 9, 8, 5765},
+        {112, 1, -8, 9, 11, 5837},
+        {113, 0, -8, 9, 11, 5936},
+        {114, 1, -9, 6, 9, 6035},
+        {115, 0, -8, 7, 8, 6089},
+        {116, 1, -10, 5, 10, 6145},
+        {117, 0, -8, 8, 8, 6195},
+        {118, 0, -8, 8, 8, 6259},
+        {119, 0, -8, 11, 8, 6323},
+        {120, 0, -8, 8, 8, 6411},
+        {121, 0, -8, 8, 11, 6475},
+        {122, 1, -8, 6, 8, 6563},
+        {123, 1, -11, 7, 14, 6611},
+        {124, 1, -11, 3, 15, 6709},
+        {125, 1, -11, 7, 14, 6754},
+        {126, 1, -7, 9, 4, 6852},
+        {160, 0, 0, 0, 0, 6888},
+        {161, 1, -10, 3, 10, 6888},
+        {162, 0, -10, 7, 13, 6918},
+        {163, 1, -10, 7, 10, 7009},
+        {164, 0, -9, 9, 9, 7079},
+        {165, 0, -10, 9, 10, 7160},
+        {166, 1, -10, 3, 12, 7250},
+        {167, 0, -10, 8, 13, 7286},
+        {168, 1, -11, 6, 2, 7390},
+        {169, 1, -10, 12, 11, 7402},
+        {170, 1, -10, 5, 7, 7534},
+        {171, 1, -8, 6, 8, 7569},
+        {172, 1, -6, 10, 5, 7617},
+        {173, 1, -5, 4, 2, 7667},
+        {174, 1, -10, 12, 11, 7675},
+        {175, 1, -11, 4, 2, 7807},
+        {176, 1, -10, 6, 5, 7815},
+        {177, 1, -9, 9, 9, 7845},
+        {178, 1, -10, 4, 5, 7926},
+        {179, 0, -10, 5, 5, 7946},
+        {180, 2, -12, 4, 3, 7971},
+        {181, 0, -8, 9, 11, 7983},
+        {182, 0, -10, 8, 13, 8082},
+        {183, 1, -6, 3, 2, 8186},
+        {184, 1, -1, 5, 4, 8192},
+        {185, 0, -10, 5, 5, 8212},
+        {186, 1, -10, 5, 7, 8237},
+        {187, 1, -8, 6, 8, 8272},
+        {188, 1, -11, 13, 12, 8320},
+        {189, 1, -11, 13, 12, 8476},
+        {190, 0, -11, 13, 12, 8632},
+        {191, 0, -10, 7, 10, 8788},
+        {192, 0, -13, 10, 13, 8858},
+        {193, 0, -13, 10, 13, 8988},
+        {194, 0, -14, 10, 14, 9118},
+        {195, 0, -13, 10, 13, 9258},
+        {196, 0, -13, 10, 13, 9388},
+        {197, -1, -13, 11, 13, 9518},
+        {198, -1, -10, 14, 10, 9661},
+        {199, 0, -10, 9, 13, 9801},
+        {200, 1, -13, 8, 13, 9918},
+        {201, 1, -13, 8, 13, 10022},
+        {202, 1, -14, 8, 14, 10126},
+        {203, 1, -13, 8, 13, 10238},
+        {204, 0, -13, 4, 13, 10342},
+        {205, 1, -13, 4, 13, 10394},
+        {206, 0, -14, 5, 14, 10446},
+        {207, 0, -13, 6, 13, 10516},
+        {208, 1, -10, 11, 10, 10594},
+        {209, 1, -13, 9, 13, 10704},
+        {210, 0, -14, 11, 14, 10821},
+        {211, 0, -14, 11, 14, 10975},
+        {212, 0, -14, 11, 14, 11129},
+        {213, 0, -14, 11, 14, 11283},
+        {214, 0, -13, 11, 13, 11437},
+        {215, 1, -9, 9, 9, 11580},
+        {216, 0, -11, 11, 12, 11661},
+        {217, 0, -14, 9, 14, 11793},
+        {218, 0, -14, 9, 14, 11919},
+        {219, 0, -14, 9, 14, 12045},
+        {220, 0, -13, 9, 13, 12171},
+        {221, 0, -13, 9, 13, 12288},
+        {222, 1, -10, 8, 10, 12405},
+        {223, 1, -11, 9, 11, 12485},
+        {224, 0, -12, 8, 12, 12584},
+        {225, 0, -12, 8, 12, 12680},
+        {226, 0, -12, 8, 12, 12776},
+        {227, 0, -11, 8, 11, 12872},
+        {228, 0, -11, 8, 11, 12960},
+        {229, 0, -13, 8, 13, 13048},
+        {230, 0, -8, 14, 8, 13152},
+        {231, 0, -8, 7, 11, 13264},
+        {232, 0, -12, 9, 12, 13341},
+        {233, 0, -12, 9, 12, 13449},
+        {234, 0, -12, 9, 12, 13557},
+        {235, 0, -11, 9, 11, 13665},
+        {236, 0, -12, 4, 12, 13764},
+        {237, 1, -12, 4, 12, 13812},
+        {238, 0, -12, 5, 12, 13860},
+        {239, -1, -11, 5, 11, 13920},
+        {240, 0, -11, 9, 11, 13975},
+        {241, 1, -11, 8, 11, 14074},
+        {242, 0, -12, 9, 12, 14162},
+        {243, 0, -12, 9, 12, 14270},
+        {244, 0, -12, 9, 12, 14378},
+        {245, 0, -11, 9, 11, 14486},
+        {246, 0, -11, 9, 11, 14585},
+        {247, 1, -8, 9, 7, 14684},
+        {248, 0, -9, 9, 10, 14747},
+        {249, 0, -12, 8, 12, 14837},
+        {250, 0, -12, 8, 12, 14933},
+        {251, 0, -12, 8, 12, 15029},
+        {252, 0, -11, 8, 11, 15125},
+        {253, 0, -12, 8, 15, 15213},
+        {254, 1, -11, 9, 14, 15333},
+        {255, 0, -11, 8, 14, 15459},
+    };
+    static const unsigned char pixels14[] = {
+64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,0,0,0,54,216,16,64,255,20,64,255,20,64,255,16,64,255,20,64,255,16,64,255,20,64,255,16,64,255,20,64,255,16,0,0,0,2,242,38,0,219,62,0,
+0,0,0,46,235,0,22,249,9,0,0,0,0,104,176,0,83,200,0,0,0,240,240,248,249,240,247,250,240,240,0,32,33,238,69,32,218,90,32,32,0,0,54,228,0,27,244,7,0,0,244,244,248,252,244,247,254,244,244,0,36,36,197,115,
+36,176,136,36,36,0,0,4,243,33,0,222,57,0,0,0,0,56,227,0,28,245,5,0,0,0,0,0,0,64,255,16,0,0,0,0,0,64,255,16,0,0,0,58,191,237,255,222,67,0,14,240,163,101,255,77,64,0,52,255,32,64,255,16,
+0,0,13,234,169,111,255,16,0,0,0,42,167,235,255,220,62,0,0,0,0,64,255,170,224,0,0,0,0,64,255,91,255,7,50,132,43,71,255,148,231,0,25,154,221,248,255,233,85,0,0,0,0,64,255,16,0,0,0,0,0,64,255,16,
+0,0,0,75,214,245,200,49,0,0,5,211,82,0,0,0,17,245,135,36,173,215,0,0,121,178,0,0,0,0,52,255,28,0,73,255,5,35,234,29,0,0,0,0,15,242,102,2,146,208,0,186,111,0,0,0,0,0,0,68,200,227,184,40,
+92,203,47,189,223,171,23,0,0,0,0,0,0,18,230,54,220,123,4,169,177,0,0,0,0,0,0,157,139,44,255,28,0,76,248,2,0,0,0,0,63,222,10,47,255,33,0,82,250,4,0,0,0,7,215,73,0,7,229,152,39,190,186,0,
+0,0,0,128,168,0,0,0,58,208,244,188,31,0,0,0,85,211,247,231,170,4,0,0,0,0,31,253,141,34,47,110,4,0,0,0,0,29,251,40,0,0,0,0,0,0,0,0,1,187,194,14,0,0,0,0,0,0,0,134,225,124,209,29,
+0,0,85,244,1,18,249,78,0,110,230,50,0,132,184,0,56,255,29,0,0,117,244,87,232,86,0,28,255,92,0,0,0,124,255,208,1,0,0,162,239,99,36,62,183,244,249,62,0,0,5,116,213,247,228,147,21,161,237,39,64,255,20,64,
+255,20,64,255,20,64,255,20,0,0,125,161,0,21,241,35,0,122,189,0,0,211,110,0,18,254,58,0,48,255,33,0,57,255,25,0,37,255,43,0,2,241,86,0,0,173,148,0,0,70,234,4,0,0,197,97,0,0,44,97,0,202,82,0,
+0,0,77,219,2,0,0,3,232,75,0,0,0,158,164,0,0,0,104,227,0,0,0,78,254,4,0,0,69,255,12,0,0,87,247,0,0,0,131,197,0,0,0,192,125,0,0,27,250,28,0,0,139,154,0,0,0,117,23,0,0,0,0,64,
+255,20,0,0,141,72,64,255,22,97,115,13,124,198,255,185,103,5,13,123,198,255,184,100,4,141,73,64,255,22,98,114,0,0,64,255,20,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,
+0,0,0,0,0,64,255,16,0,0,0,244,244,244,247,255,244,244,244,244,36,36,36,91,255,49,36,36,36,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,64,255,20,97,212,2,171,79,
+0,244,244,244,244,36,36,36,36,54,216,16,64,255,20,0,0,0,152,143,0,0,1,229,64,0,0,54,237,4,0,0,134,162,0,0,0,213,82,0,0,36,247,11,0,0,116,180,0,0,0,195,100,0,0,21,251,23,0,0,98,198,0,0,
+0,177,118,0,0,0,118,29,0,0,0,0,0,115,223,249,211,81,0,0,0,108,246,95,39,121,252,63,0,1,227,129,0,0,0,174,180,0,32,255,55,0,0,0,99,240,0,57,255,30,0,0,0,75,255,9,58,255,30,0,0,0,75,255,
+8,32,255,55,0,0,0,99,240,0,1,227,128,0,0,0,173,180,0,0,108,246,94,39,119,251,63,0,0,0,116,224,250,212,82,0,0,154,199,243,255,16,0,157,112,118,255,16,0,0,0,64,255,16,0,0,0,64,255,16,0,0,0,64,
+255,16,0,0,0,64,255,16,0,0,0,64,255,16,0,0,0,64,255,16,0,48,48,100,255,61,48,255,255,255,255,255,255,133,210,245,228,151,16,0,191,87,38,63,216,174,0,0,0,0,0,85,249,4,0,0,0,0,105,238,0,0,0,0,
+15,221,138,0,0,0,7,188,193,7,0,0,4,175,204,14,0,0,2,166,212,19,0,0,0,156,230,48,24,24,24,1,255,255,255,255,255,255,16,31,187,231,249,229,159,25,0,28,102,51,30,60,200,199,0,0,0,0,0,0,79,255,8,0,
+0,0,0,21,172,200,0,0,0,183,246,255,198,19,0,0,0,27,41,88,228,153,0,0,0,0,0,0,92,252,6,0,0,0,0,0,93,252,7,85,89,41,34,85,228,168,0,79,203,242,245,214,123,9,0,0,0,0,18,228,255,20,0,0,
+0,0,172,183,255,20,0,0,0,98,196,66,255,20,0,0,35,230,34,64,255,20,0,4,199,100,0,64,255,20,0,127,178,0,0,64,255,20,0,192,253,252,252,253,255,252,133,33,44,44,44,97,255,60,23,0,0,0,0,64,255,20,0,0,
+0,0,0,64,255,20,0,64,255,255,255,255,255,88,0,64,255,42,24,24,24,8,0,64,255,20,0,0,0,0,0,64,255,224,233,195,86,0,0,39,106,54,52,127,250,115,0,0,0,0,0,0,133,234,0,0,0,0,0,0,76,255,10,0,
+0,0,0,0,127,237,0,121,79,38,40,114,248,123,0,130,220,247,239,202,93,1,0,0,0,42,175,239,247,214,71,0,0,45,235,128,49,33,67,46,0,0,192,128,0,0,0,0,0,0,20,255,102,195,235,204,102,1,0,55,255,220,87,47,
+106,244,113,0,58,255,77,0,0,0,123,228,0,32,255,29,0,0,0,74,255,5,1,226,73,0,0,0,119,228,0,0,105,222,74,34,94,241,115,0,0,0,108,219,248,215,110,2,0,255,255,255,255,255,255,244,24,24,24,24,30,239,153,0,
+0,0,0,90,255,47,0,0,0,0,197,195,0,0,0,0,48,255,88,0,0,0,0,155,231,5,0,0,0,16,245,130,0,0,0,0,113,251,27,0,0,0,1,218,172,0,0,0,0,71,255,65,0,0,0,0,55,192,242,236,175,34,0,13,
+238,159,38,48,190,207,0,52,255,32,0,0,77,254,5,13,234,129,5,13,166,178,0,0,42,218,252,254,177,7,0,0,181,189,55,67,217,134,0,41,255,43,0,0,88,247,2,47,255,41,0,0,86,248,3,7,226,181,43,54,211,178,0,0,
+47,189,241,235,166,22,0,0,20,152,226,247,206,73,0,0,1,195,207,66,33,81,225,57,0,36,255,52,0,0,0,96,177,0,43,255,42,0,0,0,86,238,0,4,218,185,30,1,45,212,255,9,0,41,193,254,251,223,134,255,6,0,0,0,
+9,27,1,108,226,0,0,0,0,0,0,2,202,143,0,0,86,69,33,63,185,221,17,0,0,110,225,250,233,156,24,0,0,64,255,20,54,216,16,0,0,0,0,0,0,0,0,0,54,216,16,64,255,20,64,255,20,54,216,16,0,0,0,0,
+0,0,0,0,0,0,0,0,64,255,20,97,212,2,171,79,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,16,101,193,254,0,0,6,81,173,248,217,128,37,61,153,238,230,143,53,0,0,0,255,250,120,3,0,0,0,0,0,74,167,
+245,217,128,38,0,0,0,0,0,12,95,187,252,204,114,26,0,0,0,0,0,25,115,207,253,0,0,0,0,0,0,0,0,42,244,244,244,244,244,244,244,244,244,36,36,36,36,36,36,36,36,36,0,0,0,0,0,0,0,0,0,244,244,244,
+244,244,244,244,244,244,36,36,36,36,36,36,36,36,36,31,0,0,0,0,0,0,0,0,254,193,101,16,0,0,0,0,0,37,128,218,248,173,81,6,0,0,0,0,0,54,144,231,238,153,61,0,0,0,0,0,3,123,250,255,0,0,0,39,
+129,219,245,167,75,27,115,205,252,187,95,12,0,0,253,207,115,25,0,0,0,0,0,41,0,0,0,0,0,0,0,0,83,205,245,211,61,0,142,77,36,169,228,0,0,0,0,80,250,4,0,0,6,197,170,0,0,0,166,213,15,0,0,35,
+255,55,0,0,0,63,255,20,0,0,0,13,52,4,0,0,0,54,216,16,0,0,0,64,255,20,0,0,0,0,0,8,105,188,229,233,202,126,18,0,0,0,0,0,44,219,219,111,60,46,87,188,235,63,0,0,0,26,231,162,5,0,0,0,
+0,0,117,244,34,0,0,162,206,5,33,180,233,202,91,244,15,187,166,0,11,247,92,2,209,194,56,70,217,255,16,96,245,1,49,255,37,40,255,43,0,0,92,255,16,72,255,9,53,255,29,48,255,32,0,0,80,255,16,113,227,0,19,253,
+74,8,232,158,10,19,192,255,55,227,105,0,0,189,181,0,67,232,253,235,139,255,223,102,0,0,0,52,249,119,0,1,26,5,8,21,0,0,0,0,0,0,85,246,176,60,5,0,31,134,167,0,0,0,0,0,0,39,164,241,254,250,234,143,
+20,0,0,0,0,0,0,0,0,3,25,24,1,0,0,0,0,0,0,0,0,49,253,197,0,0,0,0,0,0,0,150,147,241,41,0,0,0,0,0,9,240,46,157,140,0,0,0,0,0,93,209,0,64,234,5,0,0,0,0,193,116,0,1,
+224,83,0,0,0,36,252,26,0,0,133,183,0,0,0,136,255,252,252,252,253,253,29,0,4,231,120,44,44,44,44,207,126,0,79,251,19,0,0,0,0,119,224,2,178,186,0,0,0,0,0,34,255,70,64,255,255,255,240,187,43,0,0,64,
+255,42,24,44,183,215,0,0,64,255,20,0,0,75,255,6,0,64,255,20,0,9,157,208,0,0,64,255,244,244,254,231,59,0,0,64,255,53,36,40,80,215,93,0,64,255,20,0,0,0,89,237,0,64,255,20,0,0,0,86,249,4,64,255,
+42,24,28,67,215,174,0,64,255,255,255,251,224,146,16,0,0,0,28,153,226,249,223,164,45,0,35,233,190,72,34,51,134,181,0,185,193,1,0,0,0,0,16,19,254,77,0,0,0,0,0,0,55,255,37,0,0,0,0,0,0,55,255,36,
+0,0,0,0,0,0,19,254,77,0,0,0,0,0,0,0,186,194,1,0,0,0,0,16,0,37,234,190,72,33,49,130,181,0,0,29,155,228,249,224,163,43,64,255,255,253,240,202,125,14,0,0,64,255,42,24,38,88,206,219,21,0,64,255,
+20,0,0,0,9,216,150,0,64,255,20,0,0,0,0,112,230,0,64,255,20,0,0,0,0,72,255,7,64,255,20,0,0,0,0,73,255,6,64,255,20,0,0,0,0,114,229,0,64,255,20,0,0,0,9,216,149,0,64,255,42,24,37,87,
+206,219,21,0,64,255,255,254,241,203,126,14,0,0,64,255,255,255,255,255,255,40,64,255,42,24,24,24,24,3,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,244,244,244,244,228,0,64,255,53,36,36,36,33,0,64,255,
+20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,42,24,24,24,24,6,64,255,255,255,255,255,255,72,64,255,255,255,255,255,144,64,255,42,24,24,24,13,64,255,20,0,0,0,0,64,255,20,0,0,0,0,64,255,244,244,244,244,
+30,64,255,53,36,36,36,4,64,255,20,0,0,0,0,64,255,20,0,0,0,0,64,255,20,0,0,0,0,64,255,20,0,0,0,0,0,0,15,129,209,244,242,212,150,46,0,0,26,220,209,88,46,37,70,135,187,0,0,176,206,4,0,0,
+0,0,0,1,0,17,253,81,0,0,0,0,0,0,0,0,54,255,38,0,0,0,175,244,244,244,15,55,255,28,0,0,0,25,36,91,255,16,17,253,75,0,0,0,0,0,64,255,16,0,177,196,5,0,0,0,0,64,255,16,0,27,222,200,
+84,35,32,62,166,254,14,0,0,16,131,211,246,248,220,157,51,0,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,244,244,244,244,247,255,16,64,
+255,53,36,36,36,91,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,
+20,64,255,20,64,255,20,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,66,255,16,0,0,87,248,
+0,6,40,194,183,0,64,244,189,34,0,64,255,20,0,0,21,205,206,22,64,255,20,0,31,217,192,14,0,64,255,20,42,228,175,8,0,0,64,255,75,237,158,3,0,0,0,64,255,249,170,0,0,0,0,0,64,255,169,246,68,0,0,0,
+0,64,255,21,148,247,70,0,0,0,64,255,20,0,143,248,73,0,0,64,255,20,0,0,139,249,76,0,64,255,20,0,0,0,134,249,80,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,20,
+0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,64,48,48,48,48,2,64,255,255,255,255,255,255,12,64,255,241,10,0,0,0,41,255,255,16,
+64,255,226,95,0,0,0,140,225,255,16,64,255,130,193,0,0,5,233,129,255,16,64,255,38,247,35,0,81,221,65,255,16,64,255,20,169,133,0,180,124,64,255,16,64,255,20,70,228,29,249,28,64,255,16,64,255,20,2,225,191,183,0,64,
+255,16,64,255,20,0,129,255,84,0,64,255,16,64,255,20,0,5,20,2,0,64,255,16,64,255,20,0,0,0,0,0,64,255,16,64,255,206,1,0,0,64,255,16,64,255,247,80,0,0,64,255,16,64,255,146,207,1,0,64,255,16,64,255,
+35,238,80,0,64,255,16,64,255,20,126,207,1,64,255,16,64,255,20,14,238,81,64,255,16,64,255,20,0,125,208,65,255,16,64,255,20,0,14,238,145,255,16,64,255,20,0,0,125,247,255,16,64,255,20,0,0,14,238,255,16,0,0,31,
+160,231,250,222,138,14,0,0,0,37,235,177,57,30,71,204,208,11,0,0,185,197,1,0,0,0,14,233,135,0,18,254,80,0,0,0,0,0,125,224,0,55,255,37,0,0,0,0,0,82,255,6,55,255,37,0,0,0,0,0,82,255,6,19,
+254,80,0,0,0,0,0,125,224,0,0,187,198,1,0,0,0,14,233,135,0,0,39,236,176,56,29,70,203,208,12,0,0,0,33,162,233,250,224,139,14,0,0,64,255,255,254,229,157,19,0,64,255,42,25,62,216,172,0,64,255,20,0,0,
+90,246,2,64,255,20,0,0,81,249,4,64,255,20,0,25,197,190,0,64,255,244,245,255,193,34,0,64,255,53,34,10,0,0,0,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,0,0,31,160,231,
+250,222,138,14,0,0,0,37,235,177,57,30,71,204,208,11,0,0,185,197,1,0,0,0,14,233,135,0,18,254,80,0,0,0,0,0,125,224,0,55,255,37,0,0,0,0,0,82,255,6,55,255,37,0,0,0,0,0,82,253,4,19,254,80,
+0,0,0,0,0,125,223,0,0,185,198,1,0,0,0,14,233,135,0,0,37,235,176,56,29,70,203,212,13,0,0,0,32,160,232,254,255,182,12,0,0,0,0,0,0,0,0,124,246,65,0,0,0,0,0,0,0,0,0,91,116,4,0,64,
+255,255,254,231,167,27,0,0,64,255,42,24,50,189,188,0,0,64,255,20,0,0,77,250,4,0,64,255,20,0,15,165,246,2,0,64,255,244,244,255,255,128,0,0,64,255,53,39,106,190,6,0,0,64,255,20,0,0,147,144,0,0,64,255,
+20,0,0,30,248,38,0,64,255,20,0,0,0,175,166,0,64,255,20,0,0,0,66,253,44,0,31,161,227,249,232,188,71,0,5,219,187,60,31,54,117,91,0,48,255,36,0,0,0,0,0,0,25,252,121,5,0,0,0,0,0,0,101,242,
+245,195,133,47,0,0,0,0,10,71,125,191,252,104,0,0,0,0,0,0,0,126,239,0,0,0,0,0,0,0,84,254,6,59,177,86,45,33,80,221,181,0,25,147,211,242,244,216,133,14,0,255,255,255,255,255,255,255,255,255,24,24,24,82,
+255,38,24,24,24,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,
+16,0,0,0,0,0,0,64,255,16,0,0,0,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,
+64,255,16,50,255,34,0,0,0,79,252,5,15,254,81,0,0,0,127,221,0,0,161,219,70,34,88,239,112,0,0,11,140,221,246,213,112,2,0,179,188,0,0,0,0,0,41,255,69,79,254,32,0,0,0,0,140,224,2,4,231,129,0,0,
+0,5,233,126,0,0,136,225,2,0,0,82,253,29,0,0,37,255,70,0,0,181,183,0,0,0,0,193,168,0,26,252,83,0,0,0,0,93,248,18,122,234,5,0,0,0,0,9,240,110,220,140,0,0,0,0,0,0,150,238,255,41,0,0,
+0,0,0,0,50,255,197,0,0,0,0,104,245,6,0,0,6,246,211,0,0,0,37,255,66,38,255,60,0,0,61,231,249,21,0,0,101,248,8,0,229,125,0,0,126,163,197,85,0,0,166,191,0,0,164,190,0,0,191,99,134,150,0,0,
+230,126,0,0,99,247,7,8,247,35,71,215,0,40,255,60,0,0,34,255,64,65,227,0,12,251,24,105,245,5,0,0,0,224,128,129,163,0,0,201,88,169,185,0,0,0,0,159,193,194,99,0,0,138,154,233,119,0,0,0,0,94,249,249,
+35,0,0,75,242,255,54,0,0,0,0,29,255,227,0,0,0,15,252,241,3,0,0,3,197,178,0,0,0,10,217,151,0,0,36,244,98,0,0,147,221,11,0,0,0,106,242,31,67,252,60,0,0,0,0,1,186,194,226,138,0,0,0,0,
+0,0,33,254,219,7,0,0,0,0,0,0,131,245,247,41,0,0,0,0,0,53,251,73,178,201,3,0,0,0,8,215,155,0,24,237,121,0,0,0,143,223,13,0,0,88,249,44,0,62,252,64,0,0,0,0,170,204,4,132,229,17,0,0,
+0,42,248,87,5,206,165,0,0,4,203,166,0,0,43,247,83,0,125,229,17,0,0,0,114,234,70,249,70,0,0,0,0,1,192,253,149,0,0,0,0,0,0,68,255,24,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,64,255,20,
+0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,255,255,255,255,255,255,255,255,24,24,24,24,24,50,240,150,0,0,0,0,6,199,196,5,0,0,0,0,154,229,24,0,0,0,0,103,249,57,0,0,0,0,57,
+249,102,0,0,0,0,24,229,154,0,0,0,0,5,196,199,6,0,0,0,0,151,240,50,24,24,24,24,24,255,255,255,255,255,255,255,255,64,255,255,184,64,255,42,17,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,
+0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,244,175,9,36,36,25,216,79,0,0,0,137,158,0,0,0,58,234,2,0,0,2,232,61,0,0,0,155,140,0,0,0,76,219,0,0,0,8,244,43,0,
+0,0,173,122,0,0,0,94,201,0,0,0,18,250,26,0,0,0,191,104,0,0,0,66,82,228,255,255,20,21,82,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,
+20,0,64,255,20,0,64,255,20,217,247,255,20,32,36,36,2,0,0,0,73,250,225,28,0,0,0,0,0,59,245,132,187,215,20,0,0,0,47,238,114,0,7,176,204,13,0,36,230,101,0,0,0,4,163,191,8,244,244,244,244,244,244,244,
+36,36,36,36,36,36,36,79,90,0,0,22,219,74,0,0,36,215,31,0,93,205,244,229,154,14,0,0,98,71,33,63,214,152,0,0,0,0,0,0,84,237,0,0,53,182,227,243,247,255,11,12,237,165,60,39,98,255,16,52,255,32,0,0,
+123,255,16,21,249,138,34,88,227,255,16,0,90,224,247,188,95,255,16,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,64,255,68,198,248,225,108,0,0,64,255,222,86,37,108,249,86,0,
+64,255,99,0,0,0,144,208,0,64,255,36,0,0,0,81,249,3,64,255,35,0,0,0,81,250,3,64,255,98,0,0,0,143,209,0,64,255,220,84,36,106,248,88,0,64,255,70,200,248,226,110,0,0,0,2,118,220,249,226,123,0,137,239,
+96,35,60,100,13,248,104,0,0,0,0,54,255,37,0,0,0,0,55,255,37,0,0,0,0,13,248,104,0,0,0,0,0,137,239,96,35,56,99,0,2,121,223,250,225,120,0,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,
+0,0,0,0,0,0,64,255,16,0,4,140,235,245,178,92,255,16,0,134,236,86,37,110,236,255,16,9,247,99,0,0,0,146,255,16,45,255,36,0,0,0,81,255,16,46,255,35,0,0,0,81,255,16,10,247,98,0,0,0,145,255,16,0,
+136,235,84,36,108,235,255,16,0,5,142,236,246,182,92,255,16,0,0,110,217,248,218,119,3,0,0,128,220,78,33,74,226,121,0,10,246,62,0,0,0,94,229,0,53,255,245,244,244,244,247,255,10,55,255,67,36,36,36,36,36,2,12,247,
+98,0,0,0,0,0,0,0,127,238,101,37,45,92,131,0,0,0,102,209,249,238,198,97,0,0,93,217,250,255,22,251,106,27,24,59,255,17,0,0,255,255,255,255,255,82,255,38,24,24,64,255,16,0,0,64,255,16,0,0,64,255,16,0,
+0,64,255,16,0,0,64,255,16,0,0,64,255,16,0,0,0,6,143,235,245,178,91,255,16,0,139,233,83,37,106,233,255,16,10,248,95,0,0,0,142,255,16,46,255,35,0,0,0,80,255,16,46,255,35,0,0,0,81,255,16,10,248,95,
+0,0,0,141,255,16,0,139,232,82,36,104,232,255,15,0,6,144,237,245,178,100,255,7,0,0,0,0,0,0,130,224,0,0,47,97,41,39,108,245,119,0,0,46,200,240,245,209,105,1,0,64,255,20,0,0,0,0,0,64,255,20,0,0,
+0,0,0,64,255,20,0,0,0,0,0,64,255,70,205,245,194,34,0,64,255,202,62,44,204,183,0,64,255,71,0,0,90,247,0,64,255,25,0,0,65,255,14,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,64,255,20,0,0,
+64,255,16,64,255,20,0,0,64,255,16,64,255,20,6,24,1,0,0,0,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,0,64,255,20,0,6,24,1,0,0,0,0,0,64,255,20,0,64,255,20,
+0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,71,255,9,21,148,221,0,190,221,71,0,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,20,0,
+7,172,206,22,64,255,20,13,189,193,14,0,64,255,41,204,178,8,0,0,64,255,227,177,4,0,0,0,64,255,151,237,49,0,0,0,64,255,20,133,237,48,0,0,64,255,20,0,134,236,47,0,64,255,20,0,0,135,236,47,64,255,20,64,
+255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,70,202,247,201,36,52,201,245,194,32,0,64,255,204,64,43,202,204,193,62,43,202,181,0,64,255,72,0,0,89,255,67,0,
+0,89,247,0,64,255,25,0,0,65,255,21,0,0,65,255,14,64,255,20,0,0,64,255,16,0,0,64,255,16,64,255,20,0,0,64,255,16,0,0,64,255,16,64,255,20,0,0,64,255,16,0,0,64,255,16,64,255,20,0,0,64,255,16,
+0,0,64,255,16,64,255,70,205,245,194,34,0,64,255,202,62,44,204,183,0,64,255,71,0,0,90,247,0,64,255,25,0,0,65,255,14,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,64,255,20,
+0,0,64,255,16,0,4,132,227,250,217,100,0,0,0,136,236,86,37,108,249,84,0,9,248,100,0,0,0,144,209,0,45,255,36,0,0,0,81,249,3,46,255,36,0,0,0,81,249,3,9,248,100,0,0,0,144,208,0,0,135,236,85,37,
+108,249,84,0,0,4,133,228,250,217,100,0,0,64,255,68,198,248,225,108,0,0,64,255,222,86,37,108,249,86,0,64,255,99,0,0,0,144,208,0,64,255,36,0,0,0,81,249,3,64,255,35,0,0,0,81,250,3,64,255,98,0,0,0,
+143,209,0,64,255,220,84,36,106,248,88,0,64,255,70,200,248,226,110,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,0,4,140,235,245,178,92,255,16,0,134,236,86,37,110,236,
+255,16,9,247,99,0,0,0,146,255,16,45,255,36,0,0,0,81,255,16,46,255,35,0,0,0,81,255,16,10,247,98,0,0,0,145,255,16,0,136,235,84,36,108,235,255,16,0,5,142,236,246,182,92,255,16,0,0,0,0,0,0,64,255,
+16,0,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,0,0,5,64,255,73,202,250,76,64,255,211,71,34,21,64,255,83,0,0,0,64,255,31,0,0,0,64,255,20,0,0,0,64,255,20,0,0,0,64,255,20,
+0,0,0,64,255,20,0,0,0,0,95,220,248,226,110,0,27,252,120,32,56,81,0,51,255,46,0,0,0,0,4,199,241,164,81,2,0,0,4,73,149,240,169,0,0,0,0,0,85,253,5,55,114,46,36,162,221,0,41,188,238,244,194,48,
+0,64,255,16,0,0,64,255,16,0,0,255,255,255,255,255,82,255,38,24,24,64,255,16,0,0,64,255,16,0,0,64,255,16,0,0,58,255,19,0,0,25,253,101,23,20,0,111,225,251,255,64,255,20,0,0,64,255,16,64,255,20,0,0,
+64,255,16,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,62,255,21,0,0,69,255,16,41,255,45,0,0,116,255,16,5,227,170,37,80,222,255,16,0,62,212,247,189,93,255,16,103,233,4,0,0,0,166,177,17,249,72,0,0,
+11,245,85,0,176,163,0,0,92,241,8,0,84,243,10,0,183,157,0,0,8,240,89,22,251,65,0,0,0,157,180,109,227,2,0,0,0,66,251,213,137,0,0,0,0,2,227,255,45,0,0,73,243,4,0,37,255,151,0,0,133,187,12,251,
+56,0,101,235,216,0,0,197,123,0,201,121,0,165,127,247,25,10,250,59,0,137,185,0,228,54,193,89,69,245,5,0,73,244,42,241,3,129,154,133,187,0,0,12,251,160,181,0,65,219,197,123,0,0,0,201,252,116,0,8,248,252,59,0,
+0,0,136,255,52,0,0,192,245,5,0,21,231,126,0,0,46,248,84,0,71,250,57,9,213,159,0,0,0,144,222,159,220,12,0,0,0,7,216,253,55,0,0,0,0,39,245,252,89,0,0,0,5,204,167,112,240,30,0,0,136,226,16,1,
+184,193,2,63,251,64,0,0,24,234,121,126,212,0,0,0,0,197,145,28,252,54,0,0,39,255,46,0,180,152,0,0,137,203,0,0,79,240,9,3,230,104,0,0,4,230,92,77,245,14,0,0,0,134,190,175,161,0,0,0,0,34,253,251,
+62,0,0,0,0,0,190,218,0,0,0,0,0,1,216,119,0,0,0,0,22,114,245,19,0,0,0,0,255,235,91,0,0,0,0,255,255,255,255,255,255,24,24,24,26,194,195,0,0,0,134,225,22,0,0,86,244,49,0,0,49,244,86,0,
+0,22,225,133,0,0,0,195,194,26,24,24,24,255,255,255,255,255,255,0,0,0,131,228,252,64,0,0,34,255,117,30,6,0,0,62,255,25,0,0,0,0,64,255,20,0,0,0,0,71,255,15,0,0,0,4,152,230,0,0,0,61,252,243,
+67,0,0,0,9,48,181,209,0,0,0,0,0,76,255,12,0,0,0,0,64,255,20,0,0,0,0,61,255,23,0,0,0,0,35,255,86,0,0,0,0,0,163,254,249,61,0,0,0,0,12,33,9,64,255,20,64,255,20,64,255,20,64,255,
+20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,32,128,10,64,252,224,103,0,0,0,6,31,150,244,2,0,0,0,0,69,255,17,0,0,0,0,64,255,20,0,0,0,0,
+59,255,28,0,0,0,0,24,253,118,2,0,0,0,0,103,252,251,61,0,0,15,240,154,46,9,0,0,57,255,33,0,0,0,0,64,255,20,0,0,0,0,67,255,17,0,0,0,0,125,247,1,0,0,61,250,251,130,0,0,0,9,32,10,
+0,0,0,0,0,0,0,0,0,0,0,0,2,63,181,231,209,127,38,0,43,187,222,94,44,88,177,249,251,233,113,17,0,0,0,0,9,24,0,0,64,255,20,54,216,16,0,0,0,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,
+64,255,20,64,255,20,0,0,0,58,232,14,0,0,0,0,64,255,16,0,0,6,146,237,255,241,175,0,152,222,114,255,57,115,13,249,86,64,255,16,0,47,255,33,64,255,16,0,50,255,30,64,255,16,0,17,253,75,64,255,16,0,0,168,
+204,87,255,26,82,0,14,173,250,255,254,202,0,0,0,69,255,28,0,0,0,0,64,255,16,0,0,0,0,6,24,1,0,0,0,67,201,243,239,186,0,13,240,152,38,39,95,0,53,255,29,0,0,0,0,64,255,16,0,0,0,244,247,255,
+244,244,0,0,36,91,255,49,36,0,0,0,64,255,16,0,0,0,0,64,255,16,0,0,0,24,82,255,38,24,24,24,255,255,255,255,255,255,255,4,154,46,0,0,0,0,65,135,0,138,241,148,224,224,151,242,91,0,0,204,205,60,74,227,
+160,0,0,35,255,52,0,0,96,241,1,0,44,255,40,0,0,84,247,3,0,1,209,174,14,27,205,157,0,0,91,249,199,253,251,195,237,55,6,202,81,0,18,13,0,114,164,0,1,0,0,0,0,0,0,0,49,248,33,0,0,0,76,238,
+16,0,168,161,0,0,1,208,119,0,0,36,248,43,0,89,229,9,0,0,0,151,175,4,219,102,0,0,20,216,222,251,156,248,218,195,0,0,0,0,115,255,67,0,0,0,22,244,244,247,255,244,244,221,0,3,36,36,91,255,53,36,32,0,
+0,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,0,0,0,0,0,0,64,255,20,64,255,20,64,255,20,64,255,20,64,255,20,0,84,212,248,231,168,0,0,29,252,
+119,32,55,118,0,0,35,253,71,0,0,0,0,0,0,92,250,148,29,0,0,0,5,212,157,115,234,146,13,0,54,255,36,0,26,204,193,0,17,241,157,3,0,81,254,5,0,56,222,199,81,212,147,0,0,0,10,134,253,180,0,0,0,0,
+0,0,113,249,3,0,7,79,12,4,137,238,1,0,11,219,255,252,233,80,0,0,0,0,16,26,2,0,0,0,61,244,19,61,244,15,9,36,2,9,36,2,0,0,0,88,189,233,229,175,62,0,0,0,0,2,164,236,114,47,54,133,246,120,
+0,0,0,125,237,68,170,228,215,95,65,251,77,0,6,241,112,208,195,59,51,66,0,156,200,0,49,255,76,255,43,0,0,0,0,81,253,3,54,255,76,255,33,0,0,0,0,73,255,6,14,250,95,230,164,14,4,34,0,131,216,0,0,156,
+218,76,220,254,250,123,34,239,108,0,0,13,203,210,63,24,20,82,229,167,1,0,0,0,10,136,235,251,253,223,109,1,0,0,0,0,0,0,2,26,22,0,0,0,0,0,101,206,200,199,58,23,1,0,29,197,66,185,199,200,226,211,25,0,
+42,227,108,221,197,144,186,0,0,0,0,0,165,216,216,216,199,0,0,19,0,0,19,0,22,210,0,22,210,25,215,117,25,211,103,219,128,0,217,80,0,151,199,13,151,168,6,0,144,195,0,144,188,0,0,136,0,0,136,0,0,0,0,0,
+0,209,244,244,244,244,244,244,244,244,19,30,36,36,36,36,36,36,91,255,20,0,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,0,9,36,2,244,244,244,244,36,36,36,36,0,0,0,88,189,
+233,229,175,62,0,0,0,0,2,164,236,114,47,54,133,246,120,0,0,0,125,237,98,244,242,222,120,65,251,77,0,6,241,109,64,255,50,129,253,4,156,200,0,49,255,36,64,255,245,235,122,0,81,253,3,54,255,29,64,255,63,206,47,0,
+73,255,6,14,250,88,64,255,16,73,209,4,131,216,0,0,156,218,47,128,8,0,113,74,239,108,0,0,13,203,210,63,2,6,82,229,167,1,0,0,0,10,136,235,251,253,223,109,1,0,0,0,0,0,0,2,26,22,0,0,0,0,0,244,
+244,244,244,36,36,36,36,0,98,224,210,63,0,29,252,105,145,233,1,43,255,62,108,246,3,0,153,253,249,104,0,0,0,18,11,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,
+244,244,244,247,255,244,244,244,244,36,36,36,91,255,49,36,36,36,0,0,0,64,255,16,0,0,0,0,0,0,64,255,16,0,0,0,24,24,24,24,24,24,24,24,24,255,255,255,255,255,255,255,255,255,161,189,210,109,6,0,10,208,0,6,
+158,70,30,179,63,0,225,222,200,193,0,142,182,178,115,0,0,183,223,206,0,0,0,27,91,3,5,0,21,215,17,201,194,207,96,0,0,94,75,0,81,215,19,36,215,31,0,64,255,20,0,0,64,255,16,0,64,255,20,0,0,64,255,16,
+0,64,255,20,0,0,64,255,16,0,64,255,20,0,0,64,255,16,0,64,255,20,0,0,67,255,16,0,64,255,43,0,0,100,255,16,0,64,255,176,39,60,219,255,73,1,64,255,132,239,231,93,214,225,2,64,255,20,0,0,0,0,0,0,
+64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,0,26,168,235,255,255,255,16,2,202,255,255,255,100,255,16,38,255,255,255,255,84,255,16,46,255,255,255,255,84,255,16,6,225,255,255,255,84,255,16,0,51,211,255,255,84,
+255,16,0,0,0,77,255,84,255,16,0,0,0,64,255,84,255,16,0,0,0,64,255,84,255,16,0,0,0,64,255,84,255,16,0,0,0,64,255,84,255,16,0,0,0,64,255,84,255,16,0,0,0,6,24,7,24,1,54,216,16,64,255,20,
+0,0,16,1,0,0,0,132,145,0,11,57,131,251,6,23,216,227,145,0,75,170,227,0,0,0,0,212,0,0,0,0,212,0,0,0,0,212,0,0,60,192,245,192,60,36,190,200,190,36,180,60,0,56,179,212,0,0,0,208,180,65,0,61,
+180,36,192,205,193,38,0,0,0,0,0,145,216,216,216,148,19,0,0,19,0,0,210,22,0,210,22,0,103,211,25,118,214,25,0,81,217,0,128,218,6,168,151,13,199,151,188,144,0,196,144,0,136,0,0,136,0,0,0,0,0,0,0,0,
+0,18,32,2,0,0,0,0,2,31,0,0,0,155,200,255,20,0,0,0,0,106,175,0,0,0,0,64,255,20,0,0,0,22,229,32,0,0,0,0,64,255,20,0,0,0,163,124,0,0,0,0,0,64,255,20,0,0,64,219,7,0,0,0,
+0,0,64,255,20,0,5,214,73,0,0,105,160,10,126,200,224,194,87,121,176,0,0,78,231,255,16,0,0,0,0,31,236,32,0,38,191,79,255,16,0,0,0,0,178,125,0,5,198,76,106,255,67,0,0,0,79,220,7,0,14,224,224,232,
+255,222,0,0,10,224,74,0,0,0,0,0,64,255,16,0,0,32,84,0,0,0,0,0,0,24,96,6,31,77,92,7,0,0,0,0,38,56,0,0,0,126,158,255,20,0,0,0,2,205,59,0,0,0,0,64,255,20,0,0,0,103,168,0,
+0,0,0,0,64,255,20,0,0,16,226,31,0,0,0,0,0,64,255,20,0,0,146,132,0,0,0,0,0,0,64,255,20,0,43,226,13,111,188,199,84,0,126,200,224,194,75,189,97,9,94,0,105,249,3,0,0,0,0,83,205,2,0,0,
+0,148,184,0,0,0,0,8,223,61,0,0,0,111,202,16,0,0,0,0,127,171,0,0,0,120,170,10,0,0,0,0,30,238,33,0,0,19,255,244,244,244,26,0,0,14,27,0,0,0,2,36,36,36,36,3,38,200,235,213,88,0,0,0,
+36,205,3,0,0,26,71,43,152,249,6,0,0,172,90,0,0,0,0,0,0,116,217,2,0,55,207,1,0,0,0,0,80,248,254,100,0,0,194,74,0,0,0,0,0,11,42,152,247,6,79,194,0,0,0,0,0,24,8,1,122,247,8,214,
+58,0,0,59,108,6,89,247,251,242,101,103,178,0,0,39,218,255,16,0,7,28,5,11,228,44,0,11,175,82,255,16,0,0,0,0,126,162,0,0,153,94,106,255,67,0,0,0,22,236,32,0,0,182,224,232,255,222,0,0,0,150,146,0,
+0,0,0,0,64,255,16,0,0,0,91,19,0,0,0,0,0,24,96,6,0,0,64,255,16,0,0,0,0,54,216,13,0,0,0,0,64,255,16,0,0,0,0,73,252,5,0,0,0,0,176,200,0,0,0,0,118,244,43,0,0,0,15,247,
+102,0,0,0,0,51,255,33,0,0,0,3,14,240,165,48,75,178,63,0,64,205,246,223,143,17,0,0,0,94,199,11,0,0,0,0,0,0,0,0,73,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,253,197,0,0,
+0,0,0,0,0,150,147,241,41,0,0,0,0,0,9,240,46,157,140,0,0,0,0,0,93,209,0,64,234,5,0,0,0,0,193,116,0,1,224,83,0,0,0,36,252,26,0,0,133,183,0,0,0,136,255,252,252,252,253,253,29,0,4,231,
+120,44,44,44,44,207,126,0,79,251,19,0,0,0,0,119,224,2,178,186,0,0,0,0,0,34,255,70,0,0,0,0,76,206,21,0,0,0,0,0,0,4,115,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,253,197,
+0,0,0,0,0,0,0,150,147,241,41,0,0,0,0,0,9,240,46,157,140,0,0,0,0,0,93,209,0,64,234,5,0,0,0,0,193,116,0,1,224,83,0,0,0,36,252,26,0,0,133,183,0,0,0,136,255,252,252,252,253,253,29,0,
+4,231,120,44,44,44,44,207,126,0,79,251,19,0,0,0,0,119,224,2,178,186,0,0,0,0,0,34,255,70,0,0,0,8,124,77,0,0,0,0,0,0,0,149,139,210,45,0,0,0,0,0,15,109,0,37,88,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,49,253,197,0,0,0,0,0,0,0,150,147,241,41,0,0,0,0,0,9,240,46,157,140,0,0,0,0,0,93,209,0,64,234,5,0,0,0,0,193,116,0,1,224,83,0,0,0,36,252,26,0,0,133,183,
+0,0,0,136,255,252,252,252,253,253,29,0,4,231,120,44,44,44,44,207,126,0,79,251,19,0,0,0,0,119,224,2,178,186,0,0,0,0,0,34,255,70,0,0,0,154,215,213,194,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,186,253,57,0,0,0,0,0,0,31,243,144,157,0,0,0,0,0,0,129,165,38,243,13,0,0,0,0,2,226,73,0,202,101,0,0,0,0,73,232,3,0,109,201,0,0,0,0,172,143,0,0,
+21,250,45,0,0,21,250,253,252,252,252,255,145,0,0,115,219,44,44,44,44,107,237,7,0,214,134,0,0,0,0,10,245,89,58,255,50,0,0,0,0,0,170,189,0,0,61,244,19,61,244,15,0,0,0,0,9,36,2,9,36,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,62,253,251,24,0,0,0,0,0,0,160,166,214,118,0,0,0,0,0,13,244,67,115,216,0,0,0,0,0,101,223,1,21,250,58,0,0,0,0,199,125,0,0,172,156,0,0,0,41,253,29,
+0,0,72,242,11,0,0,140,255,252,252,252,252,255,96,0,5,233,120,44,44,44,44,154,194,0,81,251,19,0,0,0,0,55,255,37,179,186,0,0,0,0,0,0,225,134,0,0,0,0,111,226,214,74,0,0,0,0,0,0,38,255,103,142,
+241,3,0,0,0,0,0,27,253,70,116,230,0,0,0,0,0,0,0,145,253,255,96,0,0,0,0,0,0,0,204,159,213,155,0,0,0,0,0,0,45,255,53,107,242,10,0,0,0,0,0,144,204,0,13,243,95,0,0,0,0,6,235,99,
+0,0,150,193,0,0,0,0,84,239,10,0,0,43,254,36,0,0,0,182,255,252,252,252,252,255,133,0,0,26,252,87,44,44,44,44,124,228,2,0,122,229,1,0,0,0,0,22,252,73,0,218,146,0,0,0,0,0,0,190,171,0,0,0,
+0,75,255,255,255,255,255,255,255,255,36,0,0,0,0,184,178,82,255,42,24,24,24,24,3,0,0,0,38,254,58,64,255,20,0,0,0,0,0,0,0,0,146,197,0,64,255,20,0,0,0,0,0,0,0,13,242,80,0,64,255,244,244,244,
+244,228,0,0,0,109,217,2,0,64,255,53,36,36,36,33,0,0,1,216,251,244,244,247,255,20,0,0,0,0,0,0,71,244,42,36,36,91,255,20,0,0,0,0,0,0,180,158,0,0,0,64,255,42,24,24,24,24,6,35,253,60,0,0,
+0,64,255,255,255,255,255,255,72,0,0,28,153,226,249,223,164,45,0,35,233,190,72,34,51,134,181,0,185,193,1,0,0,0,0,16,19,254,77,0,0,0,0,0,0,55,255,37,0,0,0,0,0,0,55,255,36,0,0,0,0,0,0,19,
+254,77,0,0,0,0,0,0,0,186,194,1,0,0,0,0,16,0,37,234,190,72,33,49,130,181,0,0,29,155,228,255,228,163,46,0,0,0,0,0,128,151,0,0,0,0,0,10,38,119,249,4,0,0,0,0,25,236,247,157,0,0,0,0,
+71,212,23,0,0,0,0,0,0,57,81,0,0,0,0,0,0,0,0,0,0,0,64,255,255,255,255,255,255,40,64,255,42,24,24,24,24,3,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,244,244,244,244,228,0,64,255,
+53,36,36,36,33,0,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,42,24,24,24,24,6,64,255,255,255,255,255,255,72,0,0,0,54,214,36,0,0,0,0,0,106,31,0,0,0,0,0,0,0,0,0,0,0,64,255,
+255,255,255,255,255,40,64,255,42,24,24,24,24,3,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,244,244,244,244,228,0,64,255,53,36,36,36,33,0,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,
+42,24,24,24,24,6,64,255,255,255,255,255,255,72,0,0,1,115,93,0,0,0,0,0,117,160,196,70,0,0,0,5,114,6,21,103,0,0,0,0,0,0,0,0,0,0,64,255,255,255,255,255,255,40,64,255,42,24,24,24,24,3,64,255,
+20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,244,244,244,244,228,0,64,255,53,36,36,36,33,0,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,42,24,24,24,24,6,64,255,255,255,255,255,255,72,0,61,
+244,15,61,244,15,0,0,9,36,2,9,36,2,0,0,0,0,0,0,0,0,0,64,255,255,255,255,255,255,72,64,255,42,24,24,24,24,6,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,244,244,244,244,244,15,64,255,
+53,36,36,36,36,2,64,255,20,0,0,0,0,0,64,255,20,0,0,0,0,0,64,255,42,24,24,24,24,9,64,255,255,255,255,255,255,104,6,174,122,0,0,4,113,17,0,0,0,0,0,64,255,20,0,64,255,20,0,64,255,20,0,64,
+255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,1,165,135,0,38,97,0,0,0,0,0,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,
+20,0,64,255,20,0,64,255,20,0,64,255,20,0,0,49,128,27,0,14,210,119,188,2,59,66,0,86,38,0,0,0,0,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,
+0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,61,244,19,61,244,15,9,36,2,9,36,2,0,0,0,0,0,0,0,0,232,104,0,0,0,0,232,104,0,0,0,0,232,104,0,0,0,0,232,104,0,0,0,0,
+232,104,0,0,0,0,232,104,0,0,0,0,232,104,0,0,0,0,232,104,0,0,0,0,232,104,0,0,0,0,232,104,0,0,0,64,255,255,253,240,202,125,14,0,0,0,64,255,38,24,38,88,206,219,21,0,0,64,255,16,0,0,0,9,
+216,150,0,0,64,255,16,0,0,0,0,112,230,0,244,247,255,244,244,0,0,0,72,255,7,36,91,255,49,36,0,0,0,73,255,6,0,64,255,16,0,0,0,0,114,229,0,0,64,255,16,0,0,0,9,216,149,0,0,64,255,38,24,37,
+88,206,219,21,0,0,64,255,255,254,241,203,126,14,0,0,0,0,93,209,214,196,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,255,206,1,0,0,64,255,16,64,255,247,80,0,0,64,255,16,64,255,147,
+207,1,0,64,255,16,64,255,35,239,80,0,64,255,16,64,255,20,127,207,1,64,255,16,64,255,20,15,239,81,64,255,16,64,255,20,0,128,208,65,255,16,64,255,20,0,15,239,145,255,16,64,255,20,0,0,128,247,255,16,64,255,20,0,
+0,16,240,255,16,0,0,0,12,125,23,0,0,0,0,0,0,0,0,0,123,178,0,0,0,0,0,0,0,0,0,0,110,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,160,231,250,222,138,14,0,0,0,37,235,177,
+57,30,71,204,208,11,0,0,185,197,1,0,0,0,14,233,135,0,18,254,80,0,0,0,0,0,125,224,0,55,255,37,0,0,0,0,0,82,255,6,55,255,37,0,0,0,0,0,82,255,6,19,254,80,0,0,0,0,0,125,224,0,0,187,
+198,1,0,0,0,14,233,135,0,0,39,236,176,56,29,70,203,208,12,0,0,0,33,162,233,250,224,139,14,0,0,0,0,0,0,0,46,113,1,0,0,0,0,0,0,0,9,213,77,0,0,0,0,0,0,0,0,50,89,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,31,160,231,250,222,138,14,0,0,0,37,235,177,57,30,71,204,208,11,0,0,185,197,1,0,0,0,14,233,135,0,18,254,80,0,0,0,0,0,125,224,0,55,255,37,0,0,0,0,0,82,
+255,6,55,255,37,0,0,0,0,0,82,255,6,19,254,80,0,0,0,0,0,125,224,0,0,187,198,1,0,0,0,14,233,135,0,0,39,236,176,56,29,70,203,208,12,0,0,0,33,162,233,250,224,139,14,0,0,0,0,0,0,53,128,33,
+0,0,0,0,0,0,0,19,214,116,198,5,0,0,0,0,0,0,66,61,0,81,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,160,231,250,222,138,14,0,0,0,37,235,177,57,30,71,204,208,11,0,0,185,197,1,0,
+0,0,14,233,135,0,18,254,80,0,0,0,0,0,125,224,0,55,255,37,0,0,0,0,0,82,255,6,55,255,37,0,0,0,0,0,82,255,6,19,254,80,0,0,0,0,0,125,224,0,0,187,198,1,0,0,0,14,233,135,0,0,39,236,
+176,56,29,70,203,208,12,0,0,0,33,162,233,250,224,139,14,0,0,0,0,0,105,229,109,63,160,0,0,0,0,0,0,193,71,158,211,61,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,31,160,231,250,222,138,14,0,0,0,37,235,177,57,30,71,204,208,11,0,0,185,197,1,0,0,0,14,233,135,0,18,254,80,0,0,0,0,0,125,224,0,55,255,37,0,0,0,0,0,82,255,6,55,255,37,0,0,0,0,0,82,255,
+6,19,254,80,0,0,0,0,0,125,224,0,0,187,198,1,0,0,0,14,233,135,0,0,39,236,176,56,29,70,203,208,12,0,0,0,33,162,233,250,224,139,14,0,0,0,0,0,61,244,76,244,15,0,0,0,0,0,0,9,36,11,36,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,160,231,250,222,138,14,0,0,0,37,235,177,57,30,71,204,208,11,0,0,185,197,1,0,0,0,14,233,135,0,18,254,80,0,0,0,0,0,125,224,0,55,255,37,0,0,0,
+0,0,82,255,6,55,255,37,0,0,0,0,0,82,255,6,19,254,80,0,0,0,0,0,125,224,0,0,187,198,1,0,0,0,14,233,135,0,0,39,236,176,56,29,70,203,208,12,0,0,0,33,162,233,250,224,139,14,0,0,0,58,7,0,
+0,0,0,33,32,1,205,179,5,0,0,30,224,138,0,24,217,174,4,28,221,168,3,0,0,27,221,174,218,173,4,0,0,0,0,55,255,230,8,0,0,0,0,21,212,183,225,160,2,0,0,18,208,184,7,34,227,156,1,1,200,188,8,0,
+0,37,229,133,0,68,10,0,0,0,0,40,38,0,0,0,0,0,0,0,0,0,18,0,0,0,29,156,229,247,215,148,59,211,5,0,34,233,175,55,35,88,223,255,72,0,0,183,197,1,0,0,27,188,188,129,0,18,254,80,0,0,16,193,
+37,98,219,0,55,255,37,0,8,189,63,0,72,250,3,55,255,32,3,175,97,0,0,90,255,7,19,254,77,153,135,0,0,0,136,225,0,0,168,234,172,1,0,0,19,239,136,0,0,97,255,191,65,31,72,209,208,12,0,28,210,49,158,223,
+249,222,137,13,0,0,0,18,0,0,0,0,0,0,0,0,0,0,0,2,118,27,0,0,0,0,0,0,0,103,173,0,0,0,0,0,0,0,0,109,18,0,0,0,0,0,0,0,0,0,0,0,0,64,255,20,0,0,0,64,255,16,64,255,
+20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,50,255,34,0,0,0,79,252,5,15,254,81,0,0,0,127,221,0,0,161,219,
+70,34,88,239,112,0,0,11,140,221,246,213,112,2,0,0,0,0,0,50,96,0,0,0,0,0,0,6,210,59,0,0,0,0,0,0,42,86,0,0,0,0,0,0,0,0,0,0,0,0,0,64,255,20,0,0,0,64,255,16,64,255,20,0,
+0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,50,255,34,0,0,0,79,252,5,15,254,81,0,0,0,127,221,0,0,161,219,70,34,
+88,239,112,0,0,11,140,221,246,213,112,2,0,0,0,0,43,128,23,0,0,0,0,0,6,200,123,172,0,0,0,0,0,44,71,0,93,22,0,0,0,0,0,0,0,0,0,0,0,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,
+64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,64,255,20,0,0,0,64,255,16,50,255,34,0,0,0,79,252,5,15,254,81,0,0,0,127,221,0,0,161,219,70,34,88,239,
+112,0,0,11,140,221,246,213,112,2,0,0,0,61,244,15,61,244,15,0,0,0,9,36,2,9,36,2,0,0,0,0,0,0,0,0,0,0,64,255,20,0,0,0,0,240,16,64,255,20,0,0,0,0,240,16,64,255,20,0,0,0,0,240,
+16,64,255,20,0,0,0,0,240,16,64,255,20,0,0,0,0,240,16,64,255,20,0,0,0,0,240,16,50,255,34,0,0,0,3,249,5,15,254,84,0,0,0,50,221,0,0,161,223,77,33,65,207,112,0,0,11,140,221,246,213,112,2,0,
+0,0,0,0,164,132,0,0,0,0,0,0,36,96,0,0,0,0,0,0,0,0,0,0,0,0,0,132,229,17,0,0,0,42,248,87,5,206,165,0,0,4,203,166,0,0,43,247,83,0,125,229,17,0,0,0,114,234,70,249,70,0,0,0,
+0,1,192,253,149,0,0,0,0,0,0,68,255,24,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,64,255,20,0,0,0,0,0,64,255,244,
+242,217,147,16,0,64,255,53,37,72,219,168,0,64,255,20,0,0,91,245,1,64,255,20,0,0,81,250,4,64,255,20,0,24,195,192,0,64,255,244,244,255,195,36,0,64,255,53,34,10,0,0,0,64,255,20,0,0,0,0,0,64,255,20,
+0,0,0,0,0,0,37,176,235,238,179,33,0,0,4,217,187,48,39,163,203,0,0,43,255,42,0,1,85,255,25,0,64,255,20,1,178,195,80,11,0,64,255,20,47,255,34,0,0,0,64,255,20,31,254,133,1,0,0,64,255,20,0,100,
+246,186,20,0,64,255,20,0,0,35,207,196,0,64,255,20,0,0,0,81,255,6,64,255,20,88,37,38,169,212,0,64,255,20,194,245,240,185,41,0,0,14,126,20,0,0,0,0,0,0,121,177,0,0,0,0,0,0,0,159,104,0,0,0,
+0,0,0,0,0,0,0,0,0,93,205,244,229,154,14,0,0,98,71,33,63,214,152,0,0,0,0,0,0,84,237,0,0,53,182,227,243,247,255,11,12,237,165,60,39,98,255,16,52,255,32,0,0,123,255,16,21,249,138,34,88,227,255,16,
+0,90,224,247,188,95,255,16,0,0,0,0,51,110,0,0,0,0,0,14,218,66,0,0,0,0,0,164,103,0,0,0,0,0,0,0,0,0,0,0,0,93,205,244,229,154,14,0,0,98,71,33,62,212,152,0,0,0,0,0,0,82,237,0,
+0,59,192,239,255,255,255,11,13,239,140,25,3,73,255,16,52,255,31,0,0,129,255,16,20,248,142,34,91,229,255,16,0,87,223,247,187,94,255,16,0,0,0,92,68,0,0,0,0,0,54,204,214,20,0,0,0,4,199,39,78,162,0,0,
+0,0,0,0,0,0,0,0,0,93,205,244,229,154,14,0,0,98,71,33,63,214,152,0,0,0,0,0,0,84,237,0,0,53,182,227,243,247,255,11,12,237,165,60,39,98,255,16,52,255,32,0,0,123,255,16,21,249,138,34,88,227,255,16,
+0,90,224,247,188,95,255,16,0,2,196,209,35,216,1,0,0,40,175,83,217,140,0,0,0,0,0,0,0,0,0,0,0,93,205,244,229,154,14,0,0,98,71,33,63,214,152,0,0,0,0,0,0,84,237,0,0,53,182,227,243,247,255,11,
+12,237,165,60,39,98,255,16,52,255,32,0,0,123,255,16,21,249,138,34,88,227,255,16,0,90,224,247,188,95,255,16,0,64,255,16,64,255,16,0,0,6,24,1,6,24,1,0,0,0,0,0,0,0,0,0,0,114,211,246,227,149,12,0,
+0,112,65,33,66,216,150,0,0,0,0,0,0,84,236,0,0,53,182,227,243,247,255,11,12,237,165,60,39,98,255,16,52,255,32,0,0,123,255,16,21,249,138,34,88,227,255,16,0,90,224,247,188,95,255,16,0,0,52,209,221,76,0,0,
+0,0,203,100,144,237,1,0,0,0,215,58,108,247,3,0,0,0,83,245,252,113,0,0,0,0,0,10,15,0,0,0,0,93,205,244,229,154,14,0,0,99,76,35,47,170,152,0,0,0,0,0,0,9,233,0,0,48,173,223,242,244,255,11,
+10,234,171,64,41,36,248,16,51,255,33,0,0,47,255,16,20,248,144,34,66,203,250,16,0,83,218,248,210,70,240,16,0,92,202,242,242,179,37,85,209,247,219,121,3,0,0,98,71,33,63,214,237,217,76,33,74,226,121,0,0,0,0,0,
+0,84,255,58,0,0,0,94,229,0,0,53,182,227,243,247,255,244,244,244,244,247,255,10,12,237,165,60,39,98,255,64,36,36,36,36,36,2,52,255,32,0,0,123,255,97,0,0,0,0,0,0,21,249,138,34,88,230,165,238,101,37,43,89,
+135,0,0,88,219,247,203,61,1,107,210,247,237,197,99,0,0,2,118,220,249,226,123,0,137,239,96,35,60,100,13,248,104,0,0,0,0,54,255,37,0,0,0,0,55,255,37,0,0,0,0,13,248,104,0,0,0,0,0,137,239,96,35,56,
+99,0,2,121,223,255,232,120,0,0,0,0,124,159,0,0,0,6,40,119,250,4,0,0,15,234,247,159,0,0,0,90,85,0,0,0,0,0,0,0,30,224,72,0,0,0,0,0,0,0,40,218,37,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,110,217,248,219,123,4,0,0,128,217,76,33,72,224,129,0,10,246,59,0,0,0,91,232,0,53,255,255,255,255,255,255,255,12,55,255,37,0,0,0,0,0,0,12,247,106,0,0,0,0,0,0,0,127,241,105,38,45,94,137,0,
+0,0,102,209,249,238,198,97,0,0,0,0,0,0,89,86,0,0,0,0,0,0,78,222,27,0,0,0,0,0,39,218,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,110,217,248,218,119,3,0,0,128,220,78,33,74,226,121,0,10,
+246,62,0,0,0,94,229,0,53,255,245,244,244,244,247,255,10,55,255,67,36,36,36,36,36,2,12,247,98,0,0,0,0,0,0,0,127,238,101,37,45,92,131,0,0,0,102,209,249,238,198,97,0,0,0,0,26,128,26,0,0,0,0,0,
+0,184,176,185,1,0,0,0,0,107,157,0,157,110,0,0,0,0,0,0,0,0,0,0,0,0,0,110,217,248,218,119,3,0,0,128,220,78,33,74,226,121,0,10,246,62,0,0,0,94,229,0,53,255,245,244,244,244,247,255,10,55,255,67,
+36,36,36,36,36,2,12,247,98,0,0,0,0,0,0,0,127,238,101,37,45,92,131,0,0,0,102,209,249,238,198,97,0,0,0,64,255,80,255,16,0,0,0,0,6,24,7,24,1,0,0,0,0,0,0,0,0,0,0,0,0,0,110,217,
+248,218,119,3,0,0,128,220,78,33,74,226,121,0,10,246,62,0,0,0,94,229,0,53,255,245,244,244,244,247,255,10,55,255,67,36,36,36,36,36,2,12,247,98,0,0,0,0,0,0,0,127,238,101,37,45,92,131,0,0,0,102,209,249,
+238,198,97,0,93,75,0,0,36,226,55,0,0,52,216,24,0,0,0,0,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,0,101,68,0,98,206,13,53,213,23,0,
+0,0,0,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,64,255,20,0,0,37,127,15,0,3,199,179,158,0,118,139,1,180,74,0,0,0,0,0,0,64,255,20,0,0,64,255,
+20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,0,64,255,20,0,64,255,20,152,184,6,24,1,14,17,0,0,0,0,0,0,0,236,16,0,0,0,236,16,0,0,0,236,16,0,0,0,
+236,16,0,0,0,236,16,0,0,0,236,16,0,0,0,236,16,0,0,0,236,16,0,0,0,103,248,80,74,151,39,0,0,21,97,219,255,161,29,0,0,0,64,86,13,116,239,43,0,0,0,2,127,228,250,254,218,12,0,0,126,239,97,35,
+56,232,125,0,8,246,104,0,0,0,126,217,0,45,255,37,0,0,0,81,254,5,43,255,36,0,0,0,82,255,6,7,245,100,0,0,0,147,211,0,0,123,236,86,37,110,249,86,0,0,2,123,226,250,213,89,0,0,0,0,145,225,52,196,
+17,0,0,0,202,62,204,163,0,0,0,0,0,0,0,0,0,0,64,255,101,186,246,201,38,0,64,255,223,77,41,199,187,0,64,255,123,0,0,88,248,1,64,255,81,0,0,65,255,14,64,255,76,0,0,64,255,16,64,255,76,0,0,64,
+255,16,64,255,76,0,0,64,255,16,64,255,76,0,0,64,255,16,0,0,107,72,0,0,0,0,0,0,0,49,231,54,0,0,0,0,0,0,0,58,218,27,0,0,0,0,0,0,0,0,0,0,0,0,0,4,132,227,250,217,100,0,0,0,
+136,236,86,37,108,249,84,0,9,248,100,0,0,0,144,209,0,45,255,36,0,0,0,81,249,3,46,255,36,0,0,0,81,249,3,9,248,100,0,0,0,144,208,0,0,135,236,85,37,108,249,84,0,0,4,133,228,250,217,100,0,0,0,0,
+0,0,0,98,81,0,0,0,0,0,0,97,215,21,0,0,0,0,0,57,215,27,0,0,0,0,0,0,0,0,0,0,0,0,0,4,132,227,250,217,100,0,0,0,136,236,86,37,108,249,84,0,9,248,100,0,0,0,144,209,0,45,255,36,
+0,0,0,81,249,3,46,255,36,0,0,0,81,249,3,9,248,100,0,0,0,144,208,0,0,135,236,85,37,108,249,84,0,0,4,133,228,250,217,100,0,0,0,0,0,39,127,17,0,0,0,0,0,7,207,176,171,0,0,0,0,0,144,131,
+0,170,99,0,0,0,0,0,0,0,0,0,0,0,0,4,132,227,250,217,100,0,0,0,136,236,86,37,108,249,84,0,9,248,100,0,0,0,144,209,0,45,255,36,0,0,0,81,249,3,46,255,36,0,0,0,81,249,3,9,248,100,0,0,
+0,144,208,0,0,135,236,85,37,108,249,84,0,0,4,133,228,250,217,100,0,0,0,0,131,241,128,48,191,0,0,0,0,217,51,164,224,80,0,0,0,0,0,0,0,0,0,0,0,0,4,132,227,250,217,100,0,0,0,136,236,86,37,108,
+249,84,0,9,248,100,0,0,0,144,209,0,45,255,36,0,0,0,81,249,3,46,255,36,0,0,0,81,249,3,9,248,100,0,0,0,144,208,0,0,135,236,85,37,108,249,84,0,0,4,133,228,250,217,100,0,0,0,0,64,255,80,255,16,
+0,0,0,0,6,24,7,24,1,0,0,0,0,0,0,0,0,0,0,0,0,4,132,227,250,217,100,0,0,0,136,236,86,37,108,249,84,0,9,248,100,0,0,0,144,209,0,45,255,36,0,0,0,81,249,3,46,255,36,0,0,0,81,249,
+3,9,248,100,0,0,0,144,208,0,0,135,236,85,37,108,249,84,0,0,4,133,228,250,217,100,0,0,0,0,0,64,255,16,0,0,0,0,0,0,6,24,1,0,0,0,244,244,244,244,244,244,244,244,244,36,36,36,36,36,36,36,36,36,
+0,0,0,0,0,0,0,0,0,0,0,0,61,244,15,0,0,0,0,0,0,9,36,2,0,0,0,0,0,0,0,0,0,0,46,5,0,4,129,226,247,210,117,214,24,0,133,232,77,38,165,255,124,0,9,248,97,0,29,225,175,210,0,45,
+255,37,11,207,92,73,251,3,48,255,31,176,126,0,83,249,3,12,247,198,161,0,0,148,209,0,0,167,253,86,36,110,250,85,0,52,207,131,225,249,215,99,0,0,18,34,0,0,0,0,0,0,0,0,22,126,14,0,0,0,0,0,0,135,
+166,0,0,0,0,0,0,1,169,98,0,0,0,0,0,0,0,0,0,0,0,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,62,255,21,0,0,69,255,16,41,255,45,
+0,0,116,255,16,5,227,170,37,80,222,255,16,0,62,212,247,189,93,255,16,0,0,0,0,53,109,0,0,0,0,0,18,220,63,0,0,0,0,0,174,94,0,0,0,0,0,0,0,0,0,0,0,64,255,20,0,0,64,255,16,64,255,20,
+0,0,64,255,16,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,62,255,21,0,0,69,255,16,41,255,45,0,0,116,255,16,5,227,170,37,80,222,255,16,0,62,212,247,189,93,255,16,0,0,0,98,64,0,0,0,0,0,65,
+200,216,17,0,0,0,9,204,31,87,157,0,0,0,0,0,0,0,0,0,0,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,62,255,21,0,0,69,255,16,41,255,45,
+0,0,116,255,16,5,227,170,37,80,222,255,16,0,62,212,247,189,93,255,16,0,64,255,16,64,255,16,0,0,6,24,1,6,24,1,0,0,0,0,0,0,0,0,0,64,255,20,0,0,64,255,16,64,255,20,0,0,64,255,16,64,255,20,
+0,0,64,255,16,64,255,20,0,0,64,255,16,62,255,21,0,0,69,255,16,41,255,45,0,0,116,255,16,5,227,170,37,80,222,255,16,0,62,212,247,189,93,255,16,0,0,0,0,26,126,17,0,0,0,0,4,196,114,0,0,0,0,0,
+142,142,0,0,0,0,0,0,0,0,0,0,0,126,212,0,0,0,0,197,145,28,252,54,0,0,39,255,46,0,180,152,0,0,137,203,0,0,79,240,9,3,230,104,0,0,4,230,92,77,245,14,0,0,0,134,190,175,161,0,0,0,0,34,
+253,251,62,0,0,0,0,0,190,218,0,0,0,0,0,1,216,119,0,0,0,0,22,114,245,19,0,0,0,0,255,235,91,0,0,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,
+64,255,68,198,248,225,108,0,0,64,255,222,86,37,108,249,86,0,64,255,99,0,0,0,144,208,0,64,255,36,0,0,0,81,249,3,64,255,35,0,0,0,81,250,3,64,255,98,0,0,0,143,209,0,64,255,220,84,36,106,248,88,0,64,
+255,70,200,248,226,110,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,64,255,20,0,0,0,0,0,0,0,64,255,20,64,255,16,0,0,6,24,1,6,24,1,0,0,0,0,0,0,0,0,0,191,151,0,0,0,
+0,200,144,92,242,12,0,0,45,255,42,9,240,103,0,0,148,194,0,0,151,206,0,10,240,91,0,0,52,255,54,97,236,7,0,0,0,209,158,200,141,0,0,0,0,110,249,255,39,0,0,0,0,18,250,191,0,0,0,0,0,41,255,88,
+0,0,0,5,31,173,225,4,0,0,0,64,255,222,63,0,0,0,0,
+    };
+    static const signed char asciiKerning14[128 * 128] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,1,0,0,0,1,0,0,0,0,0,0,0,1,0,1,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,1,1,1,0,1,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,0,0,0,0,0,1,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,-1,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,-2,0,-1,-1,-1,-2,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,-1,0,0,-1,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,1,0,0,0,1,0,0,0,0,0,0,0,1,0,1,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,1,1,1,0,1,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,0,0,0,0,0,1,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,1,0,0,0,1,0,0,0,0,0,0,0,1,0,1,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,1,1,1,0,1,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,0,0,0,0,0,1,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,1,0,0,0,1,0,0,0,0,0,0,0,1,0,1,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,1,1,1,0,1,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,0,0,0,0,0,1,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,-1,0,-2,-1,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,-1,0,-1,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,-1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,1,1,1,0,
+1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,-1,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,-1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,-1,-2,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,-1,-1,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,-1,-1,0,0,0,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,-1,0,0,0,-1,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,-1,-1,0,-2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,-1,-1,-3,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,-1,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,-1,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,-1,-1,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,-1,-1,0,-1,-1,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,-1,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,-2,-2,0,0,0,0,0,0,0,0,0,0,0,-2,0,1,1,1,0,
+0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,-2,0,-2,0,-2,0,0,0,-1,0,0,0,0,0,-2,0,0,-2,-2,-1,-2,0,-2,0,-2,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,-1,-2,-2,0,0,0,0,0,0,0,0,0,0,0,-2,-1,0,0,0,-1,
+0,-1,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,-1,0,0,0,-1,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,-1,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,-1,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,-1,-1,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-2,-3,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,-1,
+0,-1,-1,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,-2,-1,0,0,-2,-1,0,-1,-1,-1,-1,-1,-1,-1,-2,-1,0,-1,0,-1,-2,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,-1,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,0,-1,0,-1,0,0,0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,0,-1,
+0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,0,-1,-1,-1,-1,-1,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,0,1,1,1,1,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,-1,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,1,0,0,0,1,0,0,0,0,0,0,0,1,0,1,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,0,1,1,1,0,1,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,0,0,0,0,0,1,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,
+    };
+
+    static const GlyphMetrics metrics16[256] = {
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {5, 0, 0, 3},
+        {6, 27, 4, 4},
+        {8, -29, -3, 5},
+        {13, 15, -14, 6},
+        {10, 21, 10, 7},
+        {15, -7, -25, 8},
+        {13, 1, 31, 9},
+        {5, -29, -3, 10},
+        {6, 24, 9, 11},
+        {6, 22, 7, 12},
+        {8, 32, 32, 13},
+        {14, -19, 20, 14},
+        {5, -8, -5, 15},
+        {6, -14, 14, 16},
+        {5, -18, -16, 17},
+        {5, 0, -25, 18},
+        {10, 0, 0, 19},
+        {10, 0, 0, 20},
+        {10, 0, 0, 21},
+        {10, 0, 0, 22},
+        {10, 0, 0, 23},
+        {10, 0, 0, 24},
+        {10, 0, 0, 25},
+        {10, 0, 0, 26},
+        {10, 0, 0, 27},
+        {10, 0, 0, 28},
+        {5, -8, -24, 29},
+        {5, -8, -24, 30},
+        {14, -19, 20, 31},
+        {14, -19, 20, 32},
+        {14, -19, 20, 33},
+        {9, 10, 23, 34},
+        {16, 4, -7, 35},
+        {11, 0, 3, 36},
+        {11, -27, -9, 37},
+        {11, -6, -23, 38},
+        {12, -27, -30, 39},
+        {10, -27, -30, 40},
+        {10, -27, 28, 41},
+        {12, -6, -20, 42},
+        {13, -27, 28, 43},
+        {5, -27, -5, 44},
+        {5, -13, -5, 45},
+        {11, -27, 9, 46},
+        {9, -27, -18, 47},
+        {14, -27, -5, 48},
+        {13, -27, 28, 49},
+        {12, -6, -26, 50},
+        {10, -27, -4, 51},
+        {12, -6, -26, 52},
+        {12, -27, 30, 53},
+        {10, 7, 7, 54},
+        {10, 5, -5, 55},
+        {11, 25, -25, 56},
+        {11, 0, 3, 57},
+        {16, 0, 11, 58},
+        {11, 0, 2, 59},
+        {10, 6, 25, 60},
+        {11, -18, 6, 61},
+        {6, 24, 3, 62},
+        {5, 0, -25, 63},
+        {6, 27, 7, 64},
+        {13, 0, -26, 65},
+        {8, -2, 2, 66},
+        {8, 0, 0, 67},
+        {10, -2, 2, 68},
+        {10, 29, 8, 69},
+        {9, -7, 1, 70},
+        {10, -7, -29, 71},
+        {10, -7, 10, 72},
+        {6, -40, -21, 73},
+        {10, -7, -29, 74},
+        {10, 29, 8, 75},
+        {5, -31, -1, 76},
+        {5, -11, -1, 77},
+        {9, 29, 8, 78},
+        {5, -31, -1, 79},
+        {15, 29, 10, 80},
+        {10, 29, 8, 81},
+        {10, -7, 8, 82},
+        {10, 29, 8, 83},
+        {10, -7, -29, 84},
+        {6, 29, -12, 85},
+        {8, -8, -19, 86},
+        {7, -36, 39, 87},
+        {10, 23, 2, 88},
+        {9, 0, -30, 89},
+        {13, 0, -6, 90},
+        {9, 0, -30, 91},
+        {9, 0, -30, 92},
+        {9, -20, 20, 93},
+        {10, 32, 0, 94},
+        {6, 2, 29, 95},
+        {10, 32, 0, 96},
+        {14, -19, 20, 97},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {10, 0, 25, 0},
+        {5, 0, 0, 98},
+        {6, 27, 4, 99},
+        {10, 22, -2, 100},
+        {11, 1, 27, 101},
+        {11, -14, 16, 102},
+        {10, 20, 11, 103},
+        {6, 2, 29, 104},
+        {8, -18, -16, 105},
+        {8, -20, -12, 106},
+        {16, 14, -13, 107},
+        {7, -8, -4, 108},
+        {10, 15, 32, 109},
+        {13, 26, -13, 110},
+        {6, -14, 14, 111},
+        {16, 14, -13, 112},
+        {9, -21, 22, 113},
+        {9, -30, 31, 114},
+        {14, -19, 20, 115},
+        {6, 10, -3, 116},
+        {6, 25, 13, 117},
+        {8, 0, 0, 118},
+        {10, 23, -1, 119},
+        {11, -17, 17, 120},
+        {5, -18, -16, 121},
+        {8, 27, 0, 122},
+        {6, -14, -30, 123},
+        {8, -18, 17, 124},
+        {10, -31, -15, 125},
+        {16, -12, -6, 126},
+        {16, -12, -4, 127},
+        {15, 27, -6, 128},
+        {8, 8, -10, 129},
+        {11, 0, 3, 130},
+        {11, 0, 3, 131},
+        {11, 0, 3, 132},
+        {11, -7, 6, 133},
+        {11, 10, 21, 134},
+        {11, 21, 10, 135},
+        {15, 3, -31, 136},
+        {11, -6, -23, 137},
+        {10, -27, -30, 138},
+        {10, -27, -30, 139},
+        {10, -27, -30, 140},
+        {11, -27, 29, 141},
+        {5, -27, -5, 142},
+        {5, -27, -5, 143},
+        {5, -27, -5, 144},
+        {6, -53, 21, 145},
+        {13, -51, -30, 146},
+        {13, -27, 28, 147},
+        {12, -6, -26, 148},
+        {12, -6, -26, 149},
+        {12, -6, -26, 150},
+        {12, -6, -26, 151},
+        {12, -6, -26, 152},
+        {13, 0, -26, 153},
+        {12, -6, -26, 154},
+        {11, 25, -25, 155},
+        {11, 25, -25, 156},
+        {11, 25, -25, 157},
+        {11, 25, -25, 158},
+        {10, 6, 25, 159},
+        {10, -27, -6, 160},
+        {10, 29, 17, 161},
+        {10, -2, 2, 162},
+        {10, -2, 2, 163},
+        {10, -2, 2, 164},
+        {10, -2, 2, 165},
+        {10, -2, 2, 166},
+        {10, -2, 2, 167},
+        {16, -2, 10, 168},
+        {9, -7, 1, 169},
+        {10, -7, 10, 170},
+        {10, -7, 10, 171},
+        {10, -7, 10, 172},
+        {10, -7, 10, 173},
+        {5, -31, -1, 174},
+        {5, -31, -1, 175},
+        {5, -31, -1, 176},
+        {5, 2, 29, 177},
+        {10, -7, 8, 178},
+        {10, 29, 8, 179},
+        {10, -7, 8, 180},
+        {10, -7, 8, 181},
+        {10, -7, 8, 182},
+        {10, -7, 8, 183},
+        {10, -7, 8, 184},
+        {14, -19, 20, 185},
+        {10, -7, 8, 186},
+        {10, 23, 2, 187},
+        {10, 23, 2, 188},
+        {10, 23, 2, 189},
+        {10, 23, 2, 190},
+        {9, 0, -30, 191},
+        {10, 29, 8, 192},
+        {9, 17, 5, 193},
+    };
+    static const GlyphBitmap glyphs16[] = {
+        {32, 0, 0, 0, 0, 0},
+        {33, 2, -12, 2, 12, 0},
+        {34, 2, -12, 5, 4, 24},
+        {35, 1, -12, 11, 12, 44},
+        {36, 1, -12, 8, 15, 176},
+        {37, 1, -12, 14, 12, 296},
+        {38, 1, -12, 12, 12, 464},
+        {39, 2, -12, 2, 4, 608},
+        {40, 1, -12, 4, 15, 616},
+        {41, 0, -12, 5, 15, 676},
+        {42, -1, -12, 9, 7, 751},
+        {43, 2, -10, 10, 10, 814},
+        {44, 1, -2, 3, 4, 914},
+        {45, 1, -6, 4, 3, 926},
+        {46, 2, -2, 2, 2, 938},
+        {47, 0, -12, 6, 13, 942},
+        {48, 1, -12, 8, 12, 1020},
+        {49, 2, -12, 7, 12, 1116},
+        {50, 1, -12, 8, 12, 1200},
+        {51, 1, -12, 8, 12, 1296},
+        {52, 0, -12, 10, 12, 1392},
+        {53, 1, -12, 8, 12, 1512},
+        {54, 1, -12, 8, 12, 1608},
+        {55, 1, -12, 8, 12, 1704},
+        {56, 1, -12, 8, 12, 1800},
+        {57, 1, -12, 8, 12, 1896},
+        {58, 2, -8, 2, 8, 1992},
+        {59, 1, -8, 3, 10, 2008},
+        {60, 2, -10, 10, 10, 2038},
+        {61, 2, -8, 10, 6, 2138},
+        {62, 2, -10, 10, 10, 2198},
+        {63, 1, -12, 7, 12, 2298},
+        {64, 1, -12, 14, 16, 2382},
+        {65, 0, -12, 11, 12, 2606},
+        {66, 2, -12, 8, 12, 2738},
+        {67, 1, -12, 10, 12, 2834},
+        {68, 2, -12, 10, 12, 2954},
+        {69, 2, -12, 8, 12, 3074},
+        {70, 2, -12, 7, 12, 3170},
+        {71, 1, -12, 10, 12, 3254},
+        {72, 2, -12, 9, 12, 3374},
+        {73, 2, -12, 2, 12, 3482},
+        {74, -1, -12, 5, 15, 3506},
+        {75, 2, -12, 10, 12, 3581},
+        {76, 2, -12, 8, 12, 3701},
+        {77, 2, -12, 11, 12, 3797},
+        {78, 2, -12, 9, 12, 3929},
+        {79, 1, -12, 11, 12, 4037},
+        {80, 2, -12, 8, 12, 4169},
+        {81, 1, -12, 11, 14, 4265},
+        {82, 2, -12, 10, 12, 4419},
+        {83, 1, -12, 8, 12, 4539},
+        {84, 0, -12, 10, 12, 4635},
+        {85, 1, -12, 9, 12, 4755},
+        {86, 0, -12, 11, 12, 4863},
+        {87, 0, -12, 16, 12, 4995},
+        {88, 0, -12, 11, 12, 5187},
+        {89, -1, -12, 11, 12, 5319},
+        {90, 1, -12, 9, 12, 5451},
+        {91, 1, -12, 4, 15, 5559},
+        {92, 0, -12, 6, 13, 5619},
+        {93, 1, -12, 4, 15, 5697},
+        {94, 1, -12, 11, 5, 5757},
+        {95, 0, 2, 8, 3, 5812},
+        {96, 1, -13, 5, 3, 5836},
+        {97, 1, -9, 8, 9, 5851},
+        {98, 1, -12, 8, 12, 5923},
+        {99, 1, -9, 7, 9, 6019},
+        {100, 1, -12, 8, 12, 6082},
+        {101, 1, -9, 8, 9, 6178},
+        {102, 1, -12, 6, 12, 6250},
+        {103, 1, -9, 8, 12, 6322},
+        {104, 1, -12, 8, 12, 6418},
+        {105, 2, -12, 2, 12, 6514},
+        {106, 0, -12, 4, 15, 6538},
+        {107, 1, -12, 8, 12, 6598},
+        {108, 2, -12, 2, 12, 6694},
+        {109, 1, -9, 13, 9, 6718},
+        {110, 1, -9, 8, 9, 6835},
+        {111, 1, -9, 8, 9, 6907},
+        {112, 1, -9, 8, 12, 6979},
+        {113, 1, -9, 8, 12, 7075},
+        {114, 1, -10, 6, 10, 7171},
+        {115, 1, -9, 7, 9, 7231},
+        {116, 1, -12, 5, 12, 7294},
+        {117, 1, -9, 8, 9, 7354},
+        {118, 0, -9, 9, 9, 7426},
+        {119, 0, -9, 13, 9, 7507},
+        {120, 0, -9, 9, 9, 7624},
+        {121, 0, -9, 9, 12, 7705},
+        {122, 1, -9, 7, 9, 7813},
+        {123, 1, -12, 7, 16, 7876},
+        {124, 2, -12, 2, 16, 7988},
+        {125, 1, -12, 7, 16, 8020},
+        {126, 2, -7, 10, 4, 8132},
+        {160, 0, 0, 0, 0, 8172},
+        {161, 2, -12, 2, 12, 8172},
+        {162, 1, -12, 8, 15, 8196},
+        {163, 1, -12, 8, 12, 8316},
+        {164, 0, -10, 11, 10, 8412},
+        {165, 0, -12, 10, 12, 8522},
+        {166, 2, -11, 2, 14, 8642},
+        {167, 1, -12, 7, 14, 8670},
+        {168, 2, -13, 5, 3, 8768},
+        {169, 2, -13, 12, 14, 8783},
+        {170, 1, -11, 5, 8, 8951},
+        {171, 1, -9, 7, 8, 8991},
+        {172, 1, -8, 11, 6, 9047},
+        {173, 1, -6, 4, 3, 9113},
+        {174, 2, -13, 12, 14, 9125},
+        {175, 2, -13, 5, 3, 9293},
+        {176, 2, -13, 5, 7, 9308},
+        {177, 2, -10, 10, 10, 9343},
+        {178, 0, -11, 6, 6, 9443},
+        {179, 0, -11, 5, 6, 9479},
+        {180, 2, -13, 5, 3, 9509},
+        {181, 1, -9, 9, 12, 9524},
+        {182, 1, -12, 8, 14, 9632},
+        {183, 2, -7, 2, 2, 9744},
+        {184, 1, -1, 5, 4, 9748},
+        {185, 1, -11, 5, 6, 9768},
+        {186, 1, -11, 6, 8, 9798},
+        {187, 2, -9, 7, 8, 9846},
+        {188, 1, -12, 15, 13, 9902},
+        {189, 1, -12, 15, 13, 10097},
+        {190, 0, -13, 15, 14, 10292},
+        {191, 1, -12, 6, 12, 10502},
+        {192, 0, -15, 11, 15, 10574},
+        {193, 0, -15, 11, 15, 10739},
+        {194, 0, -15, 11, 15, 10904},
+        {195, 0, -16, 11, 16, 11069},
+        {196, -1, -15, 12, 15, 11245},
+        {197, -1, -16, 12, 16, 11425},
+        {198, 0, -12, 15, 12, 11617},
+        {199, 1, -12, 10, 15, 11797},
+        {200, 2, -15, 8, 15, 11947},
+        {201, 2, -15, 8, 15, 12067},
+        {202, 2, -15, 8, 15, 12187},
+        {203, 2, -15, 8, 15, 12307},
+        {204, 0, -15, 4, 15, 12427},
+        {205, 1, -15, 4, 15, 12487},
+        {206, 0, -15, 6, 15, 12547},
+        {207, 1, -15, 5, 15, 12637},
+        {208, 1, -12, 12, 12, 12712},
+        {209, 2, -16, 9, 16, 12856},
+        {210, 1, -15, 11, 15, 13000},
+        {211, 1, -15, 11, 15, 13165},
+        {212, 1, -15, 11, 15, 13330},
+        {213, 1, -16, 11, 16, 13495},
+        {214, 1, -16, 11, 16, 13671},
+        {215, 2, -10, 10, 10, 13847},
+        {216, 0, -13, 12, 14, 13947},
+        {217, 1, -15, 9, 15, 14115},
+        {218, 1, -15, 9, 15, 14250},
+        {219, 1, -15, 9, 15, 14385},
+        {220, 1, -16, 9, 16, 14520},
+        {221, -1, -15, 11, 15, 14664},
+        {222, 2, -12, 8, 12, 14829},
+        {223, 1, -12, 8, 12, 14925},
+        {224, 1, -13, 8, 13, 15021},
+        {225, 1, -13, 8, 13, 15125},
+        {226, 1, -13, 8, 13, 15229},
+        {227, 1, -12, 8, 12, 15333},
+        {228, 1, -12, 8, 12, 15429},
+        {229, 1, -15, 8, 15, 15525},
+        {230, 1, -9, 14, 9, 15645},
+        {231, 1, -9, 7, 12, 15771},
+        {232, 1, -13, 8, 13, 15855},
+        {233, 1, -13, 8, 13, 15959},
+        {234, 1, -13, 8, 13, 16063},
+        {235, 1, -12, 8, 12, 16167},
+        {236, 0, -13, 4, 13, 16263},
+        {237, 1, -13, 5, 13, 16315},
+        {238, 0, -13, 6, 13, 16380},
+        {239, 0, -12, 5, 12, 16458},
+        {240, 1, -12, 8, 12, 16518},
+        {241, 1, -12, 8, 12, 16614},
+        {242, 1, -13, 8, 13, 16710},
+        {243, 1, -13, 8, 13, 16814},
+        {244, 1, -13, 8, 13, 16918},
+        {245, 1, -12, 8, 12, 17022},
+        {246, 1, -12, 8, 12, 17118},
+        {247, 2, -9, 10, 8, 17214},
+        {248, 0, -10, 10, 11, 17294},
+        {249, 1, -13, 8, 13, 17404},
+        {250, 1, -13, 8, 13, 17508},
+        {251, 1, -13, 8, 13, 17612},
+        {252, 1, -12, 8, 12, 17716},
+        {253, 0, -13, 9, 16, 17812},
+        {254, 1, -12, 8, 15, 17956},
+        {255, 0, -12, 9, 15, 18076},
+    };
+    static const unsigned char pixels16[] = {
+255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,0,0,0,0,252,129,255,132,255,132,0,255,132,255,132,0,255,132,255,132,0,255,132,255,132,0,255,132,0,0,0,0,138,177,0,15,254,45,0,0,0,0,0,189,126,0,65,246,
+4,0,0,0,0,0,239,75,0,116,199,0,0,0,0,0,35,255,25,0,167,149,0,0,0,255,255,255,255,255,255,255,255,255,255,0,48,48,178,178,48,76,255,67,48,48,0,0,0,213,106,0,87,228,0,0,0,4,4,20,254,51,4,145,
+173,4,4,0,255,255,255,255,255,255,255,255,255,255,0,52,52,167,185,52,71,255,82,52,52,0,0,0,211,103,0,89,226,0,0,0,0,0,28,255,31,0,160,153,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,0,0,0,0,
+26,172,239,255,247,218,125,0,180,238,90,230,71,114,145,0,243,145,0,224,0,0,0,0,218,195,8,224,0,0,0,0,74,241,235,246,130,61,0,0,0,19,93,242,203,255,179,5,0,0,0,224,0,83,255,93,1,0,0,224,0,17,255,114,
+207,94,45,227,59,182,249,44,120,202,240,255,239,194,69,0,0,0,0,224,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,112,0,0,0,0,18,170,241,219,86,0,0,0,0,107,169,0,0,0,160,237,81,157,251,39,0,0,23,226,
+26,0,0,0,234,151,0,20,255,108,0,0,164,111,0,0,0,0,241,143,0,12,255,116,0,65,207,3,0,0,0,0,185,220,28,114,255,60,6,213,56,0,0,0,0,0,42,222,255,254,137,0,122,153,0,0,0,0,0,0,0,3,37,17,
+0,32,225,18,20,169,237,217,88,0,0,0,0,0,0,179,96,0,165,219,21,110,252,43,0,0,0,0,80,194,1,0,237,142,0,11,255,111,0,0,0,10,220,44,0,0,237,151,0,21,255,112,0,0,0,137,138,0,0,0,169,237,80,157,
+253,45,0,0,42,221,11,0,0,0,23,175,242,222,94,0,0,0,71,207,246,225,154,0,0,0,0,0,0,37,248,177,68,95,199,0,0,0,0,0,0,110,255,17,0,0,0,0,0,0,0,0,0,110,255,55,0,0,0,0,0,0,0,0,
+0,30,249,212,16,0,0,0,0,0,0,0,0,102,220,248,194,9,0,0,0,0,0,0,85,245,37,79,251,178,4,0,13,255,95,0,213,163,0,0,89,253,160,1,79,252,25,0,248,148,0,0,0,101,255,142,212,158,0,0,205,223,13,0,
+0,0,117,255,246,20,0,0,67,250,210,94,66,106,219,229,253,151,0,0,0,55,180,240,249,216,130,14,104,255,138,0,255,132,255,132,255,132,255,132,0,11,231,83,0,126,211,1,6,235,107,0,87,253,20,0,159,212,0,0,215,165,0,0,
+241,144,0,0,249,137,0,0,230,153,0,0,190,186,0,0,128,238,1,0,41,255,60,0,0,192,153,0,0,59,247,26,0,0,104,57,1,207,116,0,0,0,81,238,17,0,0,3,231,115,0,0,0,146,215,0,0,0,84,255,32,0,0,35,
+255,89,0,0,14,255,115,0,0,5,255,124,0,0,23,255,104,0,0,56,255,64,0,0,111,248,8,0,0,187,168,0,0,26,252,64,0,0,143,188,0,0,0,118,41,0,0,0,0,0,0,228,0,0,0,0,0,115,30,0,228,0,29,117,
+0,0,81,202,127,233,125,200,79,0,0,0,4,174,255,174,4,0,0,0,77,200,128,233,126,200,78,0,0,117,31,0,228,0,29,118,0,0,0,0,0,228,0,0,0,0,0,0,0,0,132,255,0,0,0,0,0,0,0,0,132,255,0,0,
+0,0,0,0,0,0,132,255,0,0,0,0,4,4,4,4,133,255,4,4,4,4,255,255,255,255,255,255,255,255,255,255,52,52,52,52,157,255,52,52,52,52,0,0,0,0,132,255,0,0,0,0,0,0,0,0,132,255,0,0,0,0,0,0,
+0,0,132,255,0,0,0,0,0,0,0,0,132,255,0,0,0,0,0,255,132,11,255,110,70,243,16,133,145,0,4,4,4,4,255,255,255,255,52,52,52,52,252,129,255,132,0,0,0,25,254,59,0,0,0,105,233,2,0,0,0,185,155,0,
+0,0,14,249,75,0,0,0,89,243,7,0,0,0,169,171,0,0,0,6,241,91,0,0,0,73,250,16,0,0,0,153,187,0,0,0,1,230,107,0,0,0,57,255,28,0,0,0,137,203,0,0,0,0,216,123,0,0,0,0,0,30,173,241,
+241,172,28,0,12,221,212,80,80,212,218,10,113,253,36,0,0,36,253,110,190,197,0,0,0,0,197,189,233,153,0,0,0,0,154,231,250,136,0,0,0,0,136,249,250,135,0,0,0,0,137,249,233,153,0,0,0,0,154,231,190,196,0,0,
+0,0,196,189,114,252,34,0,0,35,252,111,13,223,211,79,79,211,220,11,0,32,175,242,242,174,30,0,132,182,231,255,132,0,0,244,198,149,255,132,0,0,2,0,0,255,132,0,0,0,0,0,255,132,0,0,0,0,0,255,132,0,0,0,
+0,0,255,132,0,0,0,0,0,255,132,0,0,0,0,0,255,132,0,0,0,0,0,255,132,0,0,0,0,0,255,132,0,0,84,84,84,255,172,84,84,255,255,255,255,255,255,255,111,182,227,246,216,138,17,0,245,158,87,63,108,233,215,10,
+22,0,0,0,0,66,255,96,0,0,0,0,0,10,255,125,0,0,0,0,0,79,255,82,0,0,0,0,18,223,210,3,0,0,0,10,195,238,41,0,0,0,9,189,242,54,0,0,0,8,186,245,61,0,0,0,7,184,247,67,0,0,0,0,
+179,255,128,56,56,56,56,28,255,255,255,255,255,255,255,132,97,197,235,249,226,164,39,0,116,130,80,63,96,215,240,29,0,0,0,0,0,40,255,115,0,0,0,0,0,20,255,110,0,0,3,7,39,176,231,22,0,0,236,255,255,220,42,0,
+0,0,47,55,83,184,234,52,0,0,0,0,0,2,199,203,0,0,0,0,0,0,145,247,0,0,0,0,0,5,206,211,209,118,78,64,94,196,252,77,151,211,241,251,230,173,57,0,0,0,0,0,1,194,255,132,0,0,0,0,0,0,108,230,
+255,132,0,0,0,0,0,32,243,81,255,132,0,0,0,0,0,186,174,0,255,132,0,0,0,0,100,240,26,0,255,132,0,0,0,27,240,102,0,0,255,132,0,0,0,179,193,1,0,0,255,132,0,0,84,251,55,16,16,16,255,139,16,2,
+128,255,255,255,255,255,255,255,255,44,32,64,64,64,64,64,255,163,64,11,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,255,132,0,0,0,255,255,255,255,255,255,44,0,255,159,56,56,56,56,9,0,255,132,0,0,0,0,0,
+0,255,132,0,0,0,0,0,0,255,237,249,245,189,59,0,0,163,87,61,93,211,250,61,0,0,0,0,0,15,228,192,0,0,0,0,0,0,154,245,0,0,0,0,0,0,155,244,0,0,0,0,0,16,229,189,116,155,90,64,96,213,249,58,
+77,197,236,251,236,177,52,0,0,0,94,204,246,239,195,43,0,134,239,120,64,76,132,52,57,252,57,0,0,0,0,0,162,194,0,0,0,0,0,0,222,149,133,234,251,208,81,0,248,242,183,75,76,186,255,75,250,218,4,0,0,5,219,197,
+231,149,0,0,0,0,150,246,188,149,0,0,0,0,151,244,107,219,5,0,0,6,221,191,8,214,186,78,79,189,252,64,0,25,165,239,248,198,67,0,255,255,255,255,255,255,255,248,56,56,56,56,56,93,255,165,0,0,0,0,0,137,255,63,
+0,0,0,0,5,232,217,0,0,0,0,0,83,255,116,0,0,0,0,0,184,249,21,0,0,0,0,31,253,169,0,0,0,0,0,130,255,68,0,0,0,0,3,227,221,1,0,0,0,0,76,255,121,0,0,0,0,0,177,251,24,0,0,0,
+0,25,251,174,0,0,0,0,0,54,187,237,238,188,56,0,31,242,196,76,76,198,243,33,108,255,30,0,0,32,255,108,112,255,17,0,0,18,255,110,25,236,158,23,24,161,232,22,0,39,215,255,255,227,48,0,38,220,165,72,71,167,239,57,
+192,195,0,0,0,0,196,203,247,142,0,0,0,0,143,247,224,195,0,0,0,0,197,221,115,255,166,74,74,168,255,108,0,91,201,239,239,200,87,0,0,65,196,247,238,163,23,0,61,251,191,81,79,190,212,7,188,224,7,0,0,7,224,106,
+244,153,0,0,0,0,154,187,249,146,0,0,0,0,147,231,209,206,1,0,0,1,206,249,102,255,145,28,27,144,252,247,0,127,246,255,255,181,158,222,0,0,10,45,27,0,189,162,0,0,0,0,0,53,252,58,49,124,73,71,126,245,137,0,
+43,196,240,247,205,96,0,0,255,132,252,129,0,0,0,0,0,0,0,0,252,129,255,132,0,255,132,0,252,129,0,0,0,0,0,0,0,0,0,0,0,0,0,255,132,11,255,110,70,243,16,133,145,0,0,0,0,0,0,0,0,0,0,37,
+0,0,0,0,0,0,19,106,199,255,0,0,0,7,82,176,250,242,161,70,0,59,152,238,250,180,88,9,0,0,221,255,198,107,20,0,0,0,0,0,207,255,213,122,31,0,0,0,0,0,0,44,137,228,254,195,103,18,0,0,0,0,0,2,
+68,161,243,249,176,85,0,0,0,0,0,0,10,91,184,252,0,0,0,0,0,0,0,0,0,25,4,4,4,4,4,4,4,4,4,4,255,255,255,255,255,255,255,255,255,255,52,52,52,52,52,52,52,52,52,52,4,4,4,4,4,4,4,4,
+4,4,255,255,255,255,255,255,255,255,255,255,52,52,52,52,52,52,52,52,52,52,37,0,0,0,0,0,0,0,0,0,255,199,106,19,0,0,0,0,0,0,70,162,243,250,176,82,7,0,0,0,0,0,10,89,181,251,238,152,59,0,0,0,
+0,0,0,20,108,200,255,221,0,0,0,0,0,32,123,215,255,207,0,0,18,104,196,254,228,137,44,0,85,177,250,243,161,68,2,0,0,0,252,184,91,10,0,0,0,0,0,0,24,0,0,0,0,0,0,0,0,0,91,187,232,243,197,65,
+0,245,142,71,75,192,247,41,23,0,0,0,21,255,115,0,0,0,0,65,255,93,0,0,0,47,231,190,4,0,0,51,240,187,11,0,0,0,206,205,8,0,0,0,0,252,135,0,0,0,0,0,216,111,0,0,0,0,0,0,0,0,0,0,
+0,0,252,129,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,120,200,241,250,223,153,47,0,0,0,0,0,74,237,233,128,80,61,95,184,252,130,0,0,0,75,253,161,10,0,0,0,
+0,0,90,251,134,0,18,238,179,0,0,0,0,0,0,3,2,115,254,57,126,253,30,0,43,195,248,223,94,220,132,7,230,167,204,191,0,11,230,216,79,79,215,249,132,0,169,230,242,148,0,89,255,56,0,0,57,255,132,0,140,250,246,141,
+0,122,255,8,0,0,9,255,132,0,158,229,218,177,0,99,255,39,0,0,39,255,132,3,227,157,152,243,15,25,245,185,30,30,184,255,147,155,233,29,44,253,145,0,82,242,255,248,111,255,251,178,33,0,0,130,255,114,0,5,42,15,0,43,
+11,0,0,0,0,1,138,255,188,78,22,9,34,103,210,65,0,0,0,0,0,63,185,250,255,255,252,193,76,0,0,0,0,0,0,0,0,10,39,43,12,0,0,0,0,0,0,0,0,0,156,255,142,0,0,0,0,0,0,0,9,241,255,233,
+4,0,0,0,0,0,0,90,255,181,255,76,0,0,0,0,0,0,185,238,21,246,170,0,0,0,0,0,26,253,151,0,166,248,17,0,0,0,0,119,255,57,0,71,255,104,0,0,0,0,213,218,0,0,3,229,198,0,0,0,53,255,136,16,
+16,16,147,255,38,0,0,148,255,255,255,255,255,255,255,132,0,6,236,200,64,64,64,64,64,207,225,1,82,255,95,0,0,0,0,0,104,255,65,177,242,10,0,0,0,0,0,15,246,160,255,255,255,255,236,188,59,0,255,159,56,56,82,199,
+244,36,255,132,0,0,0,31,255,109,255,132,0,0,0,18,255,114,255,133,4,4,29,161,246,36,255,255,255,255,255,242,79,0,255,157,52,52,68,146,247,66,255,132,0,0,0,0,184,203,255,132,0,0,0,0,141,247,255,132,0,0,0,0,
+186,226,255,159,56,56,71,149,255,120,255,255,255,255,241,203,95,0,0,0,41,158,224,249,242,198,115,11,0,85,248,195,97,62,74,136,237,127,37,247,157,1,0,0,0,0,18,66,150,240,11,0,0,0,0,0,0,0,218,171,0,0,0,0,
+0,0,0,0,247,139,0,0,0,0,0,0,0,0,247,139,0,0,0,0,0,0,0,0,218,171,0,0,0,0,0,0,0,0,150,239,11,0,0,0,0,0,0,0,37,247,156,1,0,0,0,0,17,65,0,85,248,195,96,61,73,132,235,127,
+0,0,42,159,225,250,242,198,112,10,255,255,255,249,232,188,108,10,0,0,255,159,56,59,80,141,241,215,26,0,255,132,0,0,0,0,35,234,187,0,255,132,0,0,0,0,0,109,255,41,255,132,0,0,0,0,0,36,255,99,255,132,0,0,
+0,0,0,7,255,123,255,132,0,0,0,0,0,8,255,122,255,132,0,0,0,0,0,37,255,98,255,132,0,0,0,0,0,110,255,40,255,132,0,0,0,0,35,234,186,0,255,159,56,58,78,140,240,215,26,0,255,255,255,250,233,189,109,10,
+0,0,255,255,255,255,255,255,255,80,255,159,56,56,56,56,56,17,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,133,4,4,4,4,4,0,255,255,255,255,255,255,255,16,255,157,52,52,52,52,52,3,255,132,0,0,0,0,
+0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,159,56,56,56,56,56,25,255,255,255,255,255,255,255,116,255,255,255,255,255,255,164,255,159,56,56,56,56,35,255,132,0,0,0,0,0,255,132,0,0,0,0,0,255,133,
+4,4,4,4,0,255,255,255,255,255,255,36,255,157,52,52,52,52,7,255,132,0,0,0,0,0,255,132,0,0,0,0,0,255,132,0,0,0,0,0,255,132,0,0,0,0,0,255,132,0,0,0,0,0,0,0,46,162,226,249,242,204,131,24,
+0,91,250,189,96,62,74,133,234,179,41,248,144,0,0,0,0,0,12,95,153,236,7,0,0,0,0,0,0,0,219,169,0,0,0,0,0,0,0,0,247,139,0,0,0,0,4,4,4,4,247,139,0,0,0,24,255,255,255,255,219,169,0,0,
+0,4,52,52,157,255,155,236,8,0,0,0,0,0,132,255,44,250,147,0,0,0,0,0,132,255,0,98,252,191,96,62,70,110,217,243,0,0,50,165,228,250,242,204,129,24,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,
+255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,133,4,4,4,4,4,133,255,255,255,255,255,255,255,255,255,255,255,157,52,52,52,52,52,157,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,
+132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,
+132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,131,0,0,10,255,124,0,0,49,255,91,28,76,199,240,18,128,239,191,49,0,255,132,0,
+0,0,9,186,247,75,0,255,132,0,0,12,191,245,68,0,0,255,132,0,14,197,242,62,0,0,0,255,132,17,202,239,56,0,0,0,0,255,152,207,236,49,0,0,0,0,0,255,255,255,63,0,0,0,0,0,0,255,190,246,204,15,0,0,
+0,0,0,255,132,70,248,199,12,0,0,0,0,255,132,0,76,250,193,10,0,0,0,255,132,0,0,83,252,187,8,0,0,255,132,0,0,0,90,253,181,6,0,255,132,0,0,0,0,97,254,175,4,255,132,0,0,0,0,0,0,255,132,0,
+0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,
+0,0,0,0,0,255,172,84,84,84,84,84,15,255,255,255,255,255,255,255,48,255,255,129,0,0,0,0,8,241,255,132,255,242,220,0,0,0,0,87,242,255,132,255,162,254,57,0,0,0,180,160,255,132,255,132,192,148,0,0,21,251,67,255,
+132,255,132,100,235,4,0,109,228,2,255,132,255,132,15,247,76,0,202,138,0,255,132,255,132,0,171,167,38,255,46,0,255,132,255,132,0,79,246,144,210,0,0,255,132,255,132,0,5,236,253,117,0,0,255,132,255,132,0,0,112,176,27,0,
+0,255,132,255,132,0,0,0,0,0,0,0,255,132,255,132,0,0,0,0,0,0,0,255,132,255,255,99,0,0,0,0,132,255,255,255,227,8,0,0,0,132,255,255,184,254,117,0,0,0,132,255,255,132,171,238,16,0,0,132,255,255,132,38,
+251,135,0,0,132,255,255,132,0,153,245,25,0,132,255,255,132,0,26,246,152,0,132,255,255,132,0,0,136,251,38,132,255,255,132,0,0,16,238,170,132,255,255,132,0,0,0,118,254,184,255,255,132,0,0,0,9,228,255,255,255,132,0,0,
+0,0,100,255,255,0,0,62,180,237,248,216,131,13,0,0,0,104,254,177,82,63,112,232,210,19,0,44,250,147,0,0,0,0,31,240,168,0,155,239,10,0,0,0,0,0,129,253,31,220,171,0,0,0,0,0,0,48,255,94,248,139,0,0,
+0,0,0,0,16,255,123,248,139,0,0,0,0,0,0,16,255,122,220,171,0,0,0,0,0,0,48,255,95,156,239,9,0,0,0,0,0,129,254,31,46,251,146,0,0,0,0,31,240,170,0,0,107,254,176,80,62,112,231,213,20,0,0,0,
+65,182,238,249,218,133,14,0,0,255,255,255,252,223,159,28,0,255,159,56,59,101,229,228,13,255,132,0,0,0,66,255,95,255,132,0,0,0,10,255,126,255,132,0,0,0,46,255,106,255,133,4,7,48,202,247,29,255,255,255,255,255,211,65,
+0,255,157,52,48,19,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,62,180,237,248,216,130,12,0,0,0,104,254,177,82,63,112,232,209,18,0,44,
+250,147,0,0,0,0,31,240,164,0,155,239,10,0,0,0,0,0,129,253,28,220,171,0,0,0,0,0,0,48,255,92,248,139,0,0,0,0,0,0,16,255,121,247,139,0,0,0,0,0,0,16,255,120,219,171,0,0,0,0,0,0,48,255,
+95,154,239,9,0,0,0,0,0,129,255,36,44,250,146,0,0,0,0,31,240,191,0,0,104,254,176,80,62,112,231,235,31,0,0,0,63,181,237,255,255,198,24,0,0,0,0,0,0,0,0,164,242,50,0,0,0,0,0,0,0,0,6,192,
+233,37,0,255,255,255,252,226,169,39,0,0,0,255,159,56,59,98,224,229,17,0,0,255,132,0,0,0,61,255,92,0,0,255,132,0,0,0,10,255,122,0,0,255,132,0,0,0,42,255,87,0,0,255,133,4,7,45,195,201,6,0,0,255,
+255,255,255,255,225,23,0,0,0,255,157,52,60,125,252,192,1,0,0,255,132,0,0,0,124,255,89,0,0,255,132,0,0,0,7,226,214,2,0,255,132,0,0,0,0,101,255,85,0,255,132,0,0,0,0,4,218,208,1,0,86,198,238,244,
+219,164,42,114,255,153,75,69,108,192,87,227,174,0,0,0,0,0,2,245,151,0,0,0,0,0,0,191,245,113,34,0,0,0,0,40,214,255,255,230,156,47,0,0,4,66,137,195,252,249,73,0,0,0,0,0,39,231,206,0,0,0,0,0,
+0,146,247,28,0,0,0,0,0,185,223,251,168,90,61,80,168,255,109,112,183,228,250,241,195,90,0,255,255,255,255,255,255,255,255,255,255,56,56,56,56,255,159,56,56,56,56,0,0,0,0,255,132,0,0,0,0,0,0,0,0,255,132,0,
+0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,
+0,0,0,255,132,0,0,0,0,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,
+255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,252,135,0,0,0,0,0,136,252,230,162,0,0,0,0,0,162,228,164,233,12,0,0,0,12,234,163,38,241,212,96,65,96,212,241,38,0,41,169,234,252,234,169,40,0,177,
+238,7,0,0,0,0,0,13,245,160,82,255,83,0,0,0,0,0,97,255,65,6,236,177,0,0,0,0,0,191,225,1,0,148,250,20,0,0,0,30,254,132,0,0,53,255,107,0,0,0,122,255,38,0,0,0,213,201,0,0,0,215,198,0,
+0,0,0,119,255,38,0,54,255,104,0,0,0,0,27,253,132,0,148,248,17,0,0,0,0,0,185,224,6,235,170,0,0,0,0,0,0,90,255,141,255,76,0,0,0,0,0,0,9,241,254,233,4,0,0,0,0,0,0,0,156,255,143,0,
+0,0,0,89,255,62,0,0,0,23,255,233,0,0,0,0,107,255,44,26,255,124,0,0,0,85,245,255,40,0,0,0,169,236,1,0,221,186,0,0,0,147,179,220,102,0,0,0,230,175,0,0,158,243,4,0,0,209,118,160,164,0,0,37,
+255,113,0,0,96,255,54,0,16,253,57,99,226,0,0,99,255,51,0,0,34,255,116,0,77,246,6,38,255,32,0,161,241,3,0,0,0,227,178,0,139,191,0,0,233,94,0,223,182,0,0,0,0,165,238,1,201,130,0,0,173,156,28,255,
+120,0,0,0,0,103,255,57,251,69,0,0,112,218,91,255,57,0,0,0,0,40,255,177,252,12,0,0,52,255,177,245,5,0,0,0,0,0,233,254,203,0,0,0,3,243,254,189,0,0,0,0,0,0,171,255,142,0,0,0,0,186,255,127,
+0,0,0,0,170,238,24,0,0,0,3,204,219,9,0,22,237,174,0,0,0,119,254,63,0,0,0,94,255,85,0,38,247,151,0,0,0,0,0,183,233,21,195,226,14,0,0,0,0,0,30,243,221,255,74,0,0,0,0,0,0,0,135,255,
+173,0,0,0,0,0,0,0,14,228,254,226,13,0,0,0,0,0,0,153,245,73,248,148,0,0,0,0,0,63,254,113,0,124,254,58,0,0,0,9,219,201,2,0,5,210,214,6,0,0,139,250,45,0,0,0,53,253,129,0,52,252,130,0,
+0,0,0,0,142,249,43,3,201,220,9,0,0,0,0,99,255,79,0,42,249,139,0,0,0,23,238,167,0,0,0,124,252,52,0,0,171,234,20,0,0,0,4,207,208,5,79,255,87,0,0,0,0,0,48,251,137,229,175,0,0,0,0,0,
+0,0,132,255,238,24,0,0,0,0,0,0,0,6,255,138,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,
+0,0,0,0,0,255,132,0,0,0,0,255,255,255,255,255,255,255,255,255,56,56,56,56,56,56,93,253,181,0,0,0,0,0,7,206,229,20,0,0,0,0,0,146,253,64,0,0,0,0,0,78,255,129,0,0,0,0,0,28,237,194,3,0,
+0,0,0,3,194,237,28,0,0,0,0,0,130,255,78,0,0,0,0,0,65,253,145,0,0,0,0,0,20,229,206,6,0,0,0,0,0,181,253,93,56,56,56,56,56,56,255,255,255,255,255,255,255,255,255,255,255,255,100,255,159,56,21,255,
+132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,133,4,1,255,255,255,100,52,52,52,20,216,123,0,0,0,0,137,203,0,0,0,0,57,
+255,28,0,0,0,1,230,107,0,0,0,0,153,187,0,0,0,0,73,250,16,0,0,0,6,241,91,0,0,0,0,169,171,0,0,0,0,89,243,7,0,0,0,14,249,75,0,0,0,0,185,155,0,0,0,0,105,233,2,0,0,0,26,254,
+59,220,255,255,132,48,56,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,3,4,255,132,220,255,255,132,44,52,52,26,0,0,0,
+0,38,128,90,0,0,0,0,0,0,0,30,226,246,255,105,0,0,0,0,0,23,218,216,30,141,254,92,0,0,0,17,209,205,21,0,0,123,251,80,0,11,199,192,14,0,0,0,0,104,246,69,4,4,4,4,4,4,4,4,255,255,255,255,
+255,255,255,255,52,52,52,52,52,52,52,52,68,248,64,0,0,0,102,228,20,0,0,0,141,180,1,36,161,222,247,225,163,27,0,62,136,80,62,90,205,224,9,0,0,0,0,4,30,255,84,5,118,214,245,255,255,255,123,139,252,129,68,53,
+55,255,132,228,160,0,0,0,35,255,132,238,156,0,0,0,133,255,132,165,248,110,68,138,218,255,132,18,164,238,241,176,31,255,132,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,133,121,226,248,
+203,62,0,255,227,200,82,84,203,247,46,255,238,13,0,0,15,239,169,255,163,0,0,0,0,164,232,255,139,0,0,0,0,140,251,255,163,0,0,0,0,164,232,255,237,13,0,0,15,239,169,255,227,200,82,83,203,247,45,255,132,120,227,249,
+203,63,0,0,31,161,231,249,225,157,31,234,227,104,66,93,175,160,245,28,0,0,0,0,231,169,0,0,0,0,0,251,141,0,0,0,0,0,231,168,0,0,0,0,0,159,244,27,0,0,0,0,30,234,225,102,65,89,172,0,32,164,235,249,
+224,155,0,0,0,0,0,0,132,255,0,0,0,0,0,0,132,255,0,0,0,0,0,0,132,255,0,64,203,248,226,121,132,255,39,248,200,82,84,203,227,255,164,238,13,0,0,15,239,255,221,163,0,0,0,0,164,255,247,139,0,0,0,0,
+140,255,221,163,0,0,0,0,164,255,163,237,13,0,0,15,239,255,39,249,200,82,83,203,227,255,0,64,204,249,227,120,132,255,0,36,170,238,248,199,62,0,31,236,207,88,73,179,249,50,158,233,16,0,0,4,218,173,229,160,4,4,4,4,
+151,234,251,255,255,255,255,255,255,253,233,171,52,52,52,52,52,52,163,215,7,0,0,0,0,0,33,235,199,92,63,82,133,130,0,32,162,232,250,228,177,70,0,3,152,233,255,128,0,88,255,109,56,28,0,128,255,2,0,0,255,255,255,255,
+255,0,56,159,255,56,56,0,0,132,255,0,0,0,0,132,255,0,0,0,0,132,255,0,0,0,0,132,255,0,0,0,0,132,255,0,0,0,0,132,255,0,0,0,0,132,255,0,0,0,0,64,204,248,225,117,132,255,39,249,197,81,83,199,
+225,255,164,235,10,0,0,12,237,255,221,161,0,0,0,0,163,255,247,139,0,0,0,0,140,255,221,161,0,0,0,0,163,255,164,235,10,0,0,12,237,255,39,249,197,81,82,199,226,254,0,65,204,249,227,121,149,238,0,0,0,0,0,4,
+213,187,0,150,90,63,86,188,254,70,0,157,226,248,244,196,75,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,106,220,245,202,59,0,255,223,190,81,78,209,240,17,255,221,6,0,0,53,
+255,93,255,150,0,0,0,7,255,124,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,56,28,0,0,255,132,255,132,255,132,255,132,
+255,132,255,132,255,132,255,132,255,132,0,0,255,132,0,0,56,28,0,0,0,0,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,131,0,15,255,111,64,146,
+255,52,253,223,109,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,10,182,231,47,255,132,0,19,200,218,33,0,255,132,30,215,203,21,0,0,255,174,229,186,12,0,0,0,255,236,
+255,87,0,0,0,0,255,133,149,250,82,0,0,0,255,132,0,146,251,84,0,0,255,132,0,0,143,251,85,0,255,132,0,0,0,141,251,86,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,
+121,229,244,167,11,41,190,245,214,70,0,255,227,175,73,112,251,162,212,104,71,197,243,17,255,216,3,0,0,176,255,86,0,0,52,255,88,255,149,0,0,0,138,255,16,0,0,14,255,116,255,132,0,0,0,132,255,0,0,0,8,255,124,255,
+132,0,0,0,132,255,0,0,0,8,255,124,255,132,0,0,0,132,255,0,0,0,8,255,124,255,132,0,0,0,132,255,0,0,0,8,255,124,255,132,0,0,0,132,255,0,0,0,8,255,124,255,132,106,220,245,202,59,0,255,223,190,81,78,
+209,240,17,255,221,6,0,0,53,255,93,255,150,0,0,0,7,255,124,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,0,56,189,244,244,
+188,54,0,49,248,205,84,84,205,247,46,173,240,16,0,0,16,240,171,235,164,0,0,0,0,164,233,252,139,0,0,0,0,140,251,235,163,0,0,0,0,164,233,173,238,13,0,0,15,239,171,49,248,201,82,83,203,247,46,0,57,190,245,244,
+189,54,0,255,133,121,226,248,203,62,0,255,227,200,82,84,203,247,46,255,238,13,0,0,15,239,169,255,163,0,0,0,0,164,232,255,139,0,0,0,0,140,251,255,163,0,0,0,0,164,232,255,237,13,0,0,15,239,169,255,227,200,82,83,
+203,247,45,255,132,120,227,249,203,63,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,64,203,248,226,121,132,255,39,248,200,82,84,203,227,255,164,238,13,0,0,15,239,255,221,163,0,0,0,
+0,164,255,247,139,0,0,0,0,140,255,221,163,0,0,0,0,164,255,163,237,13,0,0,15,239,255,39,249,200,82,83,203,227,255,0,64,204,249,227,120,132,255,0,0,0,0,0,0,132,255,0,0,0,0,0,0,132,255,0,0,0,0,0,
+0,132,255,0,0,0,0,3,4,255,133,120,223,253,48,255,229,192,82,72,22,255,228,7,0,0,0,255,157,0,0,0,0,255,133,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,25,
+165,232,249,228,172,4,188,233,96,62,87,161,6,244,145,0,0,0,0,0,192,239,118,46,1,0,0,23,153,232,255,228,113,0,0,0,1,46,155,255,76,0,0,0,0,14,255,118,207,112,71,69,165,251,52,149,212,244,241,197,74,0,0,128,
+66,0,0,0,255,132,0,0,0,255,132,0,0,255,255,255,255,255,56,255,159,56,56,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,250,139,0,0,0,211,209,62,52,0,65,210,249,255,255,132,0,0,0,0,
+255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,248,139,0,0,0,18,255,132,217,184,0,0,0,96,255,132,126,254,128,67,117,211,255,132,7,141,228,245,182,34,
+255,132,86,255,46,0,0,0,0,183,208,8,240,138,0,0,0,23,251,115,0,155,228,2,0,0,112,252,25,0,62,255,68,0,0,205,184,0,0,1,223,161,0,41,255,91,0,0,0,131,243,10,134,243,10,0,0,0,38,255,92,225,160,0,
+0,0,0,0,200,228,255,67,0,0,0,0,0,107,255,228,2,0,0,52,255,60,0,0,109,255,132,0,0,37,255,74,2,239,126,0,0,175,246,198,0,0,103,252,13,0,177,191,0,2,238,141,251,12,0,168,200,0,0,112,248,8,50,254,
+23,244,73,0,232,134,0,0,46,255,66,115,207,0,184,138,43,255,69,0,0,1,235,132,181,141,0,118,204,109,249,10,0,0,0,172,201,242,75,0,52,253,190,194,0,0,0,0,106,255,252,14,0,2,239,255,129,0,0,0,0,41,255,200,
+0,0,0,177,255,64,0,0,11,216,202,5,0,0,70,254,107,0,49,249,136,0,22,232,178,0,0,0,113,254,68,184,229,20,0,0,0,1,182,248,254,67,0,0,0,0,0,89,255,207,0,0,0,0,0,24,233,205,254,111,0,0,0,1,
+185,227,18,142,248,46,0,0,115,253,63,0,6,206,213,9,49,249,132,0,0,0,39,245,151,148,233,5,0,0,0,12,243,135,42,255,86,0,0,0,103,254,34,0,192,189,0,0,0,206,184,0,0,86,254,37,0,53,255,81,0,0,5,230,
+140,0,157,229,4,0,0,0,130,236,22,245,130,0,0,0,0,27,251,193,252,29,0,0,0,0,0,174,255,178,0,0,0,0,0,0,89,255,75,0,0,0,0,0,0,165,224,2,0,0,0,0,56,104,252,110,0,0,0,0,0,255,243,157,
+4,0,0,0,0,255,255,255,255,255,255,255,56,56,56,56,66,232,216,0,0,0,1,174,236,35,0,0,0,137,249,62,0,0,0,96,255,96,0,0,0,62,249,136,0,0,0,35,236,174,1,0,0,0,216,232,66,56,56,56,56,255,255,255,
+255,255,255,255,0,0,0,54,196,241,254,0,0,0,205,229,87,58,0,0,0,249,146,0,0,0,0,0,255,132,0,0,0,0,0,255,132,0,0,0,0,18,255,121,0,0,2,19,138,255,65,0,0,128,255,254,121,0,0,0,26,67,178,248,
+44,0,0,0,0,28,255,115,0,0,0,0,1,255,131,0,0,0,0,0,255,132,0,0,0,0,0,252,140,0,0,0,0,0,219,209,33,5,0,0,0,89,242,255,255,0,0,0,0,6,39,51,255,132,255,132,255,132,255,132,255,132,255,132,
+255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,255,132,128,251,226,143,3,0,0,28,65,150,255,80,0,0,0,0,14,255,124,0,0,0,0,0,255,132,0,0,0,0,0,255,132,0,0,0,0,0,245,149,0,0,0,0,
+0,189,229,51,7,0,0,0,27,214,255,255,0,0,0,160,243,100,56,0,0,0,240,159,0,0,0,0,0,255,133,0,0,0,0,0,255,132,0,0,0,0,8,255,127,0,0,2,13,101,255,94,0,0,128,255,255,195,12,0,0,26,47,23,
+0,0,0,0,0,0,0,0,0,0,0,0,0,7,61,184,247,243,185,100,30,13,79,212,238,127,62,80,153,234,255,255,231,109,29,0,0,0,0,2,37,30,0,0,255,132,252,129,0,0,0,0,255,132,255,132,255,132,255,132,255,132,255,132,
+255,132,255,132,0,0,0,0,63,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,0,0,0,0,20,153,224,255,239,181,16,31,230,225,104,231,78,151,26,162,246,30,0,224,0,0,0,231,169,0,0,224,0,0,0,251,140,0,0,
+224,0,0,0,231,166,0,0,224,0,0,0,160,243,23,0,224,0,0,0,30,233,217,89,229,64,142,25,0,30,159,233,255,240,178,16,0,0,0,0,224,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,49,0,0,0,0,0,2,122,
+222,250,229,172,0,0,114,254,134,67,90,176,0,0,211,183,0,0,0,0,0,0,248,140,0,0,0,0,0,0,255,132,0,0,0,0,4,4,255,133,4,4,0,0,255,255,255,255,255,255,0,0,52,52,255,157,52,52,0,0,0,0,255,132,
+0,0,0,0,0,0,255,132,0,0,0,0,56,56,255,159,56,56,56,56,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,1,0,0,165,130,0,0,0,0,0,111,172,0,0,86,248,174,197,249,218,157,247,82,0,0,0,123,
+254,131,63,130,254,127,0,0,0,0,221,169,0,0,0,169,221,0,0,0,0,232,155,0,0,0,155,232,0,0,0,0,127,247,82,15,82,247,123,0,0,0,50,232,214,239,255,237,211,230,47,0,0,196,174,10,9,42,9,9,173,186,0,0,
+15,2,0,0,0,0,0,1,11,0,109,246,24,0,0,0,0,148,228,7,8,230,142,0,0,0,26,247,109,0,0,111,246,23,0,0,145,230,8,0,0,9,231,141,0,24,246,111,0,0,0,0,113,245,22,142,231,9,0,0,62,248,248,254,
+161,245,251,248,186,0,1,4,4,64,255,189,7,4,3,0,64,255,255,255,255,255,255,255,192,0,13,52,52,52,255,157,52,52,39,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,255,132,0,0,
+0,0,255,132,255,132,255,132,255,132,255,132,255,132,0,0,0,0,255,132,255,132,255,132,255,132,255,132,255,132,0,123,226,247,214,99,0,82,255,140,65,104,113,0,117,255,23,0,0,0,0,23,218,204,43,0,0,0,51,216,148,242,144,12,
+0,216,157,0,42,218,214,16,238,189,0,0,46,255,111,114,255,164,14,33,255,96,0,77,223,228,204,160,5,0,0,8,134,251,99,0,0,0,0,0,162,239,0,49,74,17,31,204,215,0,70,241,255,255,229,63,0,0,4,36,37,5,0,0,
+4,2,0,4,2,255,132,0,255,132,52,26,0,52,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,112,205,247,247,204,110,6,0,0,0,25,206,241,130,65,65,128,240,203,24,0,6,204,226,35,0,0,0,0,32,222,202,5,107,
+255,59,90,208,247,233,145,0,55,255,106,198,198,93,255,158,69,71,120,0,0,197,198,242,145,209,195,0,0,0,0,0,0,145,241,246,140,245,142,0,0,0,0,0,0,141,246,211,184,217,178,0,0,0,0,0,0,183,210,128,251,159,254,114,
+22,19,72,0,33,250,127,16,227,208,153,250,255,255,187,12,199,226,15,0,49,233,215,88,57,42,80,213,232,47,0,0,0,27,160,245,255,255,245,159,26,0,0,0,0,0,0,8,40,40,7,0,0,0,0,105,198,192,192,46,20,0,0,40,
+194,45,175,195,192,238,210,58,0,8,246,230,30,0,105,248,92,215,184,138,241,0,0,0,0,0,156,192,192,192,189,0,0,0,12,0,0,12,0,0,94,124,0,18,200,0,110,241,55,25,211,159,127,241,57,33,220,126,0,236,167,0,108,217,
+16,0,43,229,149,2,143,214,33,0,33,220,107,0,126,232,0,0,24,84,0,0,109,2,4,4,4,4,4,4,4,4,4,2,180,255,255,255,255,255,255,255,255,255,132,36,52,52,52,52,52,52,52,52,255,132,0,0,0,0,0,0,0,0,
+0,255,132,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,0,52,26,4,4,4,4,255,255,255,255,52,52,52,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,112,205,247,247,204,110,6,0,0,0,25,206,
+241,130,65,65,128,240,203,24,0,6,204,226,37,4,3,0,0,32,222,202,5,107,255,59,132,255,255,238,162,8,55,255,106,198,198,0,132,255,52,97,255,103,0,197,198,242,145,0,132,255,4,48,255,108,0,145,241,246,140,0,132,255,255,249,
+161,10,0,141,246,211,184,0,132,255,61,195,113,0,0,183,210,128,251,36,132,255,0,29,239,66,33,250,127,16,227,203,76,120,0,0,69,109,199,226,15,0,49,233,215,81,17,17,80,213,232,47,0,0,0,27,160,245,255,255,245,159,26,0,
+0,0,0,0,0,8,40,40,7,0,0,0,0,4,4,4,4,4,255,255,255,255,255,52,52,52,52,52,0,0,0,0,0,30,191,246,186,28,184,221,71,221,181,244,140,0,141,243,209,199,22,199,205,61,236,255,231,54,0,8,39,6,0,0,
+0,0,0,132,255,0,0,0,0,0,0,0,0,132,255,0,0,0,0,4,4,4,4,133,255,4,4,4,4,255,255,255,255,255,255,255,255,255,255,52,52,52,52,157,255,52,52,52,52,0,0,0,0,132,255,0,0,0,0,0,0,0,0,132,
+255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,56,56,56,56,56,56,56,56,56,255,255,255,255,255,255,255,255,255,255,63,194,192,203,80,0,17,4,0,27,232,0,0,0,0,95,171,0,0,0,87,203,16,0,0,122,191,16,0,
+0,95,255,198,192,192,6,74,189,190,197,97,0,0,0,27,235,0,69,201,238,95,0,0,0,56,190,10,0,0,37,232,125,198,193,203,79,0,0,70,247,61,0,23,232,94,0,1,185,132,0,0,255,132,0,0,0,0,255,132,0,255,132,0,
+0,0,0,255,132,0,255,132,0,0,0,0,255,132,0,255,132,0,0,0,0,255,132,0,255,132,0,0,0,0,255,132,0,255,136,0,0,0,12,255,132,0,255,180,0,0,0,70,255,132,0,255,251,134,66,96,226,251,186,51,255,151,180,247,
+228,101,141,246,125,255,132,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,20,150,222,253,255,255,255,9,218,255,255,255,159,159,255,91,255,255,255,255,132,132,255,120,255,255,255,255,132,132,255,
+84,255,255,255,255,132,132,255,7,215,255,255,255,132,132,255,0,20,150,221,255,132,132,255,0,0,0,0,255,132,132,255,0,0,0,0,255,132,132,255,0,0,0,0,255,132,132,255,0,0,0,0,255,132,132,255,0,0,0,0,255,132,132,255,
+0,0,0,0,255,132,132,255,0,0,0,0,184,94,94,184,252,129,255,132,0,0,2,1,0,0,0,82,208,16,14,74,98,255,115,27,226,246,208,42,139,208,250,0,0,8,0,244,0,0,0,0,244,0,0,0,0,244,0,0,0,0,244,0,
+0,121,216,254,216,128,13,155,196,195,156,13,151,129,0,0,125,151,227,15,0,0,12,225,228,15,0,0,12,226,153,131,0,0,127,153,14,157,197,197,159,14,0,0,0,0,0,0,135,192,192,192,192,138,12,0,0,12,0,0,0,200,17,0,
+123,93,0,0,159,211,25,55,241,110,0,0,126,220,33,57,241,126,0,16,217,108,0,167,236,33,215,142,2,149,229,42,233,126,0,108,220,32,0,108,0,0,84,24,0,0,59,121,147,76,0,0,0,0,0,19,145,12,0,0,0,118,118,255,
+132,0,0,0,0,0,153,155,0,0,0,0,0,0,255,132,0,0,0,0,51,238,22,0,0,0,0,0,0,255,132,0,0,0,1,199,115,0,0,0,0,0,0,0,255,132,0,0,0,98,217,5,0,0,0,0,0,0,0,255,132,0,0,15,
+233,74,0,0,4,20,10,0,128,216,236,226,216,10,146,182,0,0,0,143,255,132,0,0,0,0,0,0,46,246,39,0,0,107,79,255,132,0,0,0,0,0,0,193,141,0,0,60,141,0,255,132,0,0,0,0,0,91,234,15,0,10,214,83,
+76,255,168,43,0,0,0,13,230,100,0,0,22,236,236,236,255,246,136,0,0,0,140,206,2,0,0,0,0,0,0,255,132,0,0,0,1,102,43,0,0,0,0,0,0,0,108,55,0,105,179,203,105,0,0,0,0,0,33,195,17,0,0,0,
+55,38,255,132,0,0,0,0,0,178,133,0,0,0,0,0,0,255,132,0,0,0,0,75,229,11,0,0,0,0,0,0,255,132,0,0,0,7,220,91,0,0,0,0,0,0,0,255,132,0,0,0,125,197,0,0,0,0,0,0,0,0,255,132,
+0,0,31,244,51,71,185,219,186,50,0,128,216,236,226,216,13,175,155,0,118,26,9,191,222,0,0,0,0,0,0,72,240,21,0,0,0,0,174,212,0,0,0,0,0,6,218,112,0,0,0,0,92,245,56,0,0,0,0,0,122,214,4,0,
+0,0,77,235,66,0,0,0,0,0,30,245,70,0,0,0,79,221,48,4,4,0,0,0,0,172,176,0,0,0,0,211,255,255,255,255,12,0,0,1,51,17,0,0,0,0,43,52,52,52,52,2,0,0,0,0,0,0,0,0,0,0,3,1,
+0,0,0,72,215,250,239,159,9,0,0,0,40,233,17,0,0,0,49,78,58,119,255,110,0,0,0,182,113,0,0,0,0,0,1,7,69,254,74,0,0,71,221,6,0,0,0,0,0,100,255,255,186,9,0,4,213,86,0,0,0,0,0,0,
+20,57,123,255,106,0,108,200,0,0,0,0,0,0,40,19,10,79,255,107,17,236,59,0,0,36,116,59,0,143,255,255,255,185,12,144,173,0,0,3,180,255,132,0,0,21,45,22,0,38,245,37,0,0,121,84,255,132,0,0,0,0,0,0,
+180,146,0,0,44,158,0,255,132,0,0,0,0,0,69,240,20,0,0,193,93,76,255,168,43,0,0,0,3,211,119,0,0,0,213,236,236,255,246,136,0,0,0,106,225,8,0,0,0,0,0,0,255,132,0,0,0,0,88,56,0,0,0,0,
+0,0,0,108,55,0,0,0,0,255,132,0,0,0,0,252,129,0,0,0,0,0,0,0,0,0,0,255,132,0,0,0,7,255,126,0,0,0,100,255,71,0,0,96,252,144,0,0,84,254,130,0,0,0,224,182,0,0,0,0,239,156,0,0,
+0,35,162,250,126,84,145,248,15,154,233,240,194,88,0,0,0,27,226,105,0,0,0,0,0,0,0,0,0,41,230,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,156,255,142,0,0,0,0,0,0,0,9,241,255,
+233,4,0,0,0,0,0,0,90,255,181,255,76,0,0,0,0,0,0,185,238,21,246,170,0,0,0,0,0,26,253,151,0,166,248,17,0,0,0,0,119,255,57,0,71,255,104,0,0,0,0,213,218,0,0,3,229,198,0,0,0,53,255,136,
+16,16,16,147,255,38,0,0,148,255,255,255,255,255,255,255,132,0,6,236,200,64,64,64,64,64,207,225,1,82,255,95,0,0,0,0,0,104,255,65,177,242,10,0,0,0,0,0,15,246,160,0,0,0,0,0,123,212,16,0,0,0,0,0,
+0,0,65,225,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,156,255,142,0,0,0,0,0,0,0,9,241,255,233,4,0,0,0,0,0,0,90,255,181,255,76,0,0,0,0,0,0,185,238,21,246,170,0,0,0,
+0,0,26,253,151,0,166,248,17,0,0,0,0,119,255,57,0,71,255,104,0,0,0,0,213,218,0,0,3,229,198,0,0,0,53,255,136,16,16,16,147,255,38,0,0,148,255,255,255,255,255,255,255,132,0,6,236,200,64,64,64,64,64,207,
+225,1,82,255,95,0,0,0,0,0,104,255,65,177,242,10,0,0,0,0,0,15,246,160,0,0,0,1,171,226,157,0,0,0,0,0,0,0,127,165,7,178,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,156,255,142,
+0,0,0,0,0,0,0,9,241,255,233,4,0,0,0,0,0,0,90,255,181,255,76,0,0,0,0,0,0,185,238,21,246,170,0,0,0,0,0,26,253,151,0,166,248,17,0,0,0,0,119,255,57,0,71,255,104,0,0,0,0,213,218,0,
+0,3,229,198,0,0,0,53,255,136,16,16,16,147,255,38,0,0,148,255,255,255,255,255,255,255,132,0,6,236,200,64,64,64,64,64,207,225,1,82,255,95,0,0,0,0,0,104,255,65,177,242,10,0,0,0,0,0,15,246,160,0,0,0,
+0,0,0,0,3,0,0,0,0,0,0,129,246,144,25,235,0,0,0,0,0,0,228,80,158,231,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,255,142,0,0,0,0,0,0,0,3,230,255,232,3,0,0,0,0,
+0,0,72,255,183,255,73,0,0,0,0,0,0,166,245,23,244,167,0,0,0,0,0,13,245,165,0,165,246,14,0,0,0,0,98,255,74,0,73,255,98,0,0,0,0,192,234,4,0,3,232,192,0,0,0,30,254,157,16,16,16,154,254,31,
+0,0,124,255,255,255,255,255,255,255,123,0,0,216,221,64,64,64,64,64,216,216,0,56,255,123,0,0,0,0,0,116,255,55,149,253,28,0,0,0,0,0,22,250,149,0,0,0,0,4,2,0,4,2,0,0,0,0,0,0,0,255,132,0,
+255,132,0,0,0,0,0,0,0,52,26,0,52,26,0,0,0,0,0,0,0,0,211,255,86,0,0,0,0,0,0,0,0,49,255,255,179,0,0,0,0,0,0,0,0,143,254,185,251,21,0,0,0,0,0,0,3,232,192,65,255,110,0,0,
+0,0,0,0,74,255,101,1,226,203,0,0,0,0,0,0,168,249,17,0,137,255,40,0,0,0,0,14,246,174,0,0,44,255,134,0,0,0,0,99,255,97,16,16,16,214,225,1,0,0,0,193,255,255,255,255,255,255,255,64,0,0,31,254,
+170,64,64,64,64,73,251,158,0,0,124,255,55,0,0,0,0,0,176,242,9,0,216,213,0,0,0,0,0,0,77,255,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,215,244,151,2,0,0,0,0,0,0,0,216,197,99,
+255,90,0,0,0,0,0,0,0,234,176,53,255,108,0,0,0,0,0,0,0,117,255,255,223,22,0,0,0,0,0,0,0,60,255,255,191,0,0,0,0,0,0,0,0,156,253,181,254,32,0,0,0,0,0,0,10,242,184,56,255,127,0,0,
+0,0,0,0,94,255,86,0,213,222,1,0,0,0,0,0,191,237,7,0,116,255,64,0,0,0,0,32,254,147,0,0,22,250,161,0,0,0,0,128,255,66,16,16,16,183,244,12,0,0,1,223,255,255,255,255,255,255,255,98,0,0,66,255,
+137,64,64,64,64,64,228,194,0,0,163,248,19,0,0,0,0,0,132,255,35,13,245,169,0,0,0,0,0,0,34,254,131,0,0,0,0,77,255,255,255,255,255,255,255,255,255,80,0,0,0,0,181,222,56,255,159,56,56,56,56,56,17,0,
+0,0,31,253,126,0,255,132,0,0,0,0,0,0,0,0,0,134,254,31,0,255,132,0,0,0,0,0,0,0,0,5,232,187,0,0,255,133,4,4,4,4,4,0,0,0,86,255,90,0,0,255,255,255,255,255,255,255,20,0,0,191,240,8,
+0,0,255,157,52,52,52,52,52,4,0,39,255,153,4,4,4,255,132,0,0,0,0,0,0,0,143,255,255,255,255,255,255,132,0,0,0,0,0,0,9,238,193,52,52,52,52,255,132,0,0,0,0,0,0,96,255,75,0,0,0,0,255,159,
+56,56,56,56,56,25,200,215,1,0,0,0,0,255,255,255,255,255,255,255,116,0,0,41,158,224,249,242,198,115,11,0,85,248,195,97,62,74,136,237,127,37,247,157,1,0,0,0,0,18,66,150,240,11,0,0,0,0,0,0,0,218,171,0,
+0,0,0,0,0,0,0,247,139,0,0,0,0,0,0,0,0,247,139,0,0,0,0,0,0,0,0,218,171,0,0,0,0,0,0,0,0,150,239,11,0,0,0,0,0,0,0,37,247,156,1,0,0,0,0,17,65,0,85,248,195,96,61,73,
+132,235,127,0,0,42,159,230,255,242,197,101,8,0,0,0,0,1,196,116,0,0,0,0,0,0,48,64,192,241,0,0,0,0,0,0,112,245,241,134,0,0,0,0,14,207,137,0,0,0,0,0,0,24,221,78,0,0,0,0,0,0,0,0,
+0,0,0,255,255,255,255,255,255,255,80,255,159,56,56,56,56,56,17,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,133,4,4,4,4,4,0,255,255,255,255,255,255,255,16,255,157,52,52,52,52,52,3,255,132,0,0,0,
+0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,159,56,56,56,56,56,25,255,255,255,255,255,255,255,116,0,0,0,90,230,31,0,0,0,0,41,230,47,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,
+255,255,80,255,159,56,56,56,56,56,17,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,133,4,4,4,4,4,0,255,255,255,255,255,255,255,16,255,157,52,52,52,52,52,3,255,132,0,0,0,0,0,0,255,132,0,0,0,
+0,0,0,255,132,0,0,0,0,0,0,255,159,56,56,56,56,56,25,255,255,255,255,255,255,255,116,0,0,141,226,185,3,0,0,0,92,190,9,150,145,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,80,255,159,56,56,56,
+56,56,17,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,133,4,4,4,4,4,0,255,255,255,255,255,255,255,16,255,157,52,52,52,52,52,3,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,
+0,0,0,255,159,56,56,56,56,56,25,255,255,255,255,255,255,255,116,0,2,4,0,2,4,0,0,0,132,255,0,132,255,0,0,0,26,52,0,26,52,0,0,255,255,255,255,255,255,255,100,255,159,56,56,56,56,56,21,255,132,0,0,0,
+0,0,0,255,132,0,0,0,0,0,0,255,133,4,4,4,4,4,0,255,255,255,255,255,255,255,36,255,157,52,52,52,52,52,7,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,159,56,56,56,
+56,56,29,255,255,255,255,255,255,255,136,1,169,180,1,0,7,193,113,0,0,0,0,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,
+0,255,132,0,0,255,132,0,56,240,54,16,221,78,0,0,0,0,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,
+255,132,0,0,90,228,210,12,0,54,213,26,113,176,1,0,0,0,0,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,
+0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,4,2,0,4,2,255,132,0,255,132,52,26,0,52,26,0,124,255,8,0,0,124,255,8,0,0,124,255,8,0,0,124,255,8,0,
+0,124,255,8,0,0,124,255,8,0,0,124,255,8,0,0,124,255,8,0,0,124,255,8,0,0,124,255,8,0,0,124,255,8,0,0,124,255,8,0,0,132,255,255,255,245,224,177,92,4,0,0,0,132,255,56,56,63,90,158,248,202,19,0,
+0,132,255,0,0,0,0,0,50,242,177,0,0,132,255,0,0,0,0,0,0,119,255,37,4,133,255,4,4,4,0,0,0,40,255,98,255,255,255,255,255,255,0,0,0,8,255,123,52,157,255,52,52,52,0,0,0,9,255,122,0,132,255,0,
+0,0,0,0,0,41,255,97,0,132,255,0,0,0,0,0,0,120,255,36,0,132,255,0,0,0,0,0,50,242,176,0,0,132,255,56,56,62,89,158,248,203,19,0,0,132,255,255,255,247,226,177,93,4,0,0,0,0,0,0,0,0,3,0,
+0,0,0,161,246,144,17,241,21,0,0,25,233,74,159,231,143,0,0,0,0,0,0,0,0,0,0,0,255,255,99,0,0,0,0,132,255,255,255,227,8,0,0,0,132,255,255,184,255,117,0,0,0,132,255,255,132,171,238,16,0,0,132,255,
+255,132,39,252,135,0,0,132,255,255,132,0,155,245,25,0,132,255,255,132,0,27,246,152,0,132,255,255,132,0,0,138,251,38,132,255,255,132,0,0,17,239,170,132,255,255,132,0,0,0,121,254,184,255,255,132,0,0,0,10,230,255,255,255,
+132,0,0,0,0,104,255,255,0,0,0,58,240,56,0,0,0,0,0,0,0,0,0,79,223,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,180,237,248,216,131,13,0,0,0,104,254,177,82,63,112,232,210,19,0,44,
+250,147,0,0,0,0,31,240,168,0,155,239,10,0,0,0,0,0,129,253,31,220,171,0,0,0,0,0,0,48,255,94,248,139,0,0,0,0,0,0,16,255,123,248,139,0,0,0,0,0,0,16,255,122,220,171,0,0,0,0,0,0,48,255,
+95,156,239,9,0,0,0,0,0,129,254,31,46,251,146,0,0,0,0,31,240,170,0,0,107,254,176,80,62,112,231,213,20,0,0,0,65,182,238,249,218,133,14,0,0,0,0,0,0,0,174,174,2,0,0,0,0,0,0,0,117,197,8,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,180,237,248,216,131,13,0,0,0,104,254,177,82,63,112,232,210,19,0,44,250,147,0,0,0,0,31,240,168,0,155,239,10,0,0,0,0,0,129,253,31,220,171,0,0,0,0,
+0,0,48,255,94,248,139,0,0,0,0,0,0,16,255,123,248,139,0,0,0,0,0,0,16,255,122,220,171,0,0,0,0,0,0,48,255,95,156,239,9,0,0,0,0,0,129,254,31,46,251,146,0,0,0,0,31,240,170,0,0,107,254,176,
+80,62,112,231,213,20,0,0,0,65,182,238,249,218,133,14,0,0,0,0,0,13,211,227,105,0,0,0,0,0,0,2,179,115,21,209,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,180,237,248,216,131,13,0,0,0,104,
+254,177,82,63,112,232,210,19,0,44,250,147,0,0,0,0,31,240,168,0,155,239,10,0,0,0,0,0,129,253,31,220,171,0,0,0,0,0,0,48,255,94,248,139,0,0,0,0,0,0,16,255,123,248,139,0,0,0,0,0,0,16,255,122,
+220,171,0,0,0,0,0,0,48,255,95,156,239,9,0,0,0,0,0,129,254,31,46,251,146,0,0,0,0,31,240,170,0,0,107,254,176,80,62,112,231,213,20,0,0,0,65,182,238,249,218,133,14,0,0,0,0,0,0,0,0,0,3,0,
+0,0,0,0,6,197,237,106,64,197,0,0,0,0,0,61,207,78,185,228,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,180,237,248,216,131,13,0,0,0,104,254,177,82,63,112,232,210,19,0,44,250,147,0,0,0,0,
+31,240,168,0,155,239,10,0,0,0,0,0,129,253,31,220,171,0,0,0,0,0,0,48,255,94,248,139,0,0,0,0,0,0,16,255,123,248,139,0,0,0,0,0,0,16,255,122,220,171,0,0,0,0,0,0,48,255,95,156,239,9,0,0,
+0,0,0,129,254,31,46,251,146,0,0,0,0,31,240,170,0,0,107,254,176,80,62,112,231,213,20,0,0,0,65,182,238,249,218,133,14,0,0,0,0,0,4,2,0,4,2,0,0,0,0,0,0,255,132,0,255,132,0,0,0,0,0,0,
+52,26,0,52,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,180,237,248,216,131,13,0,0,0,104,254,177,82,63,112,232,210,19,0,44,250,147,0,0,0,0,31,240,168,0,155,239,10,0,0,0,0,0,129,253,31,220,
+171,0,0,0,0,0,0,48,255,94,248,139,0,0,0,0,0,0,16,255,123,248,139,0,0,0,0,0,0,16,255,122,220,171,0,0,0,0,0,0,48,255,95,156,239,9,0,0,0,0,0,129,254,31,46,251,146,0,0,0,0,31,240,170,
+0,0,107,254,176,80,62,112,231,213,20,0,0,0,65,182,238,249,218,133,14,0,0,24,58,0,0,0,0,0,9,73,0,137,244,61,0,0,0,9,189,232,12,4,170,243,59,0,9,188,236,46,0,0,4,172,242,67,187,236,47,0,0,0,
+0,4,174,255,238,49,0,0,0,0,0,8,186,253,243,59,0,0,0,0,8,184,236,53,175,242,57,0,0,7,182,237,48,0,5,175,241,56,0,140,237,49,0,0,0,5,175,235,12,17,45,0,0,0,0,0,5,58,0,0,0,0,0,0,
+0,0,0,0,0,17,4,0,0,0,59,177,235,250,222,145,28,195,95,0,0,100,253,177,81,63,121,243,251,179,1,0,41,249,147,0,0,0,0,141,255,189,0,0,152,239,10,0,0,0,85,234,154,255,38,0,218,171,0,0,0,54,240,61,
+42,255,98,0,247,139,0,0,29,230,95,0,12,255,124,0,248,143,0,12,208,134,0,0,17,255,122,0,220,173,2,177,172,1,0,0,48,255,93,0,155,242,147,204,10,0,0,0,131,253,29,0,43,251,244,27,0,0,0,31,240,164,0,0,
+46,240,255,191,81,63,112,231,208,17,0,3,215,82,82,191,242,248,215,128,12,0,0,0,24,0,0,0,0,0,0,0,0,0,0,0,0,30,227,112,0,0,0,0,0,0,0,40,230,63,0,0,0,0,0,0,0,0,0,0,0,0,255,132,
+0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,252,135,0,
+0,0,0,0,136,252,230,162,0,0,0,0,0,162,228,164,233,12,0,0,0,12,234,163,38,241,212,96,65,96,212,241,38,0,41,169,234,252,234,169,40,0,0,0,0,0,115,224,28,0,0,0,0,0,65,229,37,0,0,0,0,0,0,0,
+0,0,0,0,0,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,
+0,0,132,255,252,135,0,0,0,0,0,136,252,230,162,0,0,0,0,0,162,228,164,233,12,0,0,0,12,234,163,38,241,212,96,65,96,212,241,38,0,41,169,234,252,234,169,40,0,0,0,1,172,225,174,1,0,0,0,0,138,165,6,165,
+138,0,0,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,
+132,255,255,132,0,0,0,0,0,132,255,252,135,0,0,0,0,0,136,252,230,162,0,0,0,0,0,162,228,164,233,12,0,0,0,12,234,163,38,241,212,96,65,96,212,241,38,0,41,169,234,252,234,169,40,0,0,0,4,2,0,2,4,0,
+0,0,0,255,132,0,132,255,0,0,0,0,52,26,0,26,52,0,0,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,
+255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,255,132,0,0,0,0,0,132,255,252,135,0,0,0,0,0,136,252,230,162,0,0,0,0,0,162,228,164,233,12,0,0,0,12,234,163,38,241,212,96,65,96,212,241,38,0,
+41,169,234,252,234,169,40,0,0,0,0,0,0,55,240,54,0,0,0,0,0,0,0,15,219,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,201,220,9,0,0,0,0,99,255,79,0,42,249,139,0,0,0,23,238,167,0,0,
+0,124,252,52,0,0,171,234,20,0,0,0,4,207,208,5,79,255,87,0,0,0,0,0,48,251,137,229,175,0,0,0,0,0,0,0,132,255,238,24,0,0,0,0,0,0,0,6,255,138,0,0,0,0,0,0,0,0,0,255,132,0,0,0,
+0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,0,0,255,133,4,2,0,0,0,0,255,255,255,
+253,226,161,30,0,255,157,52,55,96,226,229,14,255,132,0,0,0,63,255,96,255,132,0,0,0,10,255,126,255,132,0,0,0,46,255,106,255,133,4,7,48,202,246,28,255,255,255,255,255,211,65,0,255,157,52,48,19,0,0,0,255,132,0,
+0,0,0,0,0,255,132,0,0,0,0,0,0,4,117,215,246,221,128,5,0,129,254,129,66,105,242,125,0,224,172,0,0,0,144,218,0,254,133,0,44,208,207,141,0,255,132,0,206,187,1,0,0,255,132,0,245,169,0,0,0,255,132,0,
+147,255,155,13,0,255,132,0,1,106,238,224,46,255,132,0,0,0,23,217,212,255,132,0,0,0,0,147,242,255,132,92,91,62,94,235,174,255,132,114,227,250,228,154,19,0,131,230,21,0,0,0,0,0,1,167,182,1,0,0,0,0,0,7,
+197,114,0,0,0,0,0,0,0,0,0,0,0,36,161,222,247,225,163,27,0,62,136,80,62,90,205,224,9,0,0,0,0,4,30,255,84,5,118,214,245,255,255,255,123,139,252,129,68,53,55,255,132,228,160,0,0,0,35,255,132,238,156,0,
+0,0,133,255,132,165,248,110,68,138,218,255,132,18,164,238,241,176,31,255,132,0,0,0,0,138,223,22,0,0,0,0,69,239,43,0,0,0,0,22,227,69,0,0,0,0,0,0,0,0,0,0,0,36,161,222,247,225,163,27,0,63,140,83,
+63,91,207,224,9,0,0,0,0,0,28,255,84,4,109,203,234,248,248,255,123,135,250,117,56,41,44,255,132,227,158,0,0,0,36,255,132,238,156,0,0,0,134,255,132,166,248,110,68,138,218,255,132,18,164,238,241,176,31,255,132,0,0,44,
+250,161,0,0,0,0,2,199,122,222,69,0,0,0,110,179,0,59,219,10,0,0,0,0,0,0,0,0,0,36,161,222,247,225,163,27,0,62,136,80,62,90,205,224,9,0,0,0,0,4,30,255,84,5,118,214,245,255,255,255,123,139,252,129,
+68,53,55,255,132,228,160,0,0,0,35,255,132,238,156,0,0,0,133,255,132,165,248,110,68,138,218,255,132,18,164,238,241,176,31,255,132,0,88,241,187,33,199,62,0,0,193,117,141,238,189,4,0,0,0,0,0,0,0,0,0,36,161,222,
+247,225,163,27,0,62,136,80,62,90,205,224,9,0,0,0,0,4,30,255,84,5,118,214,245,255,255,255,123,139,252,129,68,53,55,255,132,228,160,0,0,0,35,255,132,238,156,0,0,0,133,255,132,165,248,110,68,138,218,255,132,18,164,238,
+241,176,31,255,132,0,132,255,0,132,255,0,0,0,28,56,0,28,56,0,0,0,0,0,0,0,0,0,0,32,160,221,247,225,164,27,0,57,139,81,62,90,205,224,9,0,0,0,0,4,30,255,84,5,118,214,245,255,255,255,123,139,252,129,
+68,53,55,255,132,228,160,0,0,0,35,255,132,238,156,0,0,0,133,255,132,165,248,110,68,138,218,255,132,18,164,238,241,176,31,255,132,0,0,0,0,0,0,0,0,0,0,71,230,230,71,0,0,0,0,224,188,185,223,0,0,0,0,236,
+165,163,236,0,0,0,0,108,253,253,108,0,0,0,0,0,25,25,0,0,0,36,161,222,247,225,163,27,0,62,136,80,62,90,205,224,9,0,0,0,0,4,30,255,84,5,118,214,245,255,255,255,123,139,252,129,68,53,55,255,132,228,160,0,
+0,0,35,255,132,238,156,0,0,0,133,255,132,165,248,110,68,138,218,255,132,18,164,238,241,176,31,255,132,36,162,222,248,233,162,27,44,174,239,247,194,57,0,62,136,80,62,90,205,222,242,207,88,73,179,247,46,0,0,0,0,4,30,255,
+233,16,0,0,4,218,171,5,118,214,245,255,255,255,160,4,4,4,4,151,233,139,252,129,68,53,55,255,255,255,255,255,255,255,253,228,160,0,0,0,35,255,171,52,52,52,52,52,52,238,156,0,0,0,133,255,215,7,0,0,0,0,0,164,
+248,110,68,138,253,134,244,199,92,63,83,136,133,17,157,232,246,202,80,0,42,170,233,249,227,174,68,0,31,161,231,249,225,157,31,234,227,104,66,93,175,160,245,28,0,0,0,0,231,169,0,0,0,0,0,251,141,0,0,0,0,0,231,168,
+0,0,0,0,0,159,244,27,0,0,0,0,30,234,225,102,65,89,172,0,32,164,241,255,224,155,0,0,0,0,190,128,0,0,0,49,64,192,242,0,0,0,116,245,241,133,0,0,39,239,91,0,0,0,0,0,0,71,237,32,0,0,0,0,
+0,0,113,196,3,0,0,0,0,0,0,0,0,0,0,0,36,170,238,248,200,65,0,31,236,207,88,74,181,250,53,158,234,16,0,0,5,220,176,229,160,0,0,0,0,151,235,251,252,248,248,248,248,252,254,233,166,40,40,40,40,40,40,163,
+217,8,0,0,0,0,0,33,235,201,93,63,82,134,132,0,32,162,232,250,228,177,70,0,0,0,0,55,247,69,0,0,0,0,12,219,109,0,0,0,0,0,157,154,0,0,0,0,0,0,0,0,0,0,0,0,36,170,238,248,199,62,0,31,
+236,207,88,73,179,249,50,158,233,16,0,0,4,218,173,229,160,4,4,4,4,151,234,251,255,255,255,255,255,255,253,233,171,52,52,52,52,52,52,163,215,7,0,0,0,0,0,33,235,199,92,63,82,133,130,0,32,162,232,250,228,177,70,0,
+0,1,197,231,15,0,0,0,0,102,196,154,149,0,0,0,22,225,34,11,216,54,0,0,0,0,0,0,0,0,0,0,36,170,238,248,199,62,0,31,236,207,88,73,179,249,50,158,233,16,0,0,4,218,173,229,160,4,4,4,4,151,234,251,
+255,255,255,255,255,255,253,233,171,52,52,52,52,52,52,163,215,7,0,0,0,0,0,33,235,199,92,63,82,133,130,0,32,162,232,250,228,177,70,0,0,255,132,0,255,132,0,0,0,56,28,0,56,28,0,0,0,0,0,0,0,0,0,0,
+36,170,238,248,199,62,0,31,236,209,89,73,175,249,50,158,234,17,0,0,2,212,173,229,161,4,4,4,4,143,234,251,255,255,255,255,255,255,253,233,171,52,52,52,52,52,52,162,215,7,0,0,0,0,0,31,234,199,92,63,82,132,133,0,
+31,160,231,250,228,178,72,138,225,18,0,1,170,181,1,0,8,198,122,0,0,0,0,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,255,132,0,0,129,229,28,
+0,68,241,49,0,25,230,76,0,0,0,0,0,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,255,132,0,0,0,50,252,176,
+0,0,4,206,121,218,83,0,118,174,0,49,223,15,0,0,0,0,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,255,132,0,0,0,0,
+255,132,0,0,0,0,255,132,0,0,255,132,0,255,132,56,28,0,56,28,0,0,0,0,0,0,124,255,0,0,0,124,255,0,0,0,124,255,0,0,0,124,255,0,0,0,124,255,0,0,0,124,255,0,0,0,124,255,0,0,0,124,255,0,
+0,0,124,255,0,0,0,25,213,197,41,98,163,8,5,66,156,249,252,95,15,0,14,117,45,18,202,184,4,0,0,47,187,246,248,255,142,0,36,241,216,93,64,140,255,52,164,242,20,0,0,3,221,163,232,166,0,0,0,0,165,227,251,140,
+0,0,0,0,140,249,231,164,0,0,0,0,165,234,163,239,15,0,0,16,240,168,36,241,204,83,83,205,242,39,0,45,183,244,244,183,46,0,0,60,235,204,46,170,94,0,0,158,144,122,232,207,17,0,0,0,0,0,0,0,0,0,255,160,
+91,216,245,205,62,0,255,225,202,84,76,207,242,18,255,237,15,0,0,52,255,94,255,178,0,0,0,7,255,124,255,160,0,0,0,0,255,132,255,160,0,0,0,0,255,132,255,160,0,0,0,0,255,132,255,160,0,0,0,0,255,132,255,160,
+0,0,0,0,255,132,0,66,248,63,0,0,0,0,0,0,100,228,19,0,0,0,0,0,0,140,177,0,0,0,0,0,0,0,0,0,0,0,0,56,189,244,244,188,54,0,49,248,205,84,84,205,247,46,173,240,16,0,0,16,240,171,235,164,
+0,0,0,0,164,233,252,139,0,0,0,0,140,251,235,163,0,0,0,0,164,233,173,238,13,0,0,15,239,171,49,248,201,82,83,203,247,46,0,57,190,245,244,189,54,0,0,0,0,0,73,247,59,0,0,0,0,24,233,92,0,0,0,0,
+1,185,131,0,0,0,0,0,0,0,0,0,0,0,0,56,189,244,244,188,54,0,49,248,205,84,84,205,247,46,173,240,16,0,0,16,240,171,235,164,0,0,0,0,164,233,252,139,0,0,0,0,140,251,235,163,0,0,0,0,164,233,173,238,
+13,0,0,15,239,171,49,248,201,82,83,203,247,46,0,57,190,245,244,189,54,0,0,0,9,220,219,9,0,0,0,0,136,173,172,135,0,0,0,47,224,18,17,222,47,0,0,0,0,0,0,0,0,0,0,56,189,244,244,188,54,0,49,248,
+205,84,84,205,247,46,173,240,16,0,0,16,240,171,235,164,0,0,0,0,164,233,252,139,0,0,0,0,140,251,235,163,0,0,0,0,164,233,173,238,13,0,0,15,239,171,49,248,201,82,83,203,247,46,0,57,190,245,244,189,54,0,0,38,
+225,218,65,135,126,0,0,126,165,107,225,220,34,0,0,0,0,0,0,0,0,0,0,56,189,244,244,188,54,0,49,248,205,84,84,205,247,46,173,240,16,0,0,16,240,171,235,164,0,0,0,0,164,233,252,139,0,0,0,0,140,251,235,163,
+0,0,0,0,164,233,173,238,13,0,0,15,239,171,49,248,201,82,83,203,247,46,0,57,190,245,244,189,54,0,0,124,255,0,0,255,132,0,0,27,56,0,0,56,28,0,0,0,0,0,0,0,0,0,0,56,189,244,244,188,54,0,49,248,
+206,85,82,201,247,46,173,240,16,0,0,12,236,171,235,164,0,0,0,0,156,233,252,139,0,0,0,0,132,251,235,163,0,0,0,0,156,233,173,238,13,0,0,11,235,171,49,248,202,83,81,199,247,46,0,57,190,245,244,189,54,0,0,0,
+0,0,132,255,0,0,0,0,0,0,0,0,121,236,0,0,0,0,4,4,4,4,4,4,4,4,4,4,255,255,255,255,255,255,255,255,255,255,52,52,52,52,52,52,52,52,52,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,132,255,
+0,0,0,0,0,0,0,0,121,236,0,0,0,0,0,0,0,0,0,0,0,0,64,3,0,0,54,188,244,236,177,108,224,20,0,46,247,204,84,78,201,255,84,0,0,172,241,16,0,19,211,230,159,0,0,234,166,0,6,192,93,152,221,0,
+0,250,138,0,159,140,0,138,249,0,0,225,152,121,183,3,0,166,233,0,0,161,240,215,16,0,16,241,171,0,0,82,255,200,78,83,205,247,46,0,23,225,106,179,237,244,189,54,0,0,3,62,0,0,0,0,0,0,0,0,0,150,220,14,
+0,0,0,0,0,3,182,167,0,0,0,0,0,0,13,209,101,0,0,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,
+0,0,255,132,248,139,0,0,0,18,255,132,217,184,0,0,0,96,255,132,126,254,128,67,117,211,255,132,7,141,228,245,182,34,255,132,0,0,0,0,151,220,20,0,0,0,0,82,237,39,0,0,0,0,31,233,63,0,0,0,0,0,0,0,
+0,0,0,0,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,248,139,0,0,0,18,255,132,217,184,0,0,0,96,255,132,126,254,128,67,
+117,211,255,132,7,141,228,245,182,34,255,132,0,0,57,253,154,0,0,0,0,6,213,113,229,64,0,0,0,129,164,0,67,217,9,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,
+0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,248,139,0,0,0,18,255,132,217,184,0,0,0,96,255,132,126,254,128,67,117,211,255,132,7,141,228,245,182,34,255,132,0,132,255,0,132,255,0,0,0,28,56,0,
+28,56,0,0,0,0,0,0,0,0,0,0,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,255,132,0,0,0,0,255,132,248,139,0,0,0,18,255,132,217,184,0,0,
+0,96,255,132,126,254,128,67,117,211,255,132,7,141,228,245,182,34,255,132,0,0,0,0,4,200,173,1,0,0,0,0,0,136,203,10,0,0,0,0,0,68,225,25,0,0,0,0,0,0,0,0,0,0,0,0,148,233,5,0,0,0,12,243,
+135,42,255,86,0,0,0,103,254,34,0,192,189,0,0,0,206,184,0,0,86,254,37,0,53,255,81,0,0,5,230,140,0,157,229,4,0,0,0,130,236,22,245,130,0,0,0,0,27,251,193,252,29,0,0,0,0,0,174,255,178,0,0,0,
+0,0,0,89,255,75,0,0,0,0,0,0,165,224,2,0,0,0,0,56,104,252,110,0,0,0,0,0,255,243,157,4,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,133,121,226,
+248,203,62,0,255,227,200,82,84,203,247,46,255,238,13,0,0,15,239,169,255,163,0,0,0,0,164,232,255,139,0,0,0,0,140,251,255,163,0,0,0,0,164,232,255,237,13,0,0,15,239,169,255,227,200,82,83,203,247,45,255,132,120,227,
+249,203,63,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,255,132,0,0,0,0,0,0,0,0,255,132,0,255,132,0,0,0,0,56,28,0,56,28,0,0,0,0,0,0,0,0,0,0,0,151,212,0,0,0,0,71,255,65,
+51,255,56,0,0,0,171,220,1,0,207,155,0,0,20,249,122,0,0,108,242,11,0,115,252,26,0,0,17,247,97,0,215,178,0,0,0,0,166,196,60,255,79,0,0,0,0,66,255,195,231,4,0,0,0,0,1,221,255,135,0,0,0,0,
+0,0,144,254,36,0,0,0,0,0,0,213,190,0,0,0,0,0,56,129,255,77,0,0,0,0,0,255,241,137,0,0,0,0,0,
+    };
+    static const signed char asciiKerning16[128 * 128] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,-1,0,1,0,0,1,0,1,1,0,1,0,1,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,-1,0,-1,-1,-1,-1,-1,0,-1,-1,0,-1,0,0,-1,0,-1,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,-1,0,1,0,0,1,0,1,1,0,1,0,1,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,-1,0,-1,-1,-1,-1,-1,0,-1,-1,0,-1,0,0,-1,0,-1,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,-1,0,1,0,0,1,0,1,1,0,1,0,1,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,-1,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,-2,0,-1,-1,-1,-2,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,-1,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,-1,0,1,0,0,1,0,1,1,0,1,0,1,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,-1,-1,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,-1,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,-1,0,0,0,-1,-1,-1,-3,0,0,0,0,0,0,0,0,0,0,0,-2,-1,-1,-1,-1,0,
+0,-2,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,0,0,0,-1,0,0,0,0,0,0,-2,0,-1,-1,-1,-1,-1,0,-2,-1,0,-1,0,0,-1,0,-1,-1,-1,-1,-1,0,0,0,-2,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,-1,-1,0,-1,0,0,-1,0,-1,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,-1,0,1,0,0,1,0,1,1,0,1,0,1,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,-1,0,1,0,0,1,0,1,1,0,1,0,1,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,-1,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,-1,-1,0,0,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,-1,-1,0,-2,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,0,0,0,0,-1,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,-1,0,1,0,0,1,0,1,1,0,1,0,1,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,-1,-1,0,-1,0,0,-1,0,-1,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,-1,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,-1,-3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,1,0,0,-1,-1,0,1,-1,0,1,0,1,0,-1,1,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,1,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-2,0,-1,-1,0,-1,-1,0,0,0,0,0,0,-1,0,-1,-1,-1,-1,-1,0,-1,-1,0,-1,0,0,-1,0,-1,0,-1,-1,-1,0,0,0,-1,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,-2,-2,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,
+0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,-3,1,-3,0,-3,-1,0,1,-1,0,1,0,1,1,-3,1,0,-2,-3,0,-2,0,-3,0,-2,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,-1,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,-1,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-3,-4,0,0,0,0,0,0,0,0,0,0,0,-3,-1,-1,-1,-1,0,
+0,-2,-1,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,-3,0,0,0,-3,-1,0,0,-1,-1,0,-1,0,0,-3,0,0,0,-1,-1,-2,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,1,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,-1,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,1,1,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,0,1,0,0,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,0,-1,-1,-1,0,0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,-1,-1,-1,-1,0,-1,0,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,0,-1,-1,0,-1,0,0,-1,0,-1,0,-1,-1,0,-1,-1,-1,-1,-1,0,-1,0,-1,-1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,-1,0,1,0,0,1,0,1,1,0,1,0,1,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,1,1,0,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,0,1,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,1,0,1,0,1,0,0,1,0,0,0,0,0,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,-1,-1,0,-1,0,0,-1,0,-1,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,0,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,-1,-1,0,-1,0,0,0,0,0,0,-1,-1,0,0,0,0,0,-1,0,0,0,-1,0,
+    };
+
+    static const GlyphMetrics metrics18[256] = {
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {6, 0, 0, 3},
+        {7, -18, -27, 4},
+        {9, -17, 17, 5},
+        {14, 25, -24, 6},
+        {11, 32, -13, 7},
+        {17, 0, 0, 8},
+        {14, 9, 11, 9},
+        {5, -17, -28, 10},
+        {7, -29, -29, 11},
+        {7, -15, -16, 12},
+        {9, 0, 0, 13},
+        {15, -6, 6, 14},
+        {5, 7, -29, 15},
+        {7, -8, 7, 16},
+        {6, -5, 23, 17},
+        {6, 0, -4, 18},
+        {11, 0, 0, 19},
+        {11, 0, 0, 20},
+        {11, 0, 0, 21},
+        {11, 0, 0, 22},
+        {11, 0, 0, 23},
+        {11, 0, 0, 24},
+        {11, 0, 0, 25},
+        {11, 0, 0, 26},
+        {11, 0, 0, 27},
+        {11, 0, 0, 28},
+        {6, 7, 13, 29},
+        {6, 7, 13, 30},
+        {15, -6, -26, 31},
+        {15, -6, 6, 32},
+        {15, -6, -26, 33},
+        {9, 19, 3, 34},
+        {18, 12, 3, 35},
+        {12, 0, -20, 36},
+        {12, -15, -17, 37},
+        {12, 1, -30, 38},
+        {14, -15, -4, 39},
+        {12, -15, 30, 40},
+        {11, -15, 31, 41},
+        {14, 1, -12, 42},
+        {14, -15, 15, 43},
+        {5, -15, -30, 44},
+        {5, -20, -30, 45},
+        {12, -15, 3, 46},
+        {10, -15, -12, 47},
+        {16, -15, 15, 48},
+        {14, -15, 15, 49},
+        {14, 1, -1, 50},
+        {11, -15, -21, 51},
+        {14, 1, -1, 52},
+        {13, -15, 2, 53},
+        {11, 15, 0, 54},
+        {11, 5, -5, 55},
+        {14, -28, 28, 56},
+        {12, 0, -20, 57},
+        {18, 0, 13, 58},
+        {12, 0, -21, 59},
+        {11, -25, -20, 60},
+        {13, -12, 0, 61},
+        {8, -29, 29, 62},
+        {6, 0, -4, 63},
+        {7, -10, -16, 64},
+        {15, 0, -5, 65},
+        {9, -3, 3, 66},
+        {9, 0, 0, 67},
+        {11, 5, -22, 68},
+        {12, -23, 20, 69},
+        {10, 0, -7, 70},
+        {11, 0, -21, 71},
+        {11, 0, 2, 72},
+        {7, -38, -18, 73},
+        {11, 0, -21, 74},
+        {12, -23, 30, 75},
+        {5, -19, -25, 76},
+        {5, -13, -25, 77},
+        {11, -23, 9, 78},
+        {5, -19, -25, 79},
+        {18, -23, 11, 80},
+        {12, -23, 30, 81},
+        {11, 0, 1, 82},
+        {12, -23, 20, 83},
+        {11, 0, -21, 84},
+        {9, -23, 55, 85},
+        {10, -2, 27, 86},
+        {8, -33, 36, 87},
+        {12, -30, 24, 88},
+        {11, 0, 22, 89},
+        {15, 0, 18, 90},
+        {11, 0, 22, 91},
+        {11, 0, 22, 92},
+        {10, -14, 14, 93},
+        {11, -16, -16, 94},
+        {6, 18, 1, 95},
+        {12, -16, 16, 96},
+        {15, -6, -26, 97},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {11, 0, 13, 0},
+        {6, 0, 0, 98},
+        {7, -18, -27, 99},
+        {12, -31, -9, 100},
+        {12, 9, 15, 101},
+        {12, 0, 21, 102},
+        {11, 12, -14, 103},
+        {6, 18, 1, 104},
+        {10, -12, 30, 105},
+        {9, -7, 7, 106},
+        {17, 31, -31, 107},
+        {8, 22, -10, 108},
+        {11, 25, 20, 109},
+        {16, -19, 25, 110},
+        {7, -8, 7, 111},
+        {17, 31, -31, 112},
+        {9, -8, 8, 113},
+        {10, -18, 18, 114},
+        {15, -6, 6, 115},
+        {7, -11, -5, 116},
+        {7, 6, 8, 117},
+        {9, 0, 0, 118},
+        {12, -30, 21, 119},
+        {12, 25, 22, 120},
+        {6, -5, 23, 121},
+        {9, -2, 13, 122},
+        {7, 24, 1, 123},
+        {9, -2, 13, 124},
+        {11, -19, -24, 125},
+        {17, 11, -30, 126},
+        {17, 11, -13, 127},
+        {18, -2, 15, 128},
+        {9, 16, -18, 129},
+        {12, 0, -20, 130},
+        {12, 0, -20, 131},
+        {12, 0, -20, 132},
+        {12, 16, -17, 133},
+        {13, -29, 29, 134},
+        {13, -16, 16, 135},
+        {18, -5, 30, 136},
+        {12, 1, -30, 137},
+        {12, -15, 30, 138},
+        {12, -15, 30, 139},
+        {12, -15, 30, 140},
+        {12, -15, 27, 141},
+        {5, -15, -30, 142},
+        {5, -15, -30, 143},
+        {5, -15, -30, 144},
+        {7, -53, 54, 145},
+        {15, -50, 15, 146},
+        {14, -15, 15, 147},
+        {14, 1, -1, 148},
+        {14, 1, -1, 149},
+        {14, 1, -1, 150},
+        {14, 1, -1, 151},
+        {14, 1, -1, 152},
+        {15, 0, -5, 153},
+        {14, 1, -1, 154},
+        {14, -28, 28, 155},
+        {14, -28, 28, 156},
+        {14, -28, 28, 157},
+        {14, -28, 28, 158},
+        {11, -25, -20, 159},
+        {11, -15, -23, 160},
+        {12, -23, 11, 161},
+        {11, 5, -22, 162},
+        {11, 5, -22, 163},
+        {11, 5, -22, 164},
+        {11, 5, -22, 165},
+        {11, 5, -22, 166},
+        {11, 5, -22, 167},
+        {18, 5, 22, 168},
+        {10, 0, -7, 169},
+        {11, 0, 2, 170},
+        {11, 0, 2, 171},
+        {11, 0, 2, 172},
+        {11, 0, 2, 173},
+        {5, -19, -25, 174},
+        {5, -19, -25, 175},
+        {5, -19, -25, 176},
+        {5, 1, -1, 177},
+        {11, 0, 1, 178},
+        {12, -23, 30, 179},
+        {11, 0, 1, 180},
+        {11, 0, 1, 181},
+        {11, 0, 1, 182},
+        {11, 0, 1, 183},
+        {11, 0, 1, 184},
+        {15, -6, 6, 185},
+        {11, 0, 1, 186},
+        {12, -30, 24, 187},
+        {12, -30, 24, 188},
+        {12, -30, 24, 189},
+        {12, -30, 24, 190},
+        {11, 0, 22, 191},
+        {12, -23, 20, 192},
+        {11, -5, 18, 193},
+    };
+    static const GlyphBitmap glyphs18[] = {
+        {32, 0, 0, 0, 0, 0},
+        {33, 3, -13, 2, 13, 0},
+        {34, 2, -13, 5, 5, 26},
+        {35, 1, -13, 12, 13, 51},
+        {36, 1, -14, 9, 17, 207},
+        {37, 1, -13, 15, 13, 360},
+        {38, 1, -13, 13, 13, 555},
+        {39, 2, -13, 2, 5, 724},
+        {40, 2, -14, 5, 16, 734},
+        {41, 1, -14, 5, 16, 814},
+        {42, 0, -13, 9, 8, 894},
+        {43, 2, -11, 11, 11, 966},
+        {44, 1, -2, 3, 4, 1087},
+        {45, 1, -6, 5, 3, 1099},
+        {46, 2, -3, 2, 3, 1114},
+        {47, 0, -13, 7, 15, 1120},
+        {48, 1, -13, 9, 13, 1225},
+        {49, 2, -13, 8, 13, 1342},
+        {50, 1, -13, 8, 13, 1446},
+        {51, 1, -13, 9, 13, 1550},
+        {52, 1, -13, 10, 13, 1667},
+        {53, 1, -13, 9, 13, 1797},
+        {54, 1, -13, 9, 13, 1914},
+        {55, 1, -13, 8, 13, 2031},
+        {56, 1, -13, 9, 13, 2135},
+        {57, 1, -13, 9, 13, 2252},
+        {58, 2, -10, 2, 10, 2369},
+        {59, 1, -10, 3, 12, 2389},
+        {60, 2, -11, 12, 11, 2425},
+        {61, 2, -9, 11, 7, 2557},
+        {62, 2, -11, 12, 11, 2634},
+        {63, 1, -13, 7, 13, 2766},
+        {64, 1, -13, 16, 17, 2857},
+        {65, 0, -13, 13, 13, 3129},
+        {66, 2, -13, 9, 13, 3298},
+        {67, 1, -13, 11, 13, 3415},
+        {68, 2, -13, 11, 13, 3558},
+        {69, 2, -13, 9, 13, 3701},
+        {70, 2, -13, 8, 13, 3818},
+        {71, 1, -13, 12, 13, 3922},
+        {72, 2, -13, 10, 13, 4078},
+        {73, 2, -13, 2, 13, 4208},
+        {74, -1, -13, 5, 17, 4234},
+        {75, 2, -13, 11, 13, 4319},
+        {76, 2, -13, 9, 13, 4462},
+        {77, 2, -13, 12, 13, 4579},
+        {78, 2, -13, 10, 13, 4735},
+        {79, 1, -13, 12, 13, 4865},
+        {80, 2, -13, 9, 13, 5021},
+        {81, 1, -13, 12, 15, 5138},
+        {82, 2, -13, 11, 13, 5318},
+        {83, 1, -13, 9, 13, 5461},
+        {84, 0, -13, 11, 13, 5578},
+        {85, 2, -13, 10, 13, 5721},
+        {86, 0, -13, 13, 13, 5851},
+        {87, 0, -13, 18, 13, 6020},
+        {88, 0, -13, 12, 13, 6254},
+        {89, 0, -13, 12, 13, 6410},
+        {90, 1, -13, 11, 13, 6566},
+        {91, 2, -14, 4, 17, 6709},
+        {92, 0, -13, 7, 15, 6777},
+        {93, 1, -14, 5, 17, 6882},
+        {94, 1, -13, 13, 5, 6967},
+        {95, 0, 2, 9, 3, 7032},
+        {96, 1, -15, 5, 4, 7059},
+        {97, 1, -10, 9, 10, 7079},
+        {98, 2, -14, 9, 14, 7169},
+        {99, 1, -10, 8, 10, 7295},
+        {100, 1, -14, 9, 14, 7375},
+        {101, 1, -10, 9, 10, 7501},
+        {102, 1, -14, 7, 14, 7591},
+        {103, 1, -10, 9, 14, 7689},
+        {104, 2, -14, 8, 14, 7815},
+        {105, 2, -14, 2, 14, 7927},
+        {106, 0, -14, 4, 18, 7955},
+        {107, 2, -14, 9, 14, 8027},
+        {108, 2, -14, 2, 14, 8153},
+        {109, 2, -10, 15, 10, 8181},
+        {110, 2, -10, 8, 10, 8331},
+        {111, 1, -10, 9, 10, 8411},
+        {112, 2, -10, 9, 14, 8501},
+        {113, 1, -10, 9, 14, 8627},
+        {114, 2, -11, 6, 11, 8753},
+        {115, 1, -10, 8, 10, 8819},
+        {116, 1, -13, 6, 13, 8899},
+        {117, 2, -10, 8, 10, 8977},
+        {118, 0, -10, 11, 10, 9057},
+        {119, 0, -10, 14, 10, 9167},
+        {120, 0, -10, 11, 10, 9307},
+        {121, 0, -10, 10, 14, 9417},
+        {122, 1, -10, 8, 10, 9557},
+        {123, 2, -14, 7, 17, 9637},
+        {124, 2, -14, 2, 18, 9756},
+        {125, 2, -14, 8, 17, 9792},
+        {126, 2, -8, 12, 4, 9928},
+        {160, 0, 0, 0, 0, 9976},
+        {161, 3, -13, 2, 13, 9976},
+        {162, 2, -13, 8, 16, 10002},
+        {163, 1, -13, 9, 13, 10130},
+        {164, 0, -11, 11, 11, 10247},
+        {165, 0, -13, 11, 13, 10368},
+        {166, 2, -13, 2, 16, 10511},
+        {167, 1, -13, 8, 16, 10543},
+        {168, 2, -14, 5, 3, 10671},
+        {169, 2, -14, 13, 15, 10686},
+        {170, 0, -14, 7, 10, 10881},
+        {171, 1, -10, 8, 9, 10951},
+        {172, 2, -8, 12, 6, 11023},
+        {173, 1, -6, 5, 3, 11095},
+        {174, 2, -14, 13, 15, 11110},
+        {175, 2, -14, 5, 3, 11305},
+        {176, 2, -14, 6, 7, 11320},
+        {177, 2, -11, 11, 11, 11362},
+        {178, 1, -14, 5, 8, 11483},
+        {179, 0, -14, 6, 8, 11523},
+        {180, 3, -15, 5, 4, 11571},
+        {181, 2, -10, 10, 14, 11591},
+        {182, 1, -13, 9, 15, 11731},
+        {183, 2, -8, 2, 3, 11866},
+        {184, 2, -1, 4, 5, 11872},
+        {185, 0, -14, 6, 8, 11892},
+        {186, 0, -14, 8, 10, 11940},
+        {187, 2, -10, 8, 9, 12020},
+        {188, 1, -14, 16, 14, 12092},
+        {189, 1, -13, 16, 14, 12316},
+        {190, 0, -15, 18, 15, 12540},
+        {191, 1, -13, 7, 13, 12810},
+        {192, 0, -17, 13, 17, 12901},
+        {193, 0, -17, 13, 17, 13122},
+        {194, 0, -17, 13, 17, 13343},
+        {195, -1, -18, 14, 18, 13564},
+        {196, 0, -17, 13, 17, 13816},
+        {197, 0, -18, 13, 18, 14037},
+        {198, 0, -13, 17, 13, 14271},
+        {199, 1, -13, 11, 17, 14492},
+        {200, 2, -17, 9, 17, 14679},
+        {201, 2, -17, 9, 17, 14832},
+        {202, 2, -17, 9, 17, 14985},
+        {203, 2, -17, 9, 17, 15138},
+        {204, 0, -17, 5, 17, 15291},
+        {205, 1, -17, 4, 17, 15376},
+        {206, 0, -17, 6, 17, 15444},
+        {207, 1, -17, 5, 17, 15546},
+        {208, 1, -13, 13, 13, 15631},
+        {209, 2, -18, 10, 18, 15800},
+        {210, 1, -17, 12, 17, 15980},
+        {211, 1, -17, 12, 17, 16184},
+        {212, 1, -17, 12, 17, 16388},
+        {213, 1, -18, 12, 18, 16592},
+        {214, 1, -17, 12, 17, 16808},
+        {215, 2, -11, 11, 11, 17012},
+        {216, 0, -14, 14, 15, 17133},
+        {217, 2, -17, 10, 17, 17343},
+        {218, 2, -17, 10, 17, 17513},
+        {219, 2, -17, 10, 17, 17683},
+        {220, 2, -17, 10, 17, 17853},
+        {221, 0, -17, 12, 17, 18023},
+        {222, 2, -13, 9, 13, 18227},
+        {223, 2, -14, 9, 14, 18344},
+        {224, 1, -15, 9, 15, 18470},
+        {225, 1, -15, 9, 15, 18605},
+        {226, 1, -15, 9, 15, 18740},
+        {227, 1, -14, 9, 14, 18875},
+        {228, 1, -14, 9, 14, 19001},
+        {229, 1, -17, 9, 17, 19127},
+        {230, 1, -10, 16, 10, 19280},
+        {231, 1, -10, 8, 14, 19440},
+        {232, 1, -15, 9, 15, 19552},
+        {233, 1, -15, 9, 15, 19687},
+        {234, 1, -15, 9, 15, 19822},
+        {235, 1, -14, 9, 14, 19957},
+        {236, -1, -15, 6, 15, 20083},
+        {237, 1, -15, 5, 15, 20173},
+        {238, 0, -15, 6, 15, 20248},
+        {239, 0, -14, 5, 14, 20338},
+        {240, 1, -14, 9, 14, 20408},
+        {241, 2, -14, 8, 14, 20534},
+        {242, 1, -15, 9, 15, 20646},
+        {243, 1, -15, 9, 15, 20781},
+        {244, 1, -15, 9, 15, 20916},
+        {245, 1, -14, 9, 14, 21051},
+        {246, 1, -14, 9, 14, 21177},
+        {247, 2, -10, 11, 9, 21303},
+        {248, 0, -11, 11, 12, 21402},
+        {249, 2, -15, 8, 15, 21534},
+        {250, 2, -15, 8, 15, 21654},
+        {251, 2, -15, 8, 15, 21774},
+        {252, 2, -14, 8, 14, 21894},
+        {253, 0, -14, 10, 18, 22006},
+        {254, 2, -14, 9, 18, 22186},
+        {255, 0, -14, 11, 18, 22348},
+    };
+    static const unsigned char pixels18[] = {
+255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,0,0,40,28,255,180,255,180,255,180,0,180,255,255,180,0,180,255,255,180,0,180,255,255,180,0,180,255,255,180,0,180,255,0,0,0,0,41,255,54,0,74,255,22,0,0,
+0,0,0,98,247,6,0,132,220,0,0,0,0,0,0,155,196,0,0,190,162,0,0,0,20,20,20,213,150,20,22,244,118,20,20,0,255,255,255,255,255,255,255,255,255,255,255,0,68,68,133,253,75,68,159,234,68,68,68,0,0,0,150,202,
+0,0,184,168,0,0,0,20,20,20,219,144,20,24,245,114,20,20,0,255,255,255,255,255,255,255,255,255,255,255,0,68,68,137,251,71,68,163,230,68,68,68,0,0,0,147,201,0,0,183,168,0,0,0,0,0,0,208,141,0,2,240,107,0,
+0,0,0,0,15,253,81,0,46,255,46,0,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,5,226,6,0,0,0,6,123,224,253,255,255,232,151,0,153,255,186,89,232,88,131,188,0,243,212,2,0,
+224,0,0,0,0,226,219,6,0,224,0,0,0,0,108,255,212,128,233,30,0,0,0,0,74,176,237,255,255,215,88,0,0,0,0,0,227,89,212,254,72,0,0,0,0,224,0,30,255,158,21,0,0,0,224,0,35,255,151,246,164,98,65,231,
+97,214,252,60,93,168,219,243,255,238,195,71,0,0,0,0,0,224,0,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,0,112,0,0,0,0,13,155,234,233,151,11,0,0,0,0,56,217,9,0,0,152,255,138,140,255,147,0,0,0,
+5,211,66,0,0,0,232,205,0,0,207,229,0,0,0,127,157,0,0,0,0,240,191,0,0,192,240,0,0,41,225,17,0,0,0,0,183,248,64,65,248,182,0,1,196,85,0,0,0,0,0,39,218,255,255,217,38,0,107,177,0,0,0,0,
+0,0,0,5,46,46,5,0,28,227,27,3,127,218,219,128,3,0,0,0,0,0,0,178,105,0,119,255,96,96,255,118,0,0,0,0,0,87,195,1,0,218,208,0,0,209,217,0,0,0,0,17,225,40,0,0,246,185,0,0,186,246,0,0,
+0,0,159,125,0,0,0,220,220,0,0,222,220,0,0,0,67,211,5,0,0,0,128,255,150,150,255,127,0,0,9,218,56,0,0,0,0,6,141,232,232,142,6,0,0,66,192,238,241,208,135,0,0,0,0,0,0,59,251,224,118,106,153,238,
+0,0,0,0,0,0,154,255,39,0,0,0,8,0,0,0,0,0,0,149,255,32,0,0,0,0,0,0,0,0,0,0,41,246,193,9,0,0,0,0,0,0,0,0,0,67,242,248,189,11,0,0,0,0,0,0,0,47,246,158,45,235,198,16,
+0,0,10,255,148,0,182,240,11,0,46,236,207,21,0,55,255,86,0,242,189,0,0,0,49,238,215,27,161,232,9,0,239,221,0,0,0,0,52,240,225,251,102,0,0,165,255,105,0,0,0,0,98,255,246,25,0,0,27,224,255,177,110,103,
+163,249,198,246,210,17,0,0,18,140,220,250,241,193,95,2,88,255,197,10,255,180,255,180,255,180,255,180,255,180,0,0,172,194,0,0,60,255,63,0,0,186,207,0,0,36,254,113,0,0,120,255,39,0,0,183,240,1,0,0,225,206,0,0,
+0,246,188,0,0,0,245,189,0,0,0,224,206,0,0,0,180,240,1,0,0,116,255,40,0,0,33,253,114,0,0,0,182,207,0,0,0,58,255,63,0,0,0,171,194,0,27,247,91,0,0,0,144,227,9,0,0,32,254,107,0,0,0,193,
+210,0,0,0,120,255,40,0,0,63,255,104,0,0,28,255,147,0,0,9,255,169,0,0,10,255,168,0,0,28,255,147,0,0,64,255,103,0,0,120,255,40,0,0,195,210,0,0,33,254,107,0,0,145,227,9,0,26,247,92,0,0,0,0,
+0,0,255,0,0,0,0,14,62,0,0,255,0,0,63,14,47,214,167,27,255,27,167,212,45,0,3,97,212,255,212,95,2,0,0,2,94,212,255,211,94,2,0,45,212,168,27,255,27,168,211,45,15,62,0,0,255,0,0,63,15,0,0,0,
+0,255,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,20,20,20,20,20,255,185,20,20,20,20,255,255,255,
+255,255,255,255,255,255,255,255,68,68,68,68,68,255,200,68,68,68,68,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,
+255,180,13,255,155,78,252,38,149,161,0,24,24,24,24,24,255,255,255,255,255,68,68,68,68,68,40,28,255,180,255,180,0,0,0,0,149,229,1,0,0,0,1,228,150,0,0,0,0,54,255,70,0,0,0,0,135,240,5,0,0,0,0,216,
+165,0,0,0,0,41,255,84,0,0,0,0,121,248,12,0,0,0,0,202,179,0,0,0,0,28,254,99,0,0,0,0,108,253,21,0,0,0,0,189,193,0,0,0,0,17,251,113,0,0,0,0,94,255,33,0,0,0,0,175,208,0,0,0,
+0,0,118,74,0,0,0,0,0,0,7,128,222,249,222,128,6,0,0,173,254,153,100,155,254,172,0,72,255,130,0,0,0,134,255,70,163,253,19,0,0,0,21,254,162,216,216,0,0,0,0,0,218,215,243,189,0,0,0,0,0,190,242,253,
+182,0,0,0,0,0,182,252,243,189,0,0,0,0,0,190,242,216,216,0,0,0,0,0,218,215,163,253,19,0,0,0,21,254,163,73,255,130,0,0,0,134,255,72,0,175,254,152,99,154,254,174,0,0,7,130,224,250,224,130,7,0,122,176,
+230,255,180,0,0,0,255,233,180,255,180,0,0,0,33,0,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,
+0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,0,255,180,0,0,0,124,124,124,255,216,124,124,124,255,255,255,255,255,255,255,255,90,167,220,247,224,172,45,0,255,208,131,99,128,234,251,69,67,0,0,0,0,34,245,205,0,0,
+0,0,0,0,193,249,0,0,0,0,0,0,219,227,0,0,0,0,0,89,255,135,0,0,0,0,42,241,216,11,0,0,0,33,227,230,34,0,0,0,28,222,235,42,0,0,0,24,217,239,49,0,0,0,19,212,243,56,0,0,0,0,205,255,
+154,92,92,92,92,92,255,255,255,255,255,255,255,255,13,156,209,238,248,220,157,36,0,25,200,141,110,99,137,235,242,42,0,0,0,0,0,0,53,255,150,0,0,0,0,0,0,22,255,167,0,0,5,20,25,60,187,255,93,0,0,64,255,255,
+255,232,113,0,0,0,17,68,77,123,212,127,2,0,0,0,0,0,0,42,248,132,0,0,0,0,0,0,0,199,229,0,0,0,0,0,0,0,208,246,22,1,0,0,0,0,63,252,191,128,215,138,105,109,159,249,242,51,60,170,223,246,249,219,
+152,34,0,0,0,0,0,2,200,255,180,0,0,0,0,0,0,111,243,255,180,0,0,0,0,0,31,243,112,255,180,0,0,0,0,0,183,205,3,255,180,0,0,0,0,92,252,51,0,255,180,0,0,0,20,235,143,0,0,255,180,0,0,0,
+165,226,12,0,0,255,180,0,0,73,255,78,0,0,0,255,180,0,0,225,194,36,36,36,36,255,190,36,20,255,255,255,255,255,255,255,255,255,148,84,84,84,84,84,84,255,204,84,48,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,
+0,255,180,0,0,0,255,255,255,255,255,255,255,20,0,255,207,92,92,92,92,92,7,0,255,180,0,0,0,0,0,0,0,255,180,4,13,0,0,0,0,0,255,246,251,255,239,160,26,0,0,202,119,81,91,156,253,228,26,0,0,0,0,0,
+0,94,255,155,0,0,0,0,0,0,0,223,230,0,0,0,0,0,0,0,191,250,0,0,0,0,0,0,1,227,227,19,0,0,0,0,0,110,255,150,128,207,137,106,112,176,255,220,21,69,181,227,247,247,213,135,16,0,0,0,41,165,231,249,
+229,176,25,0,71,247,199,117,98,121,177,40,22,237,152,1,0,0,0,0,0,126,246,14,0,11,4,0,0,0,200,199,86,220,255,251,189,49,0,239,235,252,145,81,115,239,244,41,252,255,126,0,0,0,58,255,167,243,255,26,0,0,0,0,
+214,232,215,254,2,0,0,0,0,189,250,159,255,30,0,0,0,0,218,228,65,255,139,0,0,0,71,255,154,0,162,255,167,104,138,246,230,26,0,4,118,216,249,234,162,29,0,255,255,255,255,255,255,255,251,92,92,92,92,92,116,255,179,0,
+0,0,0,0,115,255,85,0,0,0,0,0,208,239,7,0,0,0,0,45,255,153,0,0,0,0,0,139,255,60,0,0,0,0,2,229,221,0,0,0,0,0,70,255,128,0,0,0,0,0,164,255,35,0,0,0,0,12,244,196,0,0,0,0,
+0,95,255,102,0,0,0,0,0,188,248,16,0,0,0,0,27,253,170,0,0,0,0,0,43,166,224,248,226,173,55,0,47,246,230,128,99,130,232,251,64,153,255,48,0,0,0,50,255,163,168,255,22,0,0,0,23,255,153,99,255,186,56,26,
+57,188,237,42,2,131,243,255,255,255,211,36,0,0,102,192,113,78,114,230,223,33,116,248,36,0,0,0,38,248,174,225,199,0,0,0,0,0,200,238,249,202,0,0,0,0,0,204,243,207,251,47,0,0,0,50,251,189,78,253,241,136,101,138,
+242,249,58,0,53,175,224,250,235,175,51,0,0,38,168,234,249,216,117,4,0,41,240,241,134,103,158,253,159,0,177,252,51,0,0,0,110,255,63,241,205,0,0,0,0,11,254,158,248,194,0,0,0,0,4,250,213,205,242,19,0,0,0,68,
+255,242,90,255,197,61,30,84,228,250,252,0,109,239,255,255,250,134,191,238,0,0,6,51,60,18,0,222,198,0,0,0,0,0,0,40,255,125,0,0,0,0,0,6,187,237,21,47,201,127,99,121,214,247,71,0,25,177,229,250,232,166,42,0,
+0,40,28,255,180,255,180,0,0,0,0,0,0,0,0,40,28,255,180,255,180,0,40,28,0,255,180,0,255,180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,180,13,255,155,78,252,38,149,161,0,0,0,0,0,0,0,0,
+0,0,0,14,36,0,0,0,0,0,0,0,7,81,171,247,128,0,0,0,0,2,67,157,240,255,227,141,37,0,0,53,143,230,255,234,151,62,1,0,0,129,218,255,241,161,72,4,0,0,0,0,0,255,255,206,49,0,0,0,0,0,0,0,
+0,77,168,245,255,209,121,33,0,0,0,0,0,0,0,12,93,183,251,255,200,112,26,0,0,0,0,0,0,0,21,108,199,255,253,192,63,0,0,0,0,0,0,0,0,33,123,213,128,0,0,0,0,0,0,0,0,0,0,0,12,20,20,20,
+20,20,20,20,20,20,20,20,255,255,255,255,255,255,255,255,255,255,255,68,68,68,68,68,68,68,68,68,68,68,0,0,0,0,0,0,0,0,0,0,0,24,24,24,24,24,24,24,24,24,24,24,255,255,255,255,255,255,255,255,255,255,255,68,
+68,68,68,68,68,68,68,68,68,68,50,0,0,0,0,0,0,0,0,0,0,0,255,216,126,36,0,0,0,0,0,0,0,0,96,185,252,255,202,112,24,0,0,0,0,0,0,0,22,107,196,254,253,188,98,15,0,0,0,0,0,0,0,29,
+117,206,255,248,174,53,0,0,0,0,0,0,0,10,125,251,255,128,0,0,0,0,6,77,166,244,255,212,123,27,0,3,68,157,239,255,226,138,48,0,0,0,148,233,255,237,153,63,1,0,0,0,0,0,246,169,78,5,0,0,0,0,0,0,
+0,0,12,0,0,0,0,0,0,0,0,0,0,0,72,178,227,244,203,78,0,254,180,107,113,222,253,64,56,0,0,0,41,255,154,0,0,0,0,31,255,162,0,0,0,4,176,254,62,0,0,4,174,255,108,0,0,0,136,255,114,0,0,0,
+0,234,208,0,0,0,0,0,255,180,0,0,0,0,0,148,104,0,0,0,0,0,40,28,0,0,0,0,0,255,180,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,5,10,0,0,0,0,0,0,0,0,0,0,0,67,166,232,
+255,255,240,183,95,3,0,0,0,0,0,23,186,244,163,101,74,85,123,203,255,208,42,0,0,0,25,224,173,22,0,0,0,0,0,0,78,237,234,42,0,0,195,153,1,0,0,2,13,0,0,16,14,45,243,211,3,82,214,7,0,1,127,241,
+255,226,87,216,180,0,118,255,80,173,103,0,0,101,255,189,85,103,226,246,180,0,31,255,151,228,34,0,0,210,233,10,0,0,66,255,180,0,6,255,174,250,7,0,0,245,189,0,0,0,10,255,180,0,32,255,150,235,23,0,0,221,222,2,
+0,0,45,255,180,0,119,255,71,192,84,0,0,135,255,149,36,53,199,255,190,104,249,164,0,111,194,0,0,11,185,255,255,249,103,255,255,226,113,3,0,10,229,117,0,0,0,40,60,17,0,60,33,0,0,0,0,0,61,247,131,4,0,0,
+0,0,0,0,35,55,0,0,0,0,0,67,235,223,122,58,32,36,78,158,248,146,0,0,0,0,0,0,21,138,230,255,255,255,252,192,76,0,0,0,0,0,0,0,0,0,0,34,59,54,17,0,0,0,0,0,0,0,0,0,0,17,248,255,
+88,0,0,0,0,0,0,0,0,0,108,254,222,187,0,0,0,0,0,0,0,0,0,207,189,110,254,32,0,0,0,0,0,0,0,50,255,94,20,250,129,0,0,0,0,0,0,0,149,244,11,0,176,225,2,0,0,0,0,0,8,238,160,0,
+0,81,255,70,0,0,0,0,0,90,255,65,0,0,5,235,169,0,0,0,0,0,189,234,37,36,36,36,167,249,19,0,0,0,33,254,255,255,255,255,255,255,255,111,0,0,0,130,255,100,84,84,84,84,84,216,209,0,0,2,226,210,0,0,
+0,0,0,0,127,255,52,0,72,255,127,0,0,0,0,0,0,44,255,151,0,171,255,45,0,0,0,0,0,0,0,217,240,9,255,255,255,255,252,228,179,64,0,255,207,92,92,97,129,229,254,71,255,180,0,0,0,0,46,255,165,255,180,0,
+0,0,0,20,255,160,255,185,20,20,24,55,180,251,64,255,255,255,255,255,255,237,71,0,255,200,68,68,72,105,216,236,41,255,180,0,0,0,0,24,243,176,255,180,0,0,0,0,0,196,236,255,180,0,0,0,0,0,201,247,255,180,0,0,
+0,0,33,247,198,255,207,92,92,95,128,230,251,67,255,255,255,255,254,237,180,58,0,0,0,11,115,197,238,251,231,178,88,2,0,38,219,253,174,113,98,124,196,255,122,10,217,238,56,0,0,0,0,0,64,98,111,255,94,0,0,0,0,0,
+0,0,0,193,242,5,0,0,0,0,0,0,0,0,237,198,0,0,0,0,0,0,0,0,0,251,184,0,0,0,0,0,0,0,0,0,237,198,0,0,0,0,0,0,0,0,0,194,242,4,0,0,0,0,0,0,0,0,111,255,92,0,0,0,
+0,0,0,0,0,10,218,237,53,0,0,0,0,0,62,98,0,38,220,252,172,111,97,122,192,255,120,0,0,12,116,198,240,251,231,177,85,2,255,255,255,254,243,222,176,98,10,0,0,255,207,92,92,101,128,192,255,221,47,0,255,180,0,0,
+0,0,0,62,239,230,17,255,180,0,0,0,0,0,0,91,255,124,255,180,0,0,0,0,0,0,3,242,199,255,180,0,0,0,0,0,0,0,198,237,255,180,0,0,0,0,0,0,0,184,251,255,180,0,0,0,0,0,0,0,198,237,255,180,
+0,0,0,0,0,0,3,242,198,255,180,0,0,0,0,0,0,91,255,124,255,180,0,0,0,0,0,61,239,230,16,255,207,92,92,100,127,191,255,220,47,0,255,255,255,255,244,223,176,99,10,0,0,255,255,255,255,255,255,255,255,56,255,207,
+92,92,92,92,92,92,20,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,185,20,20,20,20,20,19,0,255,255,255,255,255,255,255,244,0,255,200,68,68,68,68,68,64,0,255,180,0,0,0,0,0,0,0,255,180,0,
+0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,207,92,92,92,92,92,92,34,255,255,255,255,255,255,255,255,96,255,255,255,255,255,255,255,120,255,207,92,92,92,92,92,43,255,180,0,0,0,0,
+0,0,255,180,0,0,0,0,0,0,255,185,20,20,20,20,18,0,255,255,255,255,255,255,232,0,255,200,68,68,68,68,61,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,
+0,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,6,98,183,232,250,243,212,155,66,0,0,30,207,254,185,121,98,108,149,223,255,89,7,211,240,62,0,0,0,0,0,2,88,72,106,255,95,0,0,0,0,0,0,0,
+0,0,192,242,4,0,0,0,0,0,0,0,0,0,236,198,0,0,0,0,1,20,20,20,20,14,251,184,0,0,0,0,20,255,255,255,255,180,236,198,0,0,0,0,5,68,68,68,255,180,192,243,5,0,0,0,0,0,0,0,255,180,107,255,
+95,0,0,0,0,0,0,0,255,180,8,211,240,62,0,0,0,0,0,1,255,180,0,30,208,254,186,121,97,108,139,222,255,147,0,0,6,99,185,233,251,244,212,155,63,0,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,
+180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,185,20,20,20,20,20,20,185,255,255,255,255,255,255,255,255,255,255,255,255,200,68,68,68,68,68,68,200,255,255,180,0,0,0,0,0,0,180,255,255,180,
+0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,
+255,180,255,180,255,180,255,180,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,
+180,0,0,0,255,180,0,0,1,255,177,0,0,14,255,162,0,0,67,255,119,46,114,228,246,30,128,249,202,65,0,255,180,0,0,0,0,27,214,251,91,0,255,180,0,0,0,36,223,246,76,0,0,255,180,0,0,45,231,241,62,0,0,0,
+255,180,0,57,238,234,50,0,0,0,0,255,180,68,244,226,39,0,0,0,0,0,255,228,249,216,30,0,0,0,0,0,0,255,246,255,194,11,0,0,0,0,0,0,255,180,135,255,193,12,0,0,0,0,0,255,180,0,134,255,195,12,0,0,
+0,0,255,180,0,0,132,255,196,13,0,0,0,255,180,0,0,0,131,255,197,13,0,0,255,180,0,0,0,0,130,255,198,14,0,255,180,0,0,0,0,0,129,255,199,14,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,
+255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,
+180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,216,124,124,124,124,124,124,11,255,255,255,255,255,255,255,255,24,255,255,208,0,0,0,0,0,0,209,255,255,255,247,255,50,0,0,0,0,51,255,247,255,255,186,236,148,0,
+0,0,0,149,235,186,255,255,180,145,238,7,0,0,7,238,144,180,255,255,180,46,255,87,0,0,88,255,46,180,255,255,180,0,205,185,0,0,186,204,0,180,255,255,180,0,107,253,29,29,253,106,0,180,255,255,180,0,17,248,124,125,247,17,
+0,180,255,255,180,0,0,168,220,221,167,0,0,180,255,255,180,0,0,70,255,255,69,0,0,180,255,255,180,0,0,2,124,124,2,0,0,180,255,255,180,0,0,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,0,0,180,255,255,
+255,165,0,0,0,0,0,180,255,255,255,254,50,0,0,0,0,180,255,255,210,248,188,0,0,0,0,180,255,255,180,141,255,71,0,0,0,180,255,255,180,18,239,208,2,0,0,180,255,255,180,0,118,255,94,0,0,180,255,255,180,0,8,226,
+225,7,0,180,255,255,180,0,0,95,255,117,0,180,255,255,180,0,0,2,209,238,17,180,255,255,180,0,0,0,72,255,140,180,255,255,180,0,0,0,0,188,248,210,255,255,180,0,0,0,0,50,254,255,255,255,180,0,0,0,0,0,166,255,
+255,0,0,15,128,209,244,244,209,129,16,0,0,0,41,225,250,162,105,103,160,250,225,41,0,10,218,239,52,0,0,0,0,51,239,218,10,111,255,98,0,0,0,0,0,0,99,255,110,193,243,6,0,0,0,0,0,0,6,244,192,237,198,0,
+0,0,0,0,0,0,0,199,236,251,183,0,0,0,0,0,0,0,0,184,251,237,198,0,0,0,0,0,0,0,0,199,236,194,243,6,0,0,0,0,0,0,6,244,192,112,255,96,0,0,0,0,0,0,97,255,110,12,221,237,50,0,0,0,
+0,49,238,218,10,0,43,227,250,160,104,103,158,249,226,41,0,0,0,17,130,210,245,245,211,130,16,0,0,255,255,255,255,250,225,159,35,0,255,207,92,92,103,154,248,237,30,255,180,0,0,0,0,90,255,137,255,180,0,0,0,0,13,255,
+173,255,180,0,0,0,0,54,255,152,255,185,20,20,30,81,220,253,58,255,255,255,255,255,255,223,81,0,255,200,68,68,62,36,1,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,
+255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,15,128,209,244,244,209,128,15,0,0,0,41,225,250,162,105,103,160,250,224,39,0,10,218,239,52,0,0,0,0,51,239,216,9,111,255,98,0,0,0,0,0,0,99,
+255,108,193,243,6,0,0,0,0,0,0,6,244,191,237,198,0,0,0,0,0,0,0,0,199,236,251,183,0,0,0,0,0,0,0,0,184,250,237,198,0,0,0,0,0,0,0,0,199,228,193,243,6,0,0,0,0,0,0,6,244,194,111,255,
+96,0,0,0,0,0,0,97,255,109,11,219,237,50,0,0,0,0,49,238,223,16,0,41,225,250,160,104,103,158,249,230,48,0,0,0,15,128,209,245,255,255,209,15,0,0,0,0,0,0,0,0,7,182,255,110,0,0,0,0,0,0,0,0,
+0,7,183,254,101,0,255,255,255,255,250,225,160,35,0,0,0,255,207,92,92,102,150,246,236,29,0,0,255,180,0,0,0,0,84,255,134,0,0,255,180,0,0,0,0,12,255,172,0,0,255,180,0,0,0,0,50,255,154,0,0,255,185,20,
+20,30,77,214,254,63,0,0,255,255,255,255,255,255,226,87,0,0,0,255,200,68,69,94,197,247,86,0,0,0,255,180,0,0,0,7,203,246,37,0,0,255,180,0,0,0,0,54,255,174,0,0,255,180,0,0,0,0,0,178,255,49,0,255,
+180,0,0,0,0,0,50,255,177,0,255,180,0,0,0,0,0,0,176,255,51,0,50,171,222,248,234,203,144,29,78,252,227,132,100,121,166,244,72,212,237,22,0,0,0,0,11,16,248,192,0,0,0,0,0,0,0,214,243,50,0,0,0,0,
+0,0,87,254,254,204,145,89,21,0,0,0,63,174,240,255,255,251,145,5,0,0,0,2,41,106,216,255,126,0,0,0,0,0,0,14,233,221,0,0,0,0,0,0,0,193,247,74,0,0,0,0,0,30,242,206,255,219,143,103,102,139,233,251,
+72,92,163,216,242,250,227,168,52,0,255,255,255,255,255,255,255,255,255,255,255,92,92,92,92,92,255,207,92,92,92,92,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,
+0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,
+0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,
+255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,247,190,0,0,0,0,0,0,191,246,214,231,1,0,0,0,0,1,231,212,134,255,93,
+0,0,0,0,94,255,133,15,214,254,167,111,110,166,254,214,14,0,15,135,215,247,247,215,135,15,0,171,255,48,0,0,0,0,0,0,1,223,240,9,72,255,145,0,0,0,0,0,0,66,255,151,0,2,226,236,6,0,0,0,0,0,163,255,
+52,0,0,130,255,84,0,0,0,0,14,245,209,0,0,0,33,254,181,0,0,0,0,102,255,111,0,0,0,0,189,252,26,0,0,0,199,249,19,0,0,0,0,90,255,119,0,0,40,255,169,0,0,0,0,0,8,239,216,0,0,138,255,70,
+0,0,0,0,0,0,149,255,58,3,231,226,2,0,0,0,0,0,0,50,255,155,76,255,129,0,0,0,0,0,0,0,0,207,242,184,254,32,0,0,0,0,0,0,0,0,108,255,255,187,0,0,0,0,0,0,0,0,0,17,247,255,89,0,
+0,0,0,0,72,255,131,0,0,0,0,57,255,249,10,0,0,0,0,185,254,20,12,251,196,0,0,0,0,121,251,255,68,0,0,0,4,243,210,0,0,198,250,10,0,0,0,185,182,230,132,0,0,0,57,255,145,0,0,133,255,69,0,0,
+4,243,119,168,197,0,0,0,121,255,80,0,0,68,255,133,0,0,57,255,56,105,250,11,0,0,185,253,17,0,0,9,249,198,0,0,121,244,4,41,255,70,0,4,243,206,0,0,0,0,194,250,11,0,185,185,0,0,233,134,0,57,255,141,
+0,0,0,0,129,255,71,4,243,122,0,0,171,199,0,121,255,76,0,0,0,0,64,255,135,57,255,59,0,0,108,251,12,185,252,15,0,0,0,0,7,247,200,121,246,6,0,0,45,255,76,244,202,0,0,0,0,0,0,190,251,197,189,0,
+0,0,1,236,193,255,137,0,0,0,0,0,0,125,255,255,126,0,0,0,0,175,255,255,72,0,0,0,0,0,0,60,255,255,63,0,0,0,0,112,255,251,12,0,0,0,0,134,255,97,0,0,0,0,1,193,249,44,0,6,211,240,29,0,
+0,0,113,255,120,0,0,0,50,251,185,0,0,39,246,200,3,0,0,0,0,130,255,102,3,201,247,39,0,0,0,0,0,5,207,242,150,255,113,0,0,0,0,0,0,0,46,250,255,195,2,0,0,0,0,0,0,0,32,243,255,121,0,0,
+0,0,0,0,0,1,191,249,214,245,35,0,0,0,0,0,0,110,255,122,43,249,193,1,0,0,0,0,37,245,202,3,0,122,255,110,0,0,0,2,197,248,41,0,0,3,203,245,35,0,0,117,255,118,0,0,0,0,43,249,193,1,41,247,
+199,3,0,0,0,0,0,121,255,110,77,255,153,0,0,0,0,0,10,219,234,22,0,159,255,70,0,0,0,0,145,255,82,0,0,14,225,226,15,0,0,62,254,163,0,0,0,0,67,254,158,0,11,221,228,16,0,0,0,0,0,148,255,74,
+148,255,71,0,0,0,0,0,0,10,218,237,254,152,0,0,0,0,0,0,0,0,57,255,225,12,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,
+0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,92,92,92,92,92,92,92,92,187,255,193,0,0,0,0,
+0,0,0,71,252,221,19,0,0,0,0,0,0,41,240,241,42,0,0,0,0,0,0,19,220,252,72,0,0,0,0,0,0,5,191,255,112,0,0,0,0,0,0,0,154,255,154,0,0,0,0,0,0,0,113,255,191,5,0,0,0,0,0,0,
+72,252,220,18,0,0,0,0,0,0,42,241,240,40,0,0,0,0,0,0,19,221,252,71,0,0,0,0,0,0,0,193,255,186,92,92,92,92,92,92,92,92,255,255,255,255,255,255,255,255,255,255,255,255,255,255,208,255,207,92,74,255,180,0,
+0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,185,20,16,255,255,255,208,68,68,68,55,216,167,0,0,0,0,0,
+135,241,6,0,0,0,0,54,255,73,0,0,0,0,1,228,153,0,0,0,0,0,148,232,2,0,0,0,0,68,255,58,0,0,0,0,4,238,139,0,0,0,0,0,162,219,0,0,0,0,0,81,255,44,0,0,0,0,10,246,124,0,0,0,
+0,0,175,205,0,0,0,0,0,95,255,30,0,0,0,0,18,251,110,0,0,0,0,0,189,191,0,0,0,0,0,64,124,1,24,255,255,255,180,8,92,92,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,
+0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,1,20,20,255,180,24,255,255,255,180,6,68,68,68,47,0,0,0,0,9,192,255,208,17,
+0,0,0,0,0,0,0,6,184,255,175,253,200,12,0,0,0,0,0,4,175,253,105,0,86,249,192,9,0,0,0,2,166,249,85,0,0,0,70,244,182,6,0,1,156,243,68,0,0,0,0,0,55,236,173,3,24,24,24,24,24,24,24,24,
+24,255,255,255,255,255,255,255,255,255,68,68,68,68,68,68,68,68,68,38,128,50,0,0,1,173,222,14,0,0,12,210,163,0,0,0,33,235,88,23,136,203,236,250,224,151,21,0,64,228,147,111,105,161,251,217,11,9,2,0,0,0,0,100,
+255,103,0,0,0,4,17,20,34,255,160,2,116,212,252,255,255,255,255,178,141,255,181,99,75,68,71,255,180,238,213,1,0,0,0,41,255,180,235,213,1,0,0,1,167,255,180,148,255,183,104,116,198,201,255,180,8,133,222,249,227,146,15,255,
+180,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,62,199,246,230,136,6,0,255,216,242,145,107,181,255,167,0,255,255,93,0,0,1,172,255,59,
+255,231,2,0,0,0,56,255,138,255,194,0,0,0,0,15,255,171,255,194,0,0,0,0,15,255,171,255,231,2,0,0,0,56,255,138,255,255,93,0,0,1,171,255,60,255,216,242,145,107,181,255,170,0,255,180,62,199,247,231,139,7,0,0,
+4,111,204,244,244,212,140,5,185,255,190,119,105,144,226,115,255,138,0,0,0,0,2,208,239,8,0,0,0,0,0,246,198,0,0,0,0,0,0,246,198,0,0,0,0,0,0,207,239,8,0,0,0,0,0,114,255,135,0,0,0,0,1,5,
+188,255,189,118,103,140,225,0,5,116,208,247,243,212,138,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,31,175,243,239,168,24,255,180,17,226,250,145,
+107,179,207,255,180,136,255,93,0,0,0,168,255,180,215,231,2,0,0,0,54,255,180,248,194,0,0,0,0,15,255,180,248,194,0,0,0,0,14,255,180,215,231,2,0,0,0,54,255,180,137,255,93,0,0,0,168,255,180,19,227,250,144,107,
+179,208,255,180,0,33,177,244,240,169,24,255,180,0,8,126,216,248,237,171,37,0,6,194,248,151,103,128,235,237,33,115,254,67,0,0,0,39,248,161,205,214,20,20,20,20,20,204,230,246,255,255,255,255,255,255,255,253,248,210,68,68,68,68,
+68,68,68,211,230,1,0,0,0,0,0,0,120,255,112,0,0,0,0,0,22,6,191,255,179,115,104,136,211,156,0,5,116,207,246,243,217,156,54,0,0,102,211,245,255,128,0,76,255,182,100,92,46,0,152,255,20,0,0,0,0,178,255,0,
+0,0,0,255,255,255,255,255,255,0,92,207,255,92,92,92,0,0,180,255,0,0,0,0,0,180,255,0,0,0,0,0,180,255,0,0,0,0,0,180,255,0,0,0,0,0,180,255,0,0,0,0,0,180,255,0,0,0,0,0,180,255,0,0,
+0,0,0,180,255,0,0,0,0,0,35,178,244,238,165,22,255,180,20,230,249,143,107,177,205,255,180,139,255,87,0,0,0,166,255,180,216,230,1,0,0,0,53,255,180,248,194,0,0,0,0,15,255,180,248,193,0,0,0,0,14,255,180,216,
+229,1,0,0,0,53,255,180,140,255,87,0,0,0,166,255,180,22,231,249,142,106,177,205,255,179,0,37,180,245,239,166,35,255,170,0,0,0,0,0,0,50,255,140,0,9,0,0,0,0,166,255,71,0,191,158,108,115,191,255,187,1,0,116,
+209,241,250,220,134,9,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,0,255,180,0,0,0,0,0,0,255,180,52,194,246,231,130,1,255,215,231,133,106,200,255,99,255,255,61,0,0,15,243,202,255,
+213,0,0,0,0,197,237,255,183,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,255,180,8,5,0,0,255,
+180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,0,0,255,180,0,0,255,180,0,0,8,5,0,0,0,0,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,
+0,255,180,0,0,255,180,0,0,255,180,0,3,255,176,0,29,255,154,97,181,255,81,253,222,117,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,
+180,0,0,0,39,223,224,40,255,180,0,0,57,236,209,26,0,255,180,0,78,246,190,14,0,0,255,180,102,252,168,6,0,0,0,255,242,255,172,1,0,0,0,0,255,199,209,245,66,0,0,0,0,255,180,18,205,246,70,0,0,0,255,180,
+0,16,202,248,74,0,0,255,180,0,0,14,198,249,78,0,255,180,0,0,0,12,194,250,82,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,54,194,245,229,122,0,18,159,236,
+245,173,20,0,255,215,233,136,106,198,255,112,206,167,105,157,255,171,0,255,255,67,0,0,13,242,254,140,0,0,0,179,253,22,255,215,0,0,0,0,196,255,34,0,0,0,120,255,57,255,183,0,0,0,0,180,255,3,0,0,0,104,255,75,
+255,180,0,0,0,0,180,255,0,0,0,0,104,255,76,255,180,0,0,0,0,180,255,0,0,0,0,104,255,76,255,180,0,0,0,0,180,255,0,0,0,0,104,255,76,255,180,0,0,0,0,180,255,0,0,0,0,104,255,76,255,180,0,0,
+0,0,180,255,0,0,0,0,104,255,76,255,180,52,194,246,231,130,1,255,215,231,133,106,200,255,99,255,255,61,0,0,15,243,202,255,213,0,0,0,0,197,237,255,183,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,
+0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,0,21,150,227,250,227,149,19,0,15,218,254,155,106,157,254,215,13,133,255,106,0,0,0,110,255,131,214,234,4,0,0,0,5,235,212,247,
+195,0,0,0,0,0,196,246,247,195,0,0,0,0,0,197,246,213,234,4,0,0,0,4,235,212,133,255,104,0,0,0,108,255,131,15,218,253,154,105,155,254,216,13,0,21,151,229,251,228,149,20,0,255,180,62,199,246,230,136,6,0,255,216,
+242,145,107,181,255,167,0,255,255,93,0,0,1,172,255,59,255,231,2,0,0,0,56,255,138,255,194,0,0,0,0,15,255,171,255,194,0,0,0,0,15,255,171,255,231,2,0,0,0,56,255,138,255,255,93,0,0,1,171,255,60,255,216,242,
+145,107,181,255,170,0,255,180,62,199,247,231,139,7,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,31,175,243,239,168,24,255,180,17,226,250,145,
+107,179,207,255,180,136,255,93,0,0,0,168,255,180,215,231,2,0,0,0,54,255,180,248,194,0,0,0,0,15,255,180,248,194,0,0,0,0,14,255,180,215,231,2,0,0,0,54,255,180,137,255,93,0,0,0,168,255,180,19,227,250,144,107,
+179,208,255,180,0,33,177,244,240,169,24,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,14,255,180,52,183,240,255,255,217,242,
+156,103,129,255,255,95,0,0,0,255,228,1,0,0,0,255,191,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,9,123,213,244,243,219,163,19,165,255,175,106,102,
+133,207,39,246,203,0,0,0,0,0,0,221,236,56,0,0,0,0,0,74,239,255,229,169,100,12,0,0,15,84,147,209,255,230,32,0,0,0,0,0,78,255,148,21,0,0,0,0,26,255,167,250,178,126,99,118,215,254,73,130,196,234,250,229,
+179,63,0,0,90,128,0,0,0,0,180,255,0,0,0,0,180,255,0,0,0,255,255,255,255,255,255,92,207,255,92,92,92,0,180,255,0,0,0,0,180,255,0,0,0,0,180,255,0,0,0,0,180,255,0,0,0,0,179,255,0,0,0,0,
+168,255,16,0,0,0,116,255,162,91,88,0,10,161,237,254,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,183,
+255,238,196,0,0,0,0,214,255,202,243,15,0,0,64,255,255,99,255,200,106,134,232,215,255,2,131,232,247,197,55,180,255,73,255,110,0,0,0,0,0,199,232,4,3,230,204,0,0,0,0,37,255,142,0,0,139,255,42,0,0,0,131,255,
+47,0,0,44,255,136,0,0,1,223,209,0,0,0,0,206,227,2,0,63,255,114,0,0,0,0,111,255,68,0,157,252,24,0,0,0,0,21,250,162,9,241,182,0,0,0,0,0,0,177,244,100,255,87,0,0,0,0,0,0,82,255,241,240,
+8,0,0,0,0,0,0,6,237,255,155,0,0,0,0,31,255,128,0,0,0,186,255,112,0,0,0,201,214,0,222,195,0,0,6,245,253,179,0,0,14,252,148,0,156,250,11,0,62,255,163,242,4,0,77,255,82,0,90,255,71,0,128,233,
+52,255,57,0,142,253,18,0,24,255,137,0,194,168,2,238,123,0,208,206,0,0,0,214,203,10,249,102,0,175,190,19,254,140,0,0,0,148,253,87,255,35,0,108,248,92,255,74,0,0,0,82,255,214,225,0,0,42,255,213,251,13,0,0,
+0,17,253,255,159,0,0,0,231,255,198,0,0,0,0,0,205,255,93,0,0,0,165,255,132,0,0,4,197,244,40,0,0,0,102,255,129,0,0,31,239,208,8,0,43,246,194,3,0,0,0,82,255,148,9,211,237,29,0,0,0,0,0,150,
+255,197,255,79,0,0,0,0,0,0,8,220,255,151,0,0,0,0,0,0,0,54,250,255,195,3,0,0,0,0,0,14,222,230,122,255,130,0,0,0,0,0,167,253,66,0,170,253,63,0,0,0,99,255,133,0,0,16,224,228,19,0,40,245,
+197,4,0,0,0,57,251,177,0,178,245,14,0,0,0,0,54,255,125,76,255,103,0,0,0,0,152,253,29,3,226,202,0,0,0,10,241,182,0,0,128,255,45,0,0,94,255,83,0,0,29,252,144,0,0,193,233,5,0,0,0,180,236,6,
+36,255,139,0,0,0,0,78,255,86,135,255,40,0,0,0,0,3,228,189,230,196,0,0,0,0,0,0,131,255,255,96,0,0,0,0,0,0,31,253,242,11,0,0,0,0,0,0,25,252,153,0,0,0,0,0,0,0,130,255,51,0,0,0,
+0,0,88,118,247,184,0,0,0,0,0,0,255,247,186,27,0,0,0,0,0,255,255,255,255,255,255,255,255,92,92,92,92,92,115,252,233,0,0,0,0,10,202,245,54,0,0,0,2,176,253,80,0,0,0,0,145,255,111,0,0,0,0,112,
+255,145,0,0,0,0,80,253,176,2,0,0,0,54,245,202,10,0,0,0,0,233,252,115,92,92,92,92,92,255,255,255,255,255,255,255,255,0,0,0,42,188,240,254,0,0,0,191,254,138,95,0,0,0,242,204,0,0,0,0,0,255,181,0,
+0,0,0,0,255,180,0,0,0,0,2,255,178,0,0,0,0,28,255,161,0,0,10,37,162,255,88,0,0,128,255,254,128,0,0,0,34,84,190,253,75,0,0,0,0,32,255,162,0,0,0,0,2,255,179,0,0,0,0,0,255,180,0,0,
+0,0,0,252,188,0,0,0,0,0,224,240,59,22,0,0,0,104,251,255,255,0,0,0,0,15,55,67,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,
+128,250,227,150,7,0,0,0,46,103,186,255,111,0,0,0,0,0,27,255,165,0,0,0,0,0,2,255,179,0,0,0,0,0,0,255,180,0,0,0,0,0,0,255,182,0,0,0,0,0,0,238,211,0,0,0,0,0,0,164,255,113,33,10,
+0,0,0,11,186,255,255,128,0,0,0,148,255,152,80,34,0,0,0,238,215,0,0,0,0,0,0,255,182,0,0,0,0,0,0,255,180,0,0,0,0,0,9,255,176,0,0,0,10,28,113,255,146,0,0,0,128,255,255,230,41,0,0,0,
+34,64,43,3,0,0,0,0,0,0,3,13,0,0,0,0,0,0,0,16,60,181,247,255,241,177,106,48,30,74,178,127,251,164,89,78,121,190,249,255,255,252,172,34,46,0,0,0,0,0,11,52,59,17,0,0,255,180,255,180,40,28,0,0,
+255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,255,180,0,0,0,0,148,0,0,0,0,0,0,0,232,0,0,0,0,0,0,0,232,0,0,0,0,18,148,233,255,241,209,143,11,212,251,149,240,110,151,232,125,255,106,0,232,0,
+0,3,208,237,6,0,232,0,0,0,245,197,0,0,232,0,0,0,250,189,0,0,232,0,0,0,224,221,0,0,232,0,0,0,156,255,57,0,232,0,0,0,37,245,226,68,233,28,73,155,0,64,224,255,255,255,255,221,0,0,3,54,239,70,
+32,0,0,0,0,0,232,0,0,0,0,0,0,0,199,0,0,0,0,0,0,91,199,243,247,216,156,0,0,95,255,210,117,101,134,212,0,0,206,239,11,0,0,0,0,0,0,247,191,0,0,0,0,0,0,0,255,180,0,0,0,0,0,20,
+20,255,185,20,20,20,0,0,255,255,255,255,255,255,255,0,0,68,68,255,200,68,68,68,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,92,92,255,207,92,92,92,92,92,255,255,
+255,255,255,255,255,255,255,0,11,1,0,0,0,0,0,0,13,1,5,202,172,10,0,4,4,0,16,204,142,0,97,251,205,177,251,249,176,202,225,40,0,0,104,255,203,87,109,236,253,34,0,0,0,186,237,16,0,0,74,255,110,0,0,0,
+243,191,0,0,0,11,255,166,0,0,0,201,229,6,0,0,57,255,127,0,0,0,97,255,169,43,64,216,249,22,0,0,56,236,230,225,255,255,197,251,196,18,7,225,205,27,5,52,38,0,67,239,150,0,39,10,0,0,0,0,0,0,34,8,
+47,252,154,0,0,0,0,0,89,255,58,0,149,253,50,0,0,0,2,215,182,0,0,17,235,196,0,0,0,92,255,52,0,0,0,101,255,90,0,3,218,176,0,0,0,0,2,203,228,11,96,254,47,0,0,0,240,240,247,255,137,220,254,240,
+240,0,0,32,32,32,155,255,254,66,32,32,0,0,20,20,20,38,255,200,20,20,20,0,0,255,255,255,255,255,255,255,255,255,0,0,68,68,68,68,255,200,68,68,68,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,
+0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,255,180,255,180,255,180,255,180,255,180,255,180,255,180,0,0,0,0,255,180,255,180,255,180,255,180,255,180,255,180,255,180,0,109,214,247,233,184,57,0,99,255,194,103,116,180,107,0,167,
+255,18,0,0,0,0,0,107,255,131,1,0,0,0,0,0,157,255,198,60,0,0,0,92,254,140,184,255,174,27,0,228,210,0,0,88,241,234,36,238,222,4,0,0,72,255,154,137,255,167,10,0,22,255,155,2,129,251,218,81,191,235,39,0,
+0,45,198,255,240,30,0,0,0,0,2,150,255,113,0,0,0,0,0,15,255,166,0,114,86,36,34,141,255,116,0,147,252,255,255,253,159,4,0,0,16,52,57,21,0,0,0,24,16,0,16,24,255,180,0,180,255,68,47,0,47,68,0,0,
+0,0,0,1,13,1,0,0,0,0,0,0,0,0,73,186,248,255,248,186,73,0,0,0,0,4,155,251,166,96,74,95,164,251,155,4,0,0,150,223,47,0,2,13,0,0,42,218,149,0,61,239,35,25,166,244,255,244,168,3,30,236,58,169,
+119,13,220,250,141,81,92,160,6,0,116,166,229,35,112,255,109,0,0,0,0,0,0,34,227,250,6,168,255,22,0,0,0,0,0,0,6,249,235,26,171,255,16,0,0,0,0,0,0,26,234,184,100,127,255,84,0,0,0,0,0,0,98,180,
+86,225,44,239,234,95,33,39,107,4,13,221,82,1,185,197,75,213,255,255,255,213,23,190,184,1,0,17,198,234,122,90,91,86,120,232,197,17,0,0,0,7,125,234,255,255,255,234,125,7,0,0,0,0,0,0,2,42,62,43,2,0,0,0,
+0,0,143,222,210,206,138,7,0,90,16,0,5,165,122,0,0,0,0,0,52,205,0,27,150,200,203,207,235,0,206,109,5,0,42,240,18,252,2,0,0,90,240,3,238,73,0,23,216,240,0,71,213,205,200,125,240,0,0,0,0,0,0,0,
+25,204,204,204,204,204,191,0,0,0,7,0,0,0,7,0,0,14,191,0,0,14,191,0,23,207,213,0,23,207,207,35,221,205,20,35,221,175,11,232,211,15,0,232,152,1,0,148,250,85,0,148,228,49,0,0,126,252,95,0,126,244,81,0,
+0,103,251,0,0,103,251,0,0,0,83,0,0,0,83,19,24,24,24,24,24,24,24,24,24,24,16,204,255,255,255,255,255,255,255,255,255,255,180,54,68,68,68,68,68,68,68,68,68,255,180,0,0,0,0,0,0,0,0,0,0,255,180,0,
+0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,196,137,24,24,24,24,24,255,255,255,255,255,68,68,68,68,68,0,0,0,0,0,1,13,1,0,0,0,0,0,0,0,0,73,186,248,255,248,186,73,0,0,0,
+0,4,155,251,166,96,74,95,164,251,155,4,0,0,150,223,47,20,20,17,1,0,42,218,149,0,61,239,35,0,255,255,255,250,182,23,30,236,58,169,119,0,0,255,200,69,116,255,149,0,116,166,229,35,0,0,255,185,21,64,255,152,0,34,
+227,250,6,0,0,255,255,255,248,173,23,0,6,249,235,26,0,0,255,200,91,229,97,0,0,26,234,184,100,0,0,255,180,0,77,248,46,0,98,180,86,225,17,0,255,180,0,0,174,212,22,221,82,1,185,197,21,12,8,0,0,4,30,193,
+184,1,0,17,198,234,122,51,29,50,120,232,197,17,0,0,0,7,125,234,255,255,255,234,125,7,0,0,0,0,0,0,2,42,62,43,2,0,0,0,0,24,24,24,24,24,255,255,255,255,255,68,68,68,68,68,0,0,4,4,0,0,20,172,
+249,249,169,19,175,193,86,86,195,172,242,19,0,0,20,241,202,152,40,41,153,197,47,222,255,255,216,41,0,5,48,47,4,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,20,20,20,20,20,255,185,20,
+20,20,20,255,255,255,255,255,255,255,255,255,255,255,68,68,68,68,68,255,200,68,68,68,68,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,92,92,92,92,92,92,92,92,92,92,92,255,255,255,255,255,255,255,255,255,255,255,173,213,206,187,33,71,1,0,108,187,0,0,0,54,224,0,0,0,179,141,0,0,121,220,14,0,94,237,44,0,81,242,60,0,0,249,236,
+204,204,191,0,205,206,205,194,49,0,15,0,0,80,211,0,0,0,0,101,212,0,0,162,229,226,46,0,0,0,3,141,158,0,0,0,0,44,233,20,21,0,0,127,189,43,210,208,210,177,32,0,0,58,128,33,0,20,231,166,0,0,174,204,
+9,0,98,232,28,0,0,255,180,0,0,0,0,180,255,0,0,255,180,0,0,0,0,180,255,0,0,255,180,0,0,0,0,180,255,0,0,255,180,0,0,0,0,180,255,0,0,255,180,0,0,0,0,180,255,0,0,255,180,0,0,0,0,181,
+255,0,0,255,192,0,0,0,0,204,255,0,0,255,240,15,0,0,34,251,255,1,0,255,246,206,109,118,226,239,255,130,34,255,181,140,239,240,142,62,235,226,40,255,180,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,255,
+180,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,44,168,233,253,255,255,255,180,57,246,255,255,255,207,92,255,180,196,255,255,255,255,180,0,255,180,248,255,255,255,255,180,0,255,180,236,255,255,255,255,180,0,255,180,
+156,255,255,255,255,180,0,255,180,16,183,255,255,255,180,0,255,180,0,0,61,121,255,180,0,255,180,0,0,0,0,255,180,0,255,180,0,0,0,0,255,180,0,255,180,0,0,0,0,255,180,0,255,180,0,0,0,0,255,180,0,255,180,0,
+0,0,0,255,180,0,255,180,0,0,0,0,255,180,0,255,180,0,0,0,0,220,154,0,220,154,40,28,255,180,255,180,0,0,62,30,0,0,54,176,43,70,103,242,95,255,255,156,0,18,18,0,28,190,236,240,0,0,21,94,72,240,0,0,
+0,0,32,240,0,0,0,0,32,240,0,0,0,0,32,240,0,0,0,0,32,240,0,0,0,0,32,240,0,0,0,255,255,255,255,255,0,0,116,216,212,210,84,0,0,104,204,20,0,37,226,57,0,225,61,0,0,0,104,177,13,253,6,0,
+0,0,50,220,14,253,6,0,0,0,48,221,0,227,57,0,0,0,102,179,0,107,200,18,0,36,225,59,0,1,119,217,212,210,87,0,0,0,0,0,0,0,0,0,0,204,204,204,204,204,204,0,7,0,0,0,7,0,0,0,191,14,0,0,
+191,14,0,0,207,207,23,0,213,207,23,0,11,176,221,35,20,205,221,35,0,1,152,232,0,15,211,232,0,50,228,148,0,86,250,148,81,244,126,0,95,252,126,0,251,103,0,0,251,103,0,0,82,0,0,0,82,0,0,0,66,110,135,95,
+0,0,0,0,0,0,40,132,6,0,0,0,191,152,255,180,0,0,0,0,0,0,189,150,0,0,0,0,0,0,255,180,0,0,0,0,0,82,240,21,0,0,0,0,0,0,255,180,0,0,0,0,8,222,116,0,0,0,0,0,0,0,255,180,
+0,0,0,0,124,221,6,0,0,0,0,0,0,0,255,180,0,0,0,27,244,82,0,0,0,0,0,0,0,0,255,180,0,0,0,165,193,0,0,0,54,136,95,0,191,240,248,245,240,90,58,253,51,0,0,25,211,255,180,0,0,0,0,0,
+0,2,204,159,0,0,5,191,64,255,180,0,0,0,0,0,0,99,244,26,0,0,147,101,0,255,180,0,0,0,0,0,14,233,126,0,0,71,212,100,100,255,209,87,0,0,0,0,141,227,10,0,0,96,248,248,248,255,253,217,0,0,0,39,
+250,92,0,0,0,0,0,0,0,255,180,0,0,0,0,174,198,1,0,0,0,0,0,0,0,180,126,0,116,162,187,132,0,0,0,0,0,0,94,150,0,0,0,0,137,96,255,180,0,0,0,0,0,20,238,77,0,0,0,0,0,0,255,180,
+0,0,0,0,0,155,185,0,0,0,0,0,0,0,255,180,0,0,0,0,52,249,42,0,0,0,0,0,0,0,255,180,0,0,0,1,200,146,0,0,0,0,0,0,0,0,255,180,0,0,0,98,237,17,0,0,0,0,0,0,191,240,248,245,
+240,82,15,233,107,48,240,240,237,189,50,0,0,0,0,0,0,0,146,211,3,0,0,0,35,230,224,0,0,0,0,0,0,45,251,67,0,0,0,0,5,218,201,0,0,0,0,0,0,192,175,0,0,0,0,1,155,231,38,0,0,0,0,0,
+89,248,35,0,0,0,3,155,214,36,0,0,0,0,0,12,228,136,0,0,0,10,178,189,37,24,24,1,0,0,0,136,231,13,0,0,0,64,255,255,255,255,255,12,0,0,0,61,40,0,0,0,0,17,68,68,68,68,68,3,0,0,0,12,
+1,0,0,0,0,0,0,0,17,8,0,0,0,0,0,162,240,255,249,172,17,0,0,0,0,52,248,37,0,0,0,0,0,103,85,74,137,255,146,0,0,0,1,198,141,0,0,0,0,0,0,0,13,25,90,255,150,0,0,0,93,235,16,0,
+0,0,0,0,0,0,176,255,255,191,20,0,0,12,229,106,0,0,0,0,0,0,0,0,46,79,174,253,77,0,0,135,212,3,0,0,0,0,0,0,0,0,0,0,15,255,168,0,35,248,70,0,0,0,0,0,0,0,14,82,31,34,136,255,
+138,0,178,180,0,0,0,33,185,188,0,0,21,238,255,255,255,192,17,71,251,40,0,0,6,201,232,255,0,0,0,4,46,59,30,0,5,215,145,0,0,0,148,124,180,255,0,0,0,0,0,0,0,0,113,237,18,0,0,85,168,0,180,255,
+0,0,0,0,0,0,0,22,240,109,0,0,15,232,109,100,209,255,100,17,0,0,0,0,0,156,215,4,0,0,27,248,248,248,253,255,248,42,0,0,0,0,51,253,74,0,0,0,0,0,0,0,180,255,0,0,0,0,0,0,189,181,0,0,
+0,0,0,0,0,0,126,180,0,0,0,0,0,255,180,0,0,0,0,0,255,180,0,0,0,0,0,40,28,0,0,0,0,0,255,180,0,0,0,0,4,255,176,0,0,0,0,61,255,142,0,0,0,28,225,238,31,0,0,17,215,243,57,0,
+0,0,159,253,66,0,0,0,0,243,201,0,0,0,0,0,224,225,8,0,0,0,86,122,255,204,120,130,209,255,2,111,214,246,225,172,62,0,0,0,0,94,110,1,0,0,0,0,0,0,0,0,0,0,29,221,131,0,0,0,0,0,0,0,
+0,0,0,0,28,127,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,248,255,88,0,0,0,0,0,0,0,0,0,108,254,222,187,0,0,0,0,0,0,0,0,0,207,189,110,254,32,0,0,0,0,
+0,0,0,50,255,94,20,250,129,0,0,0,0,0,0,0,149,244,11,0,176,225,2,0,0,0,0,0,8,238,160,0,0,81,255,70,0,0,0,0,0,90,255,65,0,0,5,235,169,0,0,0,0,0,189,234,37,36,36,36,167,249,19,0,
+0,0,33,254,255,255,255,255,255,255,255,111,0,0,0,130,255,100,84,84,84,84,84,216,209,0,0,2,226,210,0,0,0,0,0,0,127,255,52,0,72,255,127,0,0,0,0,0,0,44,255,151,0,171,255,45,0,0,0,0,0,0,0,217,
+240,9,0,0,0,0,0,0,74,120,9,0,0,0,0,0,0,0,0,0,64,242,75,0,0,0,0,0,0,0,0,0,1,111,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,248,255,88,0,0,
+0,0,0,0,0,0,0,108,254,222,187,0,0,0,0,0,0,0,0,0,207,189,110,254,32,0,0,0,0,0,0,0,50,255,94,20,250,129,0,0,0,0,0,0,0,149,244,11,0,176,225,2,0,0,0,0,0,8,238,160,0,0,81,255,
+70,0,0,0,0,0,90,255,65,0,0,5,235,169,0,0,0,0,0,189,234,37,36,36,36,167,249,19,0,0,0,33,254,255,255,255,255,255,255,255,111,0,0,0,130,255,100,84,84,84,84,84,216,209,0,0,2,226,210,0,0,0,0,0,
+0,127,255,52,0,72,255,127,0,0,0,0,0,0,44,255,151,0,171,255,45,0,0,0,0,0,0,0,217,240,9,0,0,0,0,2,113,127,27,0,0,0,0,0,0,0,0,0,153,187,127,212,18,0,0,0,0,0,0,0,38,116,6,0,
+84,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,248,255,88,0,0,0,0,0,0,0,0,0,108,254,222,187,0,0,0,0,0,0,0,0,0,207,189,110,254,32,0,0,0,0,0,0,0,50,255,94,
+20,250,129,0,0,0,0,0,0,0,149,244,11,0,176,225,2,0,0,0,0,0,8,238,160,0,0,81,255,70,0,0,0,0,0,90,255,65,0,0,5,235,169,0,0,0,0,0,189,234,37,36,36,36,167,249,19,0,0,0,33,254,255,255,
+255,255,255,255,255,111,0,0,0,130,255,100,84,84,84,84,84,216,209,0,0,2,226,210,0,0,0,0,0,0,127,255,52,0,72,255,127,0,0,0,0,0,0,44,255,151,0,171,255,45,0,0,0,0,0,0,0,217,240,9,0,0,0,0,
+0,7,0,0,2,19,0,0,0,0,0,0,0,0,110,252,220,68,69,234,0,0,0,0,0,0,0,0,234,135,129,236,249,116,0,0,0,0,0,0,0,0,27,4,0,5,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,59,255,255,61,0,0,0,0,0,0,0,0,0,0,159,239,235,161,0,0,0,0,0,0,0,0,0,13,244,149,142,246,15,0,0,0,0,0,0,0,0,103,255,50,43,255,105,0,0,0,0,0,0,0,0,203,207,
+0,0,200,205,0,0,0,0,0,0,0,46,255,108,0,0,101,255,49,0,0,0,0,0,0,147,248,17,0,0,13,245,149,0,0,0,0,0,8,238,185,36,36,36,36,179,239,9,0,0,0,0,91,255,255,255,255,255,255,255,255,93,0,0,
+0,0,191,229,84,84,84,84,84,84,224,193,0,0,0,35,254,146,0,0,0,0,0,0,139,255,38,0,0,135,255,63,0,0,0,0,0,0,56,255,137,0,3,230,234,3,0,0,0,0,0,0,1,228,232,5,0,0,0,0,20,14,0,14,
+20,0,0,0,0,0,0,0,0,255,180,0,180,255,0,0,0,0,0,0,0,0,68,47,0,47,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,169,255,168,0,0,0,0,0,0,0,0,0,17,248,222,
+248,17,0,0,0,0,0,0,0,0,107,253,57,254,106,0,0,0,0,0,0,0,0,204,190,0,191,203,0,0,0,0,0,0,0,45,255,99,0,100,255,45,0,0,0,0,0,0,143,248,15,0,15,248,142,0,0,0,0,0,5,234,172,0,
+0,0,173,234,5,0,0,0,0,81,255,110,36,36,36,111,255,80,0,0,0,0,179,255,255,255,255,255,255,255,178,0,0,0,24,251,178,84,84,84,84,84,175,251,23,0,0,117,255,70,0,0,0,0,0,67,255,116,0,0,213,238,5,0,
+0,0,0,0,4,236,213,0,55,255,161,0,0,0,0,0,0,0,157,255,55,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,43,211,255,208,39,0,0,0,0,0,0,0,0,201,168,79,173,198,0,0,0,0,0,0,0,0,
+247,13,0,15,246,0,0,0,0,0,0,0,0,180,108,10,111,182,0,0,0,0,0,0,0,0,21,253,255,253,26,0,0,0,0,0,0,0,0,82,255,219,255,81,0,0,0,0,0,0,0,0,177,251,47,251,176,0,0,0,0,0,0,0,
+21,250,176,0,177,250,21,0,0,0,0,0,0,112,255,78,0,79,255,111,0,0,0,0,0,0,208,231,4,0,4,231,207,0,0,0,0,0,47,255,137,0,0,0,138,255,46,0,0,0,0,143,255,75,36,36,36,75,255,142,0,0,0,4,
+233,255,255,255,255,255,255,255,233,4,0,0,78,255,143,84,84,84,84,84,140,255,77,0,0,173,252,21,0,0,0,0,0,19,251,172,0,19,249,191,0,0,0,0,0,0,0,188,249,18,108,255,109,0,0,0,0,0,0,0,105,255,108,0,
+0,0,0,0,147,255,255,255,255,255,255,255,255,255,255,56,0,0,0,0,12,241,209,92,255,207,92,92,92,92,92,92,20,0,0,0,0,107,255,90,0,255,180,0,0,0,0,0,0,0,0,0,0,0,213,229,5,0,255,180,0,0,0,0,
+0,0,0,0,0,0,67,255,121,0,0,255,185,20,20,20,20,20,19,0,0,0,0,175,245,18,0,0,255,255,255,255,255,255,255,244,0,0,0,29,252,151,0,0,0,255,200,68,68,68,68,68,64,0,0,0,135,255,60,20,20,20,255,180,
+0,0,0,0,0,0,0,0,7,234,255,255,255,255,255,255,180,0,0,0,0,0,0,0,0,95,255,109,68,68,68,68,255,180,0,0,0,0,0,0,0,0,202,226,2,0,0,0,0,255,180,0,0,0,0,0,0,0,54,255,132,0,0,0,
+0,0,255,207,92,92,92,92,92,92,35,162,255,36,0,0,0,0,0,255,255,255,255,255,255,255,255,100,0,0,11,115,197,238,251,231,178,88,2,0,38,219,253,174,113,98,124,196,255,122,10,217,238,56,0,0,0,0,0,64,98,111,255,94,
+0,0,0,0,0,0,0,0,193,242,5,0,0,0,0,0,0,0,0,237,198,0,0,0,0,0,0,0,0,0,251,184,0,0,0,0,0,0,0,0,0,237,198,0,0,0,0,0,0,0,0,0,194,242,4,0,0,0,0,0,0,0,0,111,
+255,92,0,0,0,0,0,0,0,0,10,218,237,53,0,0,0,0,0,62,98,0,38,220,252,172,111,97,122,192,255,120,0,0,12,116,198,240,255,243,177,85,2,0,0,0,0,0,0,118,137,0,0,0,0,0,0,0,0,0,19,225,0,0,
+0,0,0,0,0,102,100,145,238,0,0,0,0,0,0,0,149,248,233,100,0,0,0,0,1,106,97,0,0,0,0,0,0,0,44,233,103,0,0,0,0,0,0,0,42,123,10,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,
+255,255,255,56,255,207,92,92,92,92,92,92,20,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,185,20,20,20,20,20,19,0,255,255,255,255,255,255,255,244,0,255,200,68,68,68,68,68,64,0,255,180,0,0,0,0,
+0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,207,92,92,92,92,92,92,34,255,255,255,255,255,255,255,255,96,0,0,0,0,87,112,3,0,0,0,0,0,85,239,55,0,
+0,0,0,0,5,119,51,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,56,255,207,92,92,92,92,92,92,20,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,185,20,20,20,20,20,19,
+0,255,255,255,255,255,255,255,244,0,255,200,68,68,68,68,68,64,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,207,92,92,92,92,92,92,34,
+255,255,255,255,255,255,255,255,96,0,0,8,121,125,15,0,0,0,0,3,176,167,147,194,9,0,0,0,50,108,2,0,98,62,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,56,255,207,92,92,92,92,92,92,20,255,
+180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,185,20,20,20,20,20,19,0,255,255,255,255,255,255,255,244,0,255,200,68,68,68,68,68,64,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,
+0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,207,92,92,92,92,92,92,34,255,255,255,255,255,255,255,255,96,0,14,20,0,0,20,14,0,0,0,180,255,0,0,255,180,0,0,0,47,68,0,0,68,47,0,0,0,0,0,
+0,0,0,0,0,0,255,255,255,255,255,255,255,255,68,255,207,92,92,92,92,92,92,24,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,185,20,20,20,20,20,20,0,255,255,255,255,255,255,255,255,0,255,200,68,68,
+68,68,68,68,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,207,92,92,92,92,92,92,38,255,255,255,255,255,255,255,255,108,8,120,74,0,0,
+0,73,242,60,0,0,0,66,106,0,0,0,0,0,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,
+0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,1,111,86,0,131,217,24,18,127,27,0,0,0,0,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,
+0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,255,180,0,0,22,127,111,1,0,14,205,131,188,146,0,70,89,0,7,118,34,0,0,0,0,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,
+255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,20,20,0,14,20,255,
+255,0,180,255,68,68,0,47,68,0,0,0,0,0,0,0,180,255,0,0,0,180,255,0,0,0,180,255,0,0,0,180,255,0,0,0,180,255,0,0,0,180,255,0,0,0,180,255,0,0,0,180,255,0,0,0,180,255,0,0,0,180,255,0,
+0,0,180,255,0,0,0,180,255,0,0,0,180,255,0,0,0,255,255,255,254,241,216,165,76,1,0,0,0,0,255,207,92,92,103,136,210,255,189,15,0,0,0,255,180,0,0,0,0,0,108,255,178,0,0,0,255,180,0,0,0,0,0,0,
+161,255,52,0,0,255,180,0,0,0,0,0,0,63,255,124,20,20,255,185,20,20,20,0,0,0,17,255,162,255,255,255,255,255,255,255,0,0,0,4,255,175,68,68,255,200,68,68,68,0,0,0,17,255,162,0,0,255,180,0,0,0,0,0,
+0,63,255,124,0,0,255,180,0,0,0,0,0,0,161,255,51,0,0,255,180,0,0,0,0,0,107,255,178,0,0,0,255,207,92,92,101,134,210,255,189,16,0,0,0,255,255,255,254,242,217,166,78,1,0,0,0,0,0,7,1,0,3,18,
+0,0,0,0,103,251,221,67,75,222,0,0,0,0,222,139,128,237,248,106,0,0,0,0,26,5,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,165,0,0,0,0,0,180,255,255,255,254,50,0,0,0,0,180,255,255,210,
+248,188,0,0,0,0,180,255,255,180,141,255,71,0,0,0,180,255,255,180,18,239,208,2,0,0,180,255,255,180,0,118,255,94,0,0,180,255,255,180,0,8,226,225,7,0,180,255,255,180,0,0,95,255,117,0,180,255,255,180,0,0,2,209,
+238,17,180,255,255,180,0,0,0,72,255,140,180,255,255,180,0,0,0,0,188,248,210,255,255,180,0,0,0,0,50,254,255,255,255,180,0,0,0,0,0,166,255,255,0,0,0,5,192,210,7,0,0,0,0,0,0,0,0,0,19,221,142,0,
+0,0,0,0,0,0,0,0,0,40,126,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,128,209,244,244,209,129,16,0,0,0,41,225,250,162,105,103,160,250,225,41,0,10,218,239,52,0,0,0,0,51,239,218,10,
+111,255,98,0,0,0,0,0,0,99,255,110,193,243,6,0,0,0,0,0,0,6,244,192,237,198,0,0,0,0,0,0,0,0,199,236,251,183,0,0,0,0,0,0,0,0,184,251,237,198,0,0,0,0,0,0,0,0,199,236,194,243,6,0,
+0,0,0,0,0,6,244,192,112,255,96,0,0,0,0,0,0,97,255,110,12,221,237,50,0,0,0,0,49,238,218,10,0,43,227,250,160,104,103,158,249,226,41,0,0,0,17,130,210,245,245,211,130,16,0,0,0,0,0,0,0,7,210,189,
+4,0,0,0,0,0,0,0,0,143,220,18,0,0,0,0,0,0,0,0,12,126,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,128,209,244,244,209,129,16,0,0,0,41,225,250,162,105,103,160,250,225,41,0,
+10,218,239,52,0,0,0,0,51,239,218,10,111,255,98,0,0,0,0,0,0,99,255,110,193,243,6,0,0,0,0,0,0,6,244,192,237,198,0,0,0,0,0,0,0,0,199,236,251,183,0,0,0,0,0,0,0,0,184,251,237,198,0,0,
+0,0,0,0,0,0,199,236,194,243,6,0,0,0,0,0,0,6,244,192,112,255,96,0,0,0,0,0,0,97,255,110,12,221,237,50,0,0,0,0,49,238,218,10,0,43,227,250,160,104,103,158,249,226,41,0,0,0,17,130,210,245,245,211,
+130,16,0,0,0,0,0,0,61,249,248,63,0,0,0,0,0,0,0,21,228,105,99,230,23,0,0,0,0,0,0,70,94,0,0,92,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,128,209,244,244,209,129,16,0,0,
+0,41,225,250,162,105,103,160,250,225,41,0,10,218,239,52,0,0,0,0,51,239,218,10,111,255,98,0,0,0,0,0,0,99,255,110,193,243,6,0,0,0,0,0,0,6,244,192,237,198,0,0,0,0,0,0,0,0,199,236,251,183,0,0,
+0,0,0,0,0,0,184,251,237,198,0,0,0,0,0,0,0,0,199,236,194,243,6,0,0,0,0,0,0,6,244,192,112,255,96,0,0,0,0,0,0,97,255,110,12,221,237,50,0,0,0,0,49,238,218,10,0,43,227,250,160,104,103,158,
+249,226,41,0,0,0,17,130,210,245,245,211,130,16,0,0,0,0,0,0,7,1,0,3,19,0,0,0,0,0,0,106,252,219,66,77,226,0,0,0,0,0,0,226,136,130,237,249,110,0,0,0,0,0,0,26,4,0,5,13,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,128,209,244,244,209,129,16,0,0,0,41,225,250,162,105,103,160,250,225,41,0,10,218,239,52,0,0,0,0,51,239,218,10,111,255,98,0,0,0,0,0,0,99,255,110,193,243,6,0,
+0,0,0,0,0,6,244,192,237,198,0,0,0,0,0,0,0,0,199,236,251,183,0,0,0,0,0,0,0,0,184,251,237,198,0,0,0,0,0,0,0,0,199,236,194,243,6,0,0,0,0,0,0,6,244,192,112,255,96,0,0,0,0,0,
+0,97,255,110,12,221,237,50,0,0,0,0,49,238,218,10,0,43,227,250,160,104,103,158,249,226,41,0,0,0,17,130,210,245,245,211,130,16,0,0,0,0,0,14,20,0,0,20,14,0,0,0,0,0,0,180,255,0,0,255,180,0,0,0,
+0,0,0,47,68,0,0,68,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,128,209,244,244,209,129,16,0,0,0,41,225,250,162,105,103,160,250,225,41,0,10,218,239,52,0,0,0,0,51,239,218,10,111,255,98,0,
+0,0,0,0,0,99,255,110,193,243,6,0,0,0,0,0,0,6,244,192,237,198,0,0,0,0,0,0,0,0,199,236,251,183,0,0,0,0,0,0,0,0,184,251,237,198,0,0,0,0,0,0,0,0,199,236,194,243,6,0,0,0,0,0,
+0,6,244,192,112,255,96,0,0,0,0,0,0,97,255,110,12,221,237,50,0,0,0,0,49,238,218,10,0,43,227,250,160,104,103,158,249,226,41,0,0,0,17,130,210,245,245,211,130,16,0,0,2,99,2,0,0,0,0,0,0,98,5,70,
+255,163,3,0,0,0,0,145,255,93,0,112,255,166,3,0,0,147,255,134,0,0,0,111,255,168,5,149,255,133,0,0,0,0,0,110,255,222,255,132,0,0,0,0,0,0,1,196,255,217,5,0,0,0,0,0,1,156,255,180,254,175,5,0,
+0,0,2,158,255,125,0,103,254,177,6,0,2,159,255,122,0,0,0,101,254,179,6,71,255,119,0,0,0,0,0,100,254,93,0,52,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,13,123,
+205,242,247,214,138,25,106,219,3,0,0,38,222,249,158,103,107,182,255,239,244,59,0,0,10,217,237,49,0,0,0,0,147,255,236,17,0,0,109,255,96,0,0,0,0,60,244,142,255,118,0,0,193,243,6,0,0,0,40,237,105,2,235,195,
+0,0,237,198,0,0,0,24,223,137,0,0,201,238,0,0,251,184,0,0,12,205,169,1,0,0,185,251,0,0,238,204,0,4,183,196,7,0,0,0,203,236,0,0,193,242,9,157,217,19,0,0,0,9,246,190,0,0,111,255,195,234,35,0,
+0,0,0,104,255,108,0,0,10,221,255,114,0,0,0,0,52,240,216,9,0,0,48,238,240,254,168,104,103,159,250,223,39,0,0,4,219,109,25,140,215,248,244,208,126,14,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,4,190,209,7,0,0,0,0,0,0,0,19,222,140,0,0,0,0,0,0,0,0,42,126,11,0,0,0,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,
+0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,247,190,0,0,0,0,0,0,191,
+246,214,231,1,0,0,0,0,1,231,212,134,255,93,0,0,0,0,94,255,133,15,214,254,167,111,110,166,254,214,14,0,15,135,215,247,247,215,135,15,0,0,0,0,0,7,210,187,3,0,0,0,0,0,0,141,219,17,0,0,0,0,0,0,
+11,126,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,
+0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,247,190,0,0,0,0,0,0,191,246,214,231,1,0,0,0,0,1,231,212,134,255,93,0,0,0,0,94,255,133,15,
+214,254,167,111,110,166,254,214,14,0,15,135,215,247,247,215,135,15,0,0,0,0,60,248,248,60,0,0,0,0,0,20,227,103,103,228,21,0,0,0,0,68,94,0,0,94,69,0,0,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,
+0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,
+255,255,180,0,0,0,0,0,0,180,255,247,190,0,0,0,0,0,0,191,246,214,231,1,0,0,0,0,1,231,212,134,255,93,0,0,0,0,94,255,133,15,214,254,167,111,110,166,254,214,14,0,15,135,215,247,247,215,135,15,0,0,0,14,
+20,0,0,20,14,0,0,0,0,180,255,0,0,255,180,0,0,0,0,47,68,0,0,68,47,0,0,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,
+0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,255,180,0,0,0,0,0,0,180,255,247,190,0,0,0,0,0,0,191,246,214,
+231,1,0,0,0,0,1,231,212,134,255,93,0,0,0,0,94,255,133,15,214,254,167,111,110,166,254,214,14,0,15,135,215,247,247,215,135,15,0,0,0,0,0,0,1,111,88,0,0,0,0,0,0,0,0,0,131,217,25,0,0,0,0,0,
+0,0,0,18,127,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,255,153,0,0,0,0,0,10,219,234,22,0,159,255,70,0,0,0,0,145,255,82,0,0,14,225,226,15,0,0,62,254,163,0,0,0,0,67,254,158,
+0,11,221,228,16,0,0,0,0,0,148,255,74,148,255,71,0,0,0,0,0,0,10,218,237,254,152,0,0,0,0,0,0,0,0,57,255,225,12,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,255,180,0,0,
+0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,185,20,20,
+12,0,0,0,0,255,255,255,255,255,237,160,26,0,255,200,68,68,81,145,251,223,16,255,180,0,0,0,0,112,255,116,255,180,0,0,0,0,24,255,168,255,180,0,0,0,0,17,255,171,255,180,0,0,0,0,87,255,130,255,185,20,20,33,
+96,236,243,31,255,255,255,255,255,255,210,58,0,255,200,68,68,61,31,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,68,192,235,247,199,71,0,0,87,255,214,113,109,208,252,43,0,209,241,19,0,0,15,
+240,159,0,250,191,0,0,26,134,240,199,0,255,180,0,35,237,203,71,23,0,255,180,0,148,255,29,0,0,0,255,180,0,167,255,48,0,0,0,255,180,0,75,254,233,79,0,0,255,180,0,0,83,233,255,162,8,255,180,0,0,0,14,156,
+255,157,255,180,0,0,0,0,0,206,243,255,180,0,0,0,0,0,211,235,255,180,81,157,109,102,175,255,140,255,180,80,231,251,243,209,109,3,0,72,128,27,0,0,0,0,0,0,12,196,207,12,0,0,0,0,0,0,12,196,182,3,0,0,
+0,0,0,0,12,123,48,0,0,0,0,0,0,0,0,0,0,0,0,23,136,203,236,250,224,151,21,0,64,228,147,111,105,161,251,217,11,9,2,0,0,0,0,100,255,103,0,0,0,4,17,20,34,255,160,2,116,212,252,255,255,255,255,178,
+141,255,181,99,75,68,71,255,180,238,213,1,0,0,0,41,255,180,235,213,1,0,0,1,167,255,180,148,255,183,104,116,198,201,255,180,8,133,222,249,227,146,15,255,180,0,0,0,0,0,77,127,24,0,0,0,0,0,67,250,112,0,0,0,
+0,0,41,239,112,0,0,0,0,0,0,94,87,0,0,0,0,0,0,0,0,0,0,0,0,0,23,136,203,236,250,224,151,21,0,64,229,148,111,106,163,252,217,11,10,3,0,0,0,0,104,255,103,0,0,0,0,5,8,23,255,160,1,104,
+200,245,255,255,255,255,178,135,255,173,89,63,56,60,255,180,237,211,0,0,0,0,43,255,180,235,214,2,0,0,2,170,255,180,151,255,183,104,116,199,198,255,180,9,135,223,249,226,143,13,255,180,0,0,0,68,128,25,0,0,0,0,0,37,
+242,212,191,3,0,0,0,8,208,134,12,208,131,0,0,0,52,113,1,0,29,125,11,0,0,0,0,0,0,0,0,0,0,23,136,203,236,250,224,151,21,0,64,228,147,111,105,161,251,217,11,9,2,0,0,0,0,100,255,103,0,0,0,4,
+17,20,34,255,160,2,116,212,252,255,255,255,255,178,141,255,181,99,75,68,71,255,180,238,213,1,0,0,0,41,255,180,235,213,1,0,0,1,167,255,180,148,255,183,104,116,198,201,255,180,8,133,222,249,227,146,15,255,180,0,98,239,219,85,
+31,237,0,0,0,232,125,165,251,253,124,0,0,0,35,0,0,14,19,0,0,0,0,0,0,0,0,0,0,0,0,41,147,209,238,249,222,147,19,0,108,217,141,108,108,166,252,215,10,12,0,0,0,0,0,105,255,102,0,0,0,4,17,20,
+35,255,160,2,116,212,252,255,255,255,255,178,141,255,181,99,75,68,71,255,180,238,213,1,0,0,0,41,255,180,235,213,1,0,0,1,167,255,180,148,255,183,104,116,198,201,255,180,8,133,222,249,227,146,15,255,180,0,180,255,0,0,255,180,
+0,0,0,64,92,0,0,92,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,145,208,238,249,222,147,19,0,100,218,142,109,107,164,252,215,10,11,0,0,0,0,0,103,255,102,0,0,0,4,17,20,34,255,
+160,2,116,212,252,255,255,255,255,178,141,255,181,99,75,68,71,255,180,238,213,1,0,0,0,41,255,180,235,213,1,0,0,1,167,255,180,148,255,183,104,116,198,201,255,180,8,133,222,249,227,146,15,255,180,0,0,0,0,7,0,0,0,0,
+0,0,35,206,255,206,35,0,0,0,0,189,168,78,170,189,0,0,0,0,244,13,0,14,244,0,0,0,0,208,123,30,126,207,0,0,0,0,63,240,255,239,63,0,0,0,0,0,15,55,15,0,0,0,23,136,203,236,250,224,151,21,0,64,
+228,147,111,105,161,251,217,11,9,2,0,0,0,0,100,255,103,0,0,0,4,17,20,34,255,160,2,116,212,252,255,255,255,255,178,141,255,181,99,75,68,71,255,180,238,213,1,0,0,0,41,255,180,235,213,1,0,0,1,167,255,180,148,255,
+183,104,116,198,201,255,180,8,133,222,249,227,146,15,255,180,23,139,207,239,246,209,112,4,37,164,232,250,221,133,8,0,64,219,137,102,123,226,255,180,241,195,117,104,166,254,188,2,8,1,0,0,0,27,243,255,151,0,0,0,0,118,255,84,
+0,0,0,10,19,20,198,255,50,20,20,20,20,39,255,154,7,136,228,255,255,255,255,255,255,255,255,255,255,255,255,177,152,255,167,90,71,68,203,255,79,68,68,68,68,68,68,47,240,209,0,0,0,0,216,255,55,0,0,0,0,0,0,0,
+237,209,0,0,0,70,253,255,191,7,0,0,0,0,8,17,159,255,168,101,140,247,126,129,255,222,131,100,119,158,239,80,13,147,227,247,211,101,0,0,73,180,233,250,231,197,124,22,0,4,111,204,244,244,212,140,5,185,255,190,119,105,144,226,
+115,255,138,0,0,0,0,2,208,239,8,0,0,0,0,0,246,198,0,0,0,0,0,0,246,198,0,0,0,0,0,0,207,239,8,0,0,0,0,0,114,255,135,0,0,0,0,1,5,188,255,189,118,103,140,225,0,5,116,208,255,255,212,138,
+0,0,0,0,92,145,0,0,0,0,0,0,18,228,0,0,0,0,41,111,142,239,0,0,0,0,49,237,241,112,0,0,0,13,124,73,0,0,0,0,0,0,0,100,247,52,0,0,0,0,0,0,0,118,227,22,0,0,0,0,0,0,0,97,
+74,0,0,0,0,0,0,0,0,0,0,0,0,0,8,126,216,248,237,172,39,0,6,194,249,153,103,128,235,239,35,115,255,71,0,0,0,40,249,163,205,213,8,8,8,8,8,202,231,246,255,255,255,255,255,255,255,253,248,208,56,56,56,56,
+56,56,56,211,232,2,0,0,0,0,0,0,120,255,116,0,0,0,0,0,24,6,191,255,181,115,105,139,214,156,0,5,116,207,246,243,217,156,54,0,0,0,0,0,51,128,35,0,0,0,0,0,25,230,147,0,0,0,0,0,6,198,161,1,
+0,0,0,0,0,50,115,3,0,0,0,0,0,0,0,0,0,0,0,0,0,8,126,216,248,237,171,37,0,6,194,248,151,103,128,235,237,33,115,254,67,0,0,0,39,248,161,205,214,20,20,20,20,20,204,230,246,255,255,255,255,255,255,255,
+253,248,210,68,68,68,68,68,68,68,211,230,1,0,0,0,0,0,0,120,255,112,0,0,0,0,0,22,6,191,255,179,115,104,136,211,156,0,5,116,207,246,243,217,156,54,0,0,0,26,128,52,0,0,0,0,0,1,185,214,224,14,0,0,
+0,0,110,208,10,164,160,0,0,0,2,118,33,0,10,124,19,0,0,0,0,0,0,0,0,0,0,0,8,126,216,248,237,171,37,0,6,194,248,151,103,128,235,237,33,115,254,67,0,0,0,39,248,161,205,214,20,20,20,20,20,204,230,246,
+255,255,255,255,255,255,255,253,248,210,68,68,68,68,68,68,68,211,230,1,0,0,0,0,0,0,120,255,112,0,0,0,0,0,22,6,191,255,179,115,104,136,211,156,0,5,116,207,246,243,217,156,54,0,0,180,255,0,180,255,0,0,0,0,
+64,92,0,64,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,126,216,248,237,171,37,0,6,194,248,151,103,128,235,237,33,115,254,67,0,0,0,39,248,161,205,214,20,20,20,20,20,204,230,246,255,255,
+255,255,255,255,255,253,248,210,68,68,68,68,68,68,68,211,230,1,0,0,0,0,0,0,120,255,112,0,0,0,0,0,22,6,191,255,179,115,104,136,211,156,0,5,116,207,246,243,217,156,54,6,121,91,0,0,0,0,95,253,69,0,0,0,
+0,139,231,22,0,0,0,2,180,184,1,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,
+0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,10,125,83,0,0,156,233,30,0,86,249,59,0,33,240,97,0,0,0,0,0,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,
+255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,4,121,87,0,0,0,115,242,250,43,0,29,243,76,150,196,1,177,148,0,9,213,100,0,0,0,0,0,0,0,0,255,180,0,0,0,0,255,180,
+0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,0,0,255,180,0,0,255,180,0,76,255,92,64,0,27,92,0,0,0,0,
+0,0,0,0,0,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,0,255,180,0,0,10,199,245,54,5,72,134,
+0,0,0,24,236,238,226,168,83,0,8,160,227,170,236,213,16,0,0,0,76,11,0,57,246,190,4,0,0,15,145,229,249,250,255,136,0,9,207,255,169,107,115,212,252,39,124,255,116,0,0,0,59,255,147,211,235,5,0,0,0,0,227,215,
+247,196,0,0,0,0,0,196,245,247,195,0,0,0,0,0,197,246,209,235,5,0,0,0,5,235,208,122,255,110,0,0,0,111,255,120,8,204,254,157,105,157,254,201,7,0,14,140,225,250,225,138,12,0,0,98,239,218,85,31,237,0,0,232,
+127,165,251,253,124,0,0,35,0,0,14,19,0,0,0,0,0,0,0,0,0,0,255,180,52,194,246,231,130,1,255,215,231,133,106,200,255,99,255,255,61,0,0,15,243,202,255,213,0,0,0,0,197,237,255,183,0,0,0,0,180,255,255,180,
+0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,0,31,128,56,0,0,0,0,0,0,0,137,236,33,0,0,0,0,0,0,0,150,211,13,0,0,
+0,0,0,0,1,110,63,0,0,0,0,0,0,0,0,0,0,0,0,0,21,150,227,250,227,149,19,0,15,218,254,155,106,157,254,215,13,133,255,106,0,0,0,110,255,131,214,234,4,0,0,0,5,235,212,247,195,0,0,0,0,0,196,246,
+247,195,0,0,0,0,0,197,246,213,234,4,0,0,0,4,235,212,133,255,104,0,0,0,108,255,131,15,218,253,154,105,155,254,216,13,0,21,151,229,251,228,149,20,0,0,0,0,0,0,62,127,29,0,0,0,0,0,40,240,131,0,0,0,
+0,0,16,218,143,0,0,0,0,0,0,68,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,150,227,250,227,149,19,0,15,218,254,155,106,157,254,215,13,133,255,106,0,0,0,110,255,131,214,234,4,0,0,0,5,235,212,247,195,
+0,0,0,0,0,196,246,247,195,0,0,0,0,0,197,246,213,234,4,0,0,0,4,235,212,133,255,104,0,0,0,108,255,131,15,218,253,154,105,155,254,216,13,0,21,151,229,251,228,149,20,0,0,0,0,41,128,42,0,0,0,0,0,8,
+210,213,213,9,0,0,0,0,146,184,5,184,148,0,0,0,14,126,16,0,17,126,15,0,0,0,0,0,0,0,0,0,0,0,21,150,227,250,227,149,19,0,15,218,254,155,106,157,254,215,13,133,255,106,0,0,0,110,255,131,214,234,4,0,
+0,0,5,235,212,247,195,0,0,0,0,0,196,246,247,195,0,0,0,0,0,197,246,213,234,4,0,0,0,4,235,212,133,255,104,0,0,0,108,255,131,15,218,253,154,105,155,254,216,13,0,21,151,229,251,228,149,20,0,0,0,120,242,143,
+31,241,0,0,0,0,236,124,208,254,150,0,0,0,0,35,0,1,25,0,0,0,0,0,0,0,0,0,0,0,0,0,21,150,227,250,227,149,19,0,15,218,255,182,108,147,252,215,13,133,255,170,1,0,0,99,255,131,214,255,54,0,0,0,
+3,233,212,247,255,14,0,0,0,0,195,246,247,255,14,0,0,0,0,196,246,213,255,54,0,0,0,3,233,212,133,255,168,0,0,0,97,255,131,15,218,255,180,107,145,251,216,13,0,21,151,229,251,228,149,20,0,0,0,255,180,0,180,255,
+0,0,0,0,92,64,0,64,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,150,227,250,227,149,19,0,15,218,254,155,106,157,254,215,13,133,255,106,0,0,0,110,255,131,214,234,4,0,0,0,5,235,
+212,247,195,0,0,0,0,0,196,246,247,195,0,0,0,0,0,197,246,213,234,4,0,0,0,4,235,212,133,255,104,0,0,0,108,255,131,15,218,253,154,105,155,254,216,13,0,21,151,229,251,228,149,20,0,0,0,0,0,0,255,180,0,0,
+0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,36,25,0,0,0,0,20,20,20,20,20,20,20,20,20,20,20,255,255,255,255,255,255,255,255,255,255,255,68,68,68,68,68,68,68,68,68,68,68,0,0,0,0,0,32,22,
+0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,0,0,0,78,3,0,0,20,149,227,248,218,133,109,233,26,0,15,218,254,155,104,150,251,255,69,0,0,133,255,106,0,
+0,34,229,255,112,0,0,214,236,5,0,16,214,91,222,201,0,0,247,198,0,5,190,135,0,188,237,0,0,240,187,0,159,177,2,0,199,247,0,0,206,224,124,210,12,0,6,237,213,0,0,118,255,235,32,0,0,111,255,132,0,0,69,255,
+250,146,103,155,254,216,13,0,27,232,109,137,220,249,228,149,20,0,0,5,79,0,0,0,0,0,0,0,0,0,0,87,118,3,0,0,0,0,0,29,227,134,0,0,0,0,0,0,42,236,74,0,0,0,0,0,0,53,109,0,0,0,0,0,
+0,0,0,0,0,0,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,183,255,238,196,0,0,0,0,214,255,202,243,
+15,0,0,64,255,255,99,255,200,106,134,232,215,255,2,131,232,247,197,55,180,255,0,0,0,0,16,127,63,0,0,0,0,0,176,200,10,0,0,0,0,115,217,20,0,0,0,0,6,122,32,0,0,0,0,0,0,0,0,0,0,0,255,180,
+0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,183,255,238,196,0,0,0,0,214,255,202,243,15,0,0,64,255,255,99,255,
+200,106,134,232,215,255,2,131,232,247,197,55,180,255,0,0,0,105,89,0,0,0,0,0,85,229,239,53,0,0,0,23,232,61,90,213,7,0,0,66,85,0,0,102,46,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,180,255,255,180,
+0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,183,255,238,196,0,0,0,0,214,255,202,243,15,0,0,64,255,255,99,255,200,106,134,232,215,255,2,131,
+232,247,197,55,180,255,0,180,255,0,0,255,180,0,0,64,92,0,0,92,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,
+0,0,0,0,180,255,255,180,0,0,0,0,180,255,255,180,0,0,0,0,183,255,238,196,0,0,0,0,214,255,202,243,15,0,0,64,255,255,99,255,200,106,134,232,215,255,2,131,232,247,197,55,180,255,0,0,0,0,0,60,253,118,0,0,
+0,0,0,0,14,223,165,0,0,0,0,0,0,0,161,203,9,0,0,0,0,0,0,19,127,28,0,0,0,0,178,245,14,0,0,0,0,54,255,125,76,255,103,0,0,0,0,152,253,29,3,226,202,0,0,0,10,241,182,0,0,128,255,45,
+0,0,94,255,83,0,0,29,252,144,0,0,193,233,5,0,0,0,180,236,6,36,255,139,0,0,0,0,78,255,86,135,255,40,0,0,0,0,3,228,189,230,196,0,0,0,0,0,0,131,255,255,96,0,0,0,0,0,0,31,253,242,11,0,
+0,0,0,0,0,25,252,153,0,0,0,0,0,0,0,130,255,51,0,0,0,0,0,88,118,247,184,0,0,0,0,0,0,255,247,186,27,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,
+0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,62,199,246,230,136,6,0,255,216,242,145,107,181,255,167,0,255,255,93,0,0,1,172,255,59,255,231,2,0,0,0,56,255,138,255,194,0,0,0,0,15,255,171,255,194,0,0,0,
+0,15,255,171,255,231,2,0,0,0,56,255,138,255,255,93,0,0,1,171,255,60,255,216,242,145,107,181,255,170,0,255,180,62,199,247,231,139,7,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,0,0,0,255,180,0,0,0,0,
+0,0,0,255,180,0,0,0,0,0,0,0,0,0,0,255,180,0,180,255,0,0,0,0,0,0,92,64,0,64,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,255,164,0,0,0,0,0,
+184,240,9,0,198,246,15,0,0,0,26,252,150,0,0,93,255,104,0,0,0,119,255,50,0,0,8,236,202,0,0,0,213,207,0,0,0,0,139,255,44,0,53,255,107,0,0,0,0,36,254,142,0,149,247,16,0,0,0,0,0,185,234,12,
+237,164,0,0,0,0,0,0,80,255,165,255,64,0,0,0,0,0,0,3,227,255,219,1,0,0,0,0,0,0,0,126,255,121,0,0,0,0,0,0,0,0,120,251,25,0,0,0,0,0,0,0,6,226,176,0,0,0,0,0,0,44,92,177,
+254,56,0,0,0,0,0,0,128,255,228,104,0,0,0,0,0,0,
+    };
+    static const signed char asciiKerning18[128 * 128] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,-2,-1,-1,-1,-1,-3,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,-1,-1,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,-1,0,-1,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,-1,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,-1,0,-1,-3,0,0,0,0,0,0,0,0,0,0,0,-2,0,-1,-1,-1,0,
+0,-2,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,-1,-1,-1,0,0,0,-1,-1,-1,0,-1,0,-1,0,-2,-1,0,0,-1,-1,0,-1,-2,-1,-1,-1,-1,-1,-1,-1,0,-2,-1,-1,-2,0,0,0,-2,-1,-1,0,-1,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,-1,0,0,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,-1,-2,-1,0,-3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,-3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,-1,0,-2,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,-1,0,0,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,-2,-2,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,
+0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-3,0,-3,0,-3,-1,0,0,-1,0,0,0,0,0,-3,0,0,-3,-3,0,-3,0,-3,0,-3,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,-1,-1,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,1,
+1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,-1,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,-1,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,-1,-1,0,0,-1,-1,0,-1,-1,0,-1,0,-1,-1,-1,-1,0,-1,0,-1,-1,0,0,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,-2,-3,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,1,
+1,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,-2,0,0,0,-1,0,0,0,0,0,-2,0,0,0,0,0,-2,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,-1,-1,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,-1,0,0,0,0,-1,-1,0,0,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,-1,-1,-1,-1,-1,-1,-1,-1,-2,-3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-2,-1,-1,-1,-1,-2,-2,-1,-1,-1,-2,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,-1,-1,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,-1,0,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,-1,0,-1,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,-1,-1,-1,0,
+0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,-1,-1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,-1,-1,0,-1,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,-1,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,0,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,-1,-1,0,0,0,0,0,0,-1,-1,0,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,-1,0,0,0,-1,-3,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,
+0,0,-1,0,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,0,-1,0,0,0,-1,-1,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,-1,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,-1,-1,0,-1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,0,0,0,0,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,-1,0,-1,-1,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,0,0,0,0,-1,0,0,0,-1,0,-1,0,0,-1,0,-1,-1,0,-1,0,-1,0,-1,-1,0,0,0,0,0,0,0,0,0,0,
+    };
+
+    static const CharacterSize characterSizes[] = {
+        {12, 14.0f, 1.03125f, 0.53125f, metrics12, glyphs12, sizeof(glyphs12) / sizeof(GlyphBitmap), pixels12, asciiKerning12},
+        {13, 15.0f, 1.109375f, 0.578125f, metrics13, glyphs13, sizeof(glyphs13) / sizeof(GlyphBitmap), pixels13, asciiKerning13},
+        {14, 16.0f, 1.203125f, 0.609375f, metrics14, glyphs14, sizeof(glyphs14) / sizeof(GlyphBitmap), pixels14, asciiKerning14},
+        {16, 19.0f, 1.375f, 0.703125f, metrics16, glyphs16, sizeof(glyphs16) / sizeof(GlyphBitmap), pixels16, asciiKerning16},
+        {18, 21.0f, 1.53125f, 0.796875f, metrics18, glyphs18, sizeof(glyphs18) / sizeof(GlyphBitmap), pixels18, asciiKerning18},
+    };
+}
+}
+
+#endif // TGUI_DEFAULT_FONT_ATLAS_HPP
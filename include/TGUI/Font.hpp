@@ -32,6 +32,8 @@
 #include <string>
 #include <cstddef>
 #include <memory>
+#include <utility>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -45,9 +47,11 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     struct TGUI_API FontGlyph
     {
-        float     advance = 0;  //!< Offset to move horizontally to the next character
-        FloatRect bounds;       //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
-        IntRect   textureRect;  //!< Texture coordinates of the glyph inside the font's texture
+        float        advance = 0;      //!< Offset to move horizontally to the next character
+        FloatRect    bounds;           //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
+        IntRect      textureRect;      //!< Texture coordinates of the glyph inside the font's texture
+        float        textureScale = 1; //!< Amount of texels per pixel of the bounds (differs from 1 when glyphs are scaled from a distance field)
+        unsigned int sheet = 0;        //!< Part of the font's texture that contains the glyph (below 64), see BackendFont::markSheetsDrawn
     };
 
 
@@ -71,6 +75,48 @@ namespace tgui
         static Font getGlobalFont();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the fonts from the font cache that are no longer being used
+        ///
+        /// @return Number of fonts that were removed from the cache
+        ///
+        /// Fonts that are loaded from a file or from memory are stored in a cache, so that loading the same font again (e.g.
+        /// when many widgets in a form file specify the same font) reuses the already loaded font instead of reading and
+        /// parsing the file again. The cache keeps the fonts alive even when no widget uses them anymore, this function
+        /// releases the memory of those fonts. Fonts that are still in use remain in the cache.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t purgeUnusedFonts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all fonts from the font cache
+        ///
+        /// Fonts that are still in use remain valid, but loading the same font again will create a new backend font.
+        /// This function is called automatically when the backend is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearFontCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how many fonts are stored in the font cache
+        ///
+        /// @return Number of fonts in the cache, including the ones that are no longer used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getCachedFontsCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Loads a backend font from a file, or returns the cached one if the file was loaded before
+        ///
+        /// @param filename  Filename of the font, already including the resource path
+        ///
+        /// @return The shared backend font, or nullptr when the font could not be loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<BackendFont> loadSharedBackendFont(const String& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor which will set the font to nullptr
         ///
@@ -100,6 +146,8 @@ namespace tgui
         /// @brief Constructor to create the font from a byte array
         /// @param data         Pointer to the file data in memory
         /// @param sizeInBytes  Size of the data to load, in bytes
+        ///
+        /// Fonts created from identical data share the same backend font, until a setting of the font is changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Font(const void* data, std::size_t sizeInBytes);
 
@@ -171,6 +219,26 @@ namespace tgui
         FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs in advance so that they don't have to be loaded while drawing text
+        ///
+        /// @param codePointRanges  Ranges of unicode code points to load, both the first and last code point are included
+        /// @param characterSizes   Character sizes for which the glyphs should be loaded
+        /// @param bold             Load the bold version or the regular one?
+        /// @param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+        ///
+        /// Example usage:
+        /// @code
+        /// font.preloadGlyphs({{U' ', U'~'}, {0xC0, 0xFF}}, {13, 18});
+        /// @endcode
+        ///
+        /// With the FreeType font backend, the glyphs are rasterized on multiple threads. This function can then also be called
+        /// on a background thread (e.g. while showing a splash screen), while the gui keeps using the font on the main thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphs(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges,
+                           const std::vector<unsigned int>& characterSizes, bool bold = false, float outlineThickness = 0) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -188,6 +256,24 @@ namespace tgui
         float getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold = false) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the advances and kerning of all characters in a string at once
+        ///
+        /// @param codePoints     Unicode code points of the characters in the string
+        /// @param count          Amount of characters in the string
+        /// @param characterSize  Size of the characters
+        /// @param bold           Are the glyphs bold or regular?
+        /// @param advances       Array of count elements in which the advance of each character will be stored
+        /// @param kernings       Array of count elements in which the kerning between each character and the previous one will
+        ///                       be stored
+        ///
+        /// This gives the same results as calling getGlyph and getKerning for every character, but it is a lot faster for long
+        /// strings. A tab is 4 times as wide as a space, a newline has no advance and carriage returns are ignored.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getAdvances(const char32_t* codePoints, std::size_t count, unsigned int characterSize, bool bold,
+                         float* advances, float* kernings) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the line spacing
         ///
@@ -207,6 +293,8 @@ namespace tgui
         /// the font to look exactly the same as its source file then you should disable it.
         /// The smooth filter is enabled by default.
         ///
+        /// This function calls detachBackendFont, so other fonts that were loaded from the same file or data aren't affected.
+        ///
         /// @param smooth  True to enable smoothing, false to disable it
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setSmooth(bool smooth);
@@ -222,6 +310,23 @@ namespace tgui
         bool isSmooth() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the fonts that are used to render characters that don't exist in this font
+        ///
+        /// @param fonts  Fonts that are searched in order for characters that are missing in this font
+        ///
+        /// This allows texts that mix scripts (e.g. Latin, CJK and symbols) to be drawn with a single font. Each character
+        /// is taken from the first font in the chain that contains it, which is found with a lookup in a coverage table that
+        /// is built once per font. The glyphs of the fallback fonts are placed in the same texture as the glyphs of this font,
+        /// so texts containing characters from several fonts are still drawn at once.
+        ///
+        /// This function calls detachBackendFont, so other fonts that were loaded from the same file or data aren't affected.
+        /// Changing the fallback fonts removes all glyphs that were already loaded.
+        /// Fallback fonts are only supported by the FreeType font backend.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFallbackFonts(const std::vector<Font>& fonts);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal font
         /// @return Backend font that is used internally
@@ -229,6 +334,19 @@ namespace tgui
         std::shared_ptr<BackendFont> getBackendFont() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes sure that the internal font isn't shared with other fonts that were loaded from the same file or data
+        ///
+        /// @return Backend font that is used internally, which can be changed without affecting other fonts
+        ///
+        /// Fonts that are loaded from the same file or data share their backend font until one of them changes a setting.
+        /// The font then gets its own backend font, which only shares the file data with the others.
+        /// Call this function before changing settings of the backend font directly (e.g. the memory budget or distance field
+        /// mode of BackendFontFreetype). Copies of this object that were made earlier keep using the shared backend font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendFont> detachBackendFont();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -31,6 +31,7 @@
 #include <TGUI/Vector2.hpp>
 #include <TGUI/TextStyle.hpp>
 #include <TGUI/RenderStates.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -48,6 +49,17 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Part of a text that is placed on a single line, as found by findLineBreaks
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct WrappedLine
+        {
+            std::size_t start = 0;  //!< Index in the text of the first character on the line
+            std::size_t length = 0; //!< Amount of characters on the line, not including the newline that ends it
+            float width = 0;        //!< Width of the characters on the line, only calculated when requested
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a small distance that text should be placed from the side of a widget as padding.
         ///
@@ -113,6 +125,29 @@ namespace tgui
         static String wordWrap(float maxWidth, const String& text, Font font, unsigned int textSize, bool bold);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Splits a text in lines so that the width of the lines does not exceed maxWidth, without copying the text
+        ///
+        /// @param lines            List to which the lines are added
+        /// @param maxWidth         Maximum width of a line, or 0 to only split the text at its newlines
+        /// @param text             The text to wrap
+        /// @param font             Font of the text
+        /// @param textSize         The text size
+        /// @param bold             Should the text be bold?
+        /// @param calculateWidths  Should the width of the lines be stored in the lines?
+        /// @param start            Index in the text at which the splitting starts
+        /// @param end              Index in the text at which the splitting stops, or String::npos to split until the end
+        ///
+        /// The lines are the same as the ones in the string that is returned by wordWrap. When the text ends with a newline
+        /// (or when there is nothing between start and end) then the last line is empty.
+        ///
+        /// The text can be wrapped incrementally: the start can be the start of any line that was found earlier, the end has to be
+        /// either at a newline or at the end of the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void findLineBreaks(std::vector<WrappedLine>& lines, float maxWidth, const String& text, Font font, unsigned int textSize,
+                                   bool bold, bool calculateWidths = false, std::size_t start = 0, std::size_t end = String::npos);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -328,6 +363,19 @@ namespace tgui
         Vector2f findCharacterPos(std::size_t index) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the character in front of which a caret would be placed when clicking on a position
+        ///
+        /// @param position  Position relative to the top-left of the text, without the position of the text itself
+        ///
+        /// @return Index between 0 and the length of the string that is the closest to the position
+        ///
+        /// This is the reverse of findCharacterPos: the line is found from the y coordinate, after which the character on that
+        /// line is searched that is the closest to the x coordinate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findCharacterIndex(Vector2f position) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a small distance that text should be placed from the side of a widget as padding.
         ///
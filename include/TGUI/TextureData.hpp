@@ -49,6 +49,10 @@ namespace tgui
         // Either svgImage or backendTexture MUST have a value
         Optional<SvgImage> svgImage;
         std::shared_ptr<BackendTexture> backendTexture;
+
+        // Location of the image inside backendTexture when it was packed into an atlas page by the TextureManager.
+        // The rectangle is empty when the backend texture only contains this single image.
+        UIntRect atlasRect;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
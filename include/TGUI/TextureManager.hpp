@@ -30,6 +30,7 @@
 
 #include <TGUI/TextureData.hpp>
 #include <memory>
+#include <vector>
 #include <list>
 #include <map>
 
@@ -44,6 +45,18 @@ namespace tgui
     class TGUI_API TextureManager
     {
     public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about how well the atlas pages are being used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct AtlasStatistics
+        {
+            std::size_t pages = 0;   //!< Number of atlas pages that currently exist
+            std::size_t images = 0;  //!< Number of images that are stored inside the atlas pages
+            float fillRatio = 0;     //!< Fraction of the total page area that is occupied by images (between 0 and 1)
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads a texture
         ///
@@ -90,10 +103,80 @@ namespace tgui
         static std::size_t getCachedImagesCount();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether small images should be packed together in shared atlas pages
+        ///
+        /// @param enabled  Should images that are loaded from now on be placed in an atlas?
+        ///
+        /// When enabled, images (other than svg files) that are loaded from a file and that are at most 256x256 pixels are
+        /// copied into a shared texture instead of getting their own texture. This allows the renderer to draw many widgets
+        /// without having to switch textures in between, which is needed for batching the draw calls together.
+        /// The Texture objects still behave the same, the part rect and middle rect remain relative to the loaded image.
+        ///
+        /// Images that were already loaded before changing this setting are not affected.
+        /// Atlas mode is disabled by default.
+        ///
+        /// @warning Shaders that are set on a texture will receive texture coordinates inside the atlas page.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether small images are packed together in shared atlas pages
+        ///
+        /// @return Is atlas mode enabled?
+        ///
+        /// @see setAtlasEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about the atlas pages that are currently in use
+        ///
+        /// @return Number of pages and images, and how much of the pages is filled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static AtlasStatistics getAtlasStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tries to store the pixels of a loaded image inside an atlas page. Returns false if the image isn't suited for the atlas.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool addToAtlas(TextureData& data, const BackendTexture& imageTexture, bool smooth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Informs the atlas page that contains the texture data that the image is no longer needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeFromAtlas(const TextureData& data);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Texture in which multiple images are stored. Images are placed next to each other on horizontal shelves.
+        struct AtlasPage
+        {
+            struct Shelf
+            {
+                unsigned int top = 0;
+                unsigned int height = 0;
+                unsigned int usedWidth = 0;
+            };
+
+            std::shared_ptr<BackendTexture> backendTexture;
+            std::vector<Shelf> shelves;
+            bool smooth = true;
+            std::size_t images = 0;
+            std::size_t usedArea = 0; // Pixels occupied by images that are still in use (excluding padding)
+        };
+
         static std::map<String, std::list<TextureDataHolder>> m_imageMap;
+        static std::list<AtlasPage> m_atlasPages;
+        static bool m_atlasEnabled;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,6 +60,7 @@ namespace tgui
     namespace priv
     {
         class Animation;
+        class DamageCollector;
     }
 
 
@@ -1044,6 +1045,21 @@ namespace tgui
         virtual Widget::Ptr clone() const = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the widget that its appearance has changed
+        ///
+        /// When the render target is in retained mode, the draw commands of the widget are recorded and replayed until the
+        /// widget is invalidated. When the gui only redraws the parts of the screen that changed, the area of the widget is
+        /// marked as damaged. Changes to the size, position, transformation, renderer, font, opacity or text size already
+        /// invalidate the widget, and the widgets call this function when their own state changes. You only need to call it
+        /// yourself when writing a custom widget that draws something which the Widget base class doesn't know about.
+        ///
+        /// @see BackendRenderTarget::setRetainedModeEnabled
+        /// @see BackendGui::setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateDrawCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -1089,6 +1105,14 @@ namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the parent that it has to draw this widget differently, e.g. because it was moved or hidden
+        ///
+        /// Unlike invalidateDrawCache, this doesn't mark the entire area of the parent as damaged.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateParentDrawCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -1195,10 +1219,22 @@ namespace tgui
 
         std::function<void(const String& property)> m_rendererChangedCallback = [this](const String& property){ rendererChangedCallback(property); };
 
+        // Draw commands recorded by the render target when using retained mode
+        std::shared_ptr<priv::RecordedDrawCommands> m_drawCache;
+        bool m_drawCacheValid = false;
+
+        // Area of the view that the widget covered when the gui was last drawn, used to only redraw the parts that changed
+        FloatRect m_lastDrawnArea;
+        FloatRect m_lastDrawnRect;
+        FloatRect m_lastDrawnClipRect;
+        bool m_damaged = true;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container accesses save and load functions
+        friend class BackendRenderTarget; // Render target accesses the recorded draw commands
+        friend class priv::DamageCollector; // Gui accesses the drawn area when finding out what has to be redrawn
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
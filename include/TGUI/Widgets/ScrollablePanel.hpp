@@ -425,6 +425,8 @@ namespace tgui
         unsigned int m_verticalScrollAmount = 0;
         unsigned int m_horizontalScrollAmount = 0;
 
+        bool m_mouseOnScrollbar = false; // Is one of the scrollbars (which are drawn as part of the panel) being hovered?
+
         std::unordered_map<Widget::Ptr, unsigned int> m_connectedPositionCallbacks;
         std::unordered_map<Widget::Ptr, unsigned int> m_connectedSizeCallbacks;
 
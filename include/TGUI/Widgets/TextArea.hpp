@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TextAreaRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -418,6 +419,20 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // A line as displayed in the text area. The characters themselves are stored in m_text. The line ends with a newline
+        // when the next line doesn't start directly behind it, otherwise it was split by word wrap. The width of the line is
+        // only known when there is a horizontal scrollbar.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        using Line = Text::WrappedLine;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index in m_text of the first character on the line, taking into account that the lines behind the last
+        // edit may not have been moved yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineStart(std::size_t lineNumber) const;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will search after which character the caret should be placed. It will not change the caret position.
@@ -431,6 +446,20 @@ namespace tgui
         std::size_t getIndexOfSelectionPos(Vector2<std::size_t> selectionPos) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gets the line and column at which the caret is placed when it is located behind the character at the given index.
+        // When a word-wrapped line ends at the index then the caret is placed at the end of that line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2<std::size_t> getSelectionPosOfIndex(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns a text containing the given line, which is used to find the positions of the characters on the line.
+        // The text is reused while the line doesn't change, so that the positions don't have to be calculated again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Text& getLineText(std::size_t lineNumber) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when you are selecting text.
         // It will find out which part of the text is selected.
@@ -450,13 +479,31 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText(bool keepSelection);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces 'count' characters starting at 'index' by the given text and places the caret behind the inserted text.
+        // Only the lines of the paragraphs that were changed are word-wrapped again, the other lines are just moved.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replaceText(std::size_t index, std::size_t count, const String& text);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the part of m_text between 'start' and 'end' in lines, using word wrap when there is no horizontal scrollbar.
+        // When there is a horizontal scrollbar, the width of the lines is calculated as well.
+        // The start has to be at the beginning of a paragraph and the end has to be at a newline or at the end of the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void splitLines(std::size_t start, std::size_t end, std::vector<Line>& lines) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbars and the texts after the lines were changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLines();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the physical size of the scrollbars, as well as the viewport size.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateScrollbars();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Updates the caret and the scrollbars after the selection changed and recreates the texts that are drawn.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
@@ -554,7 +601,14 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates which lines are currently visible.
+        // This function will split the visible part of the text into five pieces so that the text can be easily drawn.
+        // Only the visible lines and about a page above and below them are placed in the texts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleTexts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates which lines are currently visible. The texts are recreated when a line becomes visible that isn't in them.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateVisibleLines();
 
@@ -620,7 +674,18 @@ namespace tgui
         // The width of the largest line
         float m_maxLineWidth;
 
-        std::vector<String> m_lines;
+        // The lines in which the text is split, always contains at least one line
+        std::vector<Line> m_lines = std::vector<Line>(1);
+
+        // Moving the lines behind an edit is postponed until the next edit happens somewhere else. The lines starting from
+        // m_shiftedLinesStart begin m_shiftedLinesOffset characters further in the text than their start member says.
+        std::size_t m_shiftedLinesStart = 1;
+        std::size_t m_shiftedLinesOffset = 0;
+
+        // The widths of all lines, sorted so that the longest width is at the end. Lines can be added and removed anywhere
+        // without affecting the other widths. It is empty when the widths aren't being measured or when they have to be
+        // measured again.
+        std::multiset<float> m_lineWidths;
 
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
@@ -629,6 +694,10 @@ namespace tgui
         std::size_t m_topLine = 1;
         std::size_t m_visibleLines = 1;
 
+        // Which lines are placed in the texts that are drawn (the end line is not included)
+        std::size_t m_textsStartLine = 0;
+        std::size_t m_textsEndLine = 0;
+
         // Information about the selection
         Vector2<std::size_t> m_selStart;
         Vector2<std::size_t> m_selEnd;
@@ -645,6 +714,9 @@ namespace tgui
         Text m_textAfterSelection2;
         Text m_defaultText;
 
+        // Text that isn't drawn but contains the line that getLineText was last called for
+        mutable Text m_lineText;
+
         std::vector<FloatRect> m_selectionRects;
 
         // The scrollbars
@@ -53,6 +53,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendFont::loadFromSharedMemory(std::shared_ptr<const std::uint8_t> data, std::size_t sizeInBytes)
+    {
+        return loadFromMemory(static_cast<const void*>(data.get()), sizeInBytes);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::uint64_t BackendFont::constructGlyphKey(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
         // Create a unique key for every character.
@@ -68,6 +75,79 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendFont::preloadGlyphs(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges,
+                                    const std::vector<unsigned int>& characterSizes, bool bold, float outlineThickness)
+    {
+        for (const unsigned int characterSize : characterSizes)
+        {
+            for (const auto& range : codePointRanges)
+            {
+                for (char32_t codePoint = range.first; codePoint <= range.second; ++codePoint)
+                {
+                    if (hasGlyph(codePoint))
+                        getGlyph(codePoint, characterSize, bold, outlineThickness);
+
+                    if (codePoint == range.second) // Prevent an infinite loop when the range ends at the largest value
+                        break;
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::getAdvances(const char32_t* codePoints, std::size_t count, unsigned int characterSize, bool bold,
+                                  float* advances, float* kernings)
+    {
+        const float whitespaceWidth = (count > 0) ? getGlyph(U' ', characterSize, bold).advance : 0;
+
+        char32_t prevChar = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const char32_t curChar = codePoints[i];
+            if (curChar == U'\r')
+            {
+                advances[i] = 0;
+                kernings[i] = 0;
+                continue;
+            }
+
+            kernings[i] = getKerning(prevChar, curChar, characterSize, bold);
+
+            if (curChar == U'\n')
+                advances[i] = 0;
+            else if (curChar == U'\t')
+                advances[i] = whitespaceWidth * 4;
+            else if (curChar == U' ')
+                advances[i] = whitespaceWidth;
+            else
+                advances[i] = getGlyph(curChar, characterSize, bold).advance;
+
+            prevChar = curChar;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t BackendFont::getGlyphGeneration(unsigned int) const
+    {
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::markSheetsDrawn(unsigned int, std::uint64_t)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::setFallbackFonts(const std::vector<std::shared_ptr<BackendFont>>&)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendFont::setSmooth(bool smooth)
     {
         m_isSmooth = smooth;
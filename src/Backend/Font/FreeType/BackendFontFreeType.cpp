@@ -25,6 +25,7 @@
 
 #include <TGUI/Backend/Font/FreeType/BackendFontFreeType.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
+#include <TGUI/DefaultFontAtlas.hpp>
 
 #if defined(__GNUC__)
     #pragma GCC diagnostic push
@@ -42,16 +43,74 @@
     #pragma GCC diagnostic pop
 #endif
 
+#include <unordered_set>
+#include <algorithm>
+#include <thread>
+#include <cstring>
+#include <limits>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // In distance field mode, glyphs are rasterized at the reference size and the distance to their edge is stored for
+        // pixels up to the spread away from it. Smaller sizes would need more padding than the spread provides.
+        const unsigned int distanceFieldReferenceSize = 48;
+        const unsigned int distanceFieldSpread = 6;
+        const unsigned int distanceFieldMinimumSize = distanceFieldReferenceSize / distanceFieldSpread;
+
+        bool setFaceSize(FT_Face face, unsigned int characterSize)
+        {
+            // Don't call FT_Set_Pixel_Sizes if we don't have to
+            if (characterSize == face->size->metrics.x_ppem)
+                return true;
+
+            return (FT_Set_Pixel_Sizes(face, 0, characterSize) == FT_Err_Ok);
+        }
+
+        bool openFace(const std::uint8_t* data, std::size_t sizeInBytes, FT_Library& library, FT_Face& face)
+        {
+            if (FT_Init_FreeType(&library) != 0)
+                return false;
+
+            if (FT_New_Memory_Face(library, static_cast<const FT_Byte*>(data), static_cast<FT_Long>(sizeInBytes), 0, &face) != 0)
+            {
+                FT_Done_FreeType(library);
+                return false;
+            }
+
+            if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) != 0)
+            {
+                FT_Done_Face(face);
+                FT_Done_FreeType(library);
+                return false;
+            }
+
+            return true;
+        }
+
+        const defaultFontAtlas::CharacterSize* findPrebakedSize(unsigned int characterSize)
+        {
+            for (const auto& prebakedSize : defaultFontAtlas::characterSizes)
+            {
+                if (prebakedSize.characterSize == characterSize)
+                    return &prebakedSize;
+            }
+
+            return nullptr;
+        }
+    }
+
+    bool BackendFontFreetype::m_prebakedDefaultFontEnabled = true;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendFontFreetype::~BackendFontFreetype()
     {
+        clearFallbackFaces();
         cleanup();
     }
 
@@ -59,40 +118,40 @@ namespace tgui
 
     bool BackendFontFreetype::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
     {
-        cleanup();
-        m_cachedLineSpacing.clear();
-        m_glyphs.clear();
-        m_rows.clear();
-        m_pixels = nullptr;
-        m_texture = nullptr;
-        m_textureSize = 0;
-        m_nextRow = 3; // First 2 rows contain pixels for underlining
+        return loadFromSharedMemory(std::shared_ptr<const std::uint8_t>(data.release(), std::default_delete<std::uint8_t[]>()), sizeInBytes);
+    }
 
-        constexpr unsigned int initialTextureSize = 128;
-        m_pixels = MakeUniqueForOverwrite<std::uint8_t[]>(initialTextureSize * initialTextureSize * 4);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::uint8_t* pixelPtr = m_pixels.get();
-        for (unsigned int y = 0; y < initialTextureSize; ++y)
-        {
-            for (unsigned int x = 0; x < initialTextureSize; ++x)
-            {
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 0;
-            }
-        }
+    bool BackendFontFreetype::loadFromSharedMemory(std::shared_ptr<const std::uint8_t> data, std::size_t sizeInBytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
 
-        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
-        for (unsigned int y = 0; y < 2; ++y)
+        cleanup();
+        m_cachedLineSpacing.clear();
+        m_pages.clear();
+        m_metricsTables.clear();
+        m_coverage = {};
+        m_evictedGlyphs = 0;
+        m_evictedPages = 0;
+        m_uploadedTextureBytes = 0;
+        m_usesPrebakedGlyphs = false;
+
+        // The renderer may only be used on the thread that draws the gui, while pages may also grow on the thread that calls
+        // preloadGlyphs. So the maximum texture size is queried here and when the texture is requested, never while growing.
+        if (isBackendSet() && getBackend()->hasRenderer())
+            m_maximumTextureSize = getBackend()->getRenderer()->getMaximumTextureSize();
+
+        // The default font isn't opened with FreeType until a glyph is needed that wasn't rasterized when TGUI was built
+        if (m_prebakedDefaultFontEnabled && (sizeInBytes == defaultFontAtlas::fontFileSize)
+         && (std::memcmp(data.get(), defaultFontAtlas::fontFileHeader, sizeof(defaultFontAtlas::fontFileHeader)) == 0))
         {
-            for (unsigned int x = 0; x < 2; ++x)
-                m_pixels[((initialTextureSize * y) + x) * 4 + 3] = 255;
+            m_fileContents = std::move(data);
+            m_fileSize = sizeInBytes;
+            m_usesPrebakedGlyphs = true;
+            return true;
         }
 
-        m_textureSize = initialTextureSize;
-
         // Initialize the freetype library each time, since we currently don't reuse the library object between fonts.
         FT_Library library;
         if (FT_Init_FreeType(&library) != 0)
@@ -115,6 +174,7 @@ namespace tgui
         }
 
         m_fileContents = std::move(data);
+        m_fileSize = sizeInBytes;
         m_library = library;
         m_face = face;
         return true;
@@ -124,33 +184,260 @@ namespace tgui
 
     bool BackendFontFreetype::hasGlyph(char32_t codePoint) const
     {
-        return FT_Get_Char_Index(m_face, static_cast<FT_ULong>(codePoint)) != 0; // m_face is allowed to be nullptr
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_usesPrebakedGlyphs && !m_face && (codePoint < 256))
+        {
+            if (defaultFontAtlas::characterSizes[0].metrics[codePoint].glyphIndex != 0)
+                return true;
+            if (m_fallbackFaces.empty())
+                return false;
+        }
+
+        if (!loadFace())
+            return false;
+
+        if (getCoverage().contains(codePoint))
+            return true;
+
+        for (const auto& fallbackFace : m_fallbackFaces)
+        {
+            if (fallbackFace.coverage.contains(codePoint))
+                return true;
+        }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     FontGlyph BackendFontFreetype::getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         FontGlyph glyph;
-        if (!m_face)
+        if (!m_fileContents)
+            return glyph;
+
+        if (!usesDistanceField(characterSize))
+        {
+            const Glyph internalGlyph = getInternalGlyph(codePoint, characterSize, bold, outlineThickness);
+            glyph.advance = internalGlyph.advance;
+            glyph.bounds = internalGlyph.bounds;
+            glyph.textureRect = internalGlyph.textureRect;
+            glyph.sheet = internalGlyph.sheet;
             return glyph;
+        }
+
+        // Scale the glyph from the distance field. The outline thickness is given in pixels at the requested size.
+        const float scale = static_cast<float>(characterSize) / distanceFieldReferenceSize;
+        const Glyph internalGlyph = getInternalGlyph(codePoint, distanceFieldReferenceSize, bold, outlineThickness / scale);
+        if ((internalGlyph.textureRect.width > 0) && (internalGlyph.textureRect.height > 0))
+        {
+            // The spread around the glyph isn't part of its bounds, it is only drawn as padding by the text
+            const float spread = static_cast<float>(distanceFieldSpread);
+            glyph.bounds = {(internalGlyph.bounds.left + spread) * scale, (internalGlyph.bounds.top + spread) * scale,
+                            (internalGlyph.bounds.width - 2 * spread) * scale, (internalGlyph.bounds.height - 2 * spread) * scale};
+            glyph.textureRect = {internalGlyph.textureRect.left + static_cast<int>(distanceFieldSpread),
+                                 internalGlyph.textureRect.top + static_cast<int>(distanceFieldSpread),
+                                 internalGlyph.textureRect.width - static_cast<int>(2 * distanceFieldSpread),
+                                 internalGlyph.textureRect.height - static_cast<int>(2 * distanceFieldSpread)};
+            glyph.textureScale = 1 / scale;
+            glyph.sheet = internalGlyph.sheet;
+        }
 
-        const Glyph internalGlyph = getInternalGlyph(codePoint, characterSize, bold, outlineThickness);
-        glyph.advance = internalGlyph.advance;
-        glyph.bounds = internalGlyph.bounds;
-        glyph.textureRect = internalGlyph.textureRect;
+        // The advance is taken from the requested size, so that texts have the same layout as without distance fields
+        glyph.advance = getGlyphMetrics(getMetricsTable(characterSize, bold), codePoint, bold).advance;
         return glyph;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    IntRect BackendFontFreetype::findAvailableGlyphRect(unsigned int width, unsigned int height)
+    void BackendFontFreetype::preloadGlyphs(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges,
+                                            const std::vector<unsigned int>& characterSizes, bool bold, float outlineThickness)
+    {
+        struct Job
+        {
+            char32_t codePoint;
+            std::size_t faceIndex;
+            unsigned int characterSize;
+            float outlineThickness;
+            bool distanceField;
+            bool rasterized;
+            RasterizedGlyph result;
+        };
+
+        // Make a list of the glyphs that still have to be loaded.
+        // With distance fields, the glyphs of all sizes are rasterized at the reference size and only have to be loaded once.
+        std::vector<Job> jobs;
+        std::unordered_set<std::uint64_t> jobKeys;
+        std::vector<std::pair<std::shared_ptr<const std::uint8_t>, std::size_t>> faceContents;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!loadFace())
+                return;
+
+            for (const unsigned int requestedSize : characterSizes)
+            {
+                const bool distanceField = usesDistanceField(requestedSize);
+                const unsigned int characterSize = distanceField ? distanceFieldReferenceSize : requestedSize;
+                const float rasterizedOutlineThickness = outlineThickness * characterSize / requestedSize;
+
+                // A page of a prebaked size is created first, so that the prebaked glyphs aren't rasterized again
+                if (m_usesPrebakedGlyphs)
+                    getPage(characterSize);
+
+                const auto pageIt = m_pages.find(characterSize);
+                for (const auto& range : codePointRanges)
+                {
+                    for (char32_t codePoint = range.first; codePoint <= range.second; ++codePoint)
+                    {
+                        const std::uint64_t glyphKey = constructGlyphKey(codePoint, characterSize, bold, rasterizedOutlineThickness);
+                        const std::size_t faceIndex = findFaceIndex(codePoint);
+                        if (((faceIndex > 0) || (FT_Get_Char_Index(m_face, static_cast<FT_ULong>(codePoint)) != 0))
+                         && ((pageIt == m_pages.end()) || (pageIt->second.glyphs.find(glyphKey) == pageIt->second.glyphs.end()))
+                         && jobKeys.insert(glyphKey).second)
+                        {
+                            jobs.push_back({codePoint, faceIndex, characterSize, rasterizedOutlineThickness, distanceField, false, {}});
+                        }
+
+                        if (codePoint == range.second) // Prevent an infinite loop when the range ends at the largest value
+                            break;
+                    }
+                }
+            }
+
+            faceContents.emplace_back(m_fileContents, m_fileSize);
+            for (const auto& fallbackFace : m_fallbackFaces)
+                faceContents.emplace_back(fallbackFace.fileContents, fallbackFace.fileSize);
+        }
+
+        if (jobs.empty())
+            return;
+
+        // Rasterize the glyphs on multiple threads. The FreeType objects can't be shared between threads, so every thread
+        // opens its own faces on the font data. Each thread handles a fixed subset of the jobs, so no locking is needed.
+        // The faces of fallback fonts are only opened by a thread when one of its jobs needs them.
+        const std::size_t minJobsPerThread = 32;
+        const std::size_t threadCount = std::max<std::size_t>(1, std::min<std::size_t>(std::thread::hardware_concurrency(),
+                                                                                       jobs.size() / minJobsPerThread));
+        const auto rasterizeJobs = [&jobs,&faceContents,threadCount,bold](std::size_t firstJob)
+        {
+            struct ThreadFace
+            {
+                FT_Library library = nullptr;
+                FT_Face face = nullptr;
+                FT_Stroker stroker = nullptr;
+                bool failed = false;
+            };
+
+            std::vector<ThreadFace> faces(faceContents.size());
+            for (std::size_t i = firstJob; i < jobs.size(); i += threadCount)
+            {
+                Job& job = jobs[i];
+                ThreadFace& face = faces[job.faceIndex];
+                if (!face.face && !face.failed)
+                    face.failed = !openFace(faceContents[job.faceIndex].first.get(), faceContents[job.faceIndex].second, face.library, face.face);
+                if (face.failed)
+                    continue;
+
+                job.rasterized = rasterizeGlyph(face.library, face.face, face.stroker, job.codePoint, job.characterSize, bold, job.outlineThickness, job.result);
+                if (job.rasterized && job.distanceField)
+                    convertToDistanceField(job.result);
+            }
+
+            for (const auto& face : faces)
+            {
+                if (face.stroker)
+                    FT_Stroker_Done(face.stroker);
+
+                if (face.face)
+                {
+                    FT_Done_Face(face.face);
+                    FT_Done_FreeType(face.library);
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < threadCount; ++i)
+            threads.emplace_back(rasterizeJobs, i);
+
+        rasterizeJobs(0);
+        for (auto& thread : threads)
+            thread.join();
+
+        // Place all rasterized glyphs in the atlas at once
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Nothing is placed when the font was reloaded or its fallback fonts changed while the glyphs were being rasterized
+        if ((m_fileContents != faceContents[0].first) || (m_fallbackFaces.size() + 1 != faceContents.size()))
+            return;
+        for (std::size_t i = 0; i < m_fallbackFaces.size(); ++i)
+        {
+            if (m_fallbackFaces[i].fileContents != faceContents[i + 1].first)
+                return;
+        }
+
+        for (const auto& job : jobs)
+        {
+            if (!job.rasterized)
+                continue;
+
+            // The glyph might have been loaded by getGlyph in the meantime, or distance fields might have been toggled
+            const std::uint64_t glyphKey = constructGlyphKey(job.codePoint, job.characterSize, bold, job.outlineThickness);
+            Page& page = getPage(job.characterSize);
+            page.lastUsed = ++m_useCounter;
+            if ((page.glyphs.find(glyphKey) != page.glyphs.end()) || (page.distanceField != job.distanceField))
+                continue;
+
+            page.glyphs.insert({glyphKey, placeGlyph(page, job.result, job.faceIndex > 0)});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::Page& BackendFontFreetype::getPage(unsigned int characterSize)
+    {
+        const auto it = m_pages.find(characterSize);
+        if (it != m_pages.end())
+            return it->second;
+
+        const unsigned int initialTextureSize = std::min(128u, m_maximumPageSize);
+        evictPages(static_cast<std::size_t>(initialTextureSize) * initialTextureSize, nullptr, std::numeric_limits<std::uint64_t>::max());
+
+        Page& page = m_pages[characterSize];
+        page.textureSize = initialTextureSize;
+        page.generation = ++m_generationCounter;
+        page.distanceField = usesDistanceField(characterSize);
+
+        // The texture only stores alpha values, the color of the glyphs is always white
+        page.pixels = MakeUniqueForOverwrite<std::uint8_t[]>(initialTextureSize * initialTextureSize);
+        std::memset(page.pixels.get(), 0, initialTextureSize * initialTextureSize);
+
+        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
+        for (unsigned int y = 0; y < 2; ++y)
+        {
+            for (unsigned int x = 0; x < 2; ++x)
+                page.pixels[(initialTextureSize * y) + x] = 255;
+        }
+
+        page.sheets.emplace_back();
+        page.sheets.back().nextRow = 3;
+
+        if (m_usesPrebakedGlyphs && !page.distanceField)
+            addPrebakedGlyphs(page, characterSize);
+
+        return page;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::findAvailableGlyphRect(const Page& page, Sheet& sheet, unsigned int width, unsigned int height, IntRect& rect)
     {
         // Find the line that where the glyph fits well.
         // This is based on the sf::Font class in the SFML library. It might not be the most optimal method, but it is good enough for now.
         Row* bestRow = nullptr;
         float bestRatio = 0;
-        for (auto& row : m_rows)
+        for (auto& row : sheet.rows)
         {
             float ratio = static_cast<float>(height) / row.height;
 
@@ -159,7 +446,7 @@ namespace tgui
                 continue;
 
             // Check if there's enough horizontal space left in the row
-            if (width > m_textureSize - row.width)
+            if (width > page.textureSize - row.width)
                 continue;
 
             // Make sure that this new row is the best found so far
@@ -171,70 +458,247 @@ namespace tgui
             bestRatio = ratio;
         }
 
-        // If we didn't find a matching row, create a new one (10% taller than the glyph)
+        // If we didn't find a matching row, create a new one (10% taller than the glyph) if it fits in the sheet
         if (!bestRow)
         {
-            // Check if the glyph can fit in the texture and resize the texture otherwise
             const unsigned int rowHeight = height + (height / 10);
-            while ((m_nextRow + rowHeight >= m_textureSize) || (width >= m_textureSize))
+            if ((sheet.nextRow + rowHeight >= sheet.top + page.textureSize) || (width >= page.textureSize))
+                return false;
+
+            sheet.rows.push_back({sheet.nextRow, rowHeight});
+            sheet.nextRow += rowHeight;
+            bestRow = &sheet.rows.back();
+        }
+
+        // Find the glyph's rectangle on the selected row
+        rect = {static_cast<int>(bestRow->width), static_cast<int>(bestRow->top), static_cast<int>(width), static_cast<int>(height)};
+
+        // Update the row informations
+        bestRow->width += width;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::growPage(Page& page)
+    {
+        unsigned int maximumPageSize = m_maximumPageSize;
+        if (m_maximumTextureSize > 0)
+            maximumPageSize = std::min(maximumPageSize, m_maximumTextureSize / static_cast<unsigned int>(page.sheets.size()));
+
+        const unsigned int newTextureSize = page.textureSize * 2;
+        if (newTextureSize > maximumPageSize)
+            return false;
+
+        // Other pages may have to make room for the larger page
+        const std::size_t sheetCount = page.sheets.size();
+        const std::size_t extraBytes = ((static_cast<std::size_t>(newTextureSize) * newTextureSize) - (static_cast<std::size_t>(page.textureSize) * page.textureSize)) * sheetCount;
+        if (!evictPages(extraBytes, &page, std::numeric_limits<std::uint64_t>::max()))
+            return false;
+
+        // Copy the existing pixels of each sheet to the top left quadrant of the larger sheet, the rest is filled with empty values
+        const std::size_t newSheetBytes = static_cast<std::size_t>(newTextureSize) * newTextureSize;
+        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(newSheetBytes * sheetCount);
+        std::memset(pixels.get(), 0, newSheetBytes * sheetCount);
+        std::vector<unsigned int> sheetOffsets(sheetCount);
+        for (std::size_t i = 0; i < sheetCount; ++i)
+        {
+            Sheet& sheet = page.sheets[i];
+            const unsigned int newTop = static_cast<unsigned int>(i) * newTextureSize;
+            for (unsigned int y = 0; y < page.textureSize; ++y)
+                std::memcpy(&pixels[static_cast<std::size_t>(newTop + y) * newTextureSize], &page.pixels[static_cast<std::size_t>(sheet.top + y) * page.textureSize], page.textureSize);
+
+            sheetOffsets[i] = newTop - sheet.top;
+            for (auto& row : sheet.rows)
+                row.top += sheetOffsets[i];
+
+            sheet.nextRow += sheetOffsets[i];
+            sheet.top = newTop;
+        }
+
+        // Glyphs below the first sheet move down together with their sheet
+        if (sheetCount > 1)
+        {
+            for (auto& pair : page.glyphs)
             {
-                /// TODO: Check if maximum texture size is reached and use multiple textures if there isn't enough space left
+                if ((pair.second.textureRect.width > 0) && (pair.second.textureRect.height > 0))
+                    pair.second.textureRect.top += static_cast<int>(sheetOffsets[pair.second.sheet]);
+            }
+
+            page.generation = ++m_generationCounter;
+        }
 
-                // Copy existing pixels to the top left quadrant
-                auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>((m_textureSize * 2) * (m_textureSize * 2) * 4);
-                for (unsigned int y = 0; y < m_textureSize; ++y)
-                    std::memcpy(&pixels[y * (2 * m_textureSize) * 4], &m_pixels[y * m_textureSize * 4], m_textureSize * 4);
+        page.pixels = std::move(pixels);
+        page.textureSize = newTextureSize;
 
-                // Top right quadrant and bottom halves are filled with empty values
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                for (unsigned int y = 0; y < m_textureSize; ++y)
-                {
-                    std::uint8_t* pixelPtr = &pixels[((y * (2 * m_textureSize)) + m_textureSize) * 4];
-                    for (unsigned int i = 0; i < m_textureSize; ++i)
-                    {
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 0;
-                    }
-                }
-                std::uint8_t* pixelPtr = &pixels[m_textureSize * (2 * m_textureSize) * 4];
-                for (unsigned int i = 0; i < (2 * m_textureSize) * m_textureSize; ++i)
-                {
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 0;
-                }
+        // The texture has to be recreated with the new size
+        page.texture = nullptr;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                m_pixels = std::move(pixels);
-                m_textureSize *= 2;
+    bool BackendFontFreetype::addSheet(Page& page, bool fallback)
+    {
+        // The sheets are stacked in a single texture, so that all glyphs of a character size can still be drawn in one batch.
+        // The bitmask that texts pass to markSheetsDrawn limits the amount of sheets to 64.
+        const std::size_t sheetBytes = static_cast<std::size_t>(page.textureSize) * page.textureSize;
+        const std::size_t textureHeight = static_cast<std::size_t>(page.textureSize) * (page.sheets.size() + 1);
+        if ((page.sheets.size() >= 64) || (m_maximumTextureSize == 0) || (textureHeight > m_maximumTextureSize))
+            return false;
+
+        // Glyphs from fallback fonts can't take more than half of the page
+        if (fallback)
+        {
+            std::size_t fallbackSheets = 0;
+            for (const auto& sheet : page.sheets)
+            {
+                if (sheet.fallback)
+                    ++fallbackSheets;
             }
 
-            // We can now create the new row
-            m_rows.push_back({m_nextRow, rowHeight});
-            m_nextRow += rowHeight;
-            bestRow = &m_rows.back();
+            if (2 * fallbackSheets >= page.sheets.size())
+                return false;
         }
 
-        // Find the glyph's rectangle on the selected row
-        IntRect rect(bestRow->width, bestRow->top, width, height);
+        // Only pages of other character sizes that weren't used since any sheet of this page was used are removed to make
+        // room for the sheet. Otherwise the least recently drawn sheet of this page has to be reused instead.
+        std::uint64_t oldestSheetUse = page.sheets[0].lastUsed;
+        for (const auto& sheet : page.sheets)
+            oldestSheetUse = std::min(oldestSheetUse, sheet.lastUsed);
 
-        // Update the row informations
-        bestRow->width += width;
-        return rect;
+        if (!evictPages(sheetBytes, &page, oldestSheetUse))
+            return false;
+
+        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(textureHeight * page.textureSize);
+        std::memcpy(pixels.get(), page.pixels.get(), textureHeight * page.textureSize - sheetBytes);
+        std::memset(&pixels[textureHeight * page.textureSize - sheetBytes], 0, sheetBytes);
+        page.pixels = std::move(pixels);
+
+        Sheet sheet;
+        sheet.top = static_cast<unsigned int>(textureHeight) - page.textureSize;
+        sheet.nextRow = sheet.top;
+        sheet.fallback = fallback;
+        page.sheets.push_back(std::move(sheet));
+
+        // The texture has to be recreated with the new size
+        page.texture = nullptr;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    BackendFontFreetype::Glyph BackendFontFreetype::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+    void BackendFontFreetype::evictSheet(Page& page, unsigned int sheetIndex)
     {
-        Glyph glyph;
-        if (!m_face)
-            return glyph;
+        for (auto it = page.glyphs.begin(); it != page.glyphs.end();)
+        {
+            if ((it->second.sheet == sheetIndex) && (it->second.textureRect.width > 0) && (it->second.textureRect.height > 0))
+            {
+                it = page.glyphs.erase(it);
+                ++m_evictedGlyphs;
+            }
+            else
+                ++it;
+        }
 
-        if (!setCurrentSize(characterSize))
-            return glyph;
+        Sheet& sheet = page.sheets[sheetIndex];
+        sheet.rows.clear();
+        sheet.nextRow = sheet.top;
+        std::memset(&page.pixels[static_cast<std::size_t>(sheet.top) * page.textureSize], 0, static_cast<std::size_t>(page.textureSize) * page.textureSize);
+
+        // The first sheet keeps the white square for underlining
+        if (sheetIndex == 0)
+        {
+            for (unsigned int y = 0; y < 2; ++y)
+            {
+                for (unsigned int x = 0; x < 2; ++x)
+                    page.pixels[(page.textureSize * y) + x] = 255;
+            }
+
+            sheet.nextRow = 3;
+        }
+
+        // Texts that use glyphs from this page have to request them again. The texture is recreated instead of being updated,
+        // because a renderer may still have vertices of texts that were drawn with the old glyphs queued in a batch.
+        page.generation = ++m_generationCounter;
+        page.texture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::evictPages(std::size_t extraBytes, const Page* pageToKeep, std::uint64_t usedBefore)
+    {
+        std::size_t bytesInUse = getBytesInUse();
+        while (bytesInUse + extraBytes > m_memoryBudget)
+        {
+            auto leastRecentlyUsedIt = m_pages.end();
+            for (auto it = m_pages.begin(); it != m_pages.end(); ++it)
+            {
+                if ((&it->second == pageToKeep) || (it->second.lastUsed >= usedBefore))
+                    continue;
+
+                if ((leastRecentlyUsedIt == m_pages.end()) || (it->second.lastUsed < leastRecentlyUsedIt->second.lastUsed))
+                    leastRecentlyUsedIt = it;
+            }
+
+            if (leastRecentlyUsedIt == m_pages.end())
+                return false;
+
+            const Page& page = leastRecentlyUsedIt->second;
+            bytesInUse -= static_cast<std::size_t>(page.textureSize) * page.textureSize * page.sheets.size();
+            m_evictedGlyphs += page.glyphs.size();
+            m_pages.erase(leastRecentlyUsedIt);
+            ++m_evictedPages;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::getBytesInUse() const
+    {
+        std::size_t bytesInUse = 0;
+        for (const auto& pair : m_pages)
+            bytesInUse += static_cast<std::size_t>(pair.second.textureSize) * pair.second.textureSize * pair.second.sheets.size();
+        return bytesInUse;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::Glyph BackendFontFreetype::loadGlyph(Page& page, char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+    {
+        if (!loadFace())
+            return {};
+
+        // Glyphs from fallback fonts are placed in the same page as the glyphs of this font
+        RasterizedGlyph rasterizedGlyph;
+        const std::size_t faceIndex = findFaceIndex(codePoint);
+        if (faceIndex > 0)
+        {
+            FallbackFace& fallbackFace = m_fallbackFaces[faceIndex - 1];
+            if (!rasterizeGlyph(fallbackFace.library, fallbackFace.face, fallbackFace.stroker, codePoint, characterSize, bold, outlineThickness, rasterizedGlyph))
+                return {};
+        }
+        else
+        {
+            if (!rasterizeGlyph(m_library, m_face, m_stroker, codePoint, characterSize, bold, outlineThickness, rasterizedGlyph))
+                return {};
+        }
+
+        if (page.distanceField)
+            convertToDistanceField(rasterizedGlyph);
+
+        return placeGlyph(page, rasterizedGlyph, faceIndex > 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::rasterizeGlyph(FT_Library library, FT_Face face, FT_Stroker& stroker, char32_t codePoint,
+                                             unsigned int characterSize, bool bold, float outlineThickness, RasterizedGlyph& result)
+    {
+        if (!setFaceSize(face, characterSize))
+            return false;
 #if defined(__GNUC__)
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wold-style-cast"
@@ -246,25 +710,25 @@ namespace tgui
 #if defined(__GNUC__)
     #pragma GCC diagnostic pop
 #endif
-        if (FT_Load_Char(m_face, codePoint, flags) != 0)
-            return glyph;
+        if (FT_Load_Char(face, codePoint, flags) != 0)
+            return false;
 
         // Retrieve the glyph
         FT_Glyph glyphDesc;
-        if (FT_Get_Glyph(m_face->glyph, &glyphDesc) != 0)
-            return glyph;
+        if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+            return false;
 
         // Add an outline if requested and the font supports it
         if ((outlineThickness != 0) && (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE))
         {
             // Create the stroker if this is the first time an outline was requested with this font
-            if (!m_stroker)
-                FT_Stroker_New(m_library, &m_stroker);
+            if (!stroker)
+                FT_Stroker_New(library, &stroker);
 
-            if (m_stroker)
+            if (stroker)
             {
-                FT_Stroker_Set(m_stroker, static_cast<FT_Fixed>(outlineThickness * static_cast<float>(1 << 6)), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
-                FT_Glyph_Stroke(&glyphDesc, m_stroker, true);
+                FT_Stroker_Set(stroker, static_cast<FT_Fixed>(outlineThickness * static_cast<float>(1 << 6)), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
+                FT_Glyph_Stroke(&glyphDesc, stroker, true);
             }
         }
 
@@ -282,7 +746,7 @@ namespace tgui
         if (FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, 0, 1) != 0)
         {
             FT_Done_Glyph(glyphDesc);
-            return glyph;
+            return false;
         }
         FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
         FT_Bitmap& bitmap = bitmapGlyph->bitmap;
@@ -290,15 +754,16 @@ namespace tgui
         // If bold was requested but the font didn't support outlines then apply bold here using a different (lower quality) method
         // We have to cache the outline support bool because FT_Glyph_To_Bitmap changes format to FT_GLYPH_FORMAT_BITMAP.
         if (bold && !outlineSupport)
-            FT_Bitmap_Embolden(static_cast<FT_Library>(m_library), &bitmap, boldWeight, boldWeight);
+            FT_Bitmap_Embolden(library, &bitmap, boldWeight, boldWeight);
 
         // Bit shift is possible without loss because we use FT_LOAD_FORCE_AUTOHINT flag
+        Glyph& glyph = result.glyph;
         glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
         if (bold)
             glyph.advance += static_cast<float>(boldWeight) / static_cast<float>(1 << 6);
 
-        glyph.lsbDelta = static_cast<float>(m_face->glyph->lsb_delta);
-        glyph.rsbDelta = static_cast<float>(m_face->glyph->rsb_delta);
+        glyph.lsbDelta = static_cast<float>(face->glyph->lsb_delta);
+        glyph.rsbDelta = static_cast<float>(face->glyph->rsb_delta);
 
         // Compute the glyph's bounding box
         glyph.bounds.left = static_cast<float>(bitmapGlyph->left);
@@ -306,23 +771,11 @@ namespace tgui
         glyph.bounds.width = static_cast<float>(bitmap.width);
         glyph.bounds.height = static_cast<float>(bitmap.rows);
 
-        if ((bitmap.width == 0) || (bitmap.rows == 0))
-        {
-            // This branch will e.g. be executed when loading a space character. The glyph will have an advance but no bitmap.
-            FT_Done_Glyph(glyphDesc);
-            return glyph;
-        }
-
-        // Find a good position for the new glyph into the texture.
-        // We leave a small padding around characters, so that filtering doesn't pollute them with pixels from neighbors.
-        const unsigned int padding = 2;
-        glyph.textureRect = findAvailableGlyphRect(bitmap.width + (2 * padding), bitmap.rows + (2 * padding));
-        glyph.textureRect.left += padding;
-        glyph.textureRect.top += padding;
-        glyph.textureRect.width -= 2 * padding;
-        glyph.textureRect.height -= 2 * padding;
-
-        // Extract the glyph's pixels from the bitmap
+        // Extract the glyph's pixels from the bitmap.
+        // The pixels will be empty when e.g. loading a space character. The glyph will have an advance but no bitmap.
+        result.width = bitmap.width;
+        result.height = bitmap.rows;
+        result.pixels.resize(static_cast<std::size_t>(bitmap.width) * bitmap.rows);
         const std::uint8_t* glyphBitmapPixels = bitmap.buffer;
         if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
         {
@@ -330,11 +783,7 @@ namespace tgui
             for (unsigned int y = 0; y < bitmap.rows; ++y)
             {
                 for (unsigned int x = 0; x < bitmap.width; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = ((glyphBitmapPixels[(y * bitmap.pitch) + (x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
-                }
+                    result.pixels[(y * bitmap.width) + x] = ((glyphBitmapPixels[(y * bitmap.pitch) + (x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
             }
         }
         else
@@ -343,78 +792,426 @@ namespace tgui
             for (unsigned int y = 0; y < bitmap.rows; ++y)
             {
                 for (unsigned int x = 0; x < bitmap.width; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = glyphBitmapPixels[(y * bitmap.pitch) + x];
-                }
+                    result.pixels[(y * bitmap.width) + x] = glyphBitmapPixels[(y * bitmap.pitch) + x];
             }
         }
 
-        // We will have to recreate the texture now that the pixels changed
-        m_texture = nullptr;
-
         FT_Done_Glyph(glyphDesc);
-        return glyph;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    BackendFontFreetype::Glyph BackendFontFreetype::getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+    void BackendFontFreetype::convertToDistanceField(RasterizedGlyph& rasterizedGlyph)
     {
-        const std::uint64_t glyphKey = constructGlyphKey(codePoint, characterSize, bold, outlineThickness);
+        if ((rasterizedGlyph.width == 0) || (rasterizedGlyph.height == 0))
+            return;
+
+        const int spread = static_cast<int>(distanceFieldSpread);
+        const int width = static_cast<int>(rasterizedGlyph.width);
+        const int height = static_cast<int>(rasterizedGlyph.height);
+        const int newWidth = width + (2 * spread);
+        const int newHeight = height + (2 * spread);
+        const std::vector<std::uint8_t>& coverage = rasterizedGlyph.pixels;
+        const auto getCoverage = [&coverage,width,height](int x, int y) -> int {
+            if ((x < 0) || (y < 0) || (x >= width) || (y >= height))
+                return 0;
+            return coverage[static_cast<std::size_t>((y * width) + x)];
+        };
+
+        // Distances between pixels in the neighbourhood that is searched for the nearest edge
+        const int searchRadius = spread + 1;
+        const int searchSize = (2 * searchRadius) + 1;
+        std::vector<float> pixelDistances(static_cast<std::size_t>(searchSize * searchSize));
+        for (int dy = -searchRadius; dy <= searchRadius; ++dy)
+        {
+            for (int dx = -searchRadius; dx <= searchRadius; ++dx)
+                pixelDistances[static_cast<std::size_t>(((dy + searchRadius) * searchSize) + dx + searchRadius)] = std::sqrt(static_cast<float>((dx * dx) + (dy * dy)));
+        }
 
-        const auto it = m_glyphs.find(glyphKey);
-        if (it != m_glyphs.end())
-            return it->second;
+        // For every pixel, find the nearest pixel that lies on the other side of the edge. Partially covered pixels are
+        // assumed to have the edge at a distance from their center that corresponds to their coverage.
+        std::vector<std::uint8_t> distances(static_cast<std::size_t>(newWidth * newHeight));
+        for (int y = 0; y < newHeight; ++y)
+        {
+            for (int x = 0; x < newWidth; ++x)
+            {
+                const int pixelX = x - spread;
+                const int pixelY = y - spread;
+                const bool inside = (getCoverage(pixelX, pixelY) >= 128);
+
+                // Pixels outside the bitmap are never covered, so only the pixels right next to it have to be checked
+                float minDistance = static_cast<float>(spread);
+                const int searchTop = std::max(pixelY - searchRadius, -1);
+                const int searchBottom = std::min(pixelY + searchRadius, height);
+                const int searchLeft = std::max(pixelX - searchRadius, -1);
+                const int searchRight = std::min(pixelX + searchRadius, width);
+                for (int searchY = searchTop; searchY <= searchBottom; ++searchY)
+                {
+                    for (int searchX = searchLeft; searchX <= searchRight; ++searchX)
+                    {
+                        const int otherCoverage = getCoverage(searchX, searchY);
+                        if (inside ? (otherCoverage == 255) : (otherCoverage == 0))
+                            continue;
 
-        const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-        return m_glyphs.insert({glyphKey, glyph}).first->second;
+                        const float edgeOffset = (inside ? (otherCoverage - 127.5f) : (127.5f - otherCoverage)) / 255.f;
+                        const float distance = pixelDistances[static_cast<std::size_t>(((searchY - pixelY + searchRadius) * searchSize) + searchX - pixelX + searchRadius)] + edgeOffset;
+                        minDistance = std::min(minDistance, distance);
+                    }
+                }
+
+                // Store the signed distance with 128 on the edge, higher values lie inside the glyph
+                const float signedDistance = inside ? minDistance : -minDistance;
+                const float value = ((signedDistance / static_cast<float>(spread)) + 1) * 127.5f;
+                distances[static_cast<std::size_t>((y * newWidth) + x)] = static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, std::round(value))));
+            }
+        }
+
+        rasterizedGlyph.pixels = std::move(distances);
+        rasterizedGlyph.width = static_cast<unsigned int>(newWidth);
+        rasterizedGlyph.height = static_cast<unsigned int>(newHeight);
+        rasterizedGlyph.glyph.bounds.left -= static_cast<float>(spread);
+        rasterizedGlyph.glyph.bounds.top -= static_cast<float>(spread);
+        rasterizedGlyph.glyph.bounds.width += static_cast<float>(2 * spread);
+        rasterizedGlyph.glyph.bounds.height += static_cast<float>(2 * spread);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float BackendFontFreetype::getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold)
+    BackendFontFreetype::Glyph BackendFontFreetype::placeGlyph(Page& page, const RasterizedGlyph& rasterizedGlyph, bool fallback)
     {
-        // There is no kerning if one of the two characters is the null character
-        if ((first == 0) || (second == 0))
-            return 0;
-
-        if (!m_face || !setCurrentSize(characterSize))
-            return 0;
-
-        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
-        const float firstRsbDelta = getInternalGlyph(first, characterSize, bold, 0).rsbDelta;
-        const float secondLsbDelta = getInternalGlyph(second, characterSize, bold, 0).lsbDelta;
+        Glyph glyph = rasterizedGlyph.glyph;
+        const unsigned int width = rasterizedGlyph.width;
+        const unsigned int height = rasterizedGlyph.height;
+        if ((width == 0) || (height == 0))
+            return glyph;
 
-        // Get the kerning vector if present
-        FT_Vector kerning;
-        kerning.x = kerning.y = 0;
-        if (FT_HAS_KERNING(m_face))
+        // Find a good position for the new glyph into the texture.
+        // We leave a small padding around characters, so that filtering doesn't pollute them with pixels from neighbors.
+        // Glyphs from fallback fonts are kept in other sheets than the glyphs of this font, as long as the page has such a sheet.
+        // If all sheets are full then the page grows, or a sheet is added once the page can't grow anymore. Only when no sheet
+        // can be added, the glyphs are removed from the sheet in which no glyphs were drawn for the longest time.
+        const unsigned int padding = 2;
+        const unsigned int paddedWidth = width + (2 * padding);
+        const unsigned int paddedHeight = height + (2 * padding);
+        const auto hasOwnSheet = [&page,fallback]{
+            return std::any_of(page.sheets.begin(), page.sheets.end(), [fallback](const Sheet& sheet){ return sheet.fallback == fallback; });
+        };
+        const auto tryPlaceGlyph = [&]{
+            // Glyphs are only mixed in a sheet when the page has no sheet for them
+            const bool mixSheets = !hasOwnSheet();
+            for (unsigned int i = 0; i < page.sheets.size(); ++i)
+            {
+                if ((mixSheets || (page.sheets[i].fallback == fallback))
+                 && findAvailableGlyphRect(page, page.sheets[i], paddedWidth, paddedHeight, glyph.textureRect))
+                {
+                    glyph.sheet = i;
+                    return true;
+                }
+            }
+
+            return false;
+        };
+
+        // The first glyph from a fallback font gets a new sheet, unless no sheet can be added to the page
+        if (fallback && !hasOwnSheet())
+            addSheet(page, fallback);
+
+        bool placed = tryPlaceGlyph();
+
+        while (!placed && growPage(page))
+            placed = tryPlaceGlyph();
+
+        if (!placed && addSheet(page, fallback))
+            placed = tryPlaceGlyph();
+
+        if (!placed)
         {
-            const FT_UInt index1 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(first));
-            const FT_UInt index2 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(second));
-            FT_Get_Kerning(m_face, index1, index2, FT_KERNING_UNFITTED, &kerning);
+            const bool mixSheets = !hasOwnSheet();
+            bool foundSheet = false;
+            for (unsigned int i = 0; i < page.sheets.size(); ++i)
+            {
+                if ((mixSheets || (page.sheets[i].fallback == fallback))
+                 && (!foundSheet || (page.sheets[i].lastUsed < page.sheets[glyph.sheet].lastUsed)))
+                {
+                    glyph.sheet = i;
+                    foundSheet = true;
+                }
+            }
+
+            evictSheet(page, glyph.sheet);
+            if (!findAvailableGlyphRect(page, page.sheets[glyph.sheet], paddedWidth, paddedHeight, glyph.textureRect))
+            {
+                // The glyph is too large to ever fit in the page, so it will only have an advance like a space character
+                glyph.bounds = {};
+                glyph.textureRect = {};
+                glyph.sheet = 0;
+                return glyph;
+            }
         }
 
-        // X advance is already in pixels for bitmap fonts
-        if (!FT_IS_SCALABLE(m_face))
-            return static_cast<float>(kerning.x);
+        page.sheets[glyph.sheet].lastUsed = ++m_useCounter;
+
+        glyph.textureRect.left += padding;
+        glyph.textureRect.top += padding;
+        glyph.textureRect.width -= 2 * padding;
+        glyph.textureRect.height -= 2 * padding;
+
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            std::memcpy(&page.pixels[static_cast<std::size_t>(glyph.textureRect.top + y) * page.textureSize + static_cast<std::size_t>(glyph.textureRect.left)],
+                        &rasterizedGlyph.pixels[static_cast<std::size_t>(y) * width], width);
+        }
+
+        // Only the rows that contain the new glyph have to be uploaded to the texture
+        const unsigned int glyphTop = static_cast<unsigned int>(glyph.textureRect.top);
+        const unsigned int glyphBottom = glyphTop + static_cast<unsigned int>(glyph.textureRect.height);
+        if (page.dirtyRowsTop == page.dirtyRowsBottom)
+        {
+            page.dirtyRowsTop = glyphTop;
+            page.dirtyRowsBottom = glyphBottom;
+        }
+        else
+        {
+            page.dirtyRowsTop = std::min(page.dirtyRowsTop, glyphTop);
+            page.dirtyRowsBottom = std::max(page.dirtyRowsBottom, glyphBottom);
+        }
+
+        return glyph;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::Glyph BackendFontFreetype::getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+    {
+        const std::uint64_t glyphKey = constructGlyphKey(codePoint, characterSize, bold, outlineThickness);
+
+        Page& page = getPage(characterSize);
+        page.lastUsed = ++m_useCounter;
+
+        const auto it = page.glyphs.find(glyphKey);
+        if (it != page.glyphs.end())
+        {
+            page.sheets[it->second.sheet].lastUsed = m_useCounter;
+            return it->second;
+        }
+
+        const Glyph glyph = loadGlyph(page, codePoint, characterSize, bold, outlineThickness);
+        return page.glyphs.insert({glyphKey, glyph}).first->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // There is no kerning if one of the two characters is the null character
+        if ((first == 0) || (second == 0))
+            return 0;
+
+        if (!m_fileContents)
+            return 0;
+
+        return getCachedKerning(getMetricsTable(characterSize, bold), first, second, bold);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::getAdvances(const char32_t* codePoints, std::size_t count, unsigned int characterSize, bool bold,
+                                          float* advances, float* kernings)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_fileContents)
+        {
+            std::fill(advances, advances + count, 0.f);
+            std::fill(kernings, kernings + count, 0.f);
+            return;
+        }
+
+        MetricsTable& table = getMetricsTable(characterSize, bold);
+        const float whitespaceWidth = getGlyphMetrics(table, U' ', bold).advance;
+
+        const std::size_t asciiCount = table.asciiGlyphs.size();
+        char32_t prevChar = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const char32_t curChar = codePoints[i];
+            if (curChar == U'\r')
+            {
+                advances[i] = 0;
+                kernings[i] = 0;
+                continue;
+            }
 
-        // Combine kerning with compensation deltas and return the X advance
+            // Read the ASCII tables directly when the values were already loaded before
+            float kerning = std::numeric_limits<float>::quiet_NaN();
+            if (prevChar == 0)
+                kerning = 0;
+            else if ((prevChar < asciiCount) && (curChar < asciiCount) && !table.asciiKerning.empty())
+                kerning = table.asciiKerning[(prevChar * asciiCount) + curChar];
+            kernings[i] = std::isnan(kerning) ? getCachedKerning(table, prevChar, curChar, bold) : kerning;
+
+            if (curChar == U'\n')
+                advances[i] = 0;
+            else if (curChar == U'\t')
+                advances[i] = whitespaceWidth * 4;
+            else if ((curChar < asciiCount) && table.asciiGlyphs[curChar].loaded)
+                advances[i] = table.asciiGlyphs[curChar].advance;
+            else
+                advances[i] = getGlyphMetrics(table, curChar, bold).advance;
+
+            prevChar = curChar;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::MetricsTable& BackendFontFreetype::getMetricsTable(unsigned int characterSize, bool bold)
+    {
+        const std::uint64_t tableKey = (static_cast<std::uint64_t>(characterSize) << 1) | static_cast<std::uint64_t>(bold);
+        const auto it = m_metricsTables.find(tableKey);
+        if (it != m_metricsTables.end())
+            return it->second;
+
+        MetricsTable& table = m_metricsTables[tableKey];
+        table.characterSize = characterSize;
+        if (m_usesPrebakedGlyphs)
+            addPrebakedMetrics(table, bold);
+
+        return table;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const BackendFontFreetype::GlyphMetrics& BackendFontFreetype::getGlyphMetrics(MetricsTable& table, char32_t codePoint, bool bold)
+    {
+        GlyphMetrics& metrics = (codePoint < table.asciiGlyphs.size()) ? table.asciiGlyphs[codePoint] : table.otherGlyphs[codePoint];
+        if (metrics.loaded)
+            return metrics;
+
+        metrics.loaded = true;
+        if (!loadFace())
+            return metrics;
+
+        metrics.faceIndex = findFaceIndex(codePoint);
+        const FT_Face face = getFace(metrics.faceIndex);
+        if (!setFaceSize(face, table.characterSize))
+            return metrics;
+
+        metrics.glyphIndex = FT_Get_Char_Index(face, static_cast<FT_ULong>(codePoint));
+
+        // Load the glyph with the same flags as loadGlyph, but without rendering it.
+        // The advance is identical to the one of the rasterized glyph, as the bitmap conversion doesn't change it.
+#if defined(__GNUC__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wold-style-cast"
+#endif
+        if (FT_Load_Char(face, codePoint, FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT) != 0)
+            return metrics;
+#if defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+
+        // Bit shift is possible without loss because we use FT_LOAD_FORCE_AUTOHINT flag
+        metrics.advance = static_cast<float>(face->glyph->advance.x >> 6);
+        if (bold)
+            metrics.advance += 1;
+
+        metrics.lsbDelta = static_cast<float>(face->glyph->lsb_delta);
+        metrics.rsbDelta = static_cast<float>(face->glyph->rsb_delta);
+        return metrics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::getCachedKerning(MetricsTable& table, char32_t first, char32_t second, bool bold)
+    {
+        // Pairs of ASCII characters are stored in a table that is indexed directly. Other pairs are only stored when they
+        // require a lookup in the kerning table of the font.
+        const std::size_t asciiCount = table.asciiGlyphs.size();
+        const bool asciiPair = (first < asciiCount) && (second < asciiCount);
+        const std::uint64_t pairKey = (static_cast<std::uint64_t>(first) << 32) | second;
+        if (asciiPair)
+        {
+            if (table.asciiKerning.empty())
+                table.asciiKerning.resize(asciiCount * asciiCount, std::numeric_limits<float>::quiet_NaN());
+
+            const float cachedKerning = table.asciiKerning[(first * asciiCount) + second];
+            if (!std::isnan(cachedKerning))
+                return cachedKerning;
+        }
+
+        if (!setCurrentSize(table.characterSize))
+            return 0;
+
+        // With fallback fonts, the pairs are also cached because the characters might come from a font with kerning
+        const bool cachePairs = FT_HAS_KERNING(m_face) || !m_fallbackFaces.empty();
+        if (!asciiPair && cachePairs)
+        {
+            const auto it = table.kerningPairs.find(pairKey);
+            if (it != table.kerningPairs.end())
+                return it->second;
+        }
+
+        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
+        const GlyphMetrics& firstMetrics = getGlyphMetrics(table, first, bold);
+        const float firstRsbDelta = firstMetrics.rsbDelta;
+        const FT_UInt firstIndex = firstMetrics.glyphIndex;
+        const std::size_t firstFaceIndex = firstMetrics.faceIndex;
+        const GlyphMetrics& secondMetrics = getGlyphMetrics(table, second, bold);
+        const float secondLsbDelta = secondMetrics.lsbDelta;
+        const FT_UInt secondIndex = secondMetrics.glyphIndex;
+        const std::size_t secondFaceIndex = secondMetrics.faceIndex;
+
+        // Get the kerning vector if present. The kerning table only applies to glyphs from the same font.
+        const FT_Face face = getFace(firstFaceIndex);
+        FT_Vector kerning;
+        kerning.x = kerning.y = 0;
+        if ((firstFaceIndex == secondFaceIndex) && FT_HAS_KERNING(face) && setFaceSize(face, table.characterSize))
+            FT_Get_Kerning(face, firstIndex, secondIndex, FT_KERNING_UNFITTED, &kerning);
+
+        // X advance is already in pixels for bitmap fonts.
+        // Otherwise combine kerning with compensation deltas and return the X advance.
         // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
-        return std::floor((secondLsbDelta - firstRsbDelta + kerning.x + 32) / 64.f);
+        float result;
+        if (!FT_IS_SCALABLE(face))
+            result = static_cast<float>(kerning.x);
+        else
+            result = std::floor((secondLsbDelta - firstRsbDelta + kerning.x + 32) / 64.f);
+
+        if (asciiPair)
+            table.asciiKerning[(first * asciiCount) + second] = result;
+        else if (cachePairs)
+        {
+            // Don't let the cache grow without limit for texts that contain a huge amount of different characters
+            const std::size_t maxKerningPairs = 16384;
+            if (table.kerningPairs.size() >= maxKerningPairs)
+                table.kerningPairs.clear();
+
+            table.kerningPairs[pairKey] = result;
+        }
+
+        return result;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float BackendFontFreetype::getLineSpacing(unsigned int characterSize)
     {
+        std::lock_guard<std::mutex> lock(m_mutex);
         const auto it = m_cachedLineSpacing.find(characterSize);
         if (it != m_cachedLineSpacing.end())
             return it->second;
 
-        if (!m_face || !setCurrentSize(characterSize))
+        if (m_usesPrebakedGlyphs)
+        {
+            if (const auto* prebakedSize = findPrebakedSize(characterSize))
+                return prebakedSize->lineSpacing;
+        }
+
+        if (!setCurrentSize(characterSize))
             return 0;
 
         return m_face->size->metrics.height / 64.f;
@@ -424,7 +1221,14 @@ namespace tgui
 
     float BackendFontFreetype::getUnderlinePosition(unsigned int characterSize)
     {
-        if (!m_face || !setCurrentSize(characterSize))
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_usesPrebakedGlyphs)
+        {
+            if (const auto* prebakedSize = findPrebakedSize(characterSize))
+                return prebakedSize->underlinePosition;
+        }
+
+        if (!setCurrentSize(characterSize))
             return 0;
 
         // Return a fixed position if font is a bitmap font
@@ -438,7 +1242,14 @@ namespace tgui
 
     float BackendFontFreetype::getUnderlineThickness(unsigned int characterSize)
     {
-        if (!m_face || !setCurrentSize(characterSize))
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_usesPrebakedGlyphs)
+        {
+            if (const auto* prebakedSize = findPrebakedSize(characterSize))
+                return prebakedSize->underlineThickness;
+        }
+
+        if (!setCurrentSize(characterSize))
             return 0;
 
         // Return a fixed thickness if font is a bitmap font
@@ -450,34 +1261,381 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int)
+    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int characterSize)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_maximumTextureSize == 0)
+            m_maximumTextureSize = getBackend()->getRenderer()->getMaximumTextureSize();
+
+        Page& page = getPage(usesDistanceField(characterSize) ? distanceFieldReferenceSize : characterSize);
+        page.lastUsed = ++m_useCounter;
+
+        if (page.texture)
+        {
+            if (page.dirtyRowsTop == page.dirtyRowsBottom)
+                return page.texture;
+
+            // Upload the rows in which new glyphs were placed. If the texture can't be updated then it is recreated instead.
+            const UIntRect region{0, page.dirtyRowsTop, page.textureSize, page.dirtyRowsBottom - page.dirtyRowsTop};
+            if (page.texture->updateRegion(region, &page.pixels[static_cast<std::size_t>(page.dirtyRowsTop) * page.textureSize]))
+            {
+                m_uploadedTextureBytes += static_cast<std::size_t>(region.width) * region.height;
+                page.dirtyRowsTop = 0;
+                page.dirtyRowsBottom = 0;
+                return page.texture;
+            }
+        }
+
+        // Distance fields always need the smooth filter, the edges are reconstructed from the interpolated distances
+        page.texture = getBackend()->getRenderer()->createTexture();
+        const unsigned int textureHeight = page.textureSize * static_cast<unsigned int>(page.sheets.size());
+        page.texture->loadAlphaTextureOnly({page.textureSize, textureHeight}, page.pixels.get(), m_isSmooth || page.distanceField);
+        page.texture->setDistanceField(page.distanceField);
+        m_uploadedTextureBytes += static_cast<std::size_t>(page.textureSize) * textureHeight;
+        page.dirtyRowsTop = 0;
+        page.dirtyRowsBottom = 0;
+        return page.texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t BackendFontFreetype::getGlyphGeneration(unsigned int characterSize) const
     {
-        if (m_texture)
-            return m_texture;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto it = m_pages.find(usesDistanceField(characterSize) ? distanceFieldReferenceSize : characterSize);
+        if (it != m_pages.end())
+            return it->second.generation;
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::markSheetsDrawn(unsigned int characterSize, std::uint64_t sheets)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto it = m_pages.find(usesDistanceField(characterSize) ? distanceFieldReferenceSize : characterSize);
+        if (it == m_pages.end())
+            return;
+
+        Page& page = it->second;
+        page.lastUsed = ++m_useCounter;
+        for (std::size_t i = 0; i < page.sheets.size(); ++i)
+        {
+            if ((sheets >> i) & 1)
+                page.sheets[i].lastUsed = m_useCounter;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::getUploadedTextureBytes() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_uploadedTextureBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setMemoryBudget(std::size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_memoryBudget = bytes;
+        evictPages(0, nullptr, std::numeric_limits<std::uint64_t>::max());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::getMemoryBudget() const
+    {
+        return m_memoryBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setMaximumPageSize(unsigned int size)
+    {
+        TGUI_ASSERT(size >= 16, "Maximum page size in BackendFontFreetype must be at least 16");
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_maximumPageSize = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFontFreetype::getMaximumPageSize() const
+    {
+        return m_maximumPageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::AtlasStatistics BackendFontFreetype::getAtlasStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        AtlasStatistics statistics;
+        statistics.pages = m_pages.size();
+        statistics.bytesInUse = getBytesInUse();
+        statistics.evictedGlyphs = m_evictedGlyphs;
+        statistics.evictedPages = m_evictedPages;
+        for (const auto& pair : m_pages)
+        {
+            statistics.sheets += pair.second.sheets.size();
+            statistics.glyphs += pair.second.glyphs.size();
+        }
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setPrebakedDefaultFontEnabled(bool enabled)
+    {
+        m_prebakedDefaultFontEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::isPrebakedDefaultFontEnabled()
+    {
+        return m_prebakedDefaultFontEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setDistanceFieldEnabled(bool enabled)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_distanceFieldEnabled == enabled)
+            return;
 
-        m_texture = getBackend()->getRenderer()->createTexture();
-        m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth);
-        return m_texture;
+        // The existing pages contain glyphs of the other mode. Texts notice that their pages are gone when they are drawn.
+        m_distanceFieldEnabled = enabled;
+        m_pages.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::isDistanceFieldEnabled() const
+    {
+        return m_distanceFieldEnabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendFontFreetype::setSmooth(bool smooth)
     {
+        std::lock_guard<std::mutex> lock(m_mutex);
         BackendFont::setSmooth(smooth);
-        if (m_texture)
-            m_texture->setSmooth(m_isSmooth);
+        for (auto& pair : m_pages)
+        {
+            if (pair.second.texture && !pair.second.distanceField)
+                pair.second.texture->setSmooth(m_isSmooth);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool BackendFontFreetype::setCurrentSize(unsigned int characterSize)
+    bool BackendFontFreetype::usesDistanceField(unsigned int characterSize) const
+    {
+        return m_distanceFieldEnabled && (characterSize >= distanceFieldMinimumSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::addPrebakedGlyphs(Page& page, unsigned int characterSize)
+    {
+        const defaultFontAtlas::CharacterSize* prebakedSize = findPrebakedSize(characterSize);
+        if (!prebakedSize)
+            return;
+
+        RasterizedGlyph rasterizedGlyph;
+        for (std::size_t i = 0; i < prebakedSize->glyphCount; ++i)
+        {
+            const defaultFontAtlas::GlyphBitmap& bitmap = prebakedSize->glyphs[i];
+            const defaultFontAtlas::GlyphMetrics& metrics = prebakedSize->metrics[bitmap.codePoint];
+            rasterizedGlyph.glyph.advance = metrics.advance;
+            rasterizedGlyph.glyph.lsbDelta = metrics.lsbDelta;
+            rasterizedGlyph.glyph.rsbDelta = metrics.rsbDelta;
+            rasterizedGlyph.glyph.bounds = {static_cast<float>(bitmap.left), static_cast<float>(bitmap.top),
+                                            static_cast<float>(bitmap.width), static_cast<float>(bitmap.height)};
+            rasterizedGlyph.width = bitmap.width;
+            rasterizedGlyph.height = bitmap.height;
+
+            const unsigned char* pixels = prebakedSize->pixels + bitmap.pixelsOffset;
+            rasterizedGlyph.pixels.assign(pixels, pixels + (static_cast<std::size_t>(bitmap.width) * bitmap.height));
+
+            page.glyphs.insert({constructGlyphKey(bitmap.codePoint, characterSize, false, 0), placeGlyph(page, rasterizedGlyph, false)});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::addPrebakedMetrics(MetricsTable& table, bool bold)
     {
-        // Don't call FT_Set_Pixel_Sizes if we don't have to
-        if (characterSize == m_face->size->metrics.x_ppem)
+        const defaultFontAtlas::CharacterSize* prebakedSize = findPrebakedSize(table.characterSize);
+        if (!prebakedSize || bold)
+            return;
+
+        for (char32_t codePoint = 0; codePoint < 256; ++codePoint)
+        {
+            // Characters that are missing in the default font might be taken from a fallback font instead
+            const defaultFontAtlas::GlyphMetrics& prebakedMetrics = prebakedSize->metrics[codePoint];
+            if ((prebakedMetrics.glyphIndex == 0) && !m_fallbackFaces.empty())
+                continue;
+
+            GlyphMetrics& metrics = (codePoint < table.asciiGlyphs.size()) ? table.asciiGlyphs[codePoint] : table.otherGlyphs[codePoint];
+            metrics.advance = prebakedMetrics.advance;
+            metrics.lsbDelta = prebakedMetrics.lsbDelta;
+            metrics.rsbDelta = prebakedMetrics.rsbDelta;
+            metrics.glyphIndex = prebakedMetrics.glyphIndex;
+            metrics.loaded = true;
+        }
+
+        const std::size_t asciiCount = table.asciiGlyphs.size();
+        table.asciiKerning.resize(asciiCount * asciiCount);
+        for (std::size_t i = 0; i < asciiCount * asciiCount; ++i)
+        {
+            if (!table.asciiGlyphs[i / asciiCount].loaded || !table.asciiGlyphs[i % asciiCount].loaded)
+                table.asciiKerning[i] = std::numeric_limits<float>::quiet_NaN();
+            else
+                table.asciiKerning[i] = prebakedSize->asciiKerning[i];
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::findFaceIndex(char32_t codePoint) const
+    {
+        // Without fallback fonts, the coverage table isn't needed as all characters are taken from this font
+        if (m_fallbackFaces.empty() || !loadFace() || getCoverage().contains(codePoint))
+            return 0;
+
+        for (std::size_t i = 0; i < m_fallbackFaces.size(); ++i)
+        {
+            if (m_fallbackFaces[i].coverage.contains(codePoint))
+                return i + 1;
+        }
+
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FT_Face BackendFontFreetype::getFace(std::size_t faceIndex) const
+    {
+        return (faceIndex > 0) ? m_fallbackFaces[faceIndex - 1].face : m_face;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const BackendFontFreetype::GlyphCoverage& BackendFontFreetype::getCoverage() const
+    {
+        if (m_coverage.blocks.empty() && m_face)
+            buildCoverage(m_face, m_coverage);
+
+        return m_coverage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::buildCoverage(FT_Face face, GlyphCoverage& coverage)
+    {
+        const std::size_t blockCount = 0x110000 / 256;
+        coverage.blocks.assign(blockCount, 0);
+        coverage.bitmaps.clear();
+
+        FT_UInt glyphIndex;
+        FT_ULong codePoint = FT_Get_First_Char(face, &glyphIndex);
+        while (glyphIndex != 0)
+        {
+            const std::size_t block = codePoint >> 8;
+            if (block >= blockCount)
+                break;
+
+            if (coverage.blocks[block] == 0)
+            {
+                coverage.bitmaps.push_back({});
+                coverage.blocks[block] = static_cast<std::uint16_t>(coverage.bitmaps.size());
+            }
+
+            const std::size_t bit = codePoint & 0xFF;
+            coverage.bitmaps[coverage.blocks[block] - 1u][bit >> 6] |= (static_cast<std::uint64_t>(1) << (bit & 63));
+            codePoint = FT_Get_Next_Char(face, codePoint, &glyphIndex);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setFallbackFonts(const std::vector<std::shared_ptr<BackendFont>>& fonts)
+    {
+        // Take the data from the other fonts before locking the mutex of this font, so that the two mutexes are never locked
+        // at the same time (which could cause a deadlock when two fonts are each others fallback)
+        std::vector<std::pair<std::shared_ptr<const std::uint8_t>, std::size_t>> fallbackContents;
+        for (const auto& font : fonts)
+        {
+            const auto freetypeFont = std::dynamic_pointer_cast<BackendFontFreetype>(font);
+            if (!freetypeFont || (freetypeFont.get() == this))
+                continue;
+
+            std::lock_guard<std::mutex> lock(freetypeFont->m_mutex);
+            if (freetypeFont->m_fileContents)
+                fallbackContents.emplace_back(freetypeFont->m_fileContents, freetypeFont->m_fileSize);
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        clearFallbackFaces();
+        for (auto& contents : fallbackContents)
+        {
+            FallbackFace fallbackFace;
+            if (!openFace(contents.first.get(), contents.second, fallbackFace.library, fallbackFace.face))
+                continue;
+
+            buildCoverage(fallbackFace.face, fallbackFace.coverage);
+            fallbackFace.fileContents = std::move(contents.first);
+            fallbackFace.fileSize = contents.second;
+            m_fallbackFaces.push_back(std::move(fallbackFace));
+        }
+
+        // Characters that were missing may now be taken from another font. Texts notice that their pages are gone when drawn.
+        m_pages.clear();
+        m_metricsTables.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::clearFallbackFaces()
+    {
+        for (const auto& fallbackFace : m_fallbackFaces)
+        {
+            if (fallbackFace.stroker)
+                FT_Stroker_Done(fallbackFace.stroker);
+
+            FT_Done_Face(fallbackFace.face);
+            FT_Done_FreeType(fallbackFace.library);
+        }
+
+        m_fallbackFaces.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::loadFace() const
+    {
+        if (m_face)
             return true;
 
-        return (FT_Set_Pixel_Sizes(m_face, 0, characterSize) == FT_Err_Ok);
+        // The face is only missing when the font wasn't loaded or when it uses prebaked glyphs and FreeType wasn't needed yet
+        if (!m_usesPrebakedGlyphs)
+            return false;
+
+        return openFace(m_fileContents.get(), m_fileSize, m_library, m_face);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::setCurrentSize(unsigned int characterSize)
+    {
+        return loadFace() && setFaceSize(m_face, characterSize);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -48,6 +48,13 @@ namespace tgui
             m_backendRenderTarget = std::make_shared<BackendRenderTargetGLES2>();
             setGuiWindow(window);
         }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int Gui::queryBackBufferAge() const
+        {
+            return BackendRenderTargetGLES2::queryBackBufferAge();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,9 +25,13 @@
 
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #include <TGUI/Backend/Renderer/BackendText.hpp>
-#include <TGUI/Widget.hpp>
+#include <TGUI/Backend/Font/BackendFont.hpp>
+#include <TGUI/Backend/Window/Backend.hpp>
+#include <TGUI/Container.hpp>
 #include <array>
 #include <cmath>
+#include <cstring>
+#include <unordered_map>
 
 #if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
     #include <numbers>
@@ -39,132 +43,398 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static std::vector<Vector2f> drawCircleHelperGetPoints(int nrPoints, float radius, float offset)
+    namespace priv
     {
+        // Points on a unit circle and the indices that are needed to triangulate circles and rounded rectangles. Drawing a shape
+        // only has to scale and translate these points, it doesn't have to calculate sines and cosines or allocate memory.
+        struct ShapeTessellationCache
+        {
+            struct Shape
+            {
+                std::vector<Vector2f> unitPoints; // Offset of each point on the outline, relative to the center of its arc
+                std::vector<int> fillIndices;     // Triangles between the center point and the points on the outline
+                std::vector<int> borderIndices;   // Triangles between the outer and inner outline of the borders
+            };
+
+            const Shape& getCircle(int nrPoints);
+            const Shape& getRoundedRectangle(int nrCornerPoints);
+
+            std::unordered_map<int, Shape> circles;            // Keyed by amount of points on the circle
+            std::unordered_map<int, Shape> roundedRectangles;  // Keyed by amount of points per corner
+            std::vector<Vertex> vertices;                       // Reused each time a shape is drawn
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // The amount of points depends on the size of the shape, so there is a limit on how many different shapes are remembered
+    static const std::size_t maxCachedShapes = 64;
+
 #if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
-        const float twoPi = 2.f * std::numbers::pi_v<float>;
+    static const float twoPi = 2.f * std::numbers::pi_v<float>;
 #else
-        const float twoPi = 2.f * 3.14159265359f;
+    static const float twoPi = 2.f * 3.14159265359f;
 #endif
-        std::vector<Vector2f> points;
-        points.reserve(nrPoints);
 
-        for (int i = 0; i < nrPoints; ++i)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void fillShapeIndices(priv::ShapeTessellationCache::Shape& shape)
+    {
+        const std::size_t nrPoints = shape.unitPoints.size();
+
+        // The first vertex is the center point, the others are the points on the outline
+        shape.fillIndices.reserve(3 * nrPoints);
+        for (std::size_t i = 1; i <= nrPoints; ++i)
         {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * i / nrPoints)),
-                                offset + radius + (radius * std::sin(twoPi * i / nrPoints)));
+            shape.fillIndices.push_back(0); // Center point
+            shape.fillIndices.push_back(static_cast<int>(i));
+            shape.fillIndices.push_back(static_cast<int>(i+1));
         }
+        shape.fillIndices.back() = 1; // Last index was one too far and should use the first point again, to close the circle
+
+        // The vertices of the outer outline come first, followed by the vertices of the inner outline
+        shape.borderIndices.reserve(6 * nrPoints);
+        for (std::size_t i = 0; i < nrPoints; ++i)
+        {
+            shape.borderIndices.push_back(static_cast<int>(i));
+            shape.borderIndices.push_back(static_cast<int>(i+1));
+            shape.borderIndices.push_back(static_cast<int>(nrPoints + i));
 
-        return points;
+            shape.borderIndices.push_back(static_cast<int>(nrPoints + i));
+            shape.borderIndices.push_back(static_cast<int>(nrPoints + i+1));
+            shape.borderIndices.push_back(static_cast<int>(i+1));
+        }
+
+        // The last two triangles were given wrong indices by the loop (where there are "+1" in the code), and need to be overwitten to close the circle
+        const std::size_t nrIndices = shape.borderIndices.size();
+        shape.borderIndices[nrIndices - 1] = 0;
+        shape.borderIndices[nrIndices - 2] = static_cast<int>(nrPoints);
+        shape.borderIndices[nrIndices - 5] = 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static std::vector<Vector2f> drawRoundedRectHelperGetPoints(const int nrCornerPoints, const Vector2f& size, float radius, float offset)
+    const priv::ShapeTessellationCache::Shape& priv::ShapeTessellationCache::getCircle(int nrPoints)
     {
-#if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
-        const float twoPi = 2.f * std::numbers::pi_v<float>;
-#else
-        const float twoPi = 2.f * 3.14159265359f;
-#endif
-        std::vector<Vector2f> points;
-        points.reserve(nrCornerPoints * 4);
+        const auto it = circles.find(nrPoints);
+        if (it != circles.end())
+            return it->second;
+
+        if (circles.size() >= maxCachedShapes)
+            circles.clear();
+
+        Shape& shape = circles[nrPoints];
+        shape.unitPoints.reserve(nrPoints);
+        for (int i = 0; i < nrPoints; ++i)
+            shape.unitPoints.emplace_back(std::cos(twoPi * i / nrPoints), std::sin(twoPi * i / nrPoints));
+
+        fillShapeIndices(shape);
+        return shape;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const priv::ShapeTessellationCache::Shape& priv::ShapeTessellationCache::getRoundedRectangle(int nrCornerPoints)
+    {
+        const auto it = roundedRectangles.find(nrCornerPoints);
+        if (it != roundedRectangles.end())
+            return it->second;
 
-        const int nrPointsInCircle = 4 * (nrCornerPoints - 1);
+        if (roundedRectangles.size() >= maxCachedShapes)
+            roundedRectangles.clear();
 
-        // Top right corner
-        for (int i = 0; i < nrCornerPoints; ++i)
+        Shape& shape = roundedRectangles[nrCornerPoints];
+        shape.unitPoints.reserve(4 * nrCornerPoints);
+        if (nrCornerPoints > 1)
         {
-            points.emplace_back(offset + size.x - radius + (radius * std::cos(twoPi * i / nrPointsInCircle)),
-                                offset + radius - (radius * std::sin(twoPi * i / nrPointsInCircle)));
+            // The corners are stored counterclockwise, starting with the top right corner
+            const int nrPointsInCircle = 4 * (nrCornerPoints - 1);
+            for (int corner = 0; corner < 4; ++corner)
+            {
+                for (int i = 0; i < nrCornerPoints; ++i)
+                {
+                    const int pointIndex = corner * (nrCornerPoints - 1) + i;
+                    shape.unitPoints.emplace_back(std::cos(twoPi * pointIndex / nrPointsInCircle), -std::sin(twoPi * pointIndex / nrPointsInCircle));
+                }
+            }
         }
+        else // The radius is too small to be visible, so there is a single point in each corner of the rectangle
+        {
+            shape.unitPoints.emplace_back(1.f, -1.f);
+            shape.unitPoints.emplace_back(-1.f, -1.f);
+            shape.unitPoints.emplace_back(-1.f, 1.f);
+            shape.unitPoints.emplace_back(1.f, 1.f);
+        }
+
+        fillShapeIndices(shape);
+        return shape;
+    }
 
-        // Top left corner
-        for (int i = 0; i < nrCornerPoints; ++i)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void setCircleOutlineVertices(Vertex* vertices, const priv::ShapeTessellationCache::Shape& shape, float radius, float offset, const Color& color)
+    {
+        const Vertex::Color vertexColor(color);
+        for (std::size_t i = 0; i < shape.unitPoints.size(); ++i)
         {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * ((nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + radius - (radius * std::sin(twoPi * ((nrCornerPoints - 1) + i) / nrPointsInCircle)));
+            vertices[i] = {{offset + radius + (radius * shape.unitPoints[i].x), offset + radius + (radius * shape.unitPoints[i].y)},
+                           vertexColor};
         }
+    }
 
-        // Bottom left corner
-        for (int i = 0; i < nrCornerPoints; ++i)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void setRoundedRectOutlineVertices(Vertex* vertices, const priv::ShapeTessellationCache::Shape& shape, int nrCornerPoints,
+                                              const Vector2f& size, float radius, float offset, const Color& color)
+    {
+        const std::array<Vector2f, 4> cornerCenters = {{
+            {offset + size.x - radius, offset + radius},
+            {offset + radius, offset + radius},
+            {offset + radius, offset + size.y - radius},
+            {offset + size.x - radius, offset + size.y - radius}
+        }};
+
+        const Vertex::Color vertexColor(color);
+        for (std::size_t i = 0; i < shape.unitPoints.size(); ++i)
         {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * (2*(nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + size.y - radius - (radius * std::sin(twoPi * (2*(nrCornerPoints - 1) + i) / nrPointsInCircle)));
+            const Vector2f& center = cornerCenters[i / static_cast<std::size_t>(nrCornerPoints)];
+            vertices[i] = {{center.x + (radius * shape.unitPoints[i].x), center.y + (radius * shape.unitPoints[i].y)}, vertexColor};
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Bottom right corner
-        for (int i = 0; i < nrCornerPoints; ++i)
+    // The vertices consist of the center point, the inner outline in the background color, and the outer and inner outline in
+    // the border color. The borders are only drawn when the border vertices have been set.
+    static void drawTessellatedShape(BackendRenderTarget* renderTarget, const RenderStates& states, const priv::ShapeTessellationCache::Shape& shape,
+                                     const std::vector<Vertex>& vertices, bool drawBorders)
+    {
+        const std::size_t nrPoints = shape.unitPoints.size();
+        if (drawBorders)
         {
-            points.emplace_back(offset + size.x - radius + (radius * std::cos(twoPi * (3*(nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + size.y - radius - (radius * std::sin(twoPi * (3*(nrCornerPoints - 1) + i) / nrPointsInCircle)));
+            renderTarget->drawVertexArray(states, vertices.data() + 1 + nrPoints, 2 * nrPoints,
+                                          shape.borderIndices.data(), shape.borderIndices.size(), nullptr);
         }
 
-        return points;
+        renderTarget->drawVertexArray(states, vertices.data(), 1 + nrPoints, shape.fillIndices.data(), shape.fillIndices.size(), nullptr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void drawBordersAroundShape(BackendRenderTarget* renderTarget, const RenderStates& states,
-                                       const std::vector<Vector2f>& outerPoints, const std::vector<Vector2f>& innerPoints, const Color& color)
+    namespace priv
+    {
+        // Draw commands that were recorded for a widget while the render target was in retained mode
+        struct RecordedDrawCommands
+        {
+            enum class Type
+            {
+                VertexArray,
+                AddClippingLayer,
+                RemoveClippingLayer,
+                Widget
+            };
+
+            struct Command
+            {
+                Type type;
+                RenderStates states;
+                FloatRect clipRect;
+                std::size_t vertexOffset = 0;
+                std::size_t vertexCount = 0;
+                std::size_t indexOffset = 0;
+                std::size_t indexCount = 0;
+                std::shared_ptr<BackendTexture> texture;
+                std::weak_ptr<Widget> widget;
+            };
+
+            // Text vertices are only valid as long as the font keeps using the same texture and doesn't evict glyphs from it
+            struct FontDependency
+            {
+                std::shared_ptr<BackendFont> font;
+                unsigned int characterSize;
+                const BackendTexture* texture;
+                std::uint64_t glyphGeneration;
+            };
+
+            Transform transform;
+            std::vector<Command> commands;
+            std::vector<Vertex> vertices;
+            std::vector<int> indices;
+            std::vector<FontDependency> fontDependencies;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+    // Render target that is passed to a widget while recording its draw commands. Everything is stored and forwarded to the
+    // real render target, so that the widget still shows up on the screen in the frame where it is being recorded.
+    class RecordingRenderTarget : public BackendRenderTarget
     {
-        TGUI_ASSERT(outerPoints.size() == innerPoints.size(), "Inner and outer ring of cicle border should have the same amount of points");
+    public:
+        RecordingRenderTarget(BackendRenderTarget& target, priv::RecordedDrawCommands& recording) :
+            m_target(target),
+            m_recording(recording)
+        {
+        }
 
-        // Create the vertices
-        std::vector<Vertex> vertices;
-        vertices.reserve(outerPoints.size() + innerPoints.size());
-        for (std::size_t i = 0; i < outerPoints.size(); ++i)
-            vertices.push_back({outerPoints[i], Vertex::Color(color)});
-        for (std::size_t i = 0; i < innerPoints.size(); ++i)
-            vertices.push_back({innerPoints[i], Vertex::Color(color)});
+        void setClearColor(const Color&) override
+        {
+        }
 
-        // Create the indices
-        std::vector<int> indices;
-        indices.reserve(3 * (outerPoints.size() + innerPoints.size()));
-        for (std::size_t i = 0; i < outerPoints.size(); ++i)
+        void clearScreen() override
         {
-            indices.push_back(static_cast<int>(i));
-            indices.push_back(static_cast<int>(i+1));
-            indices.push_back(static_cast<int>(outerPoints.size() + i));
+        }
 
-            indices.push_back(static_cast<int>(outerPoints.size() + i));
-            indices.push_back(static_cast<int>(outerPoints.size() + i+1));
-            indices.push_back(static_cast<int>(i+1));
+        void drawGui(const std::shared_ptr<RootContainer>&) override
+        {
+            TGUI_ASSERT(false, "drawGui can't be called while recording the draw commands of a widget");
         }
 
-        // The last two triangles were given wrong indices by the loop (where there are "+1" in the code), and need to be overwitten to close the circle
-        indices[indices.size() - 1] = 0;
-        indices[indices.size() - 2] = static_cast<int>(outerPoints.size());
-        indices[indices.size() - 5] = 0;
+        void drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget) override
+        {
+            // Child widgets have their own recording, we only need to remember where to draw them
+            priv::RecordedDrawCommands::Command command;
+            command.type = priv::RecordedDrawCommands::Type::Widget;
+            command.states = states;
+            command.widget = widget;
+            m_recording.commands.push_back(std::move(command));
+
+            m_target.drawWidget(states, widget);
+        }
+
+        void addClippingLayer(const RenderStates& states, FloatRect rect) override
+        {
+            priv::RecordedDrawCommands::Command command;
+            command.type = priv::RecordedDrawCommands::Type::AddClippingLayer;
+            command.states = states;
+            command.clipRect = rect;
+            m_recording.commands.push_back(std::move(command));
+
+            m_target.addClippingLayer(states, rect);
+        }
+
+        void removeClippingLayer() override
+        {
+            priv::RecordedDrawCommands::Command command;
+            command.type = priv::RecordedDrawCommands::Type::RemoveClippingLayer;
+            m_recording.commands.push_back(std::move(command));
+
+            m_target.removeClippingLayer();
+        }
+
+        void drawSprite(const RenderStates& states, const Sprite& sprite) override
+        {
+#if TGUI_HAS_RENDERER_BACKEND_SFML_GRAPHICS
+            // Sprites with a shader are drawn by the SFML render target itself, so we can't record them
+            if (sprite.isSet() && sprite.getTexture().getShader())
+            {
+                m_reusable = false;
+                m_target.drawSprite(states, sprite);
+                return;
+            }
+#endif
+            BackendRenderTarget::drawSprite(states, sprite);
+        }
+
+        void drawText(const RenderStates& states, const Text& text) override
+        {
+            BackendRenderTarget::drawText(states, text);
+
+            const auto& backendText = text.getBackendText();
+            std::shared_ptr<BackendFont> font = backendText->getFont();
+            if (font)
+            {
+                const unsigned int characterSize = backendText->getCharacterSize();
+                const BackendTexture* texture = font->getTexture(characterSize).get();
+                const std::uint64_t glyphGeneration = font->getGlyphGeneration(characterSize);
+                m_recording.fontDependencies.push_back({std::move(font), characterSize, texture, glyphGeneration});
+            }
+        }
+
+        void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                             const int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override
+        {
+            priv::RecordedDrawCommands::Command command;
+            command.type = priv::RecordedDrawCommands::Type::VertexArray;
+            command.states = states;
+            command.vertexOffset = m_recording.vertices.size();
+            command.vertexCount = vertexCount;
+            command.indexOffset = m_recording.indices.size();
+            command.indexCount = indexCount;
+            command.texture = texture;
+            m_recording.commands.push_back(std::move(command));
+
+            m_recording.vertices.insert(m_recording.vertices.end(), vertices, vertices + vertexCount);
+            if (indices)
+                m_recording.indices.insert(m_recording.indices.end(), indices, indices + indexCount);
+
+            m_target.drawVertexArray(states, vertices, vertexCount, indices, indexCount, texture);
+        }
+
+        bool isReusable() const
+        {
+            return m_reusable;
+        }
+
+    protected:
 
-        // Draw the triangles
-        renderTarget->drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
+        void updateClipping(FloatRect, FloatRect) override
+        {
+        }
+
+    private:
+        BackendRenderTarget& m_target;
+        priv::RecordedDrawCommands& m_recording;
+        bool m_reusable = true;
+    };
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void drawInnerShape(BackendRenderTarget* renderTarget, const RenderStates& states, const std::vector<Vector2f>& points, const Vector2f& centerPoint, const Color& color)
+    static bool canReplayDrawCommands(const priv::RecordedDrawCommands& recording, const RenderStates& states)
     {
-        // Create the vertices (one point in the middle of the circle and the others as provided in the 'points' parameter)
-        std::vector<Vertex> vertices;
-        vertices.reserve(1 + points.size());
-        vertices.push_back({centerPoint, Vertex::Color(color)});
-        for (std::size_t i = 0; i < points.size(); ++i)
-            vertices.push_back({points[i], Vertex::Color(color)});
+        // The recorded vertices are only valid if the widget is drawn at exactly the same location as before
+        if (std::memcmp(recording.transform.getMatrix(), states.transform.getMatrix(), 16 * sizeof(float)) != 0)
+            return false;
 
-        // Create the indices
-        std::vector<int> indices;
-        indices.reserve(3 * points.size());
-        for (std::size_t i = 1; i <= points.size(); ++i)
+        for (const auto& dependency : recording.fontDependencies)
         {
-            indices.push_back(0); // Center point
-            indices.push_back(static_cast<int>(i));
-            indices.push_back(static_cast<int>(i+1));
+            if (dependency.font->getTexture(dependency.characterSize).get() != dependency.texture)
+                return false;
+            if (dependency.font->getGlyphGeneration(dependency.characterSize) != dependency.glyphGeneration)
+                return false;
         }
-        indices.back() = 1; // Last index was one too far and should use the first point again, to close the circle
 
-        // Draw the triangles
-        renderTarget->drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void replayDrawCommands(BackendRenderTarget& target, const priv::RecordedDrawCommands& recording)
+    {
+        for (const auto& command : recording.commands)
+        {
+            switch (command.type)
+            {
+            case priv::RecordedDrawCommands::Type::VertexArray:
+                target.drawVertexArray(command.states, &recording.vertices[command.vertexOffset], command.vertexCount,
+                                       (command.indexCount > 0) ? &recording.indices[command.indexOffset] : nullptr,
+                                       command.indexCount, command.texture);
+                break;
+            case priv::RecordedDrawCommands::Type::AddClippingLayer:
+                target.addClippingLayer(command.states, command.clipRect);
+                break;
+            case priv::RecordedDrawCommands::Type::RemoveClippingLayer:
+                target.removeClippingLayer();
+                break;
+            case priv::RecordedDrawCommands::Type::Widget:
+                if (const auto widget = command.widget.lock())
+                    target.drawWidget(command.states, widget);
+                break;
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -190,7 +460,251 @@ namespace tgui
          || (widgetBottomRight.x < clipRect.left) || (widgetBottomRight.y < clipRect.top))
             return;
 
-        widget->draw(*this, states);
+        if (widget->isContainer() && static_cast<Container&>(*widget).m_renderCached && isOffscreenRenderingSupported())
+        {
+            drawRenderCachedContainer(states, static_cast<Container&>(*widget));
+            return;
+        }
+
+        if (!m_retainedModeEnabled)
+        {
+            widget->draw(*this, states);
+            return;
+        }
+
+        if (widget->m_drawCacheValid && widget->m_drawCache && canReplayDrawCommands(*widget->m_drawCache, states))
+        {
+            ++m_retainedModeStatistics.cacheHits;
+            replayDrawCommands(*this, *widget->m_drawCache);
+            return;
+        }
+
+        ++m_retainedModeStatistics.cacheMisses;
+
+        // Draw the widget while recording everything that it draws. The memory of the previous recording is reused.
+        if (widget->m_drawCache)
+        {
+            widget->m_drawCache->commands.clear();
+            widget->m_drawCache->vertices.clear();
+            widget->m_drawCache->indices.clear();
+            widget->m_drawCache->fontDependencies.clear();
+        }
+        else
+            widget->m_drawCache = std::make_shared<priv::RecordedDrawCommands>();
+
+        widget->m_drawCache->transform = states.transform;
+
+        // The recorder shares the points and indices that were already calculated for drawing shapes
+        getShapeTessellationCache();
+        RecordingRenderTarget recorder{*this, *widget->m_drawCache};
+        recorder.m_shapeTessellationCache = m_shapeTessellationCache;
+        widget->draw(recorder, states);
+        widget->m_drawCacheValid = recorder.isReusable();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::setRetainedModeEnabled(bool enabled)
+    {
+        TGUI_ASSERT(m_clipLayers.empty(), "You can't change the retained mode of the render target during drawing");
+        m_retainedModeEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::isRetainedModeEnabled() const
+    {
+        return m_retainedModeEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const BackendRenderTarget::RetainedModeStatistics& BackendRenderTarget::getRetainedModeStatistics() const
+    {
+        return m_retainedModeStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::resetRetainedModeStatistics()
+    {
+        m_retainedModeStatistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::isOffscreenRenderingSupported() const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::beginOffscreenRendering(std::shared_ptr<BackendTexture>& texture, Vector2f size)
+    {
+        TGUI_ASSERT(isOffscreenRenderingSupported(), "BackendRenderTarget::beginOffscreenRendering called on render target that doesn't support it");
+
+        const Vector2u textureSize = getOffscreenTextureSize(size);
+        if ((textureSize.x == 0) || (textureSize.y == 0))
+            return false;
+
+        if (!texture || (texture->getSize() != textureSize))
+        {
+            if (isBackendSet() && getBackend()->hasRenderer())
+            {
+                const unsigned int maxTextureSize = getBackend()->getRenderer()->getMaximumTextureSize();
+                if ((textureSize.x > maxTextureSize) || (textureSize.y > maxTextureSize))
+                    return false;
+            }
+
+            texture = createOffscreenTexture(textureSize);
+            if (!texture)
+                return false;
+        }
+
+        m_offscreenStates.push_back({m_viewRect, m_viewport, m_targetSize, std::move(m_clipLayers), std::move(m_offscreenTexture)});
+        m_clipLayers.clear();
+
+        // The view is chosen so that one pixel in the texture has the same size as one pixel on the window
+        const Vector2f scale{m_viewport.width / m_viewRect.width, m_viewport.height / m_viewRect.height};
+        m_viewRect = {0, 0, textureSize.x / scale.x, textureSize.y / scale.y};
+        m_viewport = {0, 0, static_cast<float>(textureSize.x), static_cast<float>(textureSize.y)};
+        m_targetSize = Vector2f{textureSize};
+        m_offscreenTexture = texture;
+
+        setOffscreenTexture(m_offscreenTexture, true);
+        updateClipping(m_viewRect, m_viewport);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::endOffscreenRendering()
+    {
+        TGUI_ASSERT(!m_offscreenStates.empty(), "BackendRenderTarget::endOffscreenRendering called without matching beginOffscreenRendering");
+        TGUI_ASSERT(m_clipLayers.empty(), "Every clipping layer added during offscreen rendering has to be removed before it ends");
+
+        OffscreenState& state = m_offscreenStates.back();
+        m_viewRect = state.viewRect;
+        m_viewport = state.viewport;
+        m_targetSize = state.targetSize;
+        m_clipLayers = std::move(state.clipLayers);
+        m_offscreenTexture = std::move(state.texture);
+        m_offscreenStates.pop_back();
+
+        setOffscreenTexture(m_offscreenTexture, false);
+        if (m_clipLayers.empty())
+            updateClipping(m_viewRect, m_viewport);
+        else
+            updateClipping(m_clipLayers.back().first, m_clipLayers.back().second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawOffscreenTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture)
+    {
+        const Vector2f scale{m_viewport.width / m_viewRect.width, m_viewport.height / m_viewRect.height};
+        const Vector2f size{texture->getSize().x / scale.x, texture->getSize().y / scale.y};
+        const Vertex::Color vertexColor(Color::White);
+        const std::array<Vertex, 4> vertices = {{
+            {{0, 0}, vertexColor, {0, 0}},
+            {{0, size.y}, vertexColor, {0, 1}},
+            {{size.x, 0}, vertexColor, {1, 0}},
+            {{size.x, size.y}, vertexColor, {1, 1}}
+        }};
+        const std::array<int, 2*3> indices = {{
+            0, 1, 2,
+            2, 1, 3
+        }};
+        drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), texture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendRenderTarget::createOffscreenTexture(Vector2u)
+    {
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::setOffscreenTexture(const std::shared_ptr<BackendTexture>&, bool)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendRenderTarget::getOffscreenTextureSize(Vector2f size) const
+    {
+        if ((size.x <= 0) || (size.y <= 0) || (m_viewRect.width <= 0) || (m_viewRect.height <= 0))
+            return {0, 0};
+
+        return {static_cast<unsigned int>(std::ceil(size.x * m_viewport.width / m_viewRect.width)),
+                static_cast<unsigned int>(std::ceil(size.y * m_viewport.height / m_viewRect.height))};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawRenderCachedContainer(const RenderStates& states, Container& container)
+    {
+        Widget& widget = container;
+        const Vector2f size = widget.getFullSize();
+        const bool textureValid = container.m_renderCacheTexture && (container.m_renderCacheTexture->getSize() == getOffscreenTextureSize(size));
+        if (!container.m_renderCacheValid || !textureValid)
+        {
+            // Draw the widgets to the texture, or directly to the window when the texture can't be used
+            if (!beginOffscreenRendering(container.m_renderCacheTexture, size))
+            {
+                container.m_renderCacheTexture = nullptr;
+                widget.draw(*this, states);
+                return;
+            }
+
+            widget.draw(*this, {});
+            endOffscreenRendering();
+            container.m_renderCacheValid = true;
+        }
+
+        drawOffscreenTexture(states, container.m_renderCacheTexture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawGuiPartially(const std::shared_ptr<RootContainer>& root, const std::vector<FloatRect>& rects)
+    {
+        if (rects.empty())
+            return;
+
+        m_partialRedrawRects = &rects;
+        drawGui(root);
+        m_partialRedrawRects = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawRootContainer(const std::shared_ptr<RootContainer>& root)
+    {
+        if (!m_partialRedrawRects)
+        {
+            root->draw(*this, {});
+            return;
+        }
+
+        // Every area is clipped and cleared before drawing the gui in it. Widgets that lie completely outside the clipping
+        // rectangle are skipped by drawWidget, so only the widgets that overlap with the area are drawn again.
+        for (const auto& rect : *m_partialRedrawRects)
+        {
+            addClippingLayer({}, rect);
+            clearClippingArea();
+            root->draw(*this, {});
+            removeClippingLayer();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::clearClippingArea()
+    {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,27 +892,31 @@ namespace tgui
     {
         const float radius = size / 2.f;
         const int nrPoints = static_cast<int>(std::ceil((radius + std::abs(borderThickness)) * 4));
+
+        priv::ShapeTessellationCache& cache = getShapeTessellationCache();
+        const auto& shape = cache.getCircle(nrPoints);
+        cache.vertices.resize(1 + 3 * shape.unitPoints.size());
+
+        Vertex* const innerVertices = &cache.vertices[1];
+        Vertex* const borderOuterVertices = innerVertices + shape.unitPoints.size();
+        Vertex* const borderInnerVertices = borderOuterVertices + shape.unitPoints.size();
         if (borderThickness > 0)
         {
-            const std::vector<Vector2f>& outerPoints = drawCircleHelperGetPoints(nrPoints, radius + borderThickness, -borderThickness);
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
+            setCircleOutlineVertices(borderOuterVertices, shape, radius + borderThickness, -borderThickness, borderColor);
+            setCircleOutlineVertices(borderInnerVertices, shape, radius, 0, borderColor);
+            setCircleOutlineVertices(innerVertices, shape, radius, 0, backgroundColor);
         }
         else if (borderThickness < 0)
         {
-            const std::vector<Vector2f>& outerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius + borderThickness, -borderThickness);
-
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
+            setCircleOutlineVertices(borderOuterVertices, shape, radius, 0, borderColor);
+            setCircleOutlineVertices(borderInnerVertices, shape, radius + borderThickness, -borderThickness, borderColor);
+            setCircleOutlineVertices(innerVertices, shape, radius + borderThickness, -borderThickness, backgroundColor);
         }
         else // No outline
-        {
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
-        }
+            setCircleOutlineVertices(innerVertices, shape, radius, 0, backgroundColor);
+
+        cache.vertices[0] = {{radius, radius}, Vertex::Color(backgroundColor)};
+        drawTessellatedShape(this, states, shape, cache.vertices, (borderThickness != 0));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -413,11 +931,20 @@ namespace tgui
             radius = size.y / 2;
 
         const int nrCornerPoints = std::max(1, static_cast<int>(std::ceil(radius * 2)));
-        const std::vector<Vector2f>& outerPoints = drawRoundedRectHelperGetPoints(nrCornerPoints, size, radius, 0);
+
+        priv::ShapeTessellationCache& cache = getShapeTessellationCache();
+        const auto& shape = cache.getRoundedRectangle(nrCornerPoints);
+        cache.vertices.resize(1 + 3 * shape.unitPoints.size());
+
+        Vertex* const innerVertices = &cache.vertices[1];
+        Vertex* const borderOuterVertices = innerVertices + shape.unitPoints.size();
+        Vertex* const borderInnerVertices = borderOuterVertices + shape.unitPoints.size();
 
         const float borderWidth = borders.getLeft();
         if (borderWidth > 0)
         {
+            setRoundedRectOutlineVertices(borderOuterVertices, shape, nrCornerPoints, size, radius, 0, borderColor);
+
             radius = std::max(0.f, radius - borderWidth);
             const Vector2f innerSize = {std::max(0.f, size.x - 2*borderWidth), std::max(0.f, size.y - 2*borderWidth)};
             if (radius > innerSize.x / 2)
@@ -425,13 +952,24 @@ namespace tgui
             if (radius > innerSize.y / 2)
                 radius = innerSize.y / 2;
 
-            const std::vector<Vector2f>& innerPoints = drawRoundedRectHelperGetPoints(nrCornerPoints, innerSize, radius, borderWidth);
-
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, size/2.f, backgroundColor);
+            setRoundedRectOutlineVertices(borderInnerVertices, shape, nrCornerPoints, innerSize, radius, borderWidth, borderColor);
+            setRoundedRectOutlineVertices(innerVertices, shape, nrCornerPoints, innerSize, radius, borderWidth, backgroundColor);
         }
         else // There are no borders
-            drawInnerShape(this, states, outerPoints, size/2.f, backgroundColor);
+            setRoundedRectOutlineVertices(innerVertices, shape, nrCornerPoints, size, radius, 0, backgroundColor);
+
+        cache.vertices[0] = {size / 2.f, Vertex::Color(backgroundColor)};
+        drawTessellatedShape(this, states, shape, cache.vertices, (borderWidth > 0));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    priv::ShapeTessellationCache& BackendRenderTarget::getShapeTessellationCache()
+    {
+        if (!m_shapeTessellationCache)
+            m_shapeTessellationCache = std::make_shared<priv::ShapeTessellationCache>();
+
+        return *m_shapeTessellationCache;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,12 +24,90 @@
 
 
 #include <TGUI/Backend/Renderer/BackendText.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <list>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Vertices of a laid out string that can be shared between texts with the same properties.
+        // The colors aren't part of the key, texts with different colors copy the vertices and change their colors.
+        struct GlyphRun
+        {
+            std::size_t hash = 0;
+            const BackendFont* fontKey = nullptr;
+            String string;
+            unsigned int characterSize = 0;
+            unsigned int style = 0;
+            float outlineThickness = 0;
+            Color fillColor; // Color of the vertices, the vertices in the cache are never changed
+            Color outlineColor;
+
+            std::weak_ptr<BackendFont> font; // Detects when a different font was created at the same address
+            std::weak_ptr<BackendTexture> texture;
+            std::uint64_t glyphGeneration = 0;
+            std::uint64_t usedSheets = 0;
+            Vector2f size;
+            std::shared_ptr<std::vector<Vertex>> vertices;
+            std::shared_ptr<std::vector<Vertex>> outlineVertices;
+        };
+
+        struct GlyphRunCache
+        {
+            std::list<GlyphRun> runs; // Most recently used run is in front
+            std::unordered_multimap<std::size_t, std::list<GlyphRun>::iterator> lookup; // Runs by hash of their properties
+            std::size_t capacity = 1024;
+            std::size_t hits = 0;
+            std::size_t misses = 0;
+
+            void erase(std::list<GlyphRun>::iterator runIt)
+            {
+                const auto range = lookup.equal_range(runIt->hash);
+                for (auto it = range.first; it != range.second; ++it)
+                {
+                    if (it->second == runIt)
+                    {
+                        lookup.erase(it);
+                        break;
+                    }
+                }
+
+                runs.erase(runIt);
+            }
+
+            void shrinkToCapacity()
+            {
+                while (runs.size() > capacity)
+                    erase(std::prev(runs.end()));
+            }
+        };
+
+        const std::size_t maxGlyphRunStringLength = 256;
+
+        GlyphRunCache& getGlyphRunCache()
+        {
+            static GlyphRunCache cache;
+            return cache;
+        }
+
+        void hashCombine(std::size_t& hash, std::size_t value)
+        {
+            hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+
+        void setVertexColors(std::vector<Vertex>& vertices, const Color& color)
+        {
+            const Vertex::Color vertexColor(color);
+            for (auto& vertex : vertices)
+                vertex.color = vertexColor;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f BackendText::getSize()
@@ -49,6 +127,7 @@ namespace tgui
 
         m_string = string;
         m_verticesNeedUpdate = true;
+        m_characterPositions.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,6 +146,7 @@ namespace tgui
 
         m_characterSize = characterSize;
         m_verticesNeedUpdate = true;
+        m_characterPositions.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -91,9 +171,10 @@ namespace tgui
             return;
 
         TGUI_ASSERT(m_vertices != nullptr, "m_vertices should have already been created if m_verticesNeedUpdate is false");
-        const Vertex::Color vertexColor(color);
-        for (std::size_t i = 0; i < m_vertices->size(); ++i)
-            (*m_vertices)[i].color = vertexColor;
+
+        // Vertices from the glyph run cache are shared with other texts, so they have to be copied before changing them
+        unshareVertices();
+        setVertexColors(*m_vertices, color);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -119,9 +200,8 @@ namespace tgui
 
         if (m_outlineVertices)
         {
-            const Vertex::Color vertexColor(color);
-            for (std::size_t i = 0; i < m_outlineVertices->size(); ++i)
-                (*m_outlineVertices)[i].color = vertexColor;
+            unshareVertices();
+            setVertexColors(*m_outlineVertices, color);
         }
     }
 
@@ -159,6 +239,7 @@ namespace tgui
 
         m_style = style;
         m_verticesNeedUpdate = true;
+        m_characterPositions.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,6 +258,7 @@ namespace tgui
 
         m_font = font;
         m_verticesNeedUpdate = true;
+        m_characterPositions.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -193,17 +275,63 @@ namespace tgui
         if (!m_font)
             return {};
 
-        if (index > m_string.length())
-            index = m_string.length();
+        updateCharacterPositions();
+        return m_characterPositions[std::min(index, m_string.length())];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendText::findCharacterIndex(Vector2f position) const
+    {
+        if (!m_font)
+            return 0;
+
+        updateCharacterPositions();
+
+        // Find on which line the position is located
+        const float lineSpacing = m_font->getLineSpacing(m_characterSize);
+        std::size_t line = 0;
+        if ((position.y > 0) && (lineSpacing > 0))
+            line = std::min(static_cast<std::size_t>(position.y / lineSpacing), m_lineStarts.size() - 1);
+
+        // The last position on the line is in front of the newline, or at the end of the string for the last line
+        const std::size_t lineStart = m_lineStarts[line];
+        const std::size_t lineEnd = (line + 1 < m_lineStarts.size()) ? (m_lineStarts[line + 1] - 1) : m_string.length();
+
+        // Search the first position on the line that lies behind the requested position and check whether the one before it is closer
+        const auto it = std::lower_bound(m_characterPositions.begin() + static_cast<std::ptrdiff_t>(lineStart),
+                                         m_characterPositions.begin() + static_cast<std::ptrdiff_t>(lineEnd),
+                                         position.x, [](const Vector2f& charPos, float x){ return charPos.x < x; });
+
+        const auto index = static_cast<std::size_t>(it - m_characterPositions.begin());
+        if ((index > lineStart) && (position.x - m_characterPositions[index - 1].x < m_characterPositions[index].x - position.x))
+            return index - 1;
+        else
+            return index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendText::updateCharacterPositions() const
+    {
+        if (!m_characterPositions.empty())
+            return;
+
+        const bool isBold       = static_cast<unsigned int>(m_style) & TextStyle::Bold;
+        const float lineSpacing = m_font->getLineSpacing(m_characterSize);
+
+        std::vector<float> advances(m_string.length());
+        std::vector<float> kernings(m_string.length());
+        m_font->getAdvances(m_string.data(), m_string.length(), m_characterSize, isBold, advances.data(), kernings.data());
 
-        const bool isBold           = static_cast<unsigned int>(m_style) & TextStyle::Bold;
-        const float whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
-        const float lineSpacing     = m_font->getLineSpacing(m_characterSize);
+        m_characterPositions.resize(m_string.length() + 1);
+        m_lineStarts.assign(1, 0);
 
         Vector2f position;
-        char32_t prevChar = 0;
-        for (std::size_t i = 0; i < index; ++i)
+        for (std::size_t i = 0; i < m_string.length(); ++i)
         {
+            m_characterPositions[i] = position;
+
             const char32_t curChar = m_string[i];
 
             // Skip the carriage return character as we will pretend it isn't there
@@ -211,22 +339,21 @@ namespace tgui
                 continue;
 
             // Apply the kerning offset
-            position.x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
-            prevChar = curChar;
+            position.x += kernings[i];
 
-            // Handle special characters
-            switch (curChar)
+            if (curChar == U'\n')
             {
-                case ' ':  position.x += whitespaceWidth;             continue;
-                case '\t': position.x += whitespaceWidth * 4;         continue;
-                case '\n': position.y += lineSpacing; position.x = 0; continue;
+                position.y += lineSpacing;
+                position.x = 0;
+                m_lineStarts.push_back(i + 1);
+                continue;
             }
 
-            // For regular characters, add the advance offset of the glyph
-            position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance;
+            // Add the advance offset of the glyph, which is also correct for spaces and tabs
+            position.x += advances[i];
         }
 
-        return position;
+        m_characterPositions.back() = position;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,8 +369,8 @@ namespace tgui
         if (!texture)
             return data;
 
-        // If the font texture changes then we need to update the texture coordinates
-        if (texture.get() != m_lastFontTexture)
+        // If the font texture changes or glyphs were evicted from it then we need to update the texture coordinates
+        if ((texture.get() != m_lastFontTexture) || (m_font->getGlyphGeneration(m_characterSize) != m_lastGlyphGeneration))
         {
             m_lastFontTexture = texture.get();
             m_verticesNeedUpdate = true;
@@ -251,11 +378,21 @@ namespace tgui
 
         if (m_verticesNeedUpdate)
         {
+            const std::uint64_t glyphGeneration = m_font->getGlyphGeneration(m_characterSize);
             updateVertices();
 
+            // If the font had to evict glyphs to make room for the glyphs of this text, then the glyphs that were requested
+            // earlier during the update may have moved. They are all in the texture now, so updating again will find them.
+            if (m_font->getGlyphGeneration(m_characterSize) != glyphGeneration)
+            {
+                m_verticesNeedUpdate = true;
+                updateVertices();
+            }
+
             // It is possible that the texture changes during the update
             texture = m_font->getTexture(m_characterSize);
             m_lastFontTexture = texture.get();
+            m_lastGlyphGeneration = m_font->getGlyphGeneration(m_characterSize);
         }
 
         if (m_outlineVertices && !m_outlineVertices->empty())
@@ -264,11 +401,53 @@ namespace tgui
         if (m_vertices && !m_vertices->empty())
             data.emplace_back(texture, m_vertices);
 
+        // Let the font know which parts of its texture are still needed, so that it doesn't evict glyphs that are drawn every frame
+        m_font->markSheetsDrawn(m_characterSize, m_usedSheets);
         return data;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendText::setGlyphRunCacheCapacity(std::size_t maxEntries)
+    {
+        GlyphRunCache& cache = getGlyphRunCache();
+        cache.capacity = maxEntries;
+        cache.shrinkToCapacity();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendText::getGlyphRunCacheCapacity()
+    {
+        return getGlyphRunCache().capacity;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendText::GlyphRunCacheStatistics BackendText::getGlyphRunCacheStatistics()
+    {
+        const GlyphRunCache& cache = getGlyphRunCache();
+
+        GlyphRunCacheStatistics statistics;
+        statistics.entries = cache.runs.size();
+        statistics.hits = cache.hits;
+        statistics.misses = cache.misses;
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendText::clearGlyphRunCache()
+    {
+        GlyphRunCache& cache = getGlyphRunCache();
+        cache.runs.clear();
+        cache.lookup.clear();
+        cache.hits = 0;
+        cache.misses = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendText::updateVertices()
     {
         if (!m_font || !m_verticesNeedUpdate)
@@ -276,12 +455,80 @@ namespace tgui
 
         m_verticesNeedUpdate = false;
 
+        // Check if another text with the same properties already created the vertices
+        GlyphRunCache& cache = getGlyphRunCache();
+        const bool useGlyphRunCache = (cache.capacity > 0) && (m_string.length() <= maxGlyphRunStringLength);
+        std::size_t glyphRunHash = 0;
+        std::uint64_t glyphGeneration = 0;
+        if (useGlyphRunCache)
+        {
+            for (std::size_t i = 0; i < m_string.length(); ++i)
+                hashCombine(glyphRunHash, m_string.data()[i]);
+
+            hashCombine(glyphRunHash, std::hash<const BackendFont*>{}(m_font.get()));
+            hashCombine(glyphRunHash, m_characterSize);
+            hashCombine(glyphRunHash, static_cast<unsigned int>(m_style));
+            hashCombine(glyphRunHash, std::hash<float>{}(m_outlineThickness));
+
+            const auto texture = m_font->getTexture(m_characterSize);
+            glyphGeneration = m_font->getGlyphGeneration(m_characterSize);
+
+            const auto range = cache.lookup.equal_range(glyphRunHash);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                const auto runIt = it->second;
+                if ((runIt->fontKey != m_font.get()) || (runIt->string != m_string) || (runIt->characterSize != m_characterSize)
+                 || (runIt->style != static_cast<unsigned int>(m_style)) || (runIt->outlineThickness != m_outlineThickness))
+                    continue;
+
+                // The run can't be used if its texture coordinates are no longer valid
+                if ((runIt->font.lock() != m_font) || (runIt->texture.lock() != texture) || (runIt->glyphGeneration != glyphGeneration))
+                {
+                    cache.erase(runIt);
+                    break;
+                }
+
+                cache.runs.splice(cache.runs.begin(), cache.runs, runIt);
+                ++cache.hits;
+
+                m_vertices = runIt->vertices;
+                m_outlineVertices = runIt->outlineVertices;
+                m_size = runIt->size;
+                m_usedSheets = runIt->usedSheets;
+                m_verticesShared = true;
+
+                // A text with different colors gets its own copy of the vertices
+                if (runIt->fillColor != m_fillColor)
+                {
+                    unshareVertices();
+                    setVertexColors(*m_vertices, m_fillColor);
+                }
+                if (m_outlineVertices && (runIt->outlineColor != m_outlineColor))
+                {
+                    unshareVertices();
+                    setVertexColors(*m_outlineVertices, m_outlineColor);
+                }
+                return;
+            }
+
+            ++cache.misses;
+        }
+
+        // Vertices that are shared with other texts can't be reused
+        if (m_verticesShared)
+        {
+            m_vertices = nullptr;
+            m_outlineVertices = nullptr;
+            m_verticesShared = false;
+        }
+
         if (!m_vertices)
             m_vertices = std::make_shared<std::vector<Vertex>>();
         if (!m_outlineVertices && (m_outlineThickness != 0))
             m_outlineVertices = std::make_shared<std::vector<Vertex>>();
 
         m_size = {0, 0};
+        m_usedSheets = 0;
         m_vertices->clear();
         if (m_outlineVertices)
             m_outlineVertices->clear();
@@ -303,8 +550,10 @@ namespace tgui
         const float strikeThroughOffset = isStrikeThrough ? (xBounds.top + (xBounds.height / 2.f)) : 0.f;
 
         // Precompute the variables needed by the algorithm
-        const float whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
         const float lineSpacing = m_font->getLineSpacing(m_characterSize);
+        std::vector<float> advances(m_string.length());
+        std::vector<float> kernings(m_string.length());
+        m_font->getAdvances(m_string.data(), m_string.length(), m_characterSize, isBold, advances.data(), kernings.data());
         float x = 0;
         float y = static_cast<float>(m_characterSize);
 
@@ -321,7 +570,7 @@ namespace tgui
                 continue;
 
             // Apply the kerning offset
-            x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+            x += kernings[i];
 
             // If we're using the underlined style and there's a new line, draw a line
             if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
@@ -352,12 +601,13 @@ namespace tgui
                     maxX = std::max(maxX, x);
                 }
 
-                switch (curChar)
+                if (curChar == U'\n')
                 {
-                    case U' ':  x += whitespaceWidth;     break;
-                    case U'\t': x += whitespaceWidth * 4; break;
-                    case U'\n': y += lineSpacing; x = 0;  break;
+                    y += lineSpacing;
+                    x = 0;
                 }
+                else
+                    x += advances[i];
 
                 // Next glyph, no need to create a quad for whitespace
                 continue;
@@ -373,6 +623,7 @@ namespace tgui
 
                 // Add the outline glyph to the vertices
                 addGlyphQuad(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph, italicShear);
+                m_usedSheets |= std::uint64_t(1) << glyph.sheet;
                 maxX = std::max(maxX, x + right - italicShear * top - m_outlineThickness);
             }
 
@@ -381,13 +632,14 @@ namespace tgui
 
             // Add the glyph to the vertices
             addGlyphQuad(*m_vertices, {x, y}, vertexFillColor, glyph, italicShear);
+            m_usedSheets |= std::uint64_t(1) << glyph.sheet;
 
             // Update the current bounds with the non outlined glyph bounds
             if (m_outlineThickness == 0)
                 maxX = std::max(maxX, x + glyph.bounds.left + glyph.bounds.width - italicShear * glyph.bounds.top);
 
             // Advance to the next character
-            x += glyph.advance;
+            x += advances[i];
         }
 
         maxX = std::max(maxX, x);
@@ -441,6 +693,47 @@ namespace tgui
                 }
             }
         }
+
+        // Store the vertices in the cache so that other texts can use them, unless glyphs were evicted during the update
+        if (useGlyphRunCache && texture && (m_font->getGlyphGeneration(m_characterSize) == glyphGeneration))
+        {
+            GlyphRun run;
+            run.hash = glyphRunHash;
+            run.fontKey = m_font.get();
+            run.string = m_string;
+            run.characterSize = m_characterSize;
+            run.style = static_cast<unsigned int>(m_style);
+            run.outlineThickness = m_outlineThickness;
+            run.fillColor = m_fillColor;
+            run.outlineColor = m_outlineColor;
+            run.font = m_font;
+            run.texture = texture;
+            run.glyphGeneration = glyphGeneration;
+            run.usedSheets = m_usedSheets;
+            run.size = m_size;
+            run.vertices = m_vertices;
+            if (m_outlineThickness != 0)
+                run.outlineVertices = m_outlineVertices;
+
+            cache.runs.push_front(std::move(run));
+            cache.lookup.insert({glyphRunHash, cache.runs.begin()});
+            cache.shrinkToCapacity();
+            m_verticesShared = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendText::unshareVertices()
+    {
+        if (!m_verticesShared)
+            return;
+
+        m_vertices = std::make_shared<std::vector<Vertex>>(*m_vertices);
+        if (m_outlineVertices)
+            m_outlineVertices = std::make_shared<std::vector<Vertex>>(*m_outlineVertices);
+
+        m_verticesShared = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -448,16 +741,17 @@ namespace tgui
     void BackendText::addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color, const FontGlyph& glyph, float italicShear)
     {
         const float padding = 1.0;
+        const float texturePadding = padding * glyph.textureScale; // Keeps the texels at the same scale as the rest of the glyph
 
         const float left   = glyph.bounds.left - padding;
         const float top    = glyph.bounds.top - padding;
         const float right  = glyph.bounds.left + glyph.bounds.width + padding;
         const float bottom = glyph.bounds.top  + glyph.bounds.height + padding;
 
-        const float u1 = glyph.textureRect.left - padding;
-        const float v1 = glyph.textureRect.top - padding;
-        const float u2 = glyph.textureRect.left + glyph.textureRect.width + padding;
-        const float v2 = glyph.textureRect.top  + glyph.textureRect.height + padding;
+        const float u1 = glyph.textureRect.left - texturePadding;
+        const float v1 = glyph.textureRect.top - texturePadding;
+        const float u2 = glyph.textureRect.left + glyph.textureRect.width + texturePadding;
+        const float v2 = glyph.textureRect.top  + glyph.textureRect.height + texturePadding;
 
         vertices.emplace_back(Vector2f{position.x + left  - italicShear * top   , position.y + top   }, color, Vector2f{u1, v1});
         vertices.emplace_back(Vector2f{position.x + right - italicShear * top   , position.y + top   }, color, Vector2f{u2, v1});
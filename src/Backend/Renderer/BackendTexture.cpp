@@ -25,6 +25,8 @@
 
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
+#include <cstring>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -51,6 +53,48 @@ namespace tgui
         m_pixels = nullptr;
         m_imageSize = size;
         m_isSmooth = smooth;
+        m_isAlphaTexture = false;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth)
+    {
+        // Renderers that don't override this function don't support single-channel textures, so we store them as RGBA
+        bool success;
+        if (alphaPixels)
+        {
+            const auto pixels = convertAlphaToPixels(alphaPixels, static_cast<std::size_t>(size.x) * size.y);
+            success = loadTextureOnly(size, pixels.get(), smooth);
+        }
+        else
+            success = loadTextureOnly(size, nullptr, smooth);
+
+        if (!success)
+            return false;
+
+        m_isAlphaTexture = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::updateRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT(pixels, "updateRegion in BackendTexture doesn't accept a nullptr for pixels");
+        TGUI_ASSERT((region.left + region.width <= m_imageSize.x) && (region.top + region.height <= m_imageSize.y),
+                    "Region passed to updateRegion in BackendTexture has to lie inside the texture");
+
+        if (!m_pixels || m_isAlphaTexture)
+            return true;
+
+        for (unsigned int y = 0; y < region.height; ++y)
+        {
+            std::memcpy(&m_pixels[((region.top + y) * m_imageSize.x + region.left) * 4],
+                        &pixels[y * region.width * 4], region.width * 4);
+        }
+
         return true;
     }
 
@@ -63,6 +107,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTexture::isAlphaTexture() const
+    {
+        return m_isAlphaTexture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setDistanceField(bool distanceField)
+    {
+        m_isDistanceField = distanceField;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::isDistanceField() const
+    {
+        return m_isDistanceField;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTexture::setSmooth(bool smooth)
     {
         m_isSmooth = smooth;
@@ -96,6 +161,22 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<std::uint8_t[]> BackendTexture::convertAlphaToPixels(const std::uint8_t* alphaPixels, std::size_t pixelCount)
+    {
+        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(pixelCount * 4);
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            pixels[i * 4 + 0] = 255;
+            pixels[i * 4 + 1] = 255;
+            pixels[i * 4 + 2] = 255;
+            pixels[i * 4 + 3] = alphaPixels[i];
+        }
+
+        return pixels;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
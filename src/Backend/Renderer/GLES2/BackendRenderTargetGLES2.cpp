@@ -28,7 +28,24 @@
 #include <TGUI/Backend/Renderer/OpenGL.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
+#include <limits>
 #include <numeric>
+#include <cstring>
+
+#if !defined(TGUI_SYSTEM_IOS)
+    // Only the EGL functions are needed, prevent the header from including the window system headers (e.g. X11)
+    #define EGL_NO_PLATFORM_SPECIFIC_TYPES
+    #define MESA_EGL_NO_X11_HEADERS
+
+    // The khrplatform.h copy inside glad doesn't define the calling convention that the EGL headers rely on.
+    // OpenGL ES is only supported on platforms where it is empty.
+    #ifndef KHRONOS_APIENTRY
+        #define KHRONOS_APIENTRY
+    #endif
+
+    #include <EGL/egl.h>
+    #include <EGL/eglext.h>
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -61,11 +78,15 @@ namespace tgui
                 "#version 310 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform float uAlphaTexture;\n"
+                "uniform float uDistanceField;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    float edgeAlpha = clamp((texColor.a - 0.5) / max(fwidth(texColor.a), 0.0001) + 0.5, 0.0, 1.0);\n"
+                "    outColor = vec4(mix(texColor.rgb, vec3(1.0), uAlphaTexture), mix(texColor.a, edgeAlpha, uDistanceField)) * color;\n"
                 "}";
         }
         else if (TGUI_GLAD_GL_ES_VERSION_3_0)
@@ -87,11 +108,15 @@ namespace tgui
                 "#version 300 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform float uAlphaTexture;\n"
+                "uniform float uDistanceField;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    float edgeAlpha = clamp((texColor.a - 0.5) / max(fwidth(texColor.a), 0.0001) + 0.5, 0.0, 1.0);\n"
+                "    outColor = vec4(mix(texColor.rgb, vec3(1.0), uAlphaTexture), mix(texColor.a, edgeAlpha, uDistanceField)) * color;\n"
                 "}";
         }
         else // No GLES 3 support
@@ -109,14 +134,28 @@ namespace tgui
                 "    color = inColor;\n"
                 "    texCoord = inTexCoord;\n"
                 "}";
+
+            // GLES 2 only supports fwidth with an extension. Without it, the edges of distance fields get a fixed width.
             fragmentShaderSource =
                 "#version 100\n"
+                "#ifdef GL_OES_standard_derivatives\n"
+                "#extension GL_OES_standard_derivatives : enable\n"
+                "#endif\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform float uAlphaTexture;\n"
+                "uniform float uDistanceField;\n"
                 "varying vec4 color;\n"
                 "varying vec2 texCoord;\n"
                 "void main() {\n"
-                "    gl_FragColor = texture2D(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture2D(uTexture, texCoord);\n"
+                "#ifdef GL_OES_standard_derivatives\n"
+                "    float edgeWidth = max(fwidth(texColor.a), 0.0001);\n"
+                "#else\n"
+                "    float edgeWidth = 0.1;\n"
+                "#endif\n"
+                "    float edgeAlpha = clamp((texColor.a - 0.5) / edgeWidth + 0.5, 0.0, 1.0);\n"
+                "    gl_FragColor = vec4(mix(texColor.rgb, vec3(1.0), uAlphaTexture), mix(texColor.a, edgeAlpha, uDistanceField)) * color;\n"
                 "}";
         }
 
@@ -178,6 +217,12 @@ namespace tgui
         if (!TGUI_GLAD_GL_ES_VERSION_3_1)
             m_projectionMatrixShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "projectionMatrix");
 
+        // Textures with only an alpha channel are sampled as black, the shader has to know when to make them white instead
+        m_alphaTextureShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "uAlphaTexture");
+
+        // Fonts can store glyphs as distance fields, the shader has to know when to reconstruct the edges from the texture
+        m_distanceFieldShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "uDistanceField");
+
         if (!TGUI_GLAD_GL_ES_VERSION_3_0)
         {
             m_positionShaderLocation = glGetAttribLocation(m_shaderProgram, "inPosition");
@@ -202,6 +247,9 @@ namespace tgui
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
 
+        if (m_offscreenFramebuffer != 0)
+            TGUI_GL_CHECK(glDeleteFramebuffers(1, &m_offscreenFramebuffer));
+
         if (TGUI_GLAD_GL_ES_VERSION_3_0)
             TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_vertexArray));
     }
@@ -274,18 +322,33 @@ namespace tgui
                                                static_cast<int>(m_viewport.width), static_cast<int>(m_viewport.height)};
         TGUI_GL_CHECK(glViewport(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
         TGUI_GL_CHECK(glScissor(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
+        m_scissor = viewportGL;
         TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
         if (TGUI_GLAD_GL_ES_VERSION_3_0)
             TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
         TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
         TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
 
+        // Without a VAO, the attribute pointers could have been changed by other code since the last time we drew
+        if (!TGUI_GLAD_GL_ES_VERSION_3_0)
+            setVertexAttribs();
+
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        m_alphaTextureBound = false;
+        TGUI_GL_CHECK(glUniform1f(m_alphaTextureShaderUniformLocation, 0));
+        m_distanceFieldBound = false;
+        TGUI_GL_CHECK(glUniform1f(m_distanceFieldShaderUniformLocation, 0));
+
+        if (m_batchingEnabled)
+            m_batchStatistics = {};
 
         // Draw the widgets
-        root->draw(*this, {});
+        drawRootContainer(root);
+
+        if (m_batchingEnabled)
+            flushBatch();
 
         m_currentTexture = nullptr;
 
@@ -322,29 +385,35 @@ namespace tgui
         // Change the bound texture if it changed
         if (m_currentTexture != texture)
         {
-            if (texture)
-            {
-                TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureGLES2>(texture), "BackendRenderTargetGLES2 requires textures of type BackendTextureGLES2");
-                m_currentTexture = std::static_pointer_cast<BackendTextureGLES2>(texture);
+            // The queued vertices still need to be drawn with the old texture
+            if (m_batchingEnabled)
+                flushBatch();
 
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
-            }
-            else
+            TGUI_ASSERT(!texture || std::dynamic_pointer_cast<BackendTextureGLES2>(texture), "BackendRenderTargetGLES2 requires textures of type BackendTextureGLES2");
+            bindTexture(std::static_pointer_cast<BackendTextureGLES2>(texture));
+        }
+
+        Transform finalTransform = states.transform;
+        finalTransform.roundPosition(); // Avoid blurry texts
+
+        if (m_batchingEnabled)
+        {
+            if (addToBatch(finalTransform, vertices, vertexCount, indices, indexCount))
             {
-                m_currentTexture = nullptr;
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+                ++m_batchStatistics.batchedCalls;
+                return;
             }
+
+            // The vertex array was too large to be batched, so it will be drawn on its own
+            flushBatch();
         }
 
         // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
         // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
+        // Batch rendering (see setBatchingEnabled) is much faster though when many widgets are drawn.
         TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, vertexCount * sizeof(Vertex), vertices, GL_DYNAMIC_DRAW));
 
-        Transform finalTransform = states.transform;
-        finalTransform.roundPosition(); // Avoid blurry texts
         finalTransform = m_projectionTransform * finalTransform;
-
         glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix());
 
         if (indices)
@@ -360,17 +429,126 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendRenderTargetGLES2::updateClipping(FloatRect, FloatRect clipViewport)
+    void BackendRenderTargetGLES2::setBatchingEnabled(bool enabled)
     {
-        if ((clipViewport.width > 0) && (clipViewport.height > 0))
+        TGUI_ASSERT(m_batchVertices.empty(), "BackendRenderTargetGLES2::setBatchingEnabled can't be called while drawing");
+        m_batchingEnabled = enabled;
+        m_batchStatistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetGLES2::isBatchingEnabled() const
+    {
+        return m_batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const BackendRenderTargetGLES2::BatchStatistics& BackendRenderTargetGLES2::getBatchStatistics() const
+    {
+        return m_batchStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendRenderTargetGLES2::queryBackBufferAge()
+    {
+#if !defined(TGUI_SYSTEM_IOS)
+        const EGLDisplay display = eglGetCurrentDisplay();
+        const EGLSurface surface = eglGetCurrentSurface(EGL_DRAW);
+        if ((display == EGL_NO_DISPLAY) || (surface == EGL_NO_SURFACE))
+            return 0;
+
+        EGLint swapBehavior = 0;
+        if (eglQuerySurface(display, surface, EGL_SWAP_BEHAVIOR, &swapBehavior) && (swapBehavior == EGL_BUFFER_PRESERVED))
+            return 1;
+
+    #ifdef EGL_BUFFER_AGE_EXT
+        const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+        if (extensions && std::strstr(extensions, "EGL_EXT_buffer_age"))
         {
-            TGUI_GL_CHECK(glScissor(static_cast<int>(clipViewport.left), static_cast<int>(m_targetSize.y - clipViewport.top - clipViewport.height),
-                                    static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)));
+            EGLint age = 0;
+            if (eglQuerySurface(display, surface, EGL_BUFFER_AGE_EXT, &age) && (age > 0))
+                return static_cast<unsigned int>(age);
         }
-        else // Clip the entire window
+    #endif
+#endif
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetGLES2::isOffscreenRenderingSupported() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::drawOffscreenTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture)
+    {
+        // The texture contains premultiplied alpha, so its colors may not be multiplied with the alpha value again
+        if (m_batchingEnabled)
+            flushBatch();
+        TGUI_GL_CHECK(glBlendFuncSeparate(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+
+        // The rows of the framebuffer were stored from bottom to top, so the texture coordinates are flipped vertically
+        const Vector2f scale{m_viewport.width / m_viewRect.width, m_viewport.height / m_viewRect.height};
+        const Vector2f size{texture->getSize().x / scale.x, texture->getSize().y / scale.y};
+        const Vertex::Color vertexColor(Color::White);
+        const std::array<Vertex, 4> vertices = {{
+            {{0, 0}, vertexColor, {0, 1}},
+            {{0, size.y}, vertexColor, {0, 0}},
+            {{size.x, 0}, vertexColor, {1, 1}},
+            {{size.x, size.y}, vertexColor, {1, 0}}
+        }};
+        const std::array<int, 2*3> indices = {{
+            0, 1, 2,
+            2, 1, 3
+        }};
+        drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), texture);
+
+        if (m_batchingEnabled)
+            flushBatch();
+
+        if (m_offscreenTexture)
+            TGUI_GL_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+        else
+            TGUI_GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::updateClipping(FloatRect, FloatRect clipViewport)
+    {
+        std::array<int, 4> scissor = {{0, 0, 0, 0}}; // Clip the entire window by default
+        if ((clipViewport.width > 0) && (clipViewport.height > 0))
         {
-            TGUI_GL_CHECK(glScissor(0, 0, 0, 0));
+            scissor = {{static_cast<int>(clipViewport.left), static_cast<int>(m_targetSize.y - clipViewport.top - clipViewport.height),
+                        static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)}};
         }
+
+        // Nested clipping layers often result in the same scissor rectangle, there is no need to interrupt the batch in that case
+        if (scissor == m_scissor)
+            return;
+
+        if (m_batchingEnabled)
+            flushBatch();
+
+        TGUI_GL_CHECK(glScissor(scissor[0], scissor[1], scissor[2], scissor[3]));
+        m_scissor = scissor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::clearClippingArea()
+    {
+        if (m_batchingEnabled)
+            flushBatch();
+
+        // The scissor test is enabled while drawing, so only the area inside the clipping rectangle gets cleared
+        TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -392,6 +570,80 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<BackendTexture> BackendRenderTargetGLES2::createOffscreenTexture(Vector2u size)
+    {
+        // Smoothing is disabled so that pixels at the edges of the texture don't get mixed with pixels at the opposite side
+        auto texture = std::make_shared<BackendTextureGLES2>();
+        if (!texture->loadTextureOnly(size, nullptr, false))
+            return nullptr;
+
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::setOffscreenTexture(const std::shared_ptr<BackendTexture>& texture, bool clear)
+    {
+        // The queued vertices still have to be drawn on the previous target
+        if (m_batchingEnabled)
+            flushBatch();
+
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureGLES2>(texture), "BackendRenderTargetGLES2 requires textures of type BackendTextureGLES2");
+
+            if (!m_offscreenFramebufferBound)
+            {
+                TGUI_GL_CHECK(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &m_windowFramebuffer));
+                if (m_offscreenFramebuffer == 0)
+                    TGUI_GL_CHECK(glGenFramebuffers(1, &m_offscreenFramebuffer));
+
+                TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_offscreenFramebuffer));
+                m_offscreenFramebufferBound = true;
+            }
+
+            const GLuint textureId = std::static_pointer_cast<BackendTextureGLES2>(texture)->getInternalTexture();
+            TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureId, 0));
+            TGUI_GL_CHECK(glViewport(0, 0, static_cast<GLsizei>(texture->getSize().x), static_cast<GLsizei>(texture->getSize().y)));
+
+            // The alpha channel is blended separately, so that semi-transparent pixels that are drawn on the transparent
+            // texture keep their alpha value. This results in a texture with premultiplied alpha.
+            TGUI_GL_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+
+            if (clear)
+            {
+                GLfloat oldClearColor[4];
+                TGUI_GL_CHECK(glGetFloatv(GL_COLOR_CLEAR_VALUE, oldClearColor));
+                TGUI_GL_CHECK(glDisable(GL_SCISSOR_TEST));
+                TGUI_GL_CHECK(glClearColor(0, 0, 0, 0));
+                TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+                TGUI_GL_CHECK(glClearColor(oldClearColor[0], oldClearColor[1], oldClearColor[2], oldClearColor[3]));
+                TGUI_GL_CHECK(glEnable(GL_SCISSOR_TEST));
+            }
+        }
+        else // Continue drawing to the window
+        {
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(m_windowFramebuffer)));
+            m_offscreenFramebufferBound = false;
+
+            TGUI_GL_CHECK(glViewport(static_cast<int>(m_viewport.left), static_cast<int>(m_targetSize.y - m_viewport.top - m_viewport.height),
+                                     static_cast<int>(m_viewport.width), static_cast<int>(m_viewport.height)));
+            TGUI_GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+        }
+
+        // The texture that is being drawn to may not remain bound for sampling
+        bindTexture(nullptr);
+
+        // The scissor rectangle that is stored belongs to the previous target, so it has to be set again
+        m_scissor = {{-1, -1, -1, -1}};
+
+        m_projectionTransform = Transform();
+        m_projectionTransform.translate({-1 - (2.f * (m_viewRect.left / m_viewRect.width)), 1 + (2.f * (m_viewRect.top / m_viewRect.height))});
+        m_projectionTransform.scale({2.f / m_viewRect.width, -2.f / m_viewRect.height});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetGLES2::createBuffers()
     {
         if (TGUI_GLAD_GL_ES_VERSION_3_0)
@@ -418,6 +670,104 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetGLES2::addToBatch(const Transform& transform, const Vertex* vertices, std::size_t vertexCount,
+                                              const int* indices, std::size_t indexCount)
+    {
+        // OpenGL ES 2.0 only guarantees support for 16-bit indices, so a single batch can't contain more vertices than this
+        constexpr std::size_t maxBatchVertices = std::numeric_limits<std::uint16_t>::max() + 1;
+
+        if (indices)
+        {
+            // Indices may refer to any vertex in the array, so the vertices can't be split over multiple batches
+            if (vertexCount > maxBatchVertices)
+                return false;
+
+            if (m_batchVertices.size() + vertexCount > maxBatchVertices)
+                flushBatch();
+
+            const std::size_t indexOffset = m_batchVertices.size();
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                m_batchVertices.push_back({transform.transformPoint(vertices[i].position), vertices[i].color, vertices[i].texCoords});
+            for (std::size_t i = 0; i < indexCount; ++i)
+                m_batchIndices.push_back(static_cast<std::uint16_t>(indexOffset + static_cast<std::size_t>(indices[i])));
+        }
+        else // No indices were given, every 3 vertices form a triangle so the vertices can be split over several batches
+        {
+            std::size_t vertexIndex = 0;
+            while (vertexIndex < vertexCount)
+            {
+                if (m_batchVertices.size() + 3 > maxBatchVertices)
+                    flushBatch();
+
+                const std::size_t remainingSpace = ((maxBatchVertices - m_batchVertices.size()) / 3) * 3;
+                const std::size_t count = std::min(vertexCount - vertexIndex, remainingSpace);
+                const std::size_t indexOffset = m_batchVertices.size();
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const Vertex& vertex = vertices[vertexIndex + i];
+                    m_batchVertices.push_back({transform.transformPoint(vertex.position), vertex.color, vertex.texCoords});
+                    m_batchIndices.push_back(static_cast<std::uint16_t>(indexOffset + i));
+                }
+
+                vertexIndex += count;
+            }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::bindTexture(const std::shared_ptr<BackendTextureGLES2>& texture)
+    {
+        m_currentTexture = texture;
+        if (texture)
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, texture->getInternalTexture()));
+        else
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+
+        const bool alphaTexture = (texture && texture->isAlphaTexture());
+        if (alphaTexture != m_alphaTextureBound)
+        {
+            m_alphaTextureBound = alphaTexture;
+            TGUI_GL_CHECK(glUniform1f(m_alphaTextureShaderUniformLocation, alphaTexture ? 1.f : 0.f));
+        }
+
+        const bool distanceField = (alphaTexture && texture->isDistanceField());
+        if (distanceField != m_distanceFieldBound)
+        {
+            m_distanceFieldBound = distanceField;
+            TGUI_GL_CHECK(glUniform1f(m_distanceFieldShaderUniformLocation, distanceField ? 1.f : 0.f));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::flushBatch()
+    {
+        if (m_batchIndices.empty())
+            return;
+
+        // The vertices are already transformed, only the projection still has to be applied.
+        // The uniform is set on every flush because vertex arrays that were too large to batch change it.
+        glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix());
+
+        // Orphan the old buffers and upload the entire batch at once
+        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, m_batchVertices.size() * sizeof(Vertex), m_batchVertices.data(), GL_STREAM_DRAW));
+        TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_batchIndices.size() * sizeof(GLushort), m_batchIndices.data(), GL_STREAM_DRAW));
+        TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_batchIndices.size()), GL_UNSIGNED_SHORT, 0));
+
+        ++m_batchStatistics.flushes;
+        m_batchStatistics.vertices += m_batchVertices.size();
+        m_batchStatistics.indices += m_batchIndices.size();
+
+        // Clearing the vectors keeps their capacity, so no allocations are needed once the buffers are large enough
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -47,7 +47,7 @@ namespace tgui
         TGUI_ASSERT(getBackend(), "BackendTextureGLES2 can't be created when there is no system backend initialized (was a gui created yet?)");
         TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureGLES2 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
 
-        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth));
+        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth) && !m_isAlphaTexture);
 
         BackendTexture::loadTextureOnly(size, pixels, smooth);
 
@@ -97,6 +97,75 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureGLES2::loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth)
+    {
+        TGUI_ASSERT(getBackend(), "BackendTextureGLES2 can't be created when there is no system backend initialized (was a gui created yet?)");
+        TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureGLES2 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
+
+        BackendTexture::loadTextureOnly(size, nullptr, smooth);
+        m_isAlphaTexture = true;
+
+        if (m_textureId != 0)
+            TGUI_GL_CHECK(glDeleteTextures(1, &m_textureId));
+
+        TGUI_GL_CHECK(glGenTextures(1, &m_textureId));
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+        GLint oldUnpackAlignment;
+        TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+        TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+
+        // GL_ALPHA is available in all GLES versions (unlike GL_R8 and texture swizzling) and samples as (0,0,0,alpha).
+        // The render target tells its shader to replace the black color by white when such a texture is bound.
+        TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, GL_ALPHA, GL_UNSIGNED_BYTE, alphaPixels));
+
+        // Restore the state that was active when this function was called
+        TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, oldBoundTexture));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::updateRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (m_textureId == 0)
+            return false;
+
+        BackendTexture::updateRegion(region, pixels);
+        if ((region.width == 0) || (region.height == 0))
+            return true;
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        GLint oldUnpackAlignment;
+        TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+
+        // Rows of alpha textures consist of single bytes and thus aren't necessarily 4-byte aligned
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+        TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, m_isAlphaTexture ? 1 : 4));
+        TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(region.left), static_cast<GLint>(region.top),
+                                      static_cast<GLsizei>(region.width), static_cast<GLsizei>(region.height),
+                                      m_isAlphaTexture ? GL_ALPHA : GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+
+        // Restore the state that was active when this function was called
+        TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, oldBoundTexture));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureGLES2::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -0,0 +1,115 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backend/Renderer/Null/BackendRenderTargetNull.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetNull::setClearColor(const Color&)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetNull::clearScreen()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetNull::drawGui(const std::shared_ptr<RootContainer>& root)
+    {
+        m_statistics = {};
+        m_lastTexture = nullptr;
+
+        drawRootContainer(root);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetNull::drawVertexArray(const RenderStates&, const Vertex*, std::size_t vertexCount,
+                                                  const int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
+    {
+        ++m_statistics.drawCalls;
+        m_statistics.vertices += vertexCount;
+        if (indices)
+            m_statistics.indices += indexCount;
+
+        if (texture.get() != m_lastTexture)
+        {
+            // Switching between textured and untextured triangles also counts, real renderers need to change the shader state
+            ++m_statistics.textureBinds;
+            m_lastTexture = texture.get();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const BackendRenderTargetNull::Statistics& BackendRenderTargetNull::getStatistics() const
+    {
+        return m_statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetNull::isOffscreenRenderingSupported() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetNull::updateClipping(FloatRect, FloatRect)
+    {
+        ++m_statistics.clipChanges;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendRenderTargetNull::createOffscreenTexture(Vector2u size)
+    {
+        auto texture = std::make_shared<BackendTexture>();
+        texture->loadTextureOnly(size, nullptr, true);
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetNull::setOffscreenTexture(const std::shared_ptr<BackendTexture>&, bool clear)
+    {
+        // A pass starts when the texture is cleared, restoring a previous target doesn't count
+        if (clear)
+            ++m_statistics.offscreenPasses;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
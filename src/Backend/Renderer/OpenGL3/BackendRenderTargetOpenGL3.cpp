@@ -76,11 +76,14 @@ namespace tgui
         {
             "#version 330 core\n"
             "uniform sampler2D uTexture;\n"
+            "uniform float uDistanceField;\n"
             "in vec4 color;\n"
             "in vec2 texCoord;\n"
             "out vec4 outColor;\n"
             "void main() {\n"
-            "    outColor = texture(uTexture, texCoord) * color;\n"
+            "    vec4 texColor = texture(uTexture, texCoord);\n"
+            "    float edgeAlpha = clamp((texColor.a - 0.5) / max(fwidth(texColor.a), 0.0001) + 0.5, 0.0, 1.0);\n"
+            "    outColor = vec4(texColor.rgb, mix(texColor.a, edgeAlpha, uDistanceField)) * color;\n"
             "}"
         };
 
@@ -136,6 +139,9 @@ namespace tgui
         if (!TGUI_GLAD_GL_VERSION_4_3)
             m_projectionMatrixShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "projectionMatrix");
 
+        // Fonts can store glyphs as distance fields, the shader has to know when to reconstruct the edges from the texture
+        m_distanceFieldShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "uDistanceField");
+
         createBuffers();
 
         // Create a solid white 1x1 texture to pass to the shader when we aren't drawing a texture
@@ -152,6 +158,9 @@ namespace tgui
     {
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
+
+        if (m_offscreenFramebuffer != 0)
+            TGUI_GL_CHECK(glDeleteFramebuffers(1, &m_offscreenFramebuffer));
         TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_vertexArray));
     }
 
@@ -223,6 +232,7 @@ namespace tgui
                                                static_cast<int>(m_viewport.width), static_cast<int>(m_viewport.height)};
         TGUI_GL_CHECK(glViewport(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
         TGUI_GL_CHECK(glScissor(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
+        m_scissor = viewportGL;
         TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
         TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
         TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
@@ -231,9 +241,21 @@ namespace tgui
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        m_distanceFieldBound = false;
+        TGUI_GL_CHECK(glUniform1f(m_distanceFieldShaderUniformLocation, 0));
+
+        // When batching, all vertices are already transformed on the CPU so the projection matrix only has to be set once
+        if (m_batchingEnabled)
+        {
+            m_batchStatistics = {};
+            glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix());
+        }
 
         // Draw the widgets
-        root->draw(*this, {});
+        drawRootContainer(root);
+
+        if (m_batchingEnabled)
+            flushBatch();
 
         m_currentTexture = nullptr;
 
@@ -269,29 +291,45 @@ namespace tgui
         // Change the bound texture if it changed
         if (m_currentTexture != texture)
         {
-            if (texture)
-            {
-                TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
-                m_currentTexture = std::static_pointer_cast<BackendTextureOpenGL3>(texture);
+            // The queued vertices still need to be drawn with the old texture
+            if (m_batchingEnabled)
+                flushBatch();
+
+            TGUI_ASSERT(!texture || std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
+            bindTexture(std::static_pointer_cast<BackendTextureOpenGL3>(texture));
+        }
+
+        Transform finalTransform = states.transform;
+        finalTransform.roundPosition(); // Avoid blurry texts
+
+        if (m_batchingEnabled)
+        {
+            // Add the vertices to the batch, transformed to their final position (only the projection still has to be applied)
+            const auto indexOffset = static_cast<unsigned int>(m_batchVertices.size());
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                m_batchVertices.push_back({finalTransform.transformPoint(vertices[i].position), vertices[i].color, vertices[i].texCoords});
 
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
+            if (indices)
+            {
+                for (std::size_t i = 0; i < indexCount; ++i)
+                    m_batchIndices.push_back(indexOffset + static_cast<unsigned int>(indices[i]));
             }
-            else
+            else // No indices were given, all vertices need to be drawn in the order they were provided
             {
-                m_currentTexture = nullptr;
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+                for (std::size_t i = 0; i < vertexCount; ++i)
+                    m_batchIndices.push_back(indexOffset + static_cast<unsigned int>(i));
             }
+
+            ++m_batchStatistics.batchedCalls;
+            return;
         }
 
         // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
         // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
+        // Batch rendering (see setBatchingEnabled) is much faster though when many widgets are drawn.
         TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, vertexCount * sizeof(Vertex), vertices, GL_DYNAMIC_DRAW));
 
-        Transform finalTransform = states.transform;
-        finalTransform.roundPosition(); // Avoid blurry texts
         finalTransform = m_projectionTransform * finalTransform;
-
         glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix());
 
         if (indices)
@@ -307,17 +345,177 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetOpenGL3::setBatchingEnabled(bool enabled)
+    {
+        TGUI_ASSERT(m_batchVertices.empty(), "BackendRenderTargetOpenGL3::setBatchingEnabled can't be called while drawing");
+        m_batchingEnabled = enabled;
+        m_batchStatistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::isBatchingEnabled() const
+    {
+        return m_batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const BackendRenderTargetOpenGL3::BatchStatistics& BackendRenderTargetOpenGL3::getBatchStatistics() const
+    {
+        return m_batchStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::isOffscreenRenderingSupported() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawOffscreenTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture)
+    {
+        // The texture contains premultiplied alpha, so its colors may not be multiplied with the alpha value again
+        if (m_batchingEnabled)
+            flushBatch();
+        TGUI_GL_CHECK(glBlendFuncSeparate(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+
+        // The rows of the framebuffer were stored from bottom to top, so the texture coordinates are flipped vertically
+        const Vector2f scale{m_viewport.width / m_viewRect.width, m_viewport.height / m_viewRect.height};
+        const Vector2f size{texture->getSize().x / scale.x, texture->getSize().y / scale.y};
+        const Vertex::Color vertexColor(Color::White);
+        const std::array<Vertex, 4> vertices = {{
+            {{0, 0}, vertexColor, {0, 1}},
+            {{0, size.y}, vertexColor, {0, 0}},
+            {{size.x, 0}, vertexColor, {1, 1}},
+            {{size.x, size.y}, vertexColor, {1, 0}}
+        }};
+        const std::array<int, 2*3> indices = {{
+            0, 1, 2,
+            2, 1, 3
+        }};
+        drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), texture);
+
+        if (m_batchingEnabled)
+            flushBatch();
+
+        if (m_offscreenTexture)
+            TGUI_GL_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+        else
+            TGUI_GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetOpenGL3::updateClipping(FloatRect, FloatRect clipViewport)
     {
+        std::array<int, 4> scissor = {{0, 0, 0, 0}}; // Clip the entire window by default
         if ((clipViewport.width > 0) && (clipViewport.height > 0))
         {
-            TGUI_GL_CHECK(glScissor(static_cast<int>(clipViewport.left), static_cast<int>(m_targetSize.y - clipViewport.top - clipViewport.height),
-                                    static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)));
+            scissor = {{static_cast<int>(clipViewport.left), static_cast<int>(m_targetSize.y - clipViewport.top - clipViewport.height),
+                        static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)}};
         }
-        else // Clip the entire window
+
+        // Nested clipping layers often result in the same scissor rectangle, there is no need to interrupt the batch in that case
+        if (scissor == m_scissor)
+            return;
+
+        if (m_batchingEnabled)
+            flushBatch();
+
+        TGUI_GL_CHECK(glScissor(scissor[0], scissor[1], scissor[2], scissor[3]));
+        m_scissor = scissor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::clearClippingArea()
+    {
+        if (m_batchingEnabled)
+            flushBatch();
+
+        // The scissor test is enabled while drawing, so only the area inside the clipping rectangle gets cleared
+        TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendRenderTargetOpenGL3::createOffscreenTexture(Vector2u size)
+    {
+        // Smoothing is disabled so that pixels at the edges of the texture don't get mixed with pixels at the opposite side
+        auto texture = std::make_shared<BackendTextureOpenGL3>();
+        if (!texture->loadTextureOnly(size, nullptr, false))
+            return nullptr;
+
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setOffscreenTexture(const std::shared_ptr<BackendTexture>& texture, bool clear)
+    {
+        // The queued vertices still have to be drawn on the previous target
+        if (m_batchingEnabled)
+            flushBatch();
+
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
+
+            if (!m_offscreenFramebufferBound)
+            {
+                TGUI_GL_CHECK(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &m_windowFramebuffer));
+                if (m_offscreenFramebuffer == 0)
+                    TGUI_GL_CHECK(glGenFramebuffers(1, &m_offscreenFramebuffer));
+
+                TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_offscreenFramebuffer));
+                m_offscreenFramebufferBound = true;
+            }
+
+            const GLuint textureId = std::static_pointer_cast<BackendTextureOpenGL3>(texture)->getInternalTexture();
+            TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureId, 0));
+            TGUI_GL_CHECK(glViewport(0, 0, static_cast<GLsizei>(texture->getSize().x), static_cast<GLsizei>(texture->getSize().y)));
+
+            // The alpha channel is blended separately, so that semi-transparent pixels that are drawn on the transparent
+            // texture keep their alpha value. This results in a texture with premultiplied alpha.
+            TGUI_GL_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+
+            if (clear)
+            {
+                GLfloat oldClearColor[4];
+                TGUI_GL_CHECK(glGetFloatv(GL_COLOR_CLEAR_VALUE, oldClearColor));
+                TGUI_GL_CHECK(glDisable(GL_SCISSOR_TEST));
+                TGUI_GL_CHECK(glClearColor(0, 0, 0, 0));
+                TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+                TGUI_GL_CHECK(glClearColor(oldClearColor[0], oldClearColor[1], oldClearColor[2], oldClearColor[3]));
+                TGUI_GL_CHECK(glEnable(GL_SCISSOR_TEST));
+            }
+        }
+        else // Continue drawing to the window
         {
-            TGUI_GL_CHECK(glScissor(0, 0, 0, 0));
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(m_windowFramebuffer)));
+            m_offscreenFramebufferBound = false;
+
+            TGUI_GL_CHECK(glViewport(static_cast<int>(m_viewport.left), static_cast<int>(m_targetSize.y - m_viewport.top - m_viewport.height),
+                                     static_cast<int>(m_viewport.width), static_cast<int>(m_viewport.height)));
+            TGUI_GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
         }
+
+        // The texture that is being drawn to may not remain bound for sampling
+        bindTexture(nullptr);
+
+        // The scissor rectangle that is stored belongs to the previous target, so it has to be set again
+        m_scissor = {{-1, -1, -1, -1}};
+
+        m_projectionTransform = Transform();
+        m_projectionTransform.translate({-1 - (2.f * (m_viewRect.left / m_viewRect.width)), 1 + (2.f * (m_viewRect.top / m_viewRect.height))});
+        m_projectionTransform.scale({2.f / m_viewRect.width, -2.f / m_viewRect.height});
+
+        // When batching, the projection matrix is only set at the start of drawGui, so it has to be changed here as well
+        if (m_batchingEnabled)
+            glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -354,6 +552,45 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::bindTexture(const std::shared_ptr<BackendTextureOpenGL3>& texture)
+    {
+        m_currentTexture = texture;
+        if (texture)
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, texture->getInternalTexture()));
+        else
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+
+        const bool distanceField = (texture && texture->isAlphaTexture() && texture->isDistanceField());
+        if (distanceField != m_distanceFieldBound)
+        {
+            m_distanceFieldBound = distanceField;
+            TGUI_GL_CHECK(glUniform1f(m_distanceFieldShaderUniformLocation, distanceField ? 1.f : 0.f));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::flushBatch()
+    {
+        if (m_batchIndices.empty())
+            return;
+
+        // Orphan the old buffers and upload the entire batch at once
+        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, m_batchVertices.size() * sizeof(Vertex), m_batchVertices.data(), GL_STREAM_DRAW));
+        TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_batchIndices.size() * sizeof(GLuint), m_batchIndices.data(), GL_STREAM_DRAW));
+        TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_batchIndices.size()), GL_UNSIGNED_INT, 0));
+
+        ++m_batchStatistics.flushes;
+        m_batchStatistics.vertices += m_batchVertices.size();
+        m_batchStatistics.indices += m_batchIndices.size();
+
+        // Clearing the vectors keeps their capacity, so no allocations are needed once the buffers are large enough
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
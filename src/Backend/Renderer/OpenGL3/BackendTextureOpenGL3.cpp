@@ -46,7 +46,7 @@ namespace tgui
         TGUI_ASSERT(getBackend(), "BackendTextureOpenGL3 can't be created when there is no system backend initialized (was a gui created yet?)");
         TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureOpenGL3 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
 
-        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth));
+        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth) && !m_isAlphaTexture);
 
         BackendTexture::loadTextureOnly(size, pixels, smooth);
 
@@ -97,6 +97,89 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureOpenGL3::loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth)
+    {
+        TGUI_ASSERT(getBackend(), "BackendTextureOpenGL3 can't be created when there is no system backend initialized (was a gui created yet?)");
+        TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureOpenGL3 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
+
+        BackendTexture::loadTextureOnly(size, nullptr, smooth);
+        m_isAlphaTexture = true;
+
+        if (m_textureId != 0)
+            TGUI_GL_CHECK(glDeleteTextures(1, &m_textureId));
+
+        TGUI_GL_CHECK(glGenTextures(1, &m_textureId));
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+        GLint oldUnpackAlignment;
+        TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+        TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+
+        // The texture only has a red channel. The swizzle makes it behave as a white texture with the red channel as alpha,
+        // so that the shader can treat it the same as an RGBA texture.
+        const GLint swizzleMask[] = {GL_ONE, GL_ONE, GL_ONE, GL_RED};
+        TGUI_GL_CHECK(glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask));
+
+        if (TGUI_GLAD_GL_VERSION_4_2)
+        {
+            TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, GL_R8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
+            if (alphaPixels)
+                TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RED, GL_UNSIGNED_BYTE, alphaPixels));
+        }
+        else
+        {
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0));
+            TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, GL_RED, GL_UNSIGNED_BYTE, alphaPixels));
+        }
+
+        // Restore the state that was active when this function was called
+        TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, oldBoundTexture));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureOpenGL3::updateRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (m_textureId == 0)
+            return false;
+
+        BackendTexture::updateRegion(region, pixels);
+        if ((region.width == 0) || (region.height == 0))
+            return true;
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        GLint oldUnpackAlignment;
+        TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+
+        // Rows of alpha textures consist of single bytes and thus aren't necessarily 4-byte aligned
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+        TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, m_isAlphaTexture ? 1 : 4));
+        TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(region.left), static_cast<GLint>(region.top),
+                                      static_cast<GLsizei>(region.width), static_cast<GLsizei>(region.height),
+                                      m_isAlphaTexture ? GL_RED : GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+
+        // Restore the state that was active when this function was called
+        TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, oldBoundTexture));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureOpenGL3::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
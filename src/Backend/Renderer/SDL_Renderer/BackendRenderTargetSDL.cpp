@@ -101,8 +101,14 @@ namespace tgui
         if (oldBlendMode != SDL_BLENDMODE_BLEND)
             SDL_SetRenderDrawBlendMode(m_renderer, SDL_BLENDMODE_BLEND);
 
+        // We don't know which clipping rectangle is currently set
+        m_clipRect = {{0, 0, -1, -1}};
+        m_batchStatistics = {};
+
         // Draw the widgets
-        root->draw(*this, {});
+        drawRootContainer(root);
+        flushBatch();
+        m_batchTexture = nullptr;
 
         // Restore the old blend mode
         if (oldBlendMode != SDL_BLENDMODE_BLEND)
@@ -118,44 +124,78 @@ namespace tgui
     void BackendRenderTargetSDL::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
-        SDL_Texture* textureSDL = nullptr;
-        if (texture)
+        // Geometry with a different texture can't be part of the same SDL_RenderGeometry call
+        if (texture != m_batchTexture)
         {
-            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSDL>(texture), "BackendRenderTargetSDL requires textures of type BackendTextureSDL");
-            textureSDL = std::static_pointer_cast<BackendTextureSDL>(texture)->getInternalTexture();
+            TGUI_ASSERT(!texture || std::dynamic_pointer_cast<BackendTextureSDL>(texture), "BackendRenderTargetSDL requires textures of type BackendTextureSDL");
+
+            flushBatch();
+            m_batchTexture = texture;
         }
 
         Transform finalTransform = states.transform;
         finalTransform.roundPosition(); // Avoid blurry texts
         finalTransform = m_projectionTransform * finalTransform;
 
-        std::vector<Vertex> verticesSDL(vertices, vertices + vertexCount);
+        const int indexOffset = static_cast<int>(m_batchVertices.size());
         for (std::size_t i = 0; i < vertexCount; ++i)
+            m_batchVertices.push_back({finalTransform.transformPoint(vertices[i].position), vertices[i].color, vertices[i].texCoords});
+
+        if (indices)
         {
-            const Vector2f transformedPosition = finalTransform.transformPoint(vertices[i].position);
-            verticesSDL[i].position.x = transformedPosition.x;
-            verticesSDL[i].position.y = transformedPosition.y;
+            for (std::size_t i = 0; i < indexCount; ++i)
+                m_batchIndices.push_back(indexOffset + indices[i]);
+        }
+        else // No indices were given, all vertices need to be drawn in the order they were provided
+        {
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                m_batchIndices.push_back(indexOffset + static_cast<int>(i));
         }
 
-        // We use SDL_RenderGeometry instead of SDL_RenderGeometryRaw because it's easier and because the signature of
-        // the SDL_RenderGeometryRaw function is different in SDL 2.0.18 and SDL >= 2.0.20
-        static_assert(sizeof(Vertex) == sizeof(SDL_Vertex), "SDL_Vertex requires same memory layout as tgui::Vertex for cast to work");
-        SDL_RenderGeometry(m_renderer, textureSDL,
-                           reinterpret_cast<const SDL_Vertex*>(verticesSDL.data()), static_cast<int>(vertexCount),
-                           indices, static_cast<int>(indexCount));
+        ++m_batchStatistics.batchedCalls;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const BackendRenderTargetSDL::BatchStatistics& BackendRenderTargetSDL::getBatchStatistics() const
+    {
+        return m_batchStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetSDL::isOffscreenRenderingSupported() const
+    {
+        return m_renderer && SDL_RenderTargetSupported(m_renderer);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendRenderTargetSDL::updateClipping(FloatRect, FloatRect clipViewport)
     {
+        // A width of 0 is used to indicate that the entire window is clipped
+        std::array<int, 4> clipRect = {{0, 0, 0, 0}};
         if ((clipViewport.width > 0) && (clipViewport.height > 0))
+        {
+            clipRect = {{static_cast<int>(clipViewport.left - m_viewport.left), static_cast<int>(clipViewport.top - m_viewport.top),
+                         static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)}};
+        }
+
+        // Nested clipping layers often result in the same clipping rectangle, there is no need to interrupt the batch in that case
+        if (clipRect == m_clipRect)
+            return;
+
+        // The queued geometry has to be drawn with the old clipping rectangle
+        flushBatch();
+        m_clipRect = clipRect;
+
+        if (clipRect[2] > 0)
         {
             SDL_Rect clipRectSDL;
-            clipRectSDL.x = static_cast<int>(clipViewport.left - m_viewport.left);
-            clipRectSDL.y = static_cast<int>(clipViewport.top - m_viewport.top);
-            clipRectSDL.w = static_cast<int>(clipViewport.width);
-            clipRectSDL.h = static_cast<int>(clipViewport.height);
+            clipRectSDL.x = clipRect[0];
+            clipRectSDL.y = clipRect[1];
+            clipRectSDL.w = clipRect[2];
+            clipRectSDL.h = clipRect[3];
             SDL_RenderSetClipRect(m_renderer, &clipRectSDL);
         }
         else // Clip the entire window
@@ -165,6 +205,121 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::clearClippingArea()
+    {
+        // Nothing has to be cleared when the entire window is clipped
+        if (m_clipRect[2] <= 0)
+            return;
+
+        flushBatch();
+
+        // SDL_RenderClear ignores the clipping rectangle, so we fill the rectangle with the draw color (which was set in
+        // setClearColor) instead. Blending is disabled to overwrite the pixels even when the clear color is transparent.
+        SDL_SetRenderDrawBlendMode(m_renderer, SDL_BLENDMODE_NONE);
+        SDL_RenderFillRect(m_renderer, nullptr);
+        SDL_SetRenderDrawBlendMode(m_renderer, SDL_BLENDMODE_BLEND);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendRenderTargetSDL::createOffscreenTexture(Vector2u size)
+    {
+        SDL_Texture* textureSDL = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET,
+                                                    static_cast<int>(size.x), static_cast<int>(size.y));
+        if (!textureSDL)
+            return nullptr;
+
+        // Move the ownership of the texture to the backend texture (we thus don't need to call SDL_DestroyTexture ourselves)
+        auto texture = std::make_shared<BackendTextureSDL>(m_renderer);
+        texture->replaceInternalTexture(textureSDL);
+
+        // SDL_BLENDMODE_BLEND blends the alpha channel separately, so the texture will contain premultiplied alpha.
+        // The texture thus has to be drawn with a blend mode that doesn't multiply the colors with the alpha value again.
+        const SDL_BlendMode premultipliedBlendMode = SDL_ComposeCustomBlendMode(
+            SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+            SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+        if (SDL_SetTextureBlendMode(textureSDL, premultipliedBlendMode) != 0)
+            return nullptr;
+
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::setOffscreenTexture(const std::shared_ptr<BackendTexture>& texture, bool clear)
+    {
+        // The queued geometry still has to be drawn on the previous target
+        flushBatch();
+
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSDL>(texture), "BackendRenderTargetSDL requires textures of type BackendTextureSDL");
+
+            if (!m_offscreenTargetSet)
+            {
+                m_windowTarget = SDL_GetRenderTarget(m_renderer);
+                m_offscreenTargetSet = true;
+            }
+
+            SDL_SetRenderTarget(m_renderer, std::static_pointer_cast<BackendTextureSDL>(texture)->getInternalTexture());
+
+            if (clear)
+            {
+                // SDL_RenderClear ignores the viewport and clipping rectangle, so the entire texture is cleared
+                std::uint8_t oldColor[4];
+                SDL_GetRenderDrawColor(m_renderer, &oldColor[0], &oldColor[1], &oldColor[2], &oldColor[3]);
+                SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 0);
+                SDL_RenderClear(m_renderer);
+                SDL_SetRenderDrawColor(m_renderer, oldColor[0], oldColor[1], oldColor[2], oldColor[3]);
+            }
+        }
+        else // Continue drawing to the window
+        {
+            SDL_SetRenderTarget(m_renderer, m_windowTarget);
+            m_windowTarget = nullptr;
+            m_offscreenTargetSet = false;
+        }
+
+        // Changing the render target resets the viewport and clipping rectangle
+        SDL_Rect viewport;
+        viewport.x = static_cast<int>(m_viewport.left);
+        viewport.y = static_cast<int>(m_viewport.top);
+        viewport.w = static_cast<int>(m_viewport.width);
+        viewport.h = static_cast<int>(m_viewport.height);
+        SDL_RenderSetViewport(m_renderer, &viewport);
+        m_clipRect = {{0, 0, -1, -1}};
+
+        m_projectionTransform = Transform();
+        m_projectionTransform.translate({(-m_viewRect.left / m_viewRect.width) * m_viewport.width, (-m_viewRect.top / m_viewRect.height) * m_viewport.height});
+        m_projectionTransform.scale({m_viewport.width / m_viewRect.width, m_viewport.height / m_viewRect.height});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::flushBatch()
+    {
+        if (m_batchIndices.empty())
+            return;
+
+        // We use SDL_RenderGeometry instead of SDL_RenderGeometryRaw because it's easier and because the signature of
+        // the SDL_RenderGeometryRaw function is different in SDL 2.0.18 and SDL >= 2.0.20
+        static_assert(sizeof(Vertex) == sizeof(SDL_Vertex), "SDL_Vertex requires same memory layout as tgui::Vertex for cast to work");
+        SDL_Texture* textureSDL = m_batchTexture ? std::static_pointer_cast<BackendTextureSDL>(m_batchTexture)->getInternalTexture() : nullptr;
+        SDL_RenderGeometry(m_renderer, textureSDL,
+                           reinterpret_cast<const SDL_Vertex*>(m_batchVertices.data()), static_cast<int>(m_batchVertices.size()),
+                           m_batchIndices.data(), static_cast<int>(m_batchIndices.size()));
+
+        ++m_batchStatistics.flushes;
+        m_batchStatistics.vertices += m_batchVertices.size();
+        m_batchStatistics.indices += m_batchIndices.size();
+
+        // Clearing the vectors keeps their capacity, so the memory is reused for the next batch
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,6 +118,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSDL::updateRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (!m_texture)
+            return false;
+
+        BackendTexture::updateRegion(region, pixels);
+        if ((region.width == 0) || (region.height == 0))
+            return true;
+
+        const SDL_Rect rect{static_cast<int>(region.left), static_cast<int>(region.top), static_cast<int>(region.width), static_cast<int>(region.height)};
+
+        // SDL has no single-channel texture format that can be drawn as white, so alpha textures are stored as RGBA
+        if (m_isAlphaTexture)
+        {
+            const auto rgbaPixels = convertAlphaToPixels(pixels, static_cast<std::size_t>(region.width) * region.height);
+            return (SDL_UpdateTexture(m_texture, &rect, rgbaPixels.get(), static_cast<int>(region.width * 4)) == 0);
+        }
+
+        return (SDL_UpdateTexture(m_texture, &rect, pixels, static_cast<int>(region.width * 4)) == 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSDL::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -145,6 +168,7 @@ namespace tgui
 
         m_texture = texture;
         m_pixels = nullptr;
+        m_isAlphaTexture = false;
 
         int width;
         int height;
@@ -27,7 +27,9 @@
 #include <TGUI/Backend/Renderer/SFML-Graphics/BackendTextureSFML.hpp>
 #include <TGUI/Container.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <cmath>
 #include <array>
 
@@ -35,6 +37,23 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Texture that is returned by createOffscreenTexture. The widgets are drawn on the render texture, the internal
+        // texture of the base class is never used.
+        class OffscreenTextureSFML : public BackendTextureSFML
+        {
+        public:
+            OffscreenTextureSFML(Vector2u size)
+            {
+                m_imageSize = size;
+                m_isSmooth = false;
+            }
+
+            sf::RenderTexture renderTexture;
+        };
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendRenderTargetSFML::BackendRenderTargetSFML(sf::RenderTarget& target) :
@@ -75,7 +94,7 @@ namespace tgui
         updateClipping(m_viewRect, m_viewport);
 
         // Draw the widgets
-        root->draw(*this, {});
+        drawRootContainer(root);
 
         // Restore the old view
         m_target->setView(oldView);
@@ -181,6 +200,47 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendRenderTargetSFML::isOffscreenRenderingSupported() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSFML::drawOffscreenTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture)
+    {
+        TGUI_ASSERT(std::dynamic_pointer_cast<OffscreenTextureSFML>(texture), "BackendRenderTargetSFML::drawOffscreenTexture requires a texture that was created by createOffscreenTexture");
+        const sf::Texture& textureSFML = std::static_pointer_cast<OffscreenTextureSFML>(texture)->renderTexture.getTexture();
+
+        // The texture contains premultiplied alpha, so its colors may not be multiplied with the alpha value again
+        sf::RenderStates statesSFML = convertRenderStates(states, nullptr);
+        statesSFML.texture = &textureSFML;
+#if SFML_VERSION_MAJOR >= 3
+        statesSFML.blendMode = sf::BlendMode(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+#else
+        statesSFML.blendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+#endif
+
+        // SFML uses texture coordinates in pixels
+        const Vector2f scale{m_viewport.width / m_viewRect.width, m_viewport.height / m_viewRect.height};
+        const Vector2f textureSize{texture->getSize()};
+        const Vector2f size{textureSize.x / scale.x, textureSize.y / scale.y};
+        const Vertex::Color vertexColor(Color::White);
+        const std::array<Vertex, 6> vertices = {{
+            {{0, 0}, vertexColor, {0, 0}},
+            {{0, size.y}, vertexColor, {0, textureSize.y}},
+            {{size.x, 0}, vertexColor, {textureSize.x, 0}},
+            {{size.x, 0}, vertexColor, {textureSize.x, 0}},
+            {{0, size.y}, vertexColor, {0, textureSize.y}},
+            {{size.x, size.y}, vertexColor, {textureSize.x, textureSize.y}}
+        }};
+
+        static_assert(sizeof(Vertex) == sizeof(sf::Vertex), "Size of sf::Vertex has to match with tgui::Vertex for optimization to work");
+        m_target->draw(reinterpret_cast<const sf::Vertex*>(vertices.data()), vertices.size(), sf::PrimitiveType::Triangles, statesSFML);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetSFML::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
         if ((clipViewport.width > 0) && (clipViewport.height > 0))
@@ -201,6 +261,63 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetSFML::clearClippingArea()
+    {
+        // The view of the render target was set to the clipping rectangle, so we fill the entire view with the clear color.
+        // Blending is disabled to overwrite the pixels even when the clear color is transparent.
+        const sf::View& view = m_target->getView();
+        sf::RectangleShape rect{view.getSize()};
+        rect.setPosition(view.getCenter() - view.getSize() / 2.f);
+        rect.setFillColor({m_clearColor.getRed(), m_clearColor.getGreen(), m_clearColor.getBlue(), m_clearColor.getAlpha()});
+        m_target->draw(rect, sf::RenderStates{sf::BlendNone});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendRenderTargetSFML::createOffscreenTexture(Vector2u size)
+    {
+        auto texture = std::make_shared<OffscreenTextureSFML>(size);
+#if SFML_VERSION_MAJOR >= 3
+        if (!texture->renderTexture.create({size.x, size.y}))
+#else
+        if (!texture->renderTexture.create(size.x, size.y))
+#endif
+            return nullptr;
+
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSFML::setOffscreenTexture(const std::shared_ptr<BackendTexture>& texture, bool clear)
+    {
+        // Finish drawing to the texture that we were drawing to, in case it will be drawn next
+        if (m_windowTarget)
+            static_cast<sf::RenderTexture*>(m_target)->display();
+
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<OffscreenTextureSFML>(texture), "BackendRenderTargetSFML::setOffscreenTexture requires a texture that was created by createOffscreenTexture");
+
+            if (!m_windowTarget)
+                m_windowTarget = m_target;
+
+            // The default blend mode of SFML blends the alpha channel separately, so the texture will contain premultiplied alpha
+            sf::RenderTexture& renderTexture = std::static_pointer_cast<OffscreenTextureSFML>(texture)->renderTexture;
+            if (clear)
+                renderTexture.clear(sf::Color::Transparent);
+
+            m_target = &renderTexture;
+        }
+        else // Continue drawing to the window
+        {
+            m_target = m_windowTarget;
+            m_windowTarget = nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     sf::RenderStates BackendRenderTargetSFML::convertRenderStates(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture)
     {
         const float *transformMatrix = states.transform.getMatrix();
@@ -62,6 +62,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSFML::updateRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        if ((m_texture.getSize().x == 0) || (Vector2u{m_texture.getSize()} != m_imageSize))
+            return false;
+
+        BackendTexture::updateRegion(region, pixels);
+        if ((region.width == 0) || (region.height == 0))
+            return true;
+
+        // SFML only has RGBA textures, so alpha textures are stored as RGBA
+        std::unique_ptr<std::uint8_t[]> rgbaPixels;
+        if (m_isAlphaTexture)
+        {
+            rgbaPixels = convertAlphaToPixels(pixels, static_cast<std::size_t>(region.width) * region.height);
+            pixels = rgbaPixels.get();
+        }
+
+#if SFML_VERSION_MAJOR >= 3
+        m_texture.update(pixels, {region.width, region.height}, {region.left, region.top});
+#else
+        m_texture.update(pixels, region.width, region.height, region.left, region.top);
+#endif
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSFML::setSmooth(bool smooth)
     {
         BackendTexture::setSmooth(smooth);
@@ -91,6 +118,7 @@ namespace tgui
         m_pixels = nullptr;
         m_imageSize = {texture.getSize().x, texture.getSize().y};
         m_isSmooth = texture.isSmooth();
+        m_isAlphaTexture = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,575 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backend/Renderer/Software/BackendRenderTargetSoftware.hpp>
+#include <TGUI/Container.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define TGUI_SOFTWARE_RENDERER_USE_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define TGUI_SOFTWARE_RENDERER_USE_SSE2 0
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Divides a value in the range [0, 255*255] by 255, with rounding to the nearest integer
+        inline std::uint32_t divideBy255(std::uint32_t value)
+        {
+            value += 128;
+            return (value + (value >> 8)) >> 8;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The color channels are blended like the OpenGL backends do (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA). The alpha channel
+        // is composited on top of the existing alpha, so that the buffer can still be used as an image with transparency.
+        inline void blendPixel(std::uint8_t* pixel, std::uint32_t red, std::uint32_t green, std::uint32_t blue, std::uint32_t alpha)
+        {
+            const std::uint32_t invAlpha = 255 - alpha;
+            pixel[0] = static_cast<std::uint8_t>(divideBy255(red * alpha + pixel[0] * invAlpha));
+            pixel[1] = static_cast<std::uint8_t>(divideBy255(green * alpha + pixel[1] * invAlpha));
+            pixel[2] = static_cast<std::uint8_t>(divideBy255(blue * alpha + pixel[2] * invAlpha));
+            pixel[3] = static_cast<std::uint8_t>(divideBy255(255 * alpha + pixel[3] * invAlpha));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Blends a color of which the color channels were already multiplied with its alpha (GL_ONE, GL_ONE_MINUS_SRC_ALPHA).
+        // This is used for offscreen textures, which store the result of blending semi-transparent pixels onto transparency.
+        inline void blendPremultipliedPixel(std::uint8_t* pixel, std::uint32_t red, std::uint32_t green, std::uint32_t blue, std::uint32_t alpha)
+        {
+            const std::uint32_t invAlpha = 255 - alpha;
+            pixel[0] = static_cast<std::uint8_t>(std::min<std::uint32_t>(255, red + divideBy255(pixel[0] * invAlpha)));
+            pixel[1] = static_cast<std::uint8_t>(std::min<std::uint32_t>(255, green + divideBy255(pixel[1] * invAlpha)));
+            pixel[2] = static_cast<std::uint8_t>(std::min<std::uint32_t>(255, blue + divideBy255(pixel[2] * invAlpha)));
+            pixel[3] = static_cast<std::uint8_t>(std::min<std::uint32_t>(255, alpha + divideBy255(pixel[3] * invAlpha)));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Overwrites a horizontal line of pixels with a single color
+        void fillSpan(std::uint8_t* pixels, std::size_t pixelCount, const Vertex::Color& color)
+        {
+            const std::uint8_t colorBytes[4] = {color.red, color.green, color.blue, color.alpha};
+            for (std::size_t i = 0; i < pixelCount; ++i)
+                std::memcpy(pixels + 4 * i, colorBytes, 4);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Blends a single color over a horizontal line of pixels. This is the most common case by far, as most of the gui
+        // consists of rectangles and borders with a single color, so this is the part that is vectorized.
+        void blendSpan(std::uint8_t* pixels, std::size_t pixelCount, const Vertex::Color& color)
+        {
+            if (color.alpha == 0)
+                return;
+
+            if (color.alpha == 255)
+            {
+                fillSpan(pixels, pixelCount, color);
+                return;
+            }
+
+            const std::uint32_t alpha = color.alpha;
+            const std::uint32_t invAlpha = 255 - alpha;
+            const std::uint32_t srcRed = color.red * alpha;
+            const std::uint32_t srcGreen = color.green * alpha;
+            const std::uint32_t srcBlue = color.blue * alpha;
+            const std::uint32_t srcAlpha = 255 * alpha;
+
+#if TGUI_SOFTWARE_RENDERER_USE_SSE2
+            // Four pixels are blended at once, with each channel widened to 16 bits. All intermediate values fit in an
+            // unsigned 16-bit integer, as src * alpha + dst * (255 - alpha) can never exceed 255 * 255.
+            const auto toShort = [](std::uint32_t value){ return static_cast<short>(static_cast<std::uint16_t>(value)); };
+            const __m128i srcTerm = _mm_setr_epi16(toShort(srcRed), toShort(srcGreen), toShort(srcBlue), toShort(srcAlpha),
+                                                   toShort(srcRed), toShort(srcGreen), toShort(srcBlue), toShort(srcAlpha));
+            const __m128i invAlphaTerm = _mm_set1_epi16(toShort(invAlpha));
+            const __m128i rounding = _mm_set1_epi16(128);
+            const __m128i zero = _mm_setzero_si128();
+            while (pixelCount >= 4)
+            {
+                const __m128i dst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels));
+
+                __m128i low = _mm_unpacklo_epi8(dst, zero);
+                __m128i high = _mm_unpackhi_epi8(dst, zero);
+                low = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(low, invAlphaTerm), srcTerm), rounding);
+                high = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(high, invAlphaTerm), srcTerm), rounding);
+                low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+                high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels), _mm_packus_epi16(low, high));
+                pixels += 16;
+                pixelCount -= 4;
+            }
+#endif
+            for (std::size_t i = 0; i < pixelCount; ++i)
+            {
+                std::uint8_t* pixel = pixels + 4 * i;
+                pixel[0] = static_cast<std::uint8_t>(divideBy255(srcRed + pixel[0] * invAlpha));
+                pixel[1] = static_cast<std::uint8_t>(divideBy255(srcGreen + pixel[1] * invAlpha));
+                pixel[2] = static_cast<std::uint8_t>(divideBy255(srcBlue + pixel[2] * invAlpha));
+                pixel[3] = static_cast<std::uint8_t>(divideBy255(srcAlpha + pixel[3] * invAlpha));
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the color of the texture at the given normalized texture coordinates.
+        // Alpha textures store a single byte per pixel and are sampled as white with that alpha value.
+        std::array<std::uint32_t, 4> sampleTexture(const std::uint8_t* texturePixels, Vector2u textureSize, bool alphaTexture, bool smooth, float u, float v)
+        {
+            const std::size_t bytesPerPixel = alphaTexture ? 1 : 4;
+            const int width = static_cast<int>(textureSize.x);
+            const int height = static_cast<int>(textureSize.y);
+            if (!smooth)
+            {
+                const int x = std::max(0, std::min(width - 1, static_cast<int>(std::floor(u * width))));
+                const int y = std::max(0, std::min(height - 1, static_cast<int>(std::floor(v * height))));
+                const std::uint8_t* texel = texturePixels + (static_cast<std::size_t>(y) * textureSize.x + static_cast<std::size_t>(x)) * bytesPerPixel;
+                if (alphaTexture)
+                    return {{255, 255, 255, texel[0]}};
+                else
+                    return {{texel[0], texel[1], texel[2], texel[3]}};
+            }
+
+            // Bilinear filtering, with the weights stored as fixed point numbers between 0 and 256
+            const float texelX = u * width - 0.5f;
+            const float texelY = v * height - 0.5f;
+            const float floorX = std::floor(texelX);
+            const float floorY = std::floor(texelY);
+            const std::uint32_t weightX = static_cast<std::uint32_t>((texelX - floorX) * 256);
+            const std::uint32_t weightY = static_cast<std::uint32_t>((texelY - floorY) * 256);
+            const int x0 = std::max(0, std::min(width - 1, static_cast<int>(floorX)));
+            const int y0 = std::max(0, std::min(height - 1, static_cast<int>(floorY)));
+            const int x1 = std::max(0, std::min(width - 1, static_cast<int>(floorX) + 1));
+            const int y1 = std::max(0, std::min(height - 1, static_cast<int>(floorY) + 1));
+
+            const std::uint8_t* texel00 = texturePixels + (static_cast<std::size_t>(y0) * textureSize.x + static_cast<std::size_t>(x0)) * bytesPerPixel;
+            const std::uint8_t* texel10 = texturePixels + (static_cast<std::size_t>(y0) * textureSize.x + static_cast<std::size_t>(x1)) * bytesPerPixel;
+            const std::uint8_t* texel01 = texturePixels + (static_cast<std::size_t>(y1) * textureSize.x + static_cast<std::size_t>(x0)) * bytesPerPixel;
+            const std::uint8_t* texel11 = texturePixels + (static_cast<std::size_t>(y1) * textureSize.x + static_cast<std::size_t>(x1)) * bytesPerPixel;
+
+            const auto interpolate = [=](unsigned int i) -> std::uint32_t {
+                const std::uint32_t top = texel00[i] * (256 - weightX) + texel10[i] * weightX;
+                const std::uint32_t bottom = texel01[i] * (256 - weightX) + texel11[i] * weightX;
+                return (top * (256 - weightY) + bottom * weightY + 32768) >> 16;
+            };
+
+            if (alphaTexture)
+                return {{255, 255, 255, interpolate(0)}};
+
+            std::array<std::uint32_t, 4> color;
+            for (unsigned int i = 0; i < 4; ++i)
+                color[i] = interpolate(i);
+            return color;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Edge function of a triangle, written as coefX * x + coefY * y + offset. It is positive on the inside of the edge.
+        struct EdgeFunction
+        {
+            EdgeFunction(Vector2f from, Vector2f to) :
+                coefX{from.y - to.y},
+                coefY{to.x - from.x},
+                offset{-(coefX * from.x + coefY * from.y)},
+                // Pixels that lie exactly on the edge only belong to the triangle if it is a top or left edge. This ensures that
+                // the pixels on the diagonal of a rectangle aren't drawn twice, which would be visible with semi-transparent colors.
+                topLeft{(to.y < from.y) || ((to.y == from.y) && (to.x > from.x))}
+            {
+            }
+
+            float evaluate(float x, float y) const
+            {
+                return coefX * x + coefY * y + offset;
+            }
+
+            bool contains(float value) const
+            {
+                return (value > 0) || ((value == 0) && topLeft);
+            }
+
+            float coefX;
+            float coefY;
+            float offset;
+            bool topLeft;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::setClearColor(const Color& color)
+    {
+        m_clearColor = color;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::clearScreen()
+    {
+        fillArea({{0, 0, static_cast<int>(m_size.x), static_cast<int>(m_size.y)}});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::setView(FloatRect view, FloatRect viewport, Vector2f targetSize)
+    {
+        BackendRenderTarget::setView(view, viewport, targetSize);
+
+        const Vector2u newSize{static_cast<unsigned int>(std::max(0.f, std::round(targetSize.x))),
+                               static_cast<unsigned int>(std::max(0.f, std::round(targetSize.y)))};
+        if (newSize != m_size)
+        {
+            m_size = newSize;
+            m_pixels.assign(static_cast<std::size_t>(m_size.x) * m_size.y * 4, 0);
+        }
+
+        updateProjectionTransform();
+        updateClipping(view, viewport);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawGui(const std::shared_ptr<RootContainer>& root)
+    {
+        if (m_pixels.empty() || (m_viewRect.width <= 0) || (m_viewRect.height <= 0))
+            return;
+
+        // Only the viewport can be drawn to, unless a clipping layer reduces the area even further
+        updateClipping(m_viewRect, m_viewport);
+
+        drawRootContainer(root);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawVertexArray(const RenderStates& states, const Vertex* vertices,
+        std::size_t vertexCount, const int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
+    {
+        if (m_pixels.empty() || (m_clipRect[0] >= m_clipRect[2]) || (m_clipRect[1] >= m_clipRect[3]))
+            return;
+
+        const BackendTextureSoftware* textureSoftware = nullptr;
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSoftware>(texture), "BackendRenderTargetSoftware requires textures of type BackendTextureSoftware");
+            textureSoftware = static_cast<const BackendTextureSoftware*>(texture.get());
+            if (!textureSoftware->getInternalPixels())
+                return;
+        }
+
+        Transform finalTransform = states.transform;
+        finalTransform.roundPosition(); // Avoid blurry texts
+        finalTransform = m_projectionTransform * finalTransform;
+
+        m_transformedVertices.clear();
+        for (std::size_t i = 0; i < vertexCount; ++i)
+            m_transformedVertices.push_back({finalTransform.transformPoint(vertices[i].position), vertices[i].color, vertices[i].texCoords});
+
+        if (indices)
+        {
+            for (std::size_t i = 0; i + 2 < indexCount; i += 3)
+            {
+                drawTriangle(m_transformedVertices[static_cast<std::size_t>(indices[i])],
+                             m_transformedVertices[static_cast<std::size_t>(indices[i+1])],
+                             m_transformedVertices[static_cast<std::size_t>(indices[i+2])],
+                             textureSoftware);
+            }
+        }
+        else // No indices were given, the vertices form a list of triangles
+        {
+            for (std::size_t i = 0; i + 2 < vertexCount; i += 3)
+                drawTriangle(m_transformedVertices[i], m_transformedVertices[i+1], m_transformedVertices[i+2], textureSoftware);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::uint8_t* BackendRenderTargetSoftware::getPixels() const
+    {
+        if (m_pixels.empty())
+            return nullptr;
+
+        return m_pixels.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendRenderTargetSoftware::getSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetSoftware::isOffscreenRenderingSupported() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawOffscreenTexture(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture)
+    {
+        m_drawingPremultipliedTexture = true;
+        BackendRenderTarget::drawOffscreenTexture(states, texture);
+        m_drawingPremultipliedTexture = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::updateClipping(FloatRect, FloatRect clipViewport)
+    {
+        // An empty rectangle is used to indicate that the entire window is clipped
+        m_clipRect = {{0, 0, 0, 0}};
+        if ((clipViewport.width <= 0) || (clipViewport.height <= 0))
+            return;
+
+        const int left = static_cast<int>(clipViewport.left);
+        const int top = static_cast<int>(clipViewport.top);
+        m_clipRect = {{std::max(0, left), std::max(0, top),
+                       std::min(static_cast<int>(m_size.x), left + static_cast<int>(clipViewport.width)),
+                       std::min(static_cast<int>(m_size.y), top + static_cast<int>(clipViewport.height))}};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::clearClippingArea()
+    {
+        fillArea(m_clipRect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendRenderTargetSoftware::createOffscreenTexture(Vector2u size)
+    {
+        auto texture = std::make_shared<BackendTextureSoftware>();
+        texture->loadTextureOnly(size, nullptr, true);
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::setOffscreenTexture(const std::shared_ptr<BackendTexture>& texture, bool clear)
+    {
+        // The pixels of a texture are swapped into our buffer while drawing to it, so that no pixels have to be copied.
+        // Give the pixels back to the texture or window from which they were taken.
+        if (m_offscreenPixelsOwner)
+            m_offscreenPixelsOwner->swapInternalPixels(m_pixels);
+        else
+        {
+            m_windowPixels.swap(m_pixels);
+            m_windowSize = m_size;
+        }
+
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSoftware>(texture), "BackendRenderTargetSoftware requires textures of type BackendTextureSoftware");
+            m_offscreenPixelsOwner = std::static_pointer_cast<BackendTextureSoftware>(texture);
+            m_offscreenPixelsOwner->swapInternalPixels(m_pixels);
+            m_size = texture->getSize();
+
+            if (clear)
+                std::fill(m_pixels.begin(), m_pixels.end(), static_cast<std::uint8_t>(0));
+        }
+        else
+        {
+            m_offscreenPixelsOwner = nullptr;
+            m_windowPixels.swap(m_pixels);
+            m_size = m_windowSize;
+        }
+
+        updateProjectionTransform();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::updateProjectionTransform()
+    {
+        m_projectionTransform = Transform();
+        if ((m_viewRect.width > 0) && (m_viewRect.height > 0))
+        {
+            const Vector2f scale{m_viewport.width / m_viewRect.width, m_viewport.height / m_viewRect.height};
+            m_projectionTransform.translate({m_viewport.left - (m_viewRect.left * scale.x), m_viewport.top - (m_viewRect.top * scale.y)});
+            m_projectionTransform.scale(scale);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::fillArea(const std::array<int, 4>& area)
+    {
+        if ((area[0] >= area[2]) || (area[1] >= area[3]))
+            return;
+
+        const Vertex::Color color{m_clearColor.getRed(), m_clearColor.getGreen(), m_clearColor.getBlue(), m_clearColor.getAlpha()};
+        for (int y = area[1]; y < area[3]; ++y)
+        {
+            std::uint8_t* row = &m_pixels[(static_cast<std::size_t>(y) * m_size.x + static_cast<std::size_t>(area[0])) * 4];
+            fillSpan(row, static_cast<std::size_t>(area[2] - area[0]), color);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawTriangle(const Vertex& vertex0, const Vertex& vertex1, const Vertex& vertex2, const BackendTextureSoftware* texture)
+    {
+        // Make sure the vertices are always in the same order, so that the edge functions are positive inside the triangle
+        const Vertex* v0 = &vertex0;
+        const Vertex* v1 = &vertex1;
+        const Vertex* v2 = &vertex2;
+        float area = EdgeFunction(v0->position, v1->position).evaluate(v2->position.x, v2->position.y);
+        if (area == 0)
+            return;
+        if (area < 0)
+        {
+            std::swap(v1, v2);
+            area = -area;
+        }
+
+        // Only the pixels inside the bounding box of the triangle and inside the clipping rectangle have to be checked
+        const int minX = std::max(m_clipRect[0], static_cast<int>(std::floor(std::min({v0->position.x, v1->position.x, v2->position.x}))));
+        const int minY = std::max(m_clipRect[1], static_cast<int>(std::floor(std::min({v0->position.y, v1->position.y, v2->position.y}))));
+        const int maxX = std::min(m_clipRect[2], static_cast<int>(std::ceil(std::max({v0->position.x, v1->position.x, v2->position.x}))));
+        const int maxY = std::min(m_clipRect[3], static_cast<int>(std::ceil(std::max({v0->position.y, v1->position.y, v2->position.y}))));
+        if ((minX >= maxX) || (minY >= maxY))
+            return;
+
+        // The edge function opposite to a vertex determines the weight of that vertex
+        const EdgeFunction edge0{v1->position, v2->position};
+        const EdgeFunction edge1{v2->position, v0->position};
+        const EdgeFunction edge2{v0->position, v1->position};
+
+        const bool singleColor = (std::memcmp(&v0->color, &v1->color, sizeof(Vertex::Color)) == 0)
+                              && (std::memcmp(&v0->color, &v2->color, sizeof(Vertex::Color)) == 0);
+
+        const std::uint8_t* texturePixels = texture ? texture->getInternalPixels() : nullptr;
+        const Vector2u textureSize = texture ? texture->getSize() : Vector2u{};
+        const bool textureSmooth = texture ? texture->isSmooth() : false;
+        const bool alphaTexture = texture ? texture->isAlphaTexture() : false;
+        const bool distanceField = alphaTexture && texture->isDistanceField();
+
+        // Change in texture coordinates when moving one pixel to the right or down, needed to find the edges in a distance field
+        const float uPerPixelX = (v0->texCoords.x * edge0.coefX + v1->texCoords.x * edge1.coefX + v2->texCoords.x * edge2.coefX) / area;
+        const float vPerPixelX = (v0->texCoords.y * edge0.coefX + v1->texCoords.y * edge1.coefX + v2->texCoords.y * edge2.coefX) / area;
+        const float uPerPixelY = (v0->texCoords.x * edge0.coefY + v1->texCoords.x * edge1.coefY + v2->texCoords.x * edge2.coefY) / area;
+        const float vPerPixelY = (v0->texCoords.y * edge0.coefY + v1->texCoords.y * edge1.coefY + v2->texCoords.y * edge2.coefY) / area;
+
+        for (int y = minY; y < maxY; ++y)
+        {
+            const float pixelY = y + 0.5f;
+            std::uint8_t* row = &m_pixels[static_cast<std::size_t>(y) * m_size.x * 4];
+
+            // Find the first and last pixel on this row that are inside the triangle. Since a triangle is convex, all pixels
+            // in between are also inside the triangle.
+            int spanStart = minX;
+            while ((spanStart < maxX)
+                && !(edge0.contains(edge0.evaluate(spanStart + 0.5f, pixelY))
+                  && edge1.contains(edge1.evaluate(spanStart + 0.5f, pixelY))
+                  && edge2.contains(edge2.evaluate(spanStart + 0.5f, pixelY))))
+            {
+                ++spanStart;
+            }
+
+            int spanEnd = spanStart;
+            while ((spanEnd < maxX)
+                && edge0.contains(edge0.evaluate(spanEnd + 0.5f, pixelY))
+                && edge1.contains(edge1.evaluate(spanEnd + 0.5f, pixelY))
+                && edge2.contains(edge2.evaluate(spanEnd + 0.5f, pixelY)))
+            {
+                ++spanEnd;
+            }
+
+            if (spanStart == spanEnd)
+                continue;
+
+            if (!texturePixels && singleColor)
+            {
+                blendSpan(row + static_cast<std::size_t>(spanStart) * 4, static_cast<std::size_t>(spanEnd - spanStart), v0->color);
+                continue;
+            }
+
+            for (int x = spanStart; x < spanEnd; ++x)
+            {
+                const float pixelX = x + 0.5f;
+                const float weight0 = edge0.evaluate(pixelX, pixelY) / area;
+                const float weight1 = edge1.evaluate(pixelX, pixelY) / area;
+                const float weight2 = 1 - weight0 - weight1;
+
+                std::array<std::uint32_t, 4> color;
+                if (singleColor)
+                    color = {{v0->color.red, v0->color.green, v0->color.blue, v0->color.alpha}};
+                else
+                {
+                    const auto interpolate = [=](std::uint8_t c0, std::uint8_t c1, std::uint8_t c2){
+                        return static_cast<std::uint32_t>(std::max(0.f, std::min(255.f, std::round(c0 * weight0 + c1 * weight1 + c2 * weight2))));
+                    };
+                    color = {{interpolate(v0->color.red, v1->color.red, v2->color.red),
+                              interpolate(v0->color.green, v1->color.green, v2->color.green),
+                              interpolate(v0->color.blue, v1->color.blue, v2->color.blue),
+                              interpolate(v0->color.alpha, v1->color.alpha, v2->color.alpha)}};
+                }
+
+                if (texturePixels)
+                {
+                    const float u = v0->texCoords.x * weight0 + v1->texCoords.x * weight1 + v2->texCoords.x * weight2;
+                    const float v = v0->texCoords.y * weight0 + v1->texCoords.y * weight1 + v2->texCoords.y * weight2;
+                    std::array<std::uint32_t, 4> texel = sampleTexture(texturePixels, textureSize, alphaTexture, textureSmooth, u, v);
+                    if (distanceField)
+                    {
+                        // Reconstruct the edge from the distances, with a transition that is one pixel wide like fwidth in a shader
+                        const std::uint32_t distanceX = sampleTexture(texturePixels, textureSize, true, true, u + uPerPixelX, v + vPerPixelX)[3];
+                        const std::uint32_t distanceY = sampleTexture(texturePixels, textureSize, true, true, u + uPerPixelY, v + vPerPixelY)[3];
+                        const float distance = texel[3] / 255.f;
+                        const float edgeWidth = std::max((std::abs(static_cast<float>(distanceX) - texel[3]) + std::abs(static_cast<float>(distanceY) - texel[3])) / 255.f, 0.0001f);
+                        texel[3] = static_cast<std::uint32_t>(std::max(0.f, std::min(1.f, (distance - 0.5f) / edgeWidth + 0.5f)) * 255 + 0.5f);
+                    }
+
+                    for (unsigned int i = 0; i < 4; ++i)
+                        color[i] = divideBy255(color[i] * texel[i]);
+                }
+
+                if (m_drawingPremultipliedTexture)
+                    blendPremultipliedPixel(row + static_cast<std::size_t>(x) * 4, color[0], color[1], color[2], color[3]);
+                else if (color[3] > 0)
+                    blendPixel(row + static_cast<std::size_t>(x) * 4, color[0], color[1], color[2], color[3]);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,106 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backend/Renderer/Software/BackendTextureSoftware.hpp>
+
+#include <cstring>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureSoftware::loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth)
+    {
+        BackendTexture::loadTextureOnly(size, pixels, smooth);
+
+        // The pixels are copied, as the pointer that is passed to us is only valid during this call
+        const std::size_t byteCount = static_cast<std::size_t>(size.x) * size.y * 4;
+        if (pixels)
+            m_texturePixels.assign(pixels, pixels + byteCount);
+        else
+            m_texturePixels.assign(byteCount, 0);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureSoftware::loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth)
+    {
+        BackendTexture::loadTextureOnly(size, nullptr, smooth);
+        m_isAlphaTexture = true;
+
+        const std::size_t byteCount = static_cast<std::size_t>(size.x) * size.y;
+        if (alphaPixels)
+            m_texturePixels.assign(alphaPixels, alphaPixels + byteCount);
+        else
+            m_texturePixels.assign(byteCount, 0);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureSoftware::updateRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (m_texturePixels.empty())
+            return false;
+
+        BackendTexture::updateRegion(region, pixels);
+
+        const unsigned int bytesPerPixel = m_isAlphaTexture ? 1 : 4;
+        for (unsigned int y = 0; y < region.height; ++y)
+        {
+            std::memcpy(&m_texturePixels[((region.top + y) * m_imageSize.x + region.left) * bytesPerPixel],
+                        &pixels[y * region.width * bytesPerPixel], region.width * bytesPerPixel);
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::uint8_t* BackendTextureSoftware::getInternalPixels() const
+    {
+        if (m_texturePixels.empty())
+            return nullptr;
+
+        return m_texturePixels.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureSoftware::swapInternalPixels(std::vector<std::uint8_t>& pixels)
+    {
+        m_texturePixels.swap(pixels);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,6 +55,13 @@ namespace tgui
         {
             SDL_GL_SwapWindow(m_window);
         }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int Gui::queryBackBufferAge() const
+        {
+            return BackendRenderTargetGLES2::queryBackBufferAge();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
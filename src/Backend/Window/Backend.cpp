@@ -61,8 +61,9 @@ namespace tgui
             // Stop all timers (as they could contain resources that have to be destroyed before the main function exits)
             Timer::clearTimers();
 
-            // Destroy the global font
+            // Destroy the global font and the fonts that were cached for reuse
             Font::setGlobalFont(nullptr);
+            Font::clearFontCache();
 
             // Destroy the global theme
             Theme::setDefault(nullptr);
@@ -191,6 +192,9 @@ namespace tgui
     void Backend::setFontBackend(std::shared_ptr<BackendFontFactory> fontBackend)
     {
         m_fontBackend = fontBackend;
+
+        // Fonts that were created with the previous font backend can't be reused
+        Font::clearFontCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
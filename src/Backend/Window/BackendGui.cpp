@@ -25,13 +25,215 @@
 #include <TGUI/Backend/Window/BackendGui.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
+#include <TGUI/SubwidgetContainer.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Render target that doesn't draw anything, it is used to find out where each widget is located on the screen.
+        // Widgets that changed or moved since the previous frame add the area that they cover to the damaged rectangles.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class DamageCollector : public BackendRenderTarget
+        {
+        public:
+            DamageCollector(std::vector<FloatRect>& damagedRects) :
+                m_damagedRects(damagedRects)
+            {
+            }
+
+            void setClearColor(const Color&) override
+            {
+            }
+
+            void clearScreen() override
+            {
+            }
+
+            void drawGui(const std::shared_ptr<RootContainer>& root) override
+            {
+                root->draw(*this, {});
+            }
+
+            void drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget) override
+            {
+                const FloatRect clipRect = getClipRect();
+                const FloatRect widgetRect = states.transform.transformRect({widget->getWidgetOffset(), widget->getFullSize()});
+
+                // Widgets that didn't change and didn't move will still cover the same area as before
+                const bool changed = widget->m_damaged || (widgetRect != widget->m_lastDrawnRect) || (clipRect != widget->m_lastDrawnClipRect);
+                const bool containsWidgets = widget->isContainer() || dynamic_cast<const SubwidgetContainer*>(widget.get());
+                if (!changed && !containsWidgets)
+                    return;
+
+                // Find out which area the widget really covers, as its contents (e.g. a long text) can be larger than the widget.
+                // Widgets that contain other widgets are always drawn, to find out where their children are located.
+                m_widgetAreas.push_back(intersect(widgetRect, clipRect));
+                widget->draw(*this, states);
+                const FloatRect area = m_widgetAreas.back();
+                m_widgetAreas.pop_back();
+
+                if (!changed)
+                    return;
+
+                m_damagedRects.push_back(widget->m_lastDrawnArea);
+                m_damagedRects.push_back(area);
+                widget->m_lastDrawnArea = area;
+                widget->m_lastDrawnRect = widgetRect;
+                widget->m_lastDrawnClipRect = clipRect;
+                widget->m_damaged = false;
+            }
+
+            void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int*, std::size_t, const std::shared_ptr<BackendTexture>&) override
+            {
+                if (m_widgetAreas.empty() || (vertexCount == 0))
+                    return;
+
+                Vector2f minPos = states.transform.transformPoint(vertices[0].position);
+                Vector2f maxPos = minPos;
+                for (std::size_t i = 1; i < vertexCount; ++i)
+                {
+                    const Vector2f pos = states.transform.transformPoint(vertices[i].position);
+                    minPos.x = std::min(minPos.x, pos.x);
+                    minPos.y = std::min(minPos.y, pos.y);
+                    maxPos.x = std::max(maxPos.x, pos.x);
+                    maxPos.y = std::max(maxPos.y, pos.y);
+                }
+
+                const FloatRect area = intersect({minPos.x, minPos.y, maxPos.x - minPos.x, maxPos.y - minPos.y}, getClipRect());
+                m_widgetAreas.back() = unite(m_widgetAreas.back(), area);
+            }
+
+        protected:
+
+            void updateClipping(FloatRect, FloatRect) override
+            {
+            }
+
+        private:
+
+            FloatRect getClipRect() const
+            {
+                return m_clipLayers.empty() ? m_viewRect : m_clipLayers.back().first;
+            }
+
+            static FloatRect intersect(const FloatRect& rect1, const FloatRect& rect2)
+            {
+                const float left = std::max(rect1.left, rect2.left);
+                const float top = std::max(rect1.top, rect2.top);
+                const float right = std::min(rect1.left + rect1.width, rect2.left + rect2.width);
+                const float bottom = std::min(rect1.top + rect1.height, rect2.top + rect2.height);
+                if ((left < right) && (top < bottom))
+                    return {left, top, right - left, bottom - top};
+                else
+                    return {};
+            }
+
+            static FloatRect unite(const FloatRect& rect1, const FloatRect& rect2)
+            {
+                if ((rect1.width <= 0) || (rect1.height <= 0))
+                    return rect2;
+                if ((rect2.width <= 0) || (rect2.height <= 0))
+                    return rect1;
+
+                const float left = std::min(rect1.left, rect2.left);
+                const float top = std::min(rect1.top, rect2.top);
+                const float right = std::max(rect1.left + rect1.width, rect2.left + rect2.width);
+                const float bottom = std::max(rect1.top + rect1.height, rect2.top + rect2.height);
+                return {left, top, right - left, bottom - top};
+            }
+
+        private:
+            std::vector<FloatRect>& m_damagedRects;
+            std::vector<FloatRect> m_widgetAreas; // Area covered by each widget that is currently being drawn
+        };
+    }
+
+    namespace
+    {
+        // Every rectangle requires the widgets below it to be drawn again, so the amount of rectangles is kept small
+        constexpr std::size_t MaxDamagedRects = 4;
+
+        // Number of previous frames of which the damaged areas are remembered, older back buffers are redrawn entirely
+        constexpr std::size_t MaxBackBufferAge = 4;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        IntRect getBoundingRect(const IntRect& rect1, const IntRect& rect2)
+        {
+            const int left = std::min(rect1.left, rect2.left);
+            const int top = std::min(rect1.top, rect2.top);
+            const int right = std::max(rect1.left + rect1.width, rect2.left + rect2.width);
+            const int bottom = std::max(rect1.top + rect1.height, rect2.top + rect2.height);
+            return {left, top, right - left, bottom - top};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        long long getArea(const IntRect& rect)
+        {
+            return static_cast<long long>(rect.width) * rect.height;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Combines rectangles that touch or overlap, until there are at most MaxDamagedRects rectangles left
+        void mergeDamagedRects(std::vector<IntRect>& rects)
+        {
+            bool merged = true;
+            while (merged)
+            {
+                merged = false;
+                for (std::size_t i = 0; (i < rects.size()) && !merged; ++i)
+                {
+                    for (std::size_t j = i + 1; j < rects.size(); ++j)
+                    {
+                        if ((rects[i].left <= rects[j].left + rects[j].width) && (rects[j].left <= rects[i].left + rects[i].width)
+                         && (rects[i].top <= rects[j].top + rects[j].height) && (rects[j].top <= rects[i].top + rects[i].height))
+                        {
+                            rects[i] = getBoundingRect(rects[i], rects[j]);
+                            rects.erase(rects.begin() + static_cast<std::ptrdiff_t>(j));
+                            merged = true;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            // If there are still too many rectangles then merge the ones that add the least amount of extra area
+            while (rects.size() > MaxDamagedRects)
+            {
+                std::size_t bestI = 0;
+                std::size_t bestJ = 1;
+                long long bestExtraArea = -1;
+                for (std::size_t i = 0; i < rects.size(); ++i)
+                {
+                    for (std::size_t j = i + 1; j < rects.size(); ++j)
+                    {
+                        const long long extraArea = getArea(getBoundingRect(rects[i], rects[j])) - getArea(rects[i]) - getArea(rects[j]);
+                        if ((bestExtraArea < 0) || (extraArea < bestExtraArea))
+                        {
+                            bestI = i;
+                            bestJ = j;
+                            bestExtraArea = extraArea;
+                        }
+                    }
+                }
+
+                rects[bestI] = getBoundingRect(rects[bestI], rects[bestJ]);
+                rects.erase(rects.begin() + static_cast<std::ptrdiff_t>(bestJ));
+            }
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendGui::BackendGui()
@@ -215,7 +417,19 @@ namespace tgui
             updateTime();
 
         TGUI_ASSERT(m_backendRenderTarget != nullptr, "Gui must be given a window (or render target) before calling draw()");
-        m_backendRenderTarget->drawGui(m_container);
+        m_backendRenderTarget->setRetainedModeEnabled(m_retainedModeEnabled);
+        m_backendRenderTarget->resetRetainedModeStatistics();
+
+        if (m_partialRedrawEnabled)
+            m_backendRenderTarget->drawGuiPartially(m_container, updateDamagedRects());
+        else
+        {
+            m_backendRenderTarget->drawGui(m_container);
+
+            const FloatRect viewport = m_viewport.getRect();
+            m_damagedRects = {IntRect{static_cast<int>(viewport.left), static_cast<int>(viewport.top),
+                                      static_cast<int>(viewport.width), static_cast<int>(viewport.height)}};
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -480,6 +694,85 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::setRetainedModeEnabled(bool enabled)
+    {
+        m_retainedModeEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isRetainedModeEnabled() const
+    {
+        return m_retainedModeEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendRenderTarget::RetainedModeStatistics BackendGui::getRetainedModeStatistics() const
+    {
+        if (m_backendRenderTarget)
+            return m_backendRenderTarget->getRetainedModeStatistics();
+        else
+            return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setPartialRedrawEnabled(bool enabled)
+    {
+        m_partialRedrawEnabled = enabled;
+        m_fullRedrawRequired = true;
+        m_invalidatedRects.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isPartialRedrawEnabled() const
+    {
+        return m_partialRedrawEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::invalidateRect(FloatRect rect)
+    {
+        if (!m_partialRedrawEnabled || m_fullRedrawRequired || (rect.width <= 0) || (rect.height <= 0))
+            return;
+
+        // Don't keep collecting rectangles when lots of widgets are changing, just redraw everything in that case
+        if (m_invalidatedRects.size() >= 256)
+        {
+            m_fullRedrawRequired = true;
+            m_invalidatedRects.clear();
+            return;
+        }
+
+        m_invalidatedRects.push_back(rect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setBackBufferAge(unsigned int age)
+    {
+        m_backBufferAge = age;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendGui::getBackBufferAge() const
+    {
+        return m_backBufferAge;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<IntRect>& BackendGui::getDamagedRects() const
+    {
+        return m_damagedRects;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendGui::updateTime()
     {
         const auto timePointNow = std::chrono::steady_clock::now();
@@ -552,6 +845,10 @@ namespace tgui
         m_viewport.updateParentSize({static_cast<float>(m_windowSize.x), static_cast<float>(m_windowSize.y)});
         m_view.updateParentSize({m_viewport.getWidth(), m_viewport.getHeight()});
 
+        // Everything has to be redrawn when the view or window size changes
+        m_fullRedrawRequired = true;
+        m_invalidatedRects.clear();
+
         // If a render target was created already then inform it about the size change
         if (m_backendRenderTarget)
             m_backendRenderTarget->setView(m_view.getRect(), m_viewport.getRect(), {static_cast<float>(m_windowSize.x), static_cast<float>(m_windowSize.y)});
@@ -568,6 +865,106 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendGui::queryBackBufferAge() const
+    {
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<FloatRect> BackendGui::updateDamagedRects()
+    {
+        const FloatRect view = m_view.getRect();
+        const FloatRect viewport = m_viewport.getRect();
+        if ((view.width <= 0) || (view.height <= 0) || (viewport.width <= 0) || (viewport.height <= 0))
+        {
+            m_damagedRects.clear();
+            return {};
+        }
+
+        // Find the areas of the widgets that changed. This has to happen even when everything is redrawn, as the widgets
+        // need to know where they were drawn in order to report their old area when they change in a later frame.
+        std::vector<FloatRect> rects = std::move(m_invalidatedRects);
+        m_invalidatedRects.clear();
+        priv::DamageCollector collector{rects};
+        collector.setView(view, viewport, {static_cast<float>(m_windowSize.x), static_cast<float>(m_windowSize.y)});
+        collector.drawGui(m_container);
+
+        // Convert the rectangles to pixels, rounding them outwards with an extra pixel for e.g. anti-aliased text
+        const IntRect viewportPixels{static_cast<int>(viewport.left), static_cast<int>(viewport.top),
+                                     static_cast<int>(viewport.width), static_cast<int>(viewport.height)};
+        std::vector<IntRect> frameRects;
+        const bool fullRedrawRequired = m_fullRedrawRequired;
+        m_fullRedrawRequired = false;
+        if (fullRedrawRequired)
+            frameRects.push_back(viewportPixels);
+        else
+        {
+            const float scaleX = viewport.width / view.width;
+            const float scaleY = viewport.height / view.height;
+            for (const auto& rect : rects)
+            {
+                if ((rect.width <= 0) || (rect.height <= 0))
+                    continue;
+
+                const int left = std::max(viewportPixels.left, static_cast<int>(std::floor(viewport.left + (rect.left - view.left) * scaleX)) - 1);
+                const int top = std::max(viewportPixels.top, static_cast<int>(std::floor(viewport.top + (rect.top - view.top) * scaleY)) - 1);
+                const int right = std::min(viewportPixels.left + viewportPixels.width,
+                                           static_cast<int>(std::ceil(viewport.left + (rect.left + rect.width - view.left) * scaleX)) + 1);
+                const int bottom = std::min(viewportPixels.top + viewportPixels.height,
+                                            static_cast<int>(std::ceil(viewport.top + (rect.top + rect.height - view.top) * scaleY)) + 1);
+                if ((left < right) && (top < bottom))
+                    frameRects.push_back({left, top, right - left, bottom - top});
+            }
+
+            mergeDamagedRects(frameRects);
+        }
+
+        // When nothing changed, nothing is drawn and the frame shouldn't be presented. The back buffer is then left untouched.
+        m_damagedRects.clear();
+        if (frameRects.empty())
+            return {};
+
+        // The back buffer contains the frame that was drawn m_backBufferAge frames ago, so the areas that changed in the frames
+        // after it have to be redrawn as well. Everything is redrawn when the contents of the back buffer are unknown.
+        if (fullRedrawRequired || (m_backBufferAge == 0) || (m_backBufferAge - 1 > m_damageHistory.size()))
+            m_damagedRects.push_back(viewportPixels);
+        else
+        {
+            m_damagedRects = frameRects;
+            for (std::size_t i = 0; i + 1 < m_backBufferAge; ++i)
+                m_damagedRects.insert(m_damagedRects.end(), m_damageHistory[i].begin(), m_damageHistory[i].end());
+
+            mergeDamagedRects(m_damagedRects);
+
+            // Redrawing most of the screen in multiple parts is slower than redrawing it at once
+            long long damagedArea = 0;
+            for (const auto& rect : m_damagedRects)
+                damagedArea += getArea(rect);
+            if ((m_damagedRects.size() > 1) && (damagedArea * 2 > getArea(viewportPixels)))
+                m_damagedRects = {viewportPixels};
+        }
+
+        m_damageHistory.push_front(std::move(frameRects));
+        if (m_damageHistory.size() > MaxBackBufferAge)
+            m_damageHistory.pop_back();
+
+        // Convert the pixel rectangles back to the coordinate system of the view
+        std::vector<FloatRect> viewRects;
+        viewRects.reserve(m_damagedRects.size());
+        for (const auto& rect : m_damagedRects)
+        {
+            viewRects.push_back({view.left + (rect.left - viewport.left) * view.width / viewport.width,
+                                 view.top + (rect.top - viewport.top) * view.height / viewport.height,
+                                 rect.width * view.width / viewport.width,
+                                 rect.height * view.height / viewport.height});
+        }
+
+        return viewRects;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -363,9 +363,16 @@ namespace tgui
             const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(20);
             if (timePointNextAllowed <= timePointNow)
             {
-                m_backendRenderTarget->clearScreen();
+                // With partial redraw, the parts of the screen that didn't change are kept from an earlier frame. If the window system
+                // can't tell which frame the back buffer contains then everything gets redrawn whenever something changed.
+                if (m_partialRedrawEnabled)
+                    setBackBufferAge(queryBackBufferAge());
+                else
+                    m_backendRenderTarget->clearScreen();
+
                 draw();
-                glfwSwapBuffers(m_window);
+                if (!m_damagedRects.empty())
+                    glfwSwapBuffers(m_window);
                 lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
             }
 
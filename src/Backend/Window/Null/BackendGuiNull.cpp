@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backend/Window/Null/BackendGuiNull.hpp>
+#include <TGUI/Backend/Window/Null/BackendNull.hpp>
+#include <TGUI/Timer.hpp>
+
+#include <thread>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGuiNull::setWindowSize(Vector2u size)
+    {
+        m_windowSize = {static_cast<int>(size.x), static_cast<int>(size.y)};
+        updateContainerSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendGuiNull::getWindowSize() const
+    {
+        return {static_cast<unsigned int>(m_windowSize.x), static_cast<unsigned int>(m_windowSize.y)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGuiNull::mainLoop(Color clearColor)
+    {
+        TGUI_ASSERT(m_backendRenderTarget, "Gui must be given a window size (via setGuiWindow function) before mainLoop() is called");
+
+        m_backendRenderTarget->setClearColor(clearColor);
+
+        setDrawingUpdatesTime(false);
+
+        m_mainLoopStopRequested = false;
+        while (!m_mainLoopStopRequested)
+        {
+            // With partial redraw, the parts of the screen that didn't change are kept from the previous frame
+            if (!m_partialRedrawEnabled)
+                m_backendRenderTarget->clearScreen();
+
+            draw();
+
+            // There are no events to wait for, so we only need to wake up for the next timer
+            Duration timeout = std::chrono::milliseconds(10);
+            Optional<Duration> duration = Timer::getNextScheduledTime();
+            if (duration && (*duration < timeout))
+                timeout = *duration;
+
+            std::this_thread::sleep_for(std::chrono::nanoseconds(timeout));
+            updateTime();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGuiNull::stopMainLoop()
+    {
+        m_mainLoopStopRequested = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGuiNull::setGuiWindow(Vector2u windowSize)
+    {
+        TGUI_ASSERT(std::dynamic_pointer_cast<BackendNull>(getBackend()), "BackendGuiNull requires system backend of type BackendNull");
+
+        m_windowSize = {static_cast<int>(windowSize.x), static_cast<int>(windowSize.y)};
+
+        getBackend()->attachGui(this);
+
+        updateContainerSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,86 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backend/Window/Null/BackendNull.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendNull::attachGui(BackendGui* gui)
+    {
+        m_guis.insert(gui);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendNull::detatchGui(BackendGui* gui)
+    {
+        // Don't check if it existed, detach is called for every gui while attached is only called for properly initialized guis
+        m_guis.erase(gui);
+
+        if (m_destroyOnLastGuiDetatch && m_guis.empty())
+            setBackend(nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendNull::setMouseCursorStyle(Cursor::Type, const std::uint8_t*, Vector2u, Vector2u)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendNull::resetMouseCursorStyle(Cursor::Type)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendNull::setMouseCursor(BackendGui*, Cursor::Type)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendNull::isKeyboardModifierPressed(Event::KeyModifier modifierKey)
+    {
+        return m_modifierKeysPressed[static_cast<std::size_t>(modifierKey)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendNull::setKeyboardModifierPressed(Event::KeyModifier modifierKey, bool pressed)
+    {
+        m_modifierKeysPressed[static_cast<std::size_t>(modifierKey)] = pressed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -235,9 +235,16 @@ namespace tgui
                 continue;
             }
 
-            m_backendRenderTarget->clearScreen();
+            // With partial redraw, the parts of the screen that didn't change are kept from an earlier frame. If the window system
+            // can't tell which frame the back buffer contains then everything gets redrawn whenever something changed.
+            if (m_partialRedrawEnabled)
+                setBackBufferAge(queryBackBufferAge());
+            else
+                m_backendRenderTarget->clearScreen();
+
             draw();
-            m_window->display();
+            if (!m_damagedRects.empty())
+                m_window->display();
 
             refreshRequired = false;
             lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
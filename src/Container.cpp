@@ -43,6 +43,17 @@ namespace tgui
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        // A widget may change its appearance when it receives an event. Containers aren't invalidated as a whole when an event
+        // passes through them, the child widget that handles it will invalidate itself. Containers that draw something
+        // that reacts to events (e.g. the title bar buttons of a child window) invalidate themselves in their event handlers.
+        void invalidateDrawCacheOnEvent(Widget& widget)
+        {
+            if (!widget.isContainer())
+                widget.invalidateDrawCache();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void getAllRenderers(std::vector<RendererData*>& orderedRenderers, std::map<RendererData*, std::vector<const Widget*>>& rendererToWidgetsMap, const Container* container)
         {
             const auto addRenderer = [&](RendererData* rendererData, const Widget* widget){
@@ -168,7 +179,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget        {other},
+        m_renderCached{other.m_renderCached}
     {
         // Widgets with layouts that refer to each other need to be added simultaneously.
         // They all need to be in m_widgets before setParent is called on the first widget,
@@ -189,7 +201,8 @@ namespace tgui
         m_widgetBelowMouse        {std::move(other.m_widgetBelowMouse)},
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
-        m_focusedWidget           {std::move(other.m_focusedWidget)}
+        m_focusedWidget           {std::move(other.m_focusedWidget)},
+        m_renderCached            {other.m_renderCached}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -227,6 +240,8 @@ namespace tgui
             m_widgetWithLeftMouseDown = nullptr;
             m_widgetWithRightMouseDown = nullptr;
             m_focusedWidget = nullptr;
+            m_renderCached = right.m_renderCached;
+            m_renderCacheValid = false;
 
             // Remove all the old widgets
             Container::removeAllWidgets();
@@ -258,6 +273,8 @@ namespace tgui
             m_widgetWithLeftMouseDown  = std::move(right.m_widgetWithLeftMouseDown);
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
+            m_renderCached             = right.m_renderCached;
+            m_renderCacheValid         = false;
 
             // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
             // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -306,6 +323,10 @@ namespace tgui
             widgetPtr->setWidgetName(widgetName);
 
         widgetAdded(widgetPtr);
+
+        // Only the area of the new widget has to be redrawn
+        m_drawCacheValid = false;
+        widgetPtr->invalidateDrawCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -371,6 +392,10 @@ namespace tgui
                 widget->setFocused(false);
             }
 
+            // The area where the widget was drawn has to be redrawn, which has to be reported while the widget is still in the gui
+            m_drawCacheValid = false;
+            widget->invalidateDrawCache();
+
             // Remove the widget
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + i);
@@ -384,11 +409,16 @@ namespace tgui
 
     void Container::removeAllWidgets()
     {
+        m_drawCacheValid = false;
+
         if (m_mouseHover && m_parentGui && (m_mouseCursor != Cursor::Type::Arrow))
             m_parentGui->requestMouseCursor(m_mouseCursor);
 
         for (const auto& widget : m_widgets)
+        {
+            widget->invalidateDrawCache();
             widget->setParent(nullptr);
+        }
 
         m_widgets.clear();
 
@@ -594,6 +624,11 @@ namespace tgui
 
     void Container::moveWidgetToFront(const Widget::Ptr& widget)
     {
+        // Changing the order in which the widgets are drawn only affects the area of the widget that is moved
+        m_drawCacheValid = false;
+        if (widget)
+            widget->invalidateDrawCache();
+
         // Loop through all widgets
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
@@ -613,6 +648,11 @@ namespace tgui
 
     void Container::moveWidgetToBack(const Widget::Ptr& widget)
     {
+        // Changing the order in which the widgets are drawn only affects the area of the widget that is moved
+        m_drawCacheValid = false;
+        if (widget)
+            widget->invalidateDrawCache();
+
         // Loop through all widgets
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
@@ -633,6 +673,11 @@ namespace tgui
 
     std::size_t Container::moveWidgetForward(const Widget::Ptr& widget)
     {
+        // Changing the order in which the widgets are drawn only affects the area of the widget that is moved
+        m_drawCacheValid = false;
+        if (widget)
+            widget->invalidateDrawCache();
+
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
             if (m_widgets[i] != widget)
@@ -654,6 +699,11 @@ namespace tgui
 
     std::size_t Container::moveWidgetBackward(const Widget::Ptr& widget)
     {
+        // Changing the order in which the widgets are drawn only affects the area of the widget that is moved
+        m_drawCacheValid = false;
+        if (widget)
+            widget->invalidateDrawCache();
+
         for (std::size_t i = m_widgets.size(); i > 0; --i)
         {
             if (m_widgets[i-1] != widget)
@@ -675,6 +725,11 @@ namespace tgui
 
     bool Container::setWidgetIndex(const Widget::Ptr& widget, std::size_t index)
     {
+        // Changing the order in which the widgets are drawn only affects the area of the widget that is moved
+        m_drawCacheValid = false;
+        if (widget)
+            widget->invalidateDrawCache();
+
         if (index >= m_widgets.size())
             return false;
 
@@ -865,6 +920,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setRenderCached(bool renderCached)
+    {
+        if (m_renderCached == renderCached)
+            return;
+
+        m_renderCached = renderCached;
+        m_renderCacheValid = false;
+        if (!m_renderCached)
+            m_renderCacheTexture = nullptr;
+
+        invalidateDrawCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isRenderCached() const
+    {
+        return m_renderCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::childWidgetFocused(const Widget::Ptr& child)
     {
         if (m_focusedWidget != child)
@@ -951,6 +1028,7 @@ namespace tgui
 
         if (m_widgetBelowMouse)
         {
+            invalidateDrawCacheOnEvent(*m_widgetBelowMouse);
             m_widgetBelowMouse->mouseNoLongerOnWidget();
             m_widgetBelowMouse = nullptr;
         }
@@ -964,6 +1042,7 @@ namespace tgui
 
         if (m_widgetWithLeftMouseDown)
         {
+            invalidateDrawCacheOnEvent(*m_widgetWithLeftMouseDown);
             m_widgetWithLeftMouseDown->leftMouseButtonNoLongerDown();
             m_widgetWithLeftMouseDown = nullptr;
         }
@@ -977,6 +1056,7 @@ namespace tgui
 
         if (m_widgetWithRightMouseDown)
         {
+            invalidateDrawCacheOnEvent(*m_widgetWithRightMouseDown);
             m_widgetWithRightMouseDown->rightMouseButtonNoLongerDown();
             m_widgetWithRightMouseDown = nullptr;
         }
@@ -1092,6 +1172,7 @@ namespace tgui
         {
             if (m_widgetWithLeftMouseDown->isDraggableWidget() || m_widgetWithLeftMouseDown->isContainer())
             {
+                invalidateDrawCacheOnEvent(*m_widgetWithLeftMouseDown);
                 m_widgetWithLeftMouseDown->mouseMoved(transformMousePos(m_widgetWithLeftMouseDown, mousePos));
                 return true;
             }
@@ -1104,6 +1185,7 @@ namespace tgui
         if (widget != nullptr)
         {
             // Send the event to the widget
+            invalidateDrawCacheOnEvent(*widget);
             widget->mouseMoved(transformMousePos(widget, mousePos));
             return true;
         }
@@ -1139,6 +1221,7 @@ namespace tgui
             if (!widget->isContainer())
                 widget->setFocused(true);
 
+            invalidateDrawCacheOnEvent(*widget);
             widget->mousePressed(button, transformMousePos(widget, mousePos));
             return true;
         }
@@ -1165,16 +1248,21 @@ namespace tgui
     {
         Widget::Ptr widgetBelowMouse = updateWidgetBelowMouse(mousePos);
         if (widgetBelowMouse != nullptr)
+        {
+            invalidateDrawCacheOnEvent(*widgetBelowMouse);
             widgetBelowMouse->mouseReleased(button, transformMousePos(widgetBelowMouse, mousePos));
+        }
 
         if ((button == Event::MouseButton::Left) && m_widgetWithLeftMouseDown)
         {
+            invalidateDrawCacheOnEvent(*m_widgetWithLeftMouseDown);
             m_widgetWithLeftMouseDown->leftMouseButtonNoLongerDown();
             m_widgetWithLeftMouseDown = nullptr;
             return true;
         }
         else if ((button == Event::MouseButton::Right) && m_widgetWithRightMouseDown)
         {
+            invalidateDrawCacheOnEvent(*m_widgetWithRightMouseDown);
             m_widgetWithRightMouseDown->rightMouseButtonNoLongerDown();
             m_widgetWithRightMouseDown = nullptr;
             return true;
@@ -1190,7 +1278,10 @@ namespace tgui
         // Send the event to the widget below the mouse
         Widget::Ptr widget = updateWidgetBelowMouse(pos);
         if (widget != nullptr)
+        {
+            invalidateDrawCacheOnEvent(*widget);
             return widget->mouseWheelScrolled(delta, transformMousePos(widget, pos));
+        }
 
         return false;
     }
@@ -1207,6 +1298,7 @@ namespace tgui
         if (m_focusedWidget && m_focusedWidget->isFocused())
         {
             // Tell the widget that the key was pressed
+            invalidateDrawCacheOnEvent(*m_focusedWidget);
             m_focusedWidget->keyPressed(event);
             return true;
         }
@@ -1225,6 +1317,7 @@ namespace tgui
         // Tell the widget that the key was pressed
         if (m_focusedWidget && m_focusedWidget->isFocused())
         {
+            invalidateDrawCacheOnEvent(*m_focusedWidget);
             m_focusedWidget->textEntered(key);
             return true;
         }
@@ -1242,8 +1335,11 @@ namespace tgui
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
             // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                screenRefreshRequired |= m_widgets[i]->updateTime(elapsedTime);
+            if (m_widgets[i]->isVisible() && m_widgets[i]->updateTime(elapsedTime))
+            {
+                invalidateDrawCacheOnEvent(*m_widgets[i]);
+                screenRefreshRequired = true;
+            }
         }
 
         m_animationTimeElapsed = {};
@@ -1306,7 +1402,10 @@ namespace tgui
 
         // If the mouse is on a different widget, tell the old widget that the mouse has left
         if (m_widgetBelowMouse && (widgetBelowMouse != m_widgetBelowMouse))
+        {
+            invalidateDrawCacheOnEvent(*m_widgetBelowMouse);
             m_widgetBelowMouse->mouseNoLongerOnWidget();
+        }
 
         m_widgetBelowMouse = widgetBelowMouse;
         return widgetBelowMouse;
@@ -1509,6 +1608,18 @@ namespace tgui
             injectFormFilePath(child, path, checkedFilenames);
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateRenderCache()
+    {
+        // The texture of a render cached container also contains everything drawn by render cached containers inside it
+        for (Container* container = this; container != nullptr; container = container->m_parent)
+        {
+            if (container->m_renderCached)
+                container->m_renderCacheValid = false;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
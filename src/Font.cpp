@@ -27,6 +27,9 @@
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Backend/Font/BackendFont.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <algorithm>
+#include <cstring>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -35,6 +38,42 @@ namespace tgui
     namespace
     {
         Font globalFont;
+
+        // Font that was loaded before. The backend font is shared by all fonts loaded from the same file or data that didn't
+        // change any of its settings, the data is also shared with the backend fonts of those that did.
+        struct CachedFont
+        {
+            std::shared_ptr<const std::uint8_t> data;
+            std::size_t sizeInBytes = 0;
+            std::shared_ptr<BackendFont> backendFont;
+        };
+
+        // Fonts that were loaded before, keyed by their filename or by a hash of the data for fonts loaded from memory
+        std::map<String, CachedFont> fontCache;
+
+        String getMemoryFontKey(const void* data, std::size_t sizeInBytes)
+        {
+            // FNV-1a style hash of the font data, processed 8 bytes at a time because fonts can be several megabytes.
+            // The size is included in the key to make collisions even less likely.
+            std::uint64_t hash = 14695981039346656037ULL;
+            const auto* bytes = static_cast<const std::uint8_t*>(data);
+            std::size_t i = 0;
+            for (; i + sizeof(std::uint64_t) <= sizeInBytes; i += sizeof(std::uint64_t))
+            {
+                std::uint64_t word;
+                std::memcpy(&word, bytes + i, sizeof(word));
+                hash ^= word;
+                hash *= 1099511628211ULL;
+                hash ^= hash >> 29;
+            }
+            for (; i < sizeInBytes; ++i)
+            {
+                hash ^= bytes[i];
+                hash *= 1099511628211ULL;
+            }
+
+            return U"\n" + String(hash) + U":" + String(sizeInBytes); // Filenames can't contain newlines, so keys can't clash
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +95,61 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t Font::purgeUnusedFonts()
+    {
+        std::size_t fontsRemoved = 0;
+        for (auto it = fontCache.begin(); it != fontCache.end();)
+        {
+            if (it->second.backendFont.use_count() == 1)
+            {
+                it = fontCache.erase(it);
+                ++fontsRemoved;
+            }
+            else
+                ++it;
+        }
+
+        return fontsRemoved;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::clearFontCache()
+    {
+        fontCache.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Font::getCachedFontsCount()
+    {
+        return fontCache.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendFont> Font::loadSharedBackendFont(const String& filename)
+    {
+        const auto it = fontCache.find(filename);
+        if (it != fontCache.end())
+            return it->second.backendFont;
+
+        CachedFont cachedFont;
+        auto fileContents = readFileToMemory(filename, cachedFont.sizeInBytes);
+        if (!fileContents)
+            throw Exception{"Failed to load '" + filename + "'"};
+
+        cachedFont.data = std::shared_ptr<const std::uint8_t>(fileContents.release(), std::default_delete<std::uint8_t[]>());
+        cachedFont.backendFont = getBackend()->createFont();
+        if (!cachedFont.backendFont->loadFromSharedMemory(cachedFont.data, cachedFont.sizeInBytes))
+            return nullptr;
+
+        fontCache[filename] = cachedFont;
+        return cachedFont.backendFont;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Font::Font(std::nullptr_t)
     {
     }
@@ -76,10 +170,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Font::Font(const void* data, std::size_t sizeInBytes) :
-        m_backendFont{getBackend()->createFont()}
+    Font::Font(const void* data, std::size_t sizeInBytes)
     {
-        m_backendFont->loadFromMemory(data, sizeInBytes);
+        // The data is compared when the hash matches, fonts with different data but the same key are just not cached
+        const String key = getMemoryFontKey(data, sizeInBytes);
+        const auto it = fontCache.find(key);
+        if (it != fontCache.end())
+        {
+            if (std::memcmp(it->second.data.get(), data, sizeInBytes) == 0)
+            {
+                m_backendFont = it->second.backendFont;
+                return;
+            }
+
+            m_backendFont = getBackend()->createFont();
+            m_backendFont->loadFromMemory(data, sizeInBytes);
+            return;
+        }
+
+        auto copiedData = MakeUniqueForOverwrite<std::uint8_t[]>(sizeInBytes);
+        std::memcpy(copiedData.get(), data, sizeInBytes);
+
+        CachedFont cachedFont;
+        cachedFont.data = std::shared_ptr<const std::uint8_t>(copiedData.release(), std::default_delete<std::uint8_t[]>());
+        cachedFont.sizeInBytes = sizeInBytes;
+        cachedFont.backendFont = getBackend()->createFont();
+        m_backendFont = cachedFont.backendFont;
+        if (m_backendFont->loadFromSharedMemory(cachedFont.data, sizeInBytes))
+            fontCache[key] = cachedFont;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,6 +260,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Font::preloadGlyphs(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges,
+                             const std::vector<unsigned int>& characterSizes, bool bold, float outlineThickness) const
+    {
+        if (m_backendFont)
+            m_backendFont->preloadGlyphs(codePointRanges, characterSizes, bold, outlineThickness);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Font::getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold) const
     {
         if (m_backendFont)
@@ -152,6 +279,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Font::getAdvances(const char32_t* codePoints, std::size_t count, unsigned int characterSize, bool bold,
+                           float* advances, float* kernings) const
+    {
+        if (m_backendFont)
+            m_backendFont->getAdvances(codePoints, count, characterSize, bold, advances, kernings);
+        else
+        {
+            std::fill(advances, advances + count, 0.f);
+            std::fill(kernings, kernings + count, 0.f);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Font::getLineSpacing(unsigned int characterSize) const
     {
         if (m_backendFont)
@@ -164,8 +305,8 @@ namespace tgui
 
     void Font::setSmooth(bool smooth)
     {
-        if (m_backendFont)
-            m_backendFont->setSmooth(smooth);
+        if (m_backendFont && (m_backendFont->isSmooth() != smooth))
+            detachBackendFont()->setSmooth(smooth);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -180,12 +321,52 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Font::setFallbackFonts(const std::vector<Font>& fonts)
+    {
+        if (!m_backendFont)
+            return;
+
+        std::vector<std::shared_ptr<BackendFont>> backendFonts;
+        for (const auto& font : fonts)
+        {
+            if (font.m_backendFont)
+                backendFonts.push_back(font.m_backendFont);
+        }
+
+        detachBackendFont()->setFallbackFonts(backendFonts);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::shared_ptr<BackendFont> Font::getBackendFont() const
     {
         return m_backendFont;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendFont> Font::detachBackendFont()
+    {
+        if (!m_backendFont)
+            return nullptr;
+
+        // Only the backend fonts in the cache are shared between fonts that were loaded separately
+        for (const auto& pair : fontCache)
+        {
+            if (pair.second.backendFont != m_backendFont)
+                continue;
+
+            auto backendFont = getBackend()->createFont();
+            if (backendFont->loadFromSharedMemory(pair.second.data, pair.second.sizeInBytes))
+                m_backendFont = backendFont;
+
+            break;
+        }
+
+        return m_backendFont;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,22 +120,19 @@ namespace tgui
             if (filename.empty())
                 return Font{};
 
-            // Load the font but insert the resource path into the filename unless the filename is an absolute path
-            auto font = getBackend()->createFont();
+            // Load the font but insert the resource path into the filename unless the filename is an absolute path.
+            // The backend font is shared with all other fonts that were loaded from the same file.
+            String path = filename;
 #ifdef TGUI_SYSTEM_WINDOWS
             if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.length() <= 1) || (filename[1] != ':')))
 #else
             if (filename[0] != '/')
 #endif
-            {
-                if (!font->loadFromFile((getResourcePath() / filename).asString()))
-                    throw Exception{"Failed to load font from '" + (getResourcePath() / filename).asString() + "'"};
-            }
-            else
-            {
-                if (!font->loadFromFile(filename))
-                    throw Exception{"Failed to load font from '" + filename + "'"};
-            }
+                path = (getResourcePath() / filename).asString();
+
+            auto font = Font::loadSharedBackendFont(path);
+            if (!font)
+                throw Exception{"Failed to load font from '" + path + "'"};
 
             // We create the backend font manually first, as passing the string to the Font constructor would cause
             // an endless recursive call to this function.
@@ -374,7 +374,7 @@ namespace tgui
         }
         else
         {
-            texCoordOffset = m_texture.getPartRect().getPosition();
+            texCoordOffset = m_texture.getPartRect().getPosition() + m_texture.getData()->atlasRect.getPosition();
             textureSize = Vector2f{m_texture.getPartRect().getSize()};
             middleRect = FloatRect{m_texture.getMiddleRect()};
             if (middleRect == FloatRect(0, 0, textureSize.x, textureSize.y))
@@ -548,8 +548,8 @@ namespace tgui
         {
             for (auto& vertex : m_vertices)
             {
-                vertex.texCoords.x += static_cast<float>(m_texture.getPartRect().left);
-                vertex.texCoords.y += static_cast<float>(m_texture.getPartRect().top);
+                vertex.texCoords.x += static_cast<float>(texCoordOffset.x);
+                vertex.texCoords.y += static_cast<float>(texCoordOffset.y);
             }
         }
 
@@ -303,7 +303,8 @@ namespace tgui
 
     void SubwidgetContainer::draw(BackendRenderTarget& target, RenderStates states) const
     {
-        m_container->draw(target, states);
+        // The container is drawn as a separate widget so that it keeps its own draw cache in retained mode
+        target.drawWidget(states, m_container->shared_from_this());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -221,6 +221,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t Text::findCharacterIndex(Vector2f position) const
+    {
+        return m_backendText->findCharacterIndex(position);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Text::getExtraHorizontalPadding() const
     {
         return getExtraHorizontalPadding(getFont(), getCharacterSize(), getStyle());
@@ -285,26 +292,16 @@ namespace tgui
 
         const bool bold = (textStyle & TextStyle::Bold) != 0;
 
-        float width = 0.0f;
-        char32_t prevChar = 0;
-        for (std::size_t i = 0; i < text.length(); ++i)
-        {
-            float charWidth;
-            const char32_t curChar = text[i];
-            if (curChar == '\n')
-                break;
-            else if (curChar == U'\r')
-                continue; // Skip carriage return characters which aren't rendered (we only use line feed characters to indicate a new line)
-            else if (curChar == '\t')
-                charWidth = font.getGlyph(' ', characterSize, bold).advance * 4.0f;
-            else
-                charWidth = font.getGlyph(curChar, characterSize, bold).advance;
-
-            const float kerning = font.getKerning(prevChar, curChar, characterSize, bold);
+        // Only the characters in front of the first newline are part of the line
+        const std::size_t lineLength = std::min(text.find(U'\n'), text.length());
+        std::vector<float> advances(lineLength);
+        std::vector<float> kernings(lineLength);
+        font.getAdvances(text.data(), lineLength, characterSize, bold, advances.data(), kernings.data());
 
-            width += charWidth + kerning;
-            prevChar = curChar;
-        }
+        // Carriage return characters have no advance or kerning, they aren't rendered
+        float width = 0.0f;
+        for (std::size_t i = 0; i < lineLength; ++i)
+            width += advances[i] + kernings[i];
 
         return width;
     }
@@ -376,18 +373,91 @@ namespace tgui
         if (font == nullptr)
             return U"";
 
+        std::vector<WrappedLine> lines;
+        findLineBreaks(lines, maxWidth, text, font, textSize, bold);
+
+        // Every line is followed by a newline, except for the last one
         String result;
-        std::size_t index = 0;
-        while (index < text.length())
+        result.reserve(text.length() + lines.size() - 1);
+        for (std::size_t i = 0; i < lines.size(); ++i)
+        {
+            if (i > 0)
+                result += U'\n';
+
+            result.append(text, lines[i].start, lines[i].length);
+        }
+
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::findLineBreaks(std::vector<WrappedLine>& lines, float maxWidth, const String& text, Font font, unsigned int textSize,
+                              bool bold, bool calculateWidths, std::size_t start, std::size_t end)
+    {
+        end = std::min(end, text.length());
+        TGUI_ASSERT(start <= end, "start can't be located behind end in Text::findLineBreaks");
+
+        // The advances of the characters are only needed for wrapping the text and for calculating the widths of the lines
+        const bool wrapText = (maxWidth != 0) && (font != nullptr);
+        calculateWidths = calculateWidths && (font != nullptr);
+
+        std::vector<float> advances;
+        std::vector<float> kernings;
+        if (wrapText || calculateWidths)
+        {
+            advances.resize(end - start);
+            kernings.resize(end - start);
+            font.getAdvances(text.data() + start, end - start, textSize, bold, advances.data(), kernings.data());
+        }
+
+        // Sums the width of the characters on a line. The first character has no kerning, carriage returns don't count.
+        const auto addLine = [&](std::size_t lineStart, std::size_t lineLength)
+        {
+            float lineWidth = 0;
+            if (calculateWidths)
+            {
+                bool firstChar = true;
+                for (std::size_t i = lineStart; i < lineStart + lineLength; ++i)
+                {
+                    if (text[i] == U'\r')
+                        continue;
+
+                    lineWidth += advances[i - start] + (firstChar ? 0 : kernings[i - start]);
+                    firstChar = false;
+                }
+            }
+
+            lines.push_back({lineStart, lineLength, lineWidth});
+        };
+
+        // Without a maximum width, the text is only split at its newlines
+        if (!wrapText)
+        {
+            std::size_t lineStart = start;
+            for (std::size_t i = start; i < end; ++i)
+            {
+                if (text[i] == U'\n')
+                {
+                    addLine(lineStart, i - lineStart);
+                    lineStart = i + 1;
+                }
+            }
+
+            addLine(lineStart, end - lineStart);
+            return;
+        }
+
+        std::size_t index = start;
+        while (index < end)
         {
             const std::size_t oldIndex = index;
 
             // Find out how many characters we can get on this line
             float width = 0;
             char32_t prevChar = 0;
-            for (std::size_t i = index; i < text.length(); ++i)
+            for (std::size_t i = index; i < end; ++i)
             {
-                float charWidth;
                 const char32_t curChar = text[i];
                 if (curChar == U'\n')
                 {
@@ -400,12 +470,10 @@ namespace tgui
                     index++;
                     continue;
                 }
-                else if (curChar == U'\t')
-                    charWidth = font.getGlyph(' ', textSize, bold).advance * 4;
-                else
-                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
 
-                const float kerning = font.getKerning(prevChar, curChar, textSize, bold);
+                // The first character on the line has no kerning
+                const float charWidth = advances[i - start];
+                const float kerning = (prevChar != 0) ? kernings[i - start] : 0;
                 const bool isWhitespace = (curChar == U' ') || (curChar == U'\t');
 
                 // We add the character to the line, unless a non-whitespace character exceeds the line length.
@@ -429,7 +497,7 @@ namespace tgui
             if (text[index-1] != U'\n')
             {
                 const std::size_t indexWithoutWordWrap = index;
-                if ((index < text.length()) && (!isWhitespace(text[index])))
+                if ((index < end) && (!isWhitespace(text[index])))
                 {
                     std::size_t wordWrapCorrection = 0;
                     while ((index > oldIndex) && (!isWhitespace(text[index - 1])))
@@ -442,14 +510,16 @@ namespace tgui
                     if ((index - oldIndex) <= wordWrapCorrection)
                         index = indexWithoutWordWrap;
                 }
-            }
 
-            result += text.substr(oldIndex, index - oldIndex);
-            if ((index < text.length()) && (text[index-1] != U'\n'))
-                result += U'\n';
+                addLine(oldIndex, index - oldIndex);
+            }
+            else
+                addLine(oldIndex, index - 1 - oldIndex);
         }
 
-        return result;
+        // There is an empty line behind a newline at the end
+        if ((start == end) || (text[end-1] == U'\n'))
+            lines.push_back({end, 0, 0});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
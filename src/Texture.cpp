@@ -357,7 +357,7 @@ namespace tgui
         const UIntRect& partRect = getPartRect();
         TGUI_ASSERT(pixel.x < partRect.width && pixel.y < partRect.height, "Texture::isTransparentPixel called with pixel outside texture rectangle");
 
-        return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left, pixel.y + partRect.top});
+        return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left + m_data->atlasRect.left, pixel.y + partRect.top + m_data->atlasRect.top});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -454,6 +454,8 @@ namespace tgui
         {
             if (m_data->svgImage)
                 m_partRect = {0, 0, static_cast<unsigned int>(m_data->svgImage->getSize().x), static_cast<unsigned int>(m_data->svgImage->getSize().y)};
+            else if (m_data->atlasRect != UIntRect{})
+                m_partRect = {0, 0, m_data->atlasRect.width, m_data->atlasRect.height};
             else
             {
                 const Vector2u textureSize = m_data->backendTexture->getSize();
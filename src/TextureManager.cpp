@@ -27,12 +27,27 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Exception.hpp>
+#include <TGUI/Global.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const unsigned int atlasPageSize = 1024;
+    const unsigned int atlasMaxImageSize = 256;
+    const unsigned int atlasPadding = 1;
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     std::map<String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::list<TextureManager::AtlasPage> TextureManager::m_atlasPages;
+    bool TextureManager::m_atlasEnabled = false;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -85,7 +100,16 @@ namespace tgui
         {
             data->backendTexture = getBackend()->createTexture();
             if (texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth))
+            {
+                // Copy the image into a shared atlas page if possible, the texture that was loaded is no longer needed then
+                if (m_atlasEnabled)
+                {
+                    const auto imageTexture = data->backendTexture;
+                    addToAtlas(*data, *imageTexture, smooth);
+                }
+
                 return data;
+            }
         }
 
         // The image could not be loaded
@@ -134,6 +158,9 @@ namespace tgui
                     // If this was the only place where the texture is used then delete it
                     if (--(dataIt->users) == 0)
                     {
+                        if (dataIt->data->atlasRect != UIntRect{})
+                            removeFromAtlas(*dataIt->data);
+
                         imageIt->second.erase(dataIt);
                         if (imageIt->second.empty())
                             m_imageMap.erase(imageIt);
@@ -155,6 +182,171 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::AtlasStatistics TextureManager::getAtlasStatistics()
+    {
+        AtlasStatistics stats;
+        std::size_t usedArea = 0;
+        for (const auto& page : m_atlasPages)
+        {
+            ++stats.pages;
+            stats.images += page.images;
+            usedArea += page.usedArea;
+        }
+
+        if (stats.pages > 0)
+            stats.fillRatio = static_cast<float>(usedArea) / static_cast<float>(stats.pages * atlasPageSize * atlasPageSize);
+
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::addToAtlas(TextureData& data, const BackendTexture& imageTexture, bool smooth)
+    {
+        const std::uint8_t* imagePixels = imageTexture.getPixels();
+        const Vector2u imageSize = imageTexture.getSize();
+        if (!imagePixels || (imageSize.x == 0) || (imageSize.y == 0) || (imageSize.x > atlasMaxImageSize) || (imageSize.y > atlasMaxImageSize))
+            return false;
+
+        // The image is surrounded by a copy of its border pixels, so that smoothing never samples from a neighbouring image
+        const Vector2u slotSize{imageSize.x + 2 * atlasPadding, imageSize.y + 2 * atlasPadding};
+
+        // Search for the shelf that wastes the least amount of height. A new shelf is only started when no existing one fits.
+        AtlasPage* page = nullptr;
+        std::size_t shelfIndex = 0;
+        for (auto& atlasPage : m_atlasPages)
+        {
+            if (atlasPage.smooth != smooth)
+                continue;
+
+            std::size_t bestShelfIndex = atlasPage.shelves.size();
+            for (std::size_t i = 0; i < atlasPage.shelves.size(); ++i)
+            {
+                const auto& shelf = atlasPage.shelves[i];
+                if ((shelf.height < slotSize.y) || (shelf.usedWidth + slotSize.x > atlasPageSize))
+                    continue;
+
+                if ((bestShelfIndex == atlasPage.shelves.size()) || (shelf.height < atlasPage.shelves[bestShelfIndex].height))
+                    bestShelfIndex = i;
+            }
+
+            const unsigned int nextShelfTop = atlasPage.shelves.empty() ? 0 : atlasPage.shelves.back().top + atlasPage.shelves.back().height;
+            if ((bestShelfIndex < atlasPage.shelves.size()) || (nextShelfTop + slotSize.y <= atlasPageSize))
+            {
+                page = &atlasPage;
+                shelfIndex = bestShelfIndex;
+                break;
+            }
+        }
+
+        AtlasPage::Shelf shelf;
+        if (page && (shelfIndex < page->shelves.size()))
+            shelf = page->shelves[shelfIndex];
+        else
+        {
+            if (page && !page->shelves.empty())
+                shelf.top = page->shelves.back().top + page->shelves.back().height;
+            shelf.height = slotSize.y;
+        }
+
+        // Copy the image into the slot and repeat the outer pixels in the padding around it
+        std::unique_ptr<std::uint8_t[]> slotPixels = MakeUniqueForOverwrite<std::uint8_t[]>(slotSize.x * slotSize.y * 4);
+        for (unsigned int y = 0; y < slotSize.y; ++y)
+        {
+            const unsigned int srcY = std::min(std::max(y, atlasPadding) - atlasPadding, imageSize.y - 1);
+            std::uint8_t* dst = &slotPixels[y * slotSize.x * 4];
+            const std::uint8_t* srcRow = &imagePixels[srcY * imageSize.x * 4];
+
+            std::memcpy(dst + 4 * atlasPadding, srcRow, imageSize.x * 4);
+            for (unsigned int i = 0; i < atlasPadding; ++i)
+            {
+                std::memcpy(dst + 4 * i, srcRow, 4);
+                std::memcpy(dst + 4 * (atlasPadding + imageSize.x + i), srcRow + 4 * (imageSize.x - 1), 4);
+            }
+        }
+
+        // Only the slot has to be uploaded when the image is added to an existing page.
+        // A new page, or a page of which the texture can't be partially updated, is loaded again with all its pixels.
+        const UIntRect slotRect{shelf.usedWidth, shelf.top, slotSize.x, slotSize.y};
+        if (!page || !page->backendTexture->updateRegion(slotRect, slotPixels.get()))
+        {
+            std::unique_ptr<std::uint8_t[]> pagePixels;
+            if (page)
+            {
+                pagePixels = MakeUniqueForOverwrite<std::uint8_t[]>(atlasPageSize * atlasPageSize * 4);
+                std::memcpy(pagePixels.get(), page->backendTexture->getPixels(), atlasPageSize * atlasPageSize * 4);
+            }
+            else
+                pagePixels = std::make_unique<std::uint8_t[]>(atlasPageSize * atlasPageSize * 4); // Zero-initialized
+
+            for (unsigned int y = 0; y < slotSize.y; ++y)
+            {
+                std::memcpy(&pagePixels[((slotRect.top + y) * atlasPageSize + slotRect.left) * 4],
+                            &slotPixels[y * slotSize.x * 4], slotSize.x * 4);
+            }
+
+            auto pageTexture = page ? page->backendTexture : getBackend()->createTexture();
+            if (!pageTexture->load({atlasPageSize, atlasPageSize}, std::move(pagePixels), smooth))
+                return false;
+
+            if (!page)
+            {
+                m_atlasPages.emplace_back();
+                page = &m_atlasPages.back();
+                page->backendTexture = pageTexture;
+                page->smooth = smooth;
+            }
+        }
+
+        shelf.usedWidth += slotSize.x;
+        if (shelfIndex < page->shelves.size())
+            page->shelves[shelfIndex] = shelf;
+        else
+            page->shelves.push_back(shelf);
+
+        ++page->images;
+        page->usedArea += static_cast<std::size_t>(imageSize.x) * imageSize.y;
+
+        data.backendTexture = page->backendTexture;
+        data.atlasRect = {slotRect.left + atlasPadding, slotRect.top + atlasPadding, imageSize.x, imageSize.y};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeFromAtlas(const TextureData& data)
+    {
+        for (auto pageIt = m_atlasPages.begin(); pageIt != m_atlasPages.end(); ++pageIt)
+        {
+            if (pageIt->backendTexture != data.backendTexture)
+                continue;
+
+            // The space isn't reused for new images, but the page is released once none of its images are used anymore
+            --pageIt->images;
+            pageIt->usedArea -= static_cast<std::size_t>(data.atlasRect.width) * data.atlasRect.height;
+            if (pageIt->images == 0)
+                m_atlasPages.erase(pageIt);
+
+            return;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -296,6 +296,7 @@ namespace tgui
             m_opacityCached        = other.m_opacityCached;
             m_textSizeCached       = other.m_textSizeCached;
             m_mouseCursor          = other.m_mouseCursor;
+            m_drawCacheValid       = false;
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -354,6 +355,7 @@ namespace tgui
             m_opacityCached        = std::move(other.m_opacityCached);
             m_textSizeCached       = std::move(other.m_textSizeCached);
             m_mouseCursor          = std::move(other.m_mouseCursor);
+            m_drawCacheValid       = false;
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -375,6 +377,8 @@ namespace tgui
 
     void Widget::setRenderer(std::shared_ptr<RendererData> rendererData)
     {
+        invalidateDrawCache();
+
         if (rendererData == nullptr)
             rendererData = RendererData::create();
 
@@ -479,6 +483,13 @@ namespace tgui
 
         if (getPosition() != m_prevPosition)
         {
+            // Moving a container doesn't change its contents, so the texture in which it was rendered can still be used
+            const bool renderCacheValid = m_containerWidget && static_cast<Container*>(this)->m_renderCacheValid;
+            invalidateDrawCache();
+            invalidateParentDrawCache();
+            if (renderCacheValid)
+                static_cast<Container*>(this)->m_renderCacheValid = true;
+
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
@@ -497,6 +508,9 @@ namespace tgui
 
         if (getSize() != m_prevSize)
         {
+            invalidateDrawCache();
+            invalidateParentDrawCache();
+
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
@@ -559,6 +573,9 @@ namespace tgui
 
     void Widget::setOrigin(Vector2f origin)
     {
+        invalidateDrawCache();
+        invalidateParentDrawCache();
+
         m_origin = origin;
     }
 
@@ -566,6 +583,9 @@ namespace tgui
 
     void Widget::setScale(Vector2f scaleFactors)
     {
+        invalidateDrawCache();
+        invalidateParentDrawCache();
+
         m_scaleFactors = scaleFactors;
         m_scaleOrigin.reset();
     }
@@ -574,6 +594,9 @@ namespace tgui
 
     void Widget::setScale(Vector2f scaleFactors, Vector2f origin)
     {
+        invalidateDrawCache();
+        invalidateParentDrawCache();
+
         m_scaleFactors = scaleFactors;
         m_scaleOrigin = origin;
     }
@@ -592,6 +615,9 @@ namespace tgui
 
     void Widget::setRotation(float angle)
     {
+        invalidateDrawCache();
+        invalidateParentDrawCache();
+
         m_rotationDeg = angle;
         m_rotationOrigin.reset();
     }
@@ -600,6 +626,9 @@ namespace tgui
 
     void Widget::setRotation(float angle, Vector2f origin)
     {
+        invalidateDrawCache();
+        invalidateParentDrawCache();
+
         m_rotationDeg = angle;
         m_rotationOrigin = origin;
     }
@@ -877,6 +906,9 @@ namespace tgui
 
     void Widget::setVisible(bool visible)
     {
+        invalidateDrawCache();
+        invalidateParentDrawCache();
+
         m_visible = visible;
 
         // If the widget is hiden while still focused then it must be unfocused
@@ -899,6 +931,8 @@ namespace tgui
 
     void Widget::setEnabled(bool enabled)
     {
+        invalidateDrawCache();
+
         m_enabled = enabled;
 
         if (!enabled)
@@ -920,6 +954,8 @@ namespace tgui
         if (m_focused == focused)
             return;
 
+        invalidateDrawCache();
+
         if (focused)
         {
             if (canGainFocus())
@@ -955,6 +991,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidateDrawCache()
+    {
+        m_drawCacheValid = false;
+
+        if (m_containerWidget)
+            static_cast<Container*>(this)->invalidateRenderCache();
+        else if (m_parent)
+            m_parent->invalidateRenderCache();
+
+        // The part of the screen where the widget was previously drawn has to be redrawn. The new area is only known once the
+        // gui is drawn again, but this widget might no longer be part of the gui by then (e.g. when it gets removed or hidden).
+        if (!m_damaged)
+        {
+            m_damaged = true;
+            if (m_parentGui)
+                m_parentGui->invalidateRect(m_lastDrawnArea);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::moveToFront()
     {
         if (m_parent)
@@ -973,6 +1030,8 @@ namespace tgui
 
     void Widget::setInheritedFont(const Font& font)
     {
+        invalidateDrawCache();
+
         m_inheritedFont = font;
         rendererChanged("Font");
     }
@@ -988,6 +1047,8 @@ namespace tgui
 
     void Widget::setInheritedOpacity(float opacity)
     {
+        invalidateDrawCache();
+
         m_inheritedOpacity = opacity;
         rendererChanged("Opacity");
     }
@@ -1003,6 +1064,8 @@ namespace tgui
 
     void Widget::setTextSize(unsigned int size)
     {
+        invalidateDrawCache();
+
         m_textSize = size;
 
         if (getSharedRenderer()->getTextSize())
@@ -1627,6 +1690,8 @@ namespace tgui
 
     void Widget::mouseEnteredWidget()
     {
+        invalidateDrawCache();
+
         if (m_parentGui && (m_mouseCursor != Cursor::Type::Arrow))
             m_parentGui->requestMouseCursor(m_mouseCursor);
 
@@ -1638,6 +1703,8 @@ namespace tgui
 
     void Widget::mouseLeftWidget()
     {
+        invalidateDrawCache();
+
         if (m_parentGui && m_parent && (m_parent->getMouseCursor() != m_mouseCursor))
             m_parentGui->requestMouseCursor(m_parent->getMouseCursor());
 
@@ -1647,8 +1714,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidateParentDrawCache()
+    {
+        // The recorded draw commands of the parent contain the transform with which each child widget was drawn
+        if (m_parent)
+        {
+            static_cast<Widget*>(m_parent)->m_drawCacheValid = false;
+            m_parent->invalidateRenderCache();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::rendererChangedCallback(const String& property)
     {
+        invalidateDrawCache();
+
         rendererChanged(property);
     }
 
@@ -274,6 +274,8 @@ namespace tgui
 
     void BitmapButton::updateTextPosition()
     {
+        invalidateDrawCache();
+
         if (!m_imageComponent->isVisible())
             return Button::updateTextPosition();
 
@@ -468,6 +468,7 @@ namespace tgui
         if (m_state == newState)
             return;
 
+        invalidateDrawCache();
         m_state = newState;
 
         m_backgroundComponent->setComponentState(m_state);
@@ -497,6 +498,8 @@ namespace tgui
 
     void ButtonBase::updateTextPosition()
     {
+        invalidateDrawCache();
+
         const Outline& borders = m_backgroundComponent->getBorders();
         m_textPosition.x.updateParentSize(getSize().x - borders.getLeft() - borders.getRight());
         m_textPosition.y.updateParentSize(getSize().y - borders.getTop() - borders.getBottom());
@@ -543,6 +546,8 @@ namespace tgui
 
     void ButtonBase::addComponent(const std::shared_ptr<priv::dev::Component>& component)
     {
+        invalidateDrawCache();
+
         m_components.emplace_back(component);
     }
 
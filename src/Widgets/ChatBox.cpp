@@ -293,6 +293,8 @@ namespace tgui
 
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
+        invalidateDrawCache();
+
         if (m_linesStartFromTop != startFromTop)
             m_linesStartFromTop = startFromTop;
     }
@@ -322,6 +324,8 @@ namespace tgui
 
     void ChatBox::setScrollbarValue(unsigned int value)
     {
+        invalidateDrawCache();
+
         m_scroll->setValue(value);
     }
 
@@ -435,6 +439,8 @@ namespace tgui
 
     void ChatBox::recalculateFullTextHeight()
     {
+        invalidateDrawCache();
+
         m_fullTextHeight = 0;
         for (const auto& line : m_lines)
             m_fullTextHeight += line.text.getSize().y;
@@ -457,6 +457,8 @@ namespace tgui
 
     void ChildWindow::setTitle(const String& title)
     {
+        invalidateDrawCache();
+
         m_titleText.setString(title);
 
         // Reposition the images and text
@@ -496,6 +498,8 @@ namespace tgui
 
     void ChildWindow::setTitleAlignment(TitleAlignment alignment)
     {
+        invalidateDrawCache();
+
         m_titleAlignment = alignment;
 
         // Reposition the images and text
@@ -698,6 +702,8 @@ namespace tgui
         }
         else if (!FloatRect{m_bordersCached.getLeft(), m_bordersCached.getTop(), getClientSize().x, getClientSize().y + m_titleBarHeightCached + m_borderBelowTitleBarCached}.contains(pos))
         {
+            invalidateDrawCache();
+
             if (!m_focused)
                 setFocused(true);
 
@@ -720,6 +726,9 @@ namespace tgui
         }
         else if (FloatRect{m_bordersCached.getLeft(), m_bordersCached.getTop(), getClientSize().x, m_titleBarHeightCached}.contains(pos))
         {
+            // The title bar buttons are drawn as part of the child window
+            invalidateDrawCache();
+
             if (!m_focused)
                 setFocused(true);
 
@@ -758,6 +767,8 @@ namespace tgui
         }
         else
         {
+            invalidateDrawCache();
+
             // Tell the widgets that the mouse was released
             for (auto& widget : m_widgets)
                 widget->leftMouseButtonNoLongerDown();
@@ -885,6 +896,9 @@ namespace tgui
             }
             else
             {
+                // The title bar buttons are drawn as part of the child window
+                invalidateDrawCache();
+
                 if (!m_mouseHover)
                     mouseEnteredWidget();
 
@@ -932,6 +946,7 @@ namespace tgui
 
     void ChildWindow::mouseNoLongerOnWidget()
     {
+        invalidateDrawCache();
         Container::mouseNoLongerOnWidget();
 
         for (const auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
@@ -945,6 +960,7 @@ namespace tgui
 
     void ChildWindow::leftMouseButtonNoLongerDown()
     {
+        invalidateDrawCache();
         Container::leftMouseButtonNoLongerDown();
 
         for (const auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
@@ -958,6 +974,8 @@ namespace tgui
 
     void ChildWindow::updateTitleBarHeight()
     {
+        invalidateDrawCache();
+
         m_spriteTitleBar.setSize({getClientSize().x, m_titleBarHeightCached});
 
         // Set the size of the buttons in the title bar
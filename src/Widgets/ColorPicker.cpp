@@ -702,6 +702,7 @@ namespace tgui
             const std::uint8_t factor = static_cast<std::uint8_t>(255 * logInvCurve(value / m_value->getMaximum()));
             m_colorWheelTexture.setColor({factor, factor, factor});
             m_colorWheelSprite.setTexture(m_colorWheelTexture);
+            invalidateDrawCache();
         };
 
         m_value->onValueChange.disconnectAll();
@@ -290,6 +290,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItem(const String& itemName)
     {
+        invalidateDrawCache();
+
         const int previousSelectedItemIndex = m_listBox->getSelectedItemIndex();
 
         const bool ret = m_listBox->setSelectedItem(itemName);
@@ -305,6 +307,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItemById(const String& id)
     {
+        invalidateDrawCache();
+
         const int previousSelectedItemIndex = m_listBox->getSelectedItemIndex();
 
         const bool ret = m_listBox->setSelectedItemById(id);
@@ -320,6 +324,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItemByIndex(std::size_t index)
     {
+        invalidateDrawCache();
+
         const int previousSelectedItemIndex = m_listBox->getSelectedItemIndex();
 
         const bool ret = m_listBox->setSelectedItemByIndex(index);
@@ -335,6 +341,8 @@ namespace tgui
 
     void ComboBox::deselectItem()
     {
+        invalidateDrawCache();
+
         m_text.setString("");
         m_listBox->deselectItem();
     }
@@ -343,6 +351,8 @@ namespace tgui
 
     bool ComboBox::removeItem(const String& itemName)
     {
+        invalidateDrawCache();
+
         // Implemented like removeItemByIndex instead of like removeItemById because m_listBox->getItems() may be slow
 
         const bool ret = m_listBox->removeItem(itemName);
@@ -374,6 +384,8 @@ namespace tgui
 
     bool ComboBox::removeItemByIndex(std::size_t index)
     {
+        invalidateDrawCache();
+
         const bool ret = m_listBox->removeItemByIndex(index);
 
         m_text.setString(m_listBox->getSelectedItem());
@@ -389,6 +401,8 @@ namespace tgui
 
     void ComboBox::removeAllItems()
     {
+        invalidateDrawCache();
+
         m_text.setString("");
         m_listBox->removeAllItems();
 
@@ -427,6 +441,8 @@ namespace tgui
 
     bool ComboBox::changeItem(const String& originalValue, const String& newValue)
     {
+        invalidateDrawCache();
+
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -436,6 +452,8 @@ namespace tgui
 
     bool ComboBox::changeItemById(const String& id, const String& newValue)
     {
+        invalidateDrawCache();
+
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -445,6 +463,8 @@ namespace tgui
 
     bool ComboBox::changeItemByIndex(std::size_t index, const String& newValue)
     {
+        invalidateDrawCache();
+
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -468,6 +488,8 @@ namespace tgui
 
     void ComboBox::setMaximumItems(std::size_t maximumItems)
     {
+        invalidateDrawCache();
+
         m_listBox->setMaximumItems(maximumItems);
     }
 
@@ -491,6 +513,8 @@ namespace tgui
 
     void ComboBox::setDefaultText(const String& defaultText)
     {
+        invalidateDrawCache();
+
         m_defaultText.setString(defaultText);
     }
 
@@ -173,6 +173,8 @@ namespace tgui
 
     void EditBox::setDefaultText(const String& text)
     {
+        invalidateDrawCache();
+
         m_defaultText.setString(text);
     }
 
@@ -980,44 +982,8 @@ namespace tgui
             }
         }
 
-        float width = 0;
-        char32_t prevChar = 0;
-        const unsigned int textSize = getTextSize();
-        const bool bold = (m_textFull.getStyle() & TextStyle::Bold) != 0;
-
-        std::size_t index;
-        for (index = 0; index < m_text.length(); ++index)
-        {
-            float charWidth;
-            const char32_t curChar = m_text[index];
-            if (curChar == '\n')
-            {
-                // This should not happen as edit box is for single line text, but lets try the next line anyway since we haven't found the position yet
-                width = 0;
-                prevChar = 0;
-                continue;
-            }
-            else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
-            else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
-
-            const float kerning = m_fontCached.getKerning(prevChar, curChar, textSize, bold);
-            if (width + charWidth < posX)
-                width += charWidth + kerning;
-            else
-            {
-                // If the mouse is on the second halve of the character then the caret should be on the right of it
-                if (width + charWidth - posX < charWidth / 2.f)
-                    index++;
-
-                break;
-            }
-
-            prevChar = curChar;
-        }
-
-        return index;
+        // Find between which characters the position is located, the positions of the characters are reused between calls
+        return m_textFull.findCharacterIndex({posX, 0});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1054,6 +1020,8 @@ namespace tgui
 
     void EditBox::recalculateTextPositions()
     {
+        invalidateDrawCache();
+
         // If the edit box is resized then it might happen that text which previously didn't fit will now fit inside it
         if (m_textCropPosition != 0)
         {
@@ -1104,7 +1072,7 @@ namespace tgui
                                                  bold);
             }
 
-            textX += m_textBeforeSelection.findCharacterPos(charsBeforeSelection).x;
+            textX += m_textFull.findCharacterPos(charsBeforeSelection).x;
 
             // Set the position and size of the rectangle that gets drawn behind the selected text
             m_selectedTextBackground.setSize({m_textSelection.findCharacterPos(m_selChars).x, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()});
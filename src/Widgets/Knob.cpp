@@ -431,6 +431,8 @@ namespace tgui
 
     void Knob::recalculateRotation()
     {
+        invalidateDrawCache();
+
         // Calculate the difference in degrees between the start and end rotation
         float allowedAngle = 0;
         if (compareFloats(m_startRotation, m_endRotation))
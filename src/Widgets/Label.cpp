@@ -561,6 +561,8 @@ namespace tgui
 
     void Label::rearrangeText()
     {
+        invalidateDrawCache();
+
         m_lines.clear();
 
         if (m_fontCached == nullptr)
@@ -606,15 +608,15 @@ namespace tgui
         }
 
         // Fit the text in the available space
-        String string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold);
+        std::vector<Text::WrappedLine> wrappedLines;
+        Text::findLineBreaks(wrappedLines, maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold);
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
                                  m_paddingCached.getTop() + m_bordersCached.getTop(),
                                  m_paddingCached.getRight() + m_bordersCached.getRight(),
                                  m_paddingCached.getBottom() + m_bordersCached.getBottom()};
 
-        const auto lineCount = std::count(string.begin(), string.end(), U'\n') + 1;
-        float requiredTextHeight = lineCount * m_fontCached.getLineSpacing(m_textSizeCached)
+        float requiredTextHeight = wrappedLines.size() * m_fontCached.getLineSpacing(m_textSizeCached)
                                    + Text::calculateExtraVerticalSpace(m_fontCached, m_textSizeCached, m_textStyleCached)
                                    + Text::getExtraVerticalPadding(m_textSizeCached);
 
@@ -628,10 +630,10 @@ namespace tgui
                 if (maxWidth <= 0)
                     return;
 
-                string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold);
+                wrappedLines.clear();
+                Text::findLineBreaks(wrappedLines, maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold);
 
-                const auto newLineCount = std::count(string.begin(), string.end(), U'\n') + 1;
-                requiredTextHeight = newLineCount * m_fontCached.getLineSpacing(m_textSizeCached)
+                requiredTextHeight = wrappedLines.size() * m_fontCached.getLineSpacing(m_textSizeCached)
                                      + Text::calculateExtraVerticalSpace(m_fontCached, m_textSizeCached, m_textStyleCached)
                                      + Text::getExtraVerticalPadding(m_textSizeCached);
             }
@@ -643,14 +645,10 @@ namespace tgui
             m_scrollbar->setScrollAmount(m_textSizeCached);
         }
 
-        // Split the string in multiple lines
+        // Create a text for every line
         float width = 0;
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != String::npos)
+        for (const auto& wrappedLine : wrappedLines)
         {
-            newLinePos = string.find('\n', searchPosStart);
-
             TGUI_EMPLACE_BACK(line, m_lines)
             line.setCharacterSize(getTextSize());
             line.setFont(m_fontCached);
@@ -659,16 +657,10 @@ namespace tgui
             line.setOpacity(m_opacityCached);
             line.setOutlineColor(m_textOutlineColorCached);
             line.setOutlineThickness(m_textOutlineThicknessCached);
-
-            if (newLinePos != String::npos)
-                line.setString(string.substr(searchPosStart, newLinePos - searchPosStart));
-            else
-                line.setString(string.substr(searchPosStart));
+            line.setString(m_string.substr(wrappedLine.start, wrappedLine.length));
 
             if (line.getSize().x > width)
                 width = line.getSize().x;
-
-            searchPosStart = newLinePos + 1;
         }
 
         // Update the size of the label
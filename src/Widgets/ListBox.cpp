@@ -114,6 +114,8 @@ namespace tgui
 
     std::size_t ListBox::addItem(const String& itemName, const String& id)
     {
+        invalidateDrawCache();
+
         // Check if the item limit is reached (if there is one)
         if ((m_maxItems > 0) && (m_items.size() >= m_maxItems))
             return m_maxItems;
@@ -267,6 +269,8 @@ namespace tgui
 
     void ListBox::removeAllItems()
     {
+        invalidateDrawCache();
+
         // Unselect any selected item
         updateSelectedItem(-1);
         updateHoveringItem(-1);
@@ -375,6 +379,8 @@ namespace tgui
 
     bool ListBox::changeItemByIndex(std::size_t index, const String& newValue)
     {
+        invalidateDrawCache();
+
         if (index >= m_items.size())
             return false;
 
@@ -513,6 +519,8 @@ namespace tgui
 
     void ListBox::setTextAlignment(TextAlignment alignment)
     {
+        invalidateDrawCache();
+
         m_textAlignment = alignment;
     }
 
@@ -998,6 +1006,8 @@ namespace tgui
 
     void ListBox::updateItemPositions()
     {
+        invalidateDrawCache();
+
         for (std::size_t i = 0; i < m_items.size(); ++i)
             m_items[i].text.setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].text.getSize().y) / 2.0f)});
 
@@ -1008,6 +1018,8 @@ namespace tgui
 
     void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
     {
+        invalidateDrawCache();
+
         if (m_selectedItem >= 0)
         {
             if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
@@ -1093,6 +1105,7 @@ namespace tgui
         if (currentScrollbarValue == m_lastScrollbarValue)
             return;
 
+        invalidateDrawCache();
         m_lastScrollbarValue = currentScrollbarValue;
         onScroll.emit(this, currentScrollbarValue);
     }
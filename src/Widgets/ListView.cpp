@@ -255,6 +255,8 @@ namespace tgui
 
     void ListView::setColumnAlignment(std::size_t columnIndex, ColumnAlignment alignment)
     {
+        invalidateDrawCache();
+
         if (columnIndex < m_columns.size())
             m_columns[columnIndex].alignment = alignment;
         else
@@ -879,6 +881,8 @@ namespace tgui
 
     void ListView::sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp)
     {
+        invalidateDrawCache();
+
         if (index >= m_items.size())
             return;
 
@@ -1186,6 +1190,8 @@ namespace tgui
 
     void ListView::setVerticalScrollbarValue(unsigned int value)
     {
+        invalidateDrawCache();
+
         m_verticalScrollbar->setValue(value);
     }
 
@@ -1200,6 +1206,8 @@ namespace tgui
 
     void ListView::setHorizontalScrollbarValue(unsigned int value)
     {
+        invalidateDrawCache();
+
         m_horizontalScrollbar->setValue(value);
     }
 
@@ -1214,6 +1222,8 @@ namespace tgui
 
     void ListView::setFixedIconSize(Vector2f fixedIconSize)
     {
+        invalidateDrawCache();
+
         if (fixedIconSize == m_fixedIconSize)
             return;
 
@@ -2092,6 +2102,8 @@ namespace tgui
 
     void ListView::setItemColor(std::size_t index, const Color& color)
     {
+        invalidateDrawCache();
+
         for (auto& text : m_items[index].texts)
             text.setColor(color);
     }
@@ -2107,6 +2119,8 @@ namespace tgui
 
     void ListView::updateSelectedAndhoveredItemColors()
     {
+        invalidateDrawCache();
+
         for (const std::size_t selectedItem : m_selectedItems)
         {
             if ((static_cast<int>(selectedItem) == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
@@ -2530,6 +2544,8 @@ namespace tgui
 
     void ListView::updateScrollbars()
     {
+        invalidateDrawCache();
+
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
         const Vector2f innerSize = {std::max(0.f, getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight()),
                                     std::max(0.f, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - getCurrentHeaderHeight())};
@@ -395,6 +395,8 @@ namespace tgui
 
     bool MenuBar::changeMenuItem(const std::vector<String>& hierarchy, const String& text)
     {
+        invalidateDrawCache();
+
         if (hierarchy.empty())
             return false;
 
@@ -410,6 +412,8 @@ namespace tgui
 
     void MenuBar::removeAllMenus()
     {
+        invalidateDrawCache();
+
         m_menus.clear();
     }
 
@@ -417,6 +421,8 @@ namespace tgui
 
     bool MenuBar::removeMenu(const String& menu)
     {
+        invalidateDrawCache();
+
         for (std::size_t i = 0; i < m_menus.size(); ++i)
         {
             if (m_menus[i].text.getString() != menu)
@@ -442,6 +448,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const std::vector<String>& hierarchy, bool removeParentsWhenEmpty)
     {
+        invalidateDrawCache();
+
         if (hierarchy.size() < 2)
             return false;
 
@@ -459,6 +467,8 @@ namespace tgui
 
     bool MenuBar::removeSubMenuItems(const std::vector<String>& hierarchy)
     {
+        invalidateDrawCache();
+
         if (hierarchy.empty())
             return false;
 
@@ -565,6 +575,8 @@ namespace tgui
 
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
+        invalidateDrawCache();
+
         m_minimumSubMenuWidth = minimumWidth;
     }
 
@@ -579,6 +591,8 @@ namespace tgui
 
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
+        invalidateDrawCache();
+
         m_invertedMenuDirection = invertDirection;
     }
 
@@ -911,6 +925,8 @@ namespace tgui
 
     void MenuBar::createMenu(std::vector<Menu>& menus, const String& text)
     {
+        invalidateDrawCache();
+
         Menu newMenu;
         newMenu.text.setFont(m_fontCached);
         newMenu.text.setColor(m_textColorCached);
@@ -1101,6 +1117,8 @@ namespace tgui
 
     void MenuBar::updateMenuTextColor(Menu& menu, bool selected)
     {
+        invalidateDrawCache();
+
         if ((!m_enabled || !menu.enabled) && m_textColorDisabledCached.isSet())
             menu.text.setColor(m_textColorDisabledCached);
         else if (selected && m_selectedTextColorCached.isSet())
@@ -1632,6 +1650,7 @@ namespace tgui
 
     void MenuBarMenuPlaceholder::leftMouseButtonNoLongerDown()
     {
+        m_menuBar->invalidateDrawCache();
         m_menuBar->leftMouseReleasedOnMenu();
     }
 
@@ -1639,6 +1658,9 @@ namespace tgui
 
     void MenuBarMenuPlaceholder::mouseMoved(Vector2f pos)
     {
+        // The open menu is drawn by this placeholder, but the menu bar itself may also change when hovering over it
+        m_menuBar->invalidateDrawCache();
+
         bool mouseOnMenuBar = false;
         if (m_menuBar->isMouseOnOpenMenu(pos - getPosition()))
         {
@@ -389,6 +389,8 @@ namespace tgui
 
     void ProgressBar::updateTextSize()
     {
+        invalidateDrawCache();
+
         // Check if the text is auto sized
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
         {
@@ -420,6 +422,8 @@ namespace tgui
 
     void ProgressBar::recalculateFillSize()
     {
+        invalidateDrawCache();
+
         Vector2f size;
         if (m_spriteFill.isSet())
         {
@@ -164,6 +164,8 @@ namespace tgui
 
     void RadioButton::setText(const String& text)
     {
+        invalidateDrawCache();
+
         m_text.setString(text);
     }
 
@@ -604,6 +606,8 @@ namespace tgui
 
     void RadioButton::updateTextColor()
     {
+        invalidateDrawCache();
+
         if (m_checked)
         {
             if (!m_enabled && getSharedRenderer()->getTextColorCheckedDisabled().isSet())
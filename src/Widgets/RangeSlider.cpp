@@ -658,6 +658,8 @@ namespace tgui
 
     void RangeSlider::updateThumbPositions()
     {
+        invalidateDrawCache();
+
         const Vector2f innerSize = getInnerSize();
 
         if (m_verticalScroll)
@@ -441,6 +441,8 @@ namespace tgui
 
     void ScrollablePanel::setVerticalScrollbarValue(unsigned int value)
     {
+        invalidateDrawCache();
+
         m_verticalScrollbar->setValue(value);
     }
 
@@ -455,6 +457,8 @@ namespace tgui
 
     void ScrollablePanel::setHorizontalScrollbarValue(unsigned int value)
     {
+        invalidateDrawCache();
+
         m_horizontalScrollbar->setValue(value);
     }
 
@@ -481,9 +485,15 @@ namespace tgui
         m_mouseDown = true;
 
         if (m_verticalScrollbar->isMouseOnWidget(pos - getPosition()))
+        {
+            invalidateDrawCache();
             m_verticalScrollbar->leftMousePressed(pos - getPosition());
+        }
         else if (m_horizontalScrollbar->isMouseOnWidget(pos - getPosition()))
+        {
+            invalidateDrawCache();
             m_horizontalScrollbar->leftMousePressed(pos - getPosition());
+        }
         else if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
         {
             Panel::leftMousePressed({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
@@ -496,9 +506,15 @@ namespace tgui
     void ScrollablePanel::leftMouseReleased(Vector2f pos)
     {
         if (m_verticalScrollbar->isMouseOnWidget(pos - getPosition()))
+        {
+            invalidateDrawCache();
             m_verticalScrollbar->leftMouseReleased(pos - getPosition());
+        }
         else if (m_horizontalScrollbar->isMouseOnWidget(pos - getPosition()))
+        {
+            invalidateDrawCache();
             m_horizontalScrollbar->leftMouseReleased(pos - getPosition());
+        }
         else if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
         {
             Panel::leftMouseReleased({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
@@ -513,14 +529,25 @@ namespace tgui
         // Check if the mouse event should go to the scrollbar
         if ((m_verticalScrollbar->isMouseDown() && m_verticalScrollbar->isMouseDownOnThumb()) || m_verticalScrollbar->isMouseOnWidget(pos - getPosition()))
         {
+            invalidateDrawCache();
+            m_mouseOnScrollbar = true;
             m_verticalScrollbar->mouseMoved(pos - getPosition());
         }
         else if ((m_horizontalScrollbar->isMouseDown() && m_horizontalScrollbar->isMouseDownOnThumb()) || m_horizontalScrollbar->isMouseOnWidget(pos - getPosition()))
         {
+            invalidateDrawCache();
+            m_mouseOnScrollbar = true;
             m_horizontalScrollbar->mouseMoved(pos - getPosition());
         }
         else // Mouse not on scrollbar or dragging the scrollbar thumb
         {
+            // The hover state of the scrollbars only has to be redrawn when the mouse just left them
+            if (m_mouseOnScrollbar)
+            {
+                invalidateDrawCache();
+                m_mouseOnScrollbar = false;
+            }
+
             if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
             {
                 Panel::mouseMoved({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
@@ -556,11 +583,13 @@ namespace tgui
                 || m_horizontalScrollbar->isMouseOnWidget(pos - getPosition())
                 || keyboard::isShiftPressed()))
         {
+            invalidateDrawCache();
             m_horizontalScrollbar->mouseWheelScrolled(delta, pos - getPosition());
             mouseMoved(pos);
         }
         else if (m_verticalScrollbar->isShown())
         {
+            invalidateDrawCache();
             m_verticalScrollbar->mouseWheelScrolled(delta, pos - getPosition());
             mouseMoved(pos);
         }
@@ -572,6 +601,8 @@ namespace tgui
 
     void ScrollablePanel::mouseNoLongerOnWidget()
     {
+        invalidateDrawCache();
+        m_mouseOnScrollbar = false;
         Panel::mouseNoLongerOnWidget();
         m_verticalScrollbar->mouseNoLongerOnWidget();
         m_horizontalScrollbar->mouseNoLongerOnWidget();
@@ -581,6 +612,7 @@ namespace tgui
 
     void ScrollablePanel::leftMouseButtonNoLongerDown()
     {
+        invalidateDrawCache();
         Panel::leftMouseButtonNoLongerDown();
         m_verticalScrollbar->leftMouseButtonNoLongerDown();
         m_horizontalScrollbar->leftMouseButtonNoLongerDown();
@@ -756,6 +788,8 @@ namespace tgui
 
     void ScrollablePanel::updateScrollbars()
     {
+        invalidateDrawCache();
+
         const Vector2f scrollbarSpace = {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
                                          getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()};
 
@@ -198,6 +198,8 @@ namespace tgui
 
     void Scrollbar::setAutoHide(bool autoHide)
     {
+        invalidateDrawCache();
+
         m_autoHide = autoHide;
     }
 
@@ -617,6 +619,8 @@ namespace tgui
 
     void Scrollbar::updateSize()
     {
+        invalidateDrawCache();
+
         if (getSize().x < getSize().y)
             m_verticalScroll = true;
         else if (getSize().x > getSize().y)
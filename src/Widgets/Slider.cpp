@@ -658,6 +658,8 @@ namespace tgui
 
     void Slider::updateThumbPosition()
     {
+        invalidateDrawCache();
+
         if (m_verticalScroll)
         {
             m_thumb.left = m_bordersCached.getLeft() + (getInnerSize().x - m_thumb.width) / 2.0f;
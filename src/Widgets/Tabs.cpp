@@ -225,6 +225,8 @@ namespace tgui
             return false;
         }
 
+        invalidateDrawCache();
+
         if (m_selectedTab >= 0)
             m_tabs[m_selectedTab].text.setColor(m_textColorCached);
 
@@ -243,6 +245,7 @@ namespace tgui
     {
         if (m_selectedTab >= 0)
         {
+            invalidateDrawCache();
             m_tabs[m_selectedTab].text.setColor(m_textColorCached);
             m_selectedTab = -1;
         }
@@ -491,6 +494,8 @@ namespace tgui
 
     void Tabs::recalculateTabsWidth()
     {
+        invalidateDrawCache();
+
         std::size_t visibleTabs = 0;
         for (std::size_t i = 0; i < m_tabs.size(); ++i)
         {
@@ -769,6 +774,8 @@ namespace tgui
 
     void Tabs::updateTextColors()
     {
+        invalidateDrawCache();
+
         for (auto& tab : m_tabs)
         {
             if ((!m_enabled || !tab.enabled) && m_textColorDisabledCached.isSet())
@@ -27,6 +27,7 @@
 #include <TGUI/Widgets/TextArea.hpp>
 #include <TGUI/Keyboard.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -165,6 +166,8 @@ namespace tgui
 
     void TextArea::setDefaultText(const String& text)
     {
+        invalidateDrawCache();
+
         m_defaultText.setString(text);
     }
 
@@ -330,25 +333,9 @@ namespace tgui
             charactersBeforeCaret = m_text.length();
 
         // Find the line and position on that line on which the caret is located
-        std::size_t count = 0;
-        for (std::size_t i = 0; i < m_lines.size(); ++i)
-        {
-            if (count + m_lines[i].length() < charactersBeforeCaret)
-            {
-                count += m_lines[i].length();
-                if ((count < m_text.length()) && (m_text[count] == U'\n'))
-                    count += 1;
-            }
-            else
-            {
-                m_selStart.y = i;
-                m_selStart.x = charactersBeforeCaret - count;
-
-                m_selEnd = m_selStart;
-                updateSelectionTexts();
-                break;
-            }
-        }
+        m_selStart = getSelectionPosOfIndex(charactersBeforeCaret);
+        m_selEnd = m_selStart;
+        updateSelectionTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -420,6 +407,7 @@ namespace tgui
     void TextArea::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        recalculateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -433,6 +421,8 @@ namespace tgui
 
     void TextArea::setHorizontalScrollbarValue(unsigned int value)
     {
+        invalidateDrawCache();
+
         m_horizontalScrollbar->setValue(value);
     }
 
@@ -488,15 +478,18 @@ namespace tgui
                 // The next click is going to be a normal one again
                 m_possibleDoubleClick = false;
 
+                const Line& line = m_lines[m_selStart.y];
+                const std::size_t lineStart = getLineStart(m_selStart.y);
+
                 // If the click was to the right of the end of line then make sure to select the word on the left
-                if (m_lines[m_selStart.y].length() > 1 && (m_selStart.x == (m_lines[m_selStart.y].length()-1) || m_selStart.x == m_lines[m_selStart.y].length()))
+                if (line.length > 1 && (m_selStart.x == (line.length-1) || m_selStart.x == line.length))
                 {
                     m_selStart.x--;
                     m_selEnd.x = m_selStart.x;
                 }
 
                 bool selectingWhitespace;
-                if (isWhitespace(m_lines[m_selStart.y][m_selStart.x]))
+                if ((m_selStart.x < line.length) && isWhitespace(m_text[lineStart + m_selStart.x]))
                     selectingWhitespace = true;
                 else
                     selectingWhitespace = false;
@@ -504,7 +497,7 @@ namespace tgui
                 // Move start pointer to the beginning of the word/whitespace
                 for (std::size_t i = m_selStart.x; i > 0; --i)
                 {
-                    if (selectingWhitespace != isWhitespace(m_lines[m_selStart.y][i-1]))
+                    if (selectingWhitespace != isWhitespace(m_text[lineStart + i-1]))
                     {
                         m_selStart.x = i;
                         break;
@@ -514,15 +507,15 @@ namespace tgui
                 }
 
                 // Move end pointer to the end of the word/whitespace
-                for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].length(); ++i)
+                for (std::size_t i = m_selEnd.x; i < line.length; ++i)
                 {
-                    if (selectingWhitespace != isWhitespace(m_lines[m_selEnd.y][i]))
+                    if (selectingWhitespace != isWhitespace(m_text[lineStart + i]))
                     {
                         m_selEnd.x = i;
                         break;
                     }
                     else
-                        m_selEnd.x = m_lines[m_selEnd.y].length();
+                        m_selEnd.x = line.length;
                 }
             }
             else // No double clicking
@@ -691,11 +684,11 @@ namespace tgui
             else if (keyboard::isKeyPressMoveCaretLineStart(event))
                 m_selEnd.x = 0;
             else if (keyboard::isKeyPressMoveCaretLineEnd(event))
-                m_selEnd.x = m_lines[m_selEnd.y].length();
+                m_selEnd.x = m_lines[m_selEnd.y].length;
             else if (keyboard::isKeyPressMoveCaretDocumentBegin(event))
                 m_selEnd = {0, 0};
             else if (keyboard::isKeyPressMoveCaretDocumentEnd(event))
-                m_selEnd = {m_lines[m_lines.size()-1].length(), m_lines.size()-1};
+                m_selEnd = {m_lines.back().length, m_lines.size()-1};
             else
                 caretMoved = false;
 
@@ -728,48 +721,35 @@ namespace tgui
         if ((m_maxChars > 0) && (m_text.length() + 1 > m_maxChars))
             return;
 
-        auto insert = TGUI_LAMBDA_CAPTURE_EQ_THIS()
-        {
-            deleteSelectedCharacters();
-
-            const std::size_t caretPosition = getSelectionEnd();
-
-            m_text.insert(m_text.begin() + caretPosition, key);
-            m_lines[m_selEnd.y].insert(m_lines[m_selEnd.y].begin() + m_selEnd.x, key);
-
-            // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
-            if ((key != U'\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].empty() || (m_text[caretPosition-1] == U'\n'))
-            {
-                m_selStart.x++;
-                m_selEnd.x++;
-            }
-
-            rearrangeText(true);
-        };
+        // The character replaces the selected characters (if there are any)
+        const std::size_t selStart = getSelectionStart();
+        const std::size_t selEnd = getSelectionEnd();
+        const std::size_t index = std::min(selStart, selEnd);
+        const std::size_t count = std::max(selStart, selEnd) - index;
 
         // If there is a scrollbar then inserting can't go wrong
         if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
         {
-            insert();
+            replaceText(index, count, String(1, key));
         }
         else // There is no scrollbar, the text may not fit
         {
             // Store the data so that it can be reverted
-            const auto oldText = m_text;
+            const String removedText = m_text.substr(index, count);
             const auto oldSelStart = m_selStart;
             const auto oldSelEnd = m_selEnd;
 
             // Try to insert the character
-            insert();
+            replaceText(index, count, String(1, key));
 
             // Undo the insert if the text does not fit
             if (m_lines.size() > getInnerSize().y / m_lineHeight)
             {
-                m_text = oldText;
+                replaceText(index, 1, removedText);
+
                 m_selStart = oldSelStart;
                 m_selEnd = oldSelEnd;
-
-                rearrangeText(true);
+                updateSelectionTexts();
             }
         }
 
@@ -810,7 +790,7 @@ namespace tgui
 
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
-            return Vector2<std::size_t>(m_lines[m_lines.size()-1].size(), m_lines.size()-1);
+            return Vector2<std::size_t>(m_lines.back().length, m_lines.size()-1);
 
         // Find on which line the mouse is
         std::size_t lineNumber;
@@ -831,59 +811,71 @@ namespace tgui
 
         // Check if you clicked behind everything
         if (lineNumber + 1 > m_lines.size())
-            return Vector2<std::size_t>(m_lines[m_lines.size()-1].size(), m_lines.size()-1);
+            return Vector2<std::size_t>(m_lines.back().length, m_lines.size()-1);
 
         // Find between which character the mouse is standing
-        float width = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached) - m_horizontalScrollbar->getValue();
-        char32_t prevChar = 0;
-        for (std::size_t i = 0; i < m_lines[lineNumber].size(); ++i)
-        {
-            float charWidth;
-            const char32_t curChar = m_lines[lineNumber][i];
-            //if (curChar == U'\n')
-            //    return Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextArea strips newlines but this code is kept for when this function is generalized
-            //else
-            if (curChar == U'\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
-            else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+        const float posX = position.x - textOffset + m_horizontalScrollbar->getValue();
+        return {getLineText(lineNumber).findCharacterIndex({posX, 0}), lineNumber};
+    }
 
-            const float kerning = m_fontCached.getKerning(prevChar, curChar, getTextSize(), false);
-            if (width + charWidth + kerning <= position.x)
-                width += charWidth + kerning;
-            else
-            {
-                if (position.x < width + kerning + (charWidth / 2.0f))
-                    return {i, lineNumber};
-                else
-                    return {i + 1, lineNumber};
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            prevChar = curChar;
-        }
+    const Text& TextArea::getLineText(std::size_t lineNumber) const
+    {
+        m_lineText.setFont(m_fontCached);
+        m_lineText.setCharacterSize(m_textSizeCached);
+
+        const std::size_t lineStart = getLineStart(lineNumber);
+        const std::size_t lineLength = m_lines[lineNumber].length;
+        if (m_text.compare(lineStart, lineLength, m_lineText.getString()) != 0)
+            m_lineText.setString(m_text.substr(lineStart, lineLength));
+
+        return m_lineText;
+    }
 
-        // You clicked behind the last character
-        return Vector2<std::size_t>(m_lines[lineNumber].length(), lineNumber);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextArea::getLineStart(std::size_t lineNumber) const
+    {
+        // The offset may have wrapped around when text was removed, but the sum is still correct modulo the size of size_t
+        if (lineNumber >= m_shiftedLinesStart)
+            return m_lines[lineNumber].start + m_shiftedLinesOffset;
+        else
+            return m_lines[lineNumber].start;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::size_t TextArea::getIndexOfSelectionPos(Vector2<std::size_t> selectionPos) const
     {
-        auto findIndex = [this](std::size_t line)
+        return getLineStart(selectionPos.y) + selectionPos.x;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2<std::size_t> TextArea::getSelectionPosOfIndex(std::size_t index) const
+    {
+        // Find the first line that ends at or behind the index
+        std::size_t lineNumber = 0;
+        std::size_t lineCount = m_lines.size();
+        while (lineCount > 0)
         {
-            std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
+            const std::size_t halfCount = lineCount / 2;
+            const std::size_t middleLine = lineNumber + halfCount;
+            if (getLineStart(middleLine) + m_lines[middleLine].length < index)
             {
-                counter += m_lines[i].length();
-                if ((counter < m_text.length()) && (m_text[counter] == U'\n'))
-                    counter += 1;
+                lineNumber = middleLine + 1;
+                lineCount -= halfCount + 1;
             }
+            else
+                lineCount = halfCount;
+        }
 
-            return counter;
-        };
+        if (lineNumber == m_lines.size())
+            return Vector2<std::size_t>(m_lines.back().length, m_lines.size()-1);
 
-        return findIndex(selectionPos.y) + selectionPos.x;
+        return Vector2<std::size_t>(index - getLineStart(lineNumber), lineNumber);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -895,17 +887,9 @@ namespace tgui
             const std::size_t selStart = getSelectionStart();
             const std::size_t selEnd = getSelectionEnd();
             if (selStart <= selEnd)
-            {
-                m_text.erase(selStart, selEnd - selStart);
-                m_selEnd = m_selStart;
-            }
+                replaceText(selStart, selEnd - selStart, U"");
             else
-            {
-                m_text.erase(selEnd, selStart - selEnd);
-                m_selStart = m_selEnd;
-            }
-
-            rearrangeText(true);
+                replaceText(selEnd, selStart - selEnd, U"");
         }
     }
 
@@ -930,7 +914,7 @@ namespace tgui
                 if (m_selEnd.y > 0)
                 {
                     m_selEnd.y--;
-                    m_selEnd.x = m_lines[m_selEnd.y].length();
+                    m_selEnd.x = m_lines[m_selEnd.y].length;
                 }
             }
         }
@@ -948,7 +932,7 @@ namespace tgui
         else
         {
             // Move to the next line if you are at the end of the line
-            if (m_selEnd.x == m_lines[m_selEnd.y].length())
+            if (m_selEnd.x == m_lines[m_selEnd.y].length)
             {
                 if (m_selEnd.y + 1 < m_lines.size())
                 {
@@ -974,7 +958,7 @@ namespace tgui
             {
                 if (skippedWhitespace)
                 {
-                    if (isWhitespace(m_lines[m_selEnd.y][i-1]))
+                    if (isWhitespace(m_text[getLineStart(m_selEnd.y) + i-1]))
                     {
                         m_selEnd.x = i;
                         done = true;
@@ -983,7 +967,7 @@ namespace tgui
                 }
                 else
                 {
-                    if (!isWhitespace(m_lines[m_selEnd.y][i-1]))
+                    if (!isWhitespace(m_text[getLineStart(m_selEnd.y) + i-1]))
                         skippedWhitespace = true;
                 }
             }
@@ -995,7 +979,7 @@ namespace tgui
                     if (m_selEnd.y > 0)
                     {
                         m_selEnd.y--;
-                        m_selEnd.x = m_lines[m_selEnd.y].length();
+                        m_selEnd.x = m_lines[m_selEnd.y].length;
                     }
                 }
                 else
@@ -1018,11 +1002,11 @@ namespace tgui
         bool done = false;
         for (std::size_t j = m_selEnd.y; j < m_lines.size(); ++j)
         {
-            for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].length(); ++i)
+            for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].length; ++i)
             {
                 if (skippedWhitespace)
                 {
-                    if (isWhitespace(m_lines[m_selEnd.y][i]))
+                    if (isWhitespace(m_text[getLineStart(m_selEnd.y) + i]))
                     {
                         m_selEnd.x = i;
                         done = true;
@@ -1031,7 +1015,7 @@ namespace tgui
                 }
                 else
                 {
-                    if (!isWhitespace(m_lines[m_selEnd.y][i]))
+                    if (!isWhitespace(m_text[getLineStart(m_selEnd.y) + i]))
                         skippedWhitespace = true;
                 }
             }
@@ -1048,7 +1032,7 @@ namespace tgui
                 }
                 else
                 {
-                    m_selEnd.x = m_lines[m_selEnd.y].length();
+                    m_selEnd.x = m_lines[m_selEnd.y].length;
                     break;
                 }
             }
@@ -1096,7 +1080,7 @@ namespace tgui
                 m_selEnd.y = m_selEnd.y + visibleLines - 2;
         }
 
-        m_selEnd.x = m_lines[m_selEnd.y].length();
+        m_selEnd.x = m_lines[m_selEnd.y].length;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1111,37 +1095,7 @@ namespace tgui
         {
             const std::size_t pos = getSelectionEnd();
             if (pos > 0)
-            {
-                if (m_selEnd.x > 0)
-                {
-                    // There is a specific case that we have to watch out for. When we are removing the last character on
-                    // a line which was placed there by word wrap and a newline follows this character then the caret
-                    // has to be placed at the line above (before the newline) instead of at the same line (after the newline)
-                    if ((m_lines[m_selEnd.y].length() == 1) && (pos > 1) && (pos < m_text.length()) && (m_text[pos-2] != '\n') && (m_text[pos] == '\n') && (m_selEnd.y > 0))
-                    {
-                        m_selEnd.y--;
-                        m_selEnd.x = m_lines[m_selEnd.y].length();
-                    }
-                    else // Just remove the character normally
-                        --m_selEnd.x;
-                }
-                else // At the beginning of the line
-                {
-                    if (m_selEnd.y > 0)
-                    {
-                        --m_selEnd.y;
-                        m_selEnd.x = m_lines[m_selEnd.y].length();
-
-                        if ((m_text[pos-1] != '\n') && m_selEnd.x > 0)
-                            --m_selEnd.x;
-                    }
-                }
-
-                m_selStart = m_selEnd;
-
-                m_text.erase(pos - 1, 1);
-                rearrangeText(true);
-            }
+                replaceText(pos - 1, 1, U"");
         }
         else // When you did select some characters then delete them
             deleteSelectedCharacters();
@@ -1163,8 +1117,9 @@ namespace tgui
         // Check that we did not select any characters
         if (m_selStart == m_selEnd)
         {
-            m_text.erase(getSelectionEnd(), 1);
-            rearrangeText(true);
+            const std::size_t pos = getSelectionEnd();
+            if (pos < m_text.length())
+                replaceText(pos, 1, U"");
         }
         else // You did select some characters, so remove them
             deleteSelectedCharacters();
@@ -1209,14 +1164,10 @@ namespace tgui
         // Only continue pasting if you actually have to do something
         if ((m_selStart != m_selEnd) || (clipboardContents != ""))
         {
-            deleteSelectedCharacters();
-
-            m_text.insert(getSelectionEnd(), clipboardContents);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, clipboardContents);
-
-            m_selEnd.x += clipboardContents.length();
-            m_selStart = m_selEnd;
-            rearrangeText(true);
+            const std::size_t selStart = getSelectionStart();
+            const std::size_t selEnd = getSelectionEnd();
+            const std::size_t index = std::min(selStart, selEnd);
+            replaceText(index, std::max(selStart, selEnd) - index, clipboardContents);
 
             onTextChange.emit(this, m_text);
         }
@@ -1227,7 +1178,7 @@ namespace tgui
     void TextArea::selectAllText()
     {
         m_selStart = {0, 0};
-        m_selEnd = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
+        m_selEnd = Vector2<std::size_t>(m_lines.back().length, m_lines.size()-1);
         updateSelectionTexts();
     }
 
@@ -1235,126 +1186,160 @@ namespace tgui
 
     void TextArea::rearrangeText(bool keepSelection)
     {
-        // Don't continue when line height is 0 or when there is no font yet
-        if ((m_lineHeight == 0) || (m_fontCached == nullptr))
-            return;
+        // Store the current selection position when we are keeping the selection, otherwise the caret goes to the back of the text
+        const std::size_t selStart = keepSelection ? getSelectionStart() : m_text.length();
+        const std::size_t selEnd = keepSelection ? getSelectionEnd() : m_text.length();
 
-        String string;
-        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            string = m_text;
-        else
+        // Split the text in multiple lines, all of which have to be measured again
+        m_lines.clear();
+        m_lineWidths.clear();
+        splitLines(0, m_text.length(), m_lines);
+        m_shiftedLinesStart = m_lines.size();
+        m_shiftedLinesOffset = 0;
+
+        if ((m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && !m_monospacedFontOptimizationEnabled && (m_fontCached != nullptr))
         {
-            // Find the maximum width of one line
-            const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-            float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
-            if (m_verticalScrollbar->isShown())
-                maxLineWidth -= m_verticalScrollbar->getSize().x;
+            for (const auto& line : m_lines)
+                m_lineWidths.insert(line.width);
+        }
 
-            // Don't do anything when there is no room for the text
-            if (maxLineWidth <= 0)
-                return;
+        m_selStart = getSelectionPosOfIndex(selStart);
+        m_selEnd = getSelectionPosOfIndex(selEnd);
 
-            string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSizeCached, false);
-        }
+        updateLines();
+    }
 
-        // Store the current selection position when we are keeping the selection
-        const std::size_t selStart = keepSelection ? getSelectionStart() : 0;
-        const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Split the string in multiple lines
-        m_maxLineWidth = 0;
-        m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        std::size_t longestLineCharCount = 0;
-        std::size_t longestLineIndex = 0;
-        while (newLinePos != String::npos)
-        {
-            newLinePos = string.find('\n', searchPosStart);
+    void TextArea::replaceText(std::size_t index, std::size_t count, const String& text)
+    {
+        // Find the paragraphs in which the text is changed, the lines of other paragraphs aren't affected by the word wrap
+        std::size_t firstLine = getSelectionPosOfIndex(index).y;
+        while ((firstLine > 0) && (getLineStart(firstLine-1) + m_lines[firstLine-1].length == getLineStart(firstLine)))
+            --firstLine;
 
-            if (newLinePos != String::npos)
-                m_lines.push_back(string.substr(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substr(searchPosStart));
+        std::size_t lastLine = getSelectionPosOfIndex(index + count).y;
+        while ((lastLine + 1 < m_lines.size()) && (getLineStart(lastLine) + m_lines[lastLine].length == getLineStart(lastLine+1)))
+            ++lastLine;
+
+        // The widths of the lines can only be updated incrementally when the other lines were already measured
+        const bool lineWidthsKnown = (m_lineWidths.size() == m_lines.size());
+
+        const std::size_t changedPartStart = getLineStart(firstLine);
+        const std::size_t changedPartEnd = getLineStart(lastLine) + m_lines[lastLine].length;
+
+        m_text.replace(index, count, text);
+
+        // Split the changed paragraphs again
+        std::vector<Line> newLines;
+        splitLines(changedPartStart, changedPartEnd - count + text.length(), newLines);
 
-            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+        // All lines behind the changed part have to be moved. Instead of changing all of them, the lines between the previous
+        // edit and this one are updated so that the lines behind this edit are the ones that are still waiting to be moved.
+        if (m_shiftedLinesOffset != 0)
+        {
+            if (m_shiftedLinesStart <= lastLine)
             {
-                if (m_monospacedFontOptimizationEnabled)
-                {
-                    if (m_lines.back().length() > longestLineCharCount)
-                    {
-                        longestLineCharCount = m_lines.back().length();
-                        longestLineIndex = m_lines.size() - 1;
-                    }
-                }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
-                {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSizeCached);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
-                }
+                for (std::size_t i = m_shiftedLinesStart; i <= lastLine; ++i)
+                    m_lines[i].start += m_shiftedLinesOffset;
+            }
+            else
+            {
+                for (std::size_t i = lastLine + 1; i < m_shiftedLinesStart; ++i)
+                    m_lines[i].start -= m_shiftedLinesOffset;
             }
-
-            searchPosStart = newLinePos + 1;
         }
+        m_shiftedLinesOffset += text.length() - count;
 
-        if ((m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSizeCached);
+        // Only the widths of the lines that were split again have changed
+        if (lineWidthsKnown)
+        {
+            for (std::size_t i = firstLine; i <= lastLine; ++i)
+                m_lineWidths.erase(m_lineWidths.find(m_lines[i].width));
+            for (const auto& line : newLines)
+                m_lineWidths.insert(line.width);
+        }
 
-        // Check if we should try to keep our selection
-        if (keepSelection)
+        // Replace the lines of the changed paragraphs
+        const std::size_t oldLineCount = lastLine - firstLine + 1;
+        if (newLines.size() == oldLineCount)
+            std::copy(newLines.begin(), newLines.end(), m_lines.begin() + static_cast<std::ptrdiff_t>(firstLine));
+        else
         {
-            std::size_t index = 0;
-            Vector2<std::size_t> newSelStart;
-            Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
+            m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(firstLine), m_lines.begin() + static_cast<std::ptrdiff_t>(lastLine) + 1);
+            m_lines.insert(m_lines.begin() + static_cast<std::ptrdiff_t>(firstLine), newLines.begin(), newLines.end());
+        }
+        m_shiftedLinesStart = firstLine + newLines.size();
 
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-            {
-                index += m_lines[i].length();
+        // Place the caret behind the inserted text
+        m_selStart = getSelectionPosOfIndex(index + text.length());
+        m_selEnd = m_selStart;
 
-                if (!newSelStartFound && (index >= selStart))
-                {
-                    newSelStart = Vector2<std::size_t>(m_lines[i].length() - (index - selStart), i);
+        updateLines();
+    }
 
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
-                }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                if (!newSelEndFound && (index >= selEnd))
-                {
-                    newSelEnd = Vector2<std::size_t>(m_lines[i].length() - (index - selEnd), i);
+    void TextArea::splitLines(std::size_t start, std::size_t end, std::vector<Line>& lines) const
+    {
+        // Find the maximum width of one line when word wrap is used
+        float maxLineWidth = 0;
+        if ((m_horizontalScrollbarPolicy == Scrollbar::Policy::Never) && (m_fontCached != nullptr))
+        {
+            const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+            maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+            if (m_verticalScrollbar->isShown())
+                maxLineWidth -= m_verticalScrollbar->getSize().x;
+        }
 
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
-                }
+        // Without word wrap (or when there is no room for the text) the lines are only split on newlines
+        const bool calculateWidths = (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && !m_monospacedFontOptimizationEnabled;
+        Text::findLineBreaks(lines, std::max(0.f, maxLineWidth), m_text, m_fontCached, m_textSizeCached, false, calculateWidths, start, end);
+    }
 
-                // Skip newlines in the text
-                if (m_text[index] == U'\n')
-                    ++index;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
+    void TextArea::updateLines()
+    {
+        // Don't continue when line height is 0 or when there is no font yet
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+            return;
+
+        // Find the width of the longest line, which is only needed when there is a horizontal scrollbar
+        m_maxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+        {
+            if (m_monospacedFontOptimizationEnabled)
             {
-                m_selStart = newSelStart;
-                m_selEnd = newSelEnd;
+                m_lineWidths.clear();
+
+                std::size_t longestLineIndex = 0;
+                for (std::size_t i = 1; i < m_lines.size(); ++i)
+                {
+                    if (m_lines[i].length > m_lines[longestLineIndex].length)
+                        longestLineIndex = i;
+                }
+
+                m_maxLineWidth = Text::getLineWidth(m_text.substr(getLineStart(longestLineIndex), m_lines[longestLineIndex].length), m_fontCached, m_textSizeCached);
             }
-            else // The text has changed too much, the selection can't be kept
+            else // Not using optimization for monospaced font, so really calculate the width of every line
             {
-                m_selStart = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
-                m_selEnd = m_selStart;
+                // The lines already have their widths, unless the monospace optimization was disabled since they were split
+                if (m_lineWidths.size() != m_lines.size())
+                {
+                    m_lineWidths.clear();
+                    for (std::size_t i = 0; i < m_lines.size(); ++i)
+                    {
+                        m_lines[i].width = Text::getLineWidth(m_text.substr(getLineStart(i), m_lines[i].length), m_fontCached, m_textSizeCached);
+                        m_lineWidths.insert(m_lines[i].width);
+                    }
+                }
+
+                m_maxLineWidth = *m_lineWidths.rbegin();
             }
         }
-        else // Set the caret at the back of the text
-        {
-            m_selStart = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
-            m_selEnd = m_selStart;
-        }
+        else
+            m_lineWidths.clear();
 
         updateScrollbars();
 
@@ -1420,71 +1405,6 @@ namespace tgui
 
     void TextArea::updateSelectionTexts()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString("");
-            m_textSelection2.setString("");
-            m_textAfterSelection1.setString("");
-            m_textAfterSelection2.setString("");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionStart.y].substr(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substr(0, selectionStart.x));
-
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString("");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, m_lines[selectionStart.y].length() - selectionStart.x));
-
-                String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionEnd.y].substr(0, selectionEnd.x);
-
-                m_textSelection2.setString(string);
-            }
-
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substr(selectionEnd.x, m_lines[selectionEnd.y].length() - selectionEnd.x));
-
-                String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
-
-                m_textAfterSelection2.setString(string);
-            }
-        }
-
         // Check if the caret is located above or below the view
         if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
         {
@@ -1499,18 +1419,13 @@ namespace tgui
 
         // Position the caret
         {
-            /// TODO: Implement a way to calculate text size without creating a text object?
             const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-            Text tempText;
-            tempText.setFont(m_fontCached);
-            tempText.setCharacterSize(getTextSize());
-            tempText.setString(m_lines[m_selEnd.y].substr(0, m_selEnd.x));
 
             float kerning = 0;
-            if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].length()))
-                kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x - 1], m_lines[m_selEnd.y][m_selEnd.x], m_textSizeCached, false);
+            if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].length))
+                kerning = m_fontCached.getKerning(m_text[getLineStart(m_selEnd.y) + m_selEnd.x - 1], m_text[getLineStart(m_selEnd.y) + m_selEnd.x], m_textSizeCached, false);
 
-            m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().length()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
+            m_caretPosition = {textOffset + getLineText(m_selEnd.y).findCharacterPos(m_selEnd.x).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
         }
 
         if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
@@ -1581,106 +1496,187 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextArea::recalculatePositions()
+    {
+        // Forget which lines are in the texts, so that they get recreated for the lines that are visible
+        m_textsStartLine = 0;
+        m_textsEndLine = 0;
+
+        recalculateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::updateVisibleTexts()
     {
         if (!m_fontCached)
             return;
 
+        // Only put the visible lines in the texts, with an extra page above and below them so that scrolling doesn't
+        // require the texts to be recreated every time. One more line is included as it may be partially visible.
+        m_textsStartLine = (m_topLine > m_visibleLines) ? (m_topLine - m_visibleLines) : 0;
+        m_textsEndLine = std::min(m_topLine + 2 * m_visibleLines + 1, m_lines.size());
+
+        auto appendLines = [this](String& string, std::size_t startLine, std::size_t endLine)
+        {
+            for (std::size_t i = startLine; i < endLine; ++i)
+            {
+                string.append(m_text, getLineStart(i), m_lines[i].length);
+                string += U'\n';
+            }
+        };
+
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
 
         // Calculate the position of the text objects
         m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
+        m_textBeforeSelection.setPosition({textOffset, static_cast<float>(m_textsStartLine * m_lineHeight)});
         m_defaultText.setPosition({ textOffset, 0 });
 
-        if (m_selStart != m_selEnd)
+        // If there is no selection then just put the whole text in m_textBeforeSelection
+        if (m_selStart == m_selEnd)
         {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
+            String displayedText;
+            appendLines(displayedText, m_textsStartLine, m_textsEndLine);
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
+            m_textBeforeSelection.setString(displayedText);
+            m_textSelection1.setString("");
+            m_textSelection2.setString("");
+            m_textAfterSelection1.setString("");
+            m_textAfterSelection2.setString("");
+            return;
+        }
 
-            float kerningSelectionStart = 0;
-            if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].length()))
-                kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSizeCached, false);
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
 
-            float kerningSelectionEnd = 0;
-            if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].length()))
-                kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSizeCached, false);
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
 
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().length()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+        const bool selectionStartVisible = (selectionStart.y >= m_textsStartLine) && (selectionStart.y < m_textsEndLine);
+        const bool selectionEndVisible = (selectionEnd.y >= m_textsStartLine) && (selectionEnd.y < m_textsEndLine);
+        const std::size_t selection2StartLine = std::max(selectionStart.y + 1, m_textsStartLine);
+        const std::size_t afterSelection2StartLine = std::max(selectionEnd.y + 1, m_textsStartLine);
 
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
+        // Set the text before the selection
+        {
+            String string;
+            appendLines(string, m_textsStartLine, std::min(selectionStart.y, m_textsEndLine));
+            if (selectionStartVisible)
+                string.append(m_text, getLineStart(selectionStart.y), selectionStart.x);
 
-            if (!m_textSelection2.getString().empty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
+            m_textBeforeSelection.setString(string);
+        }
 
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
+        // Set the selected text
+        if (!selectionStartVisible)
+            m_textSelection1.setString("");
+        else if (m_selStart.y == m_selEnd.y)
+            m_textSelection1.setString(m_text.substr(getLineStart(selectionStart.y) + selectionStart.x, selectionEnd.x - selectionStart.x));
+        else
+            m_textSelection1.setString(m_text.substr(getLineStart(selectionStart.y) + selectionStart.x, m_lines[selectionStart.y].length - selectionStart.x));
 
-            // Recalculate the selection rectangles
-            {
-                m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
+        if (m_selStart.y != m_selEnd.y)
+        {
+            String string;
+            appendLines(string, selection2StartLine, std::min(selectionEnd.y, m_textsEndLine));
+            if (selectionEndVisible)
+                string.append(m_text, getLineStart(selectionEnd.y), selectionEnd.x);
 
-                if (!m_lines[selectionStart.y].empty())
-                {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x;
+            m_textSelection2.setString(string);
+        }
+        else
+            m_textSelection2.setString("");
 
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
+        // Set the text after the selection
+        if (selectionEndVisible)
+            m_textAfterSelection1.setString(m_text.substr(getLineStart(selectionEnd.y) + selectionEnd.x, m_lines[selectionEnd.y].length - selectionEnd.x));
+        else
+            m_textAfterSelection1.setString("");
 
-                /// TODO: Implement a way to calculate text size without creating a text object?
-                Text tempText;
-                tempText.setFont(m_fontCached);
-                tempText.setCharacterSize(getTextSize());
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+        {
+            String string;
+            appendLines(string, afterSelection2StartLine, m_textsEndLine);
+            m_textAfterSelection2.setString(string);
+        }
 
-                    if (!m_lines[i].empty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().length()).x;
-                    }
-                }
+        float kerningSelectionStart = 0;
+        if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].length))
+            kerningSelectionStart = m_fontCached.getKerning(m_text[getLineStart(selectionStart.y) + selectionStart.x-1], m_text[getLineStart(selectionStart.y) + selectionStart.x], m_textSizeCached, false);
 
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
+        float kerningSelectionEnd = 0;
+        if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].length))
+            kerningSelectionEnd = m_fontCached.getKerning(m_text[getLineStart(selectionEnd.y) + selectionEnd.x-1], m_text[getLineStart(selectionEnd.y) + selectionEnd.x], m_textSizeCached, false);
 
-                    if (m_textSelection2.getString() != U"")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substr(0, selectionEnd.x));
-                        m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
-                                                    textOffset + tempText.findCharacterPos(tempText.getString().length()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
-                    }
-                    else
-                        m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-                }
+        if (selectionStart.x > 0)
+        {
+            m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().length()).x + kerningSelectionStart,
+                                          static_cast<float>(selectionStart.y * m_lineHeight)});
+        }
+        else
+            m_textSelection1.setPosition({textOffset, static_cast<float>(selectionStart.y * m_lineHeight)});
+
+        m_textSelection2.setPosition({textOffset, static_cast<float>(selection2StartLine * m_lineHeight)});
+
+        if (selectionStart.y != selectionEnd.y)
+        {
+            m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().length()).x + kerningSelectionEnd,
+                                               static_cast<float>(selectionEnd.y * m_lineHeight)});
+        }
+        else
+            m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x + kerningSelectionEnd,
+                                               m_textSelection1.getPosition().y});
+
+        m_textAfterSelection2.setPosition({textOffset, static_cast<float>(afterSelection2StartLine * m_lineHeight)});
+
+        // Recalculate the selection rectangles of the lines in the texts
+        if (selectionStartVisible)
+        {
+            m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
+
+            if (m_lines[selectionStart.y].length > 0)
+            {
+                m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x;
+
+                // There is kerning when the selection is on just this line
+                if (selectionStart.y == selectionEnd.y)
+                    m_selectionRects.back().width += kerningSelectionEnd;
             }
+
+            if (selectionStart.y != selectionEnd.y)
+                m_selectionRects.back().width += textOffset;
         }
 
-        recalculateVisibleLines();
+        /// TODO: Implement a way to calculate text size without creating a text object?
+        Text tempText;
+        tempText.setFont(m_fontCached);
+        tempText.setCharacterSize(getTextSize());
+        for (std::size_t i = selection2StartLine; i < std::min(selectionEnd.y, m_textsEndLine); ++i)
+        {
+            m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+
+            if (m_lines[i].length > 0)
+            {
+                tempText.setString(m_text.substr(getLineStart(i), m_lines[i].length));
+                m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().length()).x;
+            }
+
+            m_selectionRects.back().width += textOffset;
+        }
+
+        if ((selectionStart.y != selectionEnd.y) && selectionEndVisible)
+        {
+            tempText.setString(m_text.substr(getLineStart(selectionEnd.y), selectionEnd.x));
+            m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
+                                        textOffset + tempText.findCharacterPos(tempText.getString().length()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextArea::recalculateVisibleLines()
     {
+        invalidateDrawCache();
+
         if (m_lineHeight == 0)
             return;
 
@@ -1709,6 +1705,10 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), m_lines.size());
         }
+
+        // Recreate the texts when lines become visible that aren't part of them yet
+        if ((m_topLine < m_textsStartLine) || (std::min(m_topLine + m_visibleLines + 1, m_lines.size()) > m_textsEndLine))
+            updateVisibleTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -622,6 +622,8 @@ namespace tgui
 
     void TreeView::setVerticalScrollbarValue(unsigned int value)
     {
+        invalidateDrawCache();
+
         m_verticalScrollbar->setValue(value);
     }
 
@@ -636,6 +638,8 @@ namespace tgui
 
     void TreeView::setHorizontalScrollbarValue(unsigned int value)
     {
+        invalidateDrawCache();
+
         m_horizontalScrollbar->setValue(value);
     }
 
@@ -1208,6 +1212,8 @@ namespace tgui
 
     void TreeView::markNodesDirty()
     {
+        invalidateDrawCache();
+
         Node* selectedNode = nullptr;
         if (m_selectedItem >= 0 && static_cast<std::size_t>(m_selectedItem) < m_visibleNodes.size())
             selectedNode = m_visibleNodes[m_selectedItem].get();
@@ -1508,6 +1514,8 @@ namespace tgui
 
     void TreeView::updateSelectedAndHoveringItemColors()
     {
+        invalidateDrawCache();
+
         if (m_selectedItem >= 0)
         {
             if ((m_selectedItem == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
@@ -0,0 +1,140 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+
+#if TGUI_HAS_RENDERER_BACKEND_SDL_RENDERER
+#include <TGUI/Backend/Renderer/SDL_Renderer/BackendRendererSDL.hpp>
+#include <TGUI/Widgets/Group.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Widgets/SeparatorLine.hpp>
+
+TEST_CASE("[BackendRenderTargetSDL]")
+{
+    // The render target can only be used when the tests are being run with an SDL_Renderer
+    const auto renderer = std::dynamic_pointer_cast<tgui::BackendRendererSDL>(tgui::getBackend()->getRenderer());
+    if (renderer)
+    {
+        // Gives access to the scratch buffers that are used to build the batches
+        struct TestRenderTarget : public tgui::BackendRenderTargetSDL
+        {
+            using tgui::BackendRenderTargetSDL::BackendRenderTargetSDL;
+
+            std::size_t getVertexCapacity() const
+            {
+                return m_batchVertices.capacity();
+            }
+
+            std::size_t getIndexCapacity() const
+            {
+                return m_batchIndices.capacity();
+            }
+        };
+
+        TestRenderTarget target(renderer->getInternalRenderer());
+        target.setView({0, 0, 100, 50}, {0, 0, 100, 50}, {100, 50});
+
+        auto root = std::make_shared<tgui::RootContainer>();
+        root->setSize({100, 50});
+
+        // Separator lines are drawn as a single untextured rectangle, without any clipping
+        const auto addLine = [](const tgui::Container::Ptr& parent, tgui::Vector2f pos){
+            auto line = tgui::SeparatorLine::create({10, 2});
+            line->setPosition(pos);
+            parent->add(line);
+        };
+
+        SECTION("Merge draw calls with the same texture and clipping")
+        {
+            addLine(root, {0, 0});
+            addLine(root, {0, 10});
+            addLine(root, {0, 20});
+
+            target.drawGui(root);
+            REQUIRE(target.getBatchStatistics().batchedCalls == 3);
+            REQUIRE(target.getBatchStatistics().flushes == 1);
+            REQUIRE(target.getBatchStatistics().vertices == 3 * 4);
+            REQUIRE(target.getBatchStatistics().indices == 3 * 6);
+
+            // The statistics only describe the last frame
+            target.drawGui(root);
+            REQUIRE(target.getBatchStatistics().batchedCalls == 3);
+            REQUIRE(target.getBatchStatistics().flushes == 1);
+        }
+
+        SECTION("Split batch when texture changes")
+        {
+            addLine(root, {0, 0});
+
+            auto picture = tgui::Picture::create("resources/image.png");
+            picture->setSize({20, 20});
+            picture->setPosition({20, 0});
+            root->add(picture);
+
+            addLine(root, {0, 30});
+
+            target.drawGui(root);
+            REQUIRE(target.getBatchStatistics().batchedCalls == 3);
+            REQUIRE(target.getBatchStatistics().flushes == 3);
+        }
+
+        SECTION("Split batch when clipping changes")
+        {
+            addLine(root, {0, 0});
+
+            auto group = tgui::Group::create({30, 30});
+            group->setPosition({50, 10});
+            root->add(group);
+            addLine(group, {0, 0});
+            addLine(group, {0, 10});
+
+            addLine(root, {0, 30});
+
+            target.drawGui(root);
+            REQUIRE(target.getBatchStatistics().batchedCalls == 4);
+            REQUIRE(target.getBatchStatistics().flushes == 3);
+        }
+
+        SECTION("Scratch buffers are reused")
+        {
+            addLine(root, {0, 0});
+            addLine(root, {0, 10});
+            addLine(root, {0, 20});
+
+            target.drawGui(root);
+            const std::size_t vertexCapacity = target.getVertexCapacity();
+            const std::size_t indexCapacity = target.getIndexCapacity();
+            REQUIRE(vertexCapacity >= 3 * 4);
+            REQUIRE(indexCapacity >= 3 * 6);
+
+            // Drawing the same frame again doesn't need to allocate any memory
+            target.drawGui(root);
+            REQUIRE(target.getVertexCapacity() == vertexCapacity);
+            REQUIRE(target.getIndexCapacity() == indexCapacity);
+        }
+    }
+}
+#endif
@@ -0,0 +1,169 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+
+#if TGUI_HAS_RENDERER_BACKEND_SOFTWARE
+#include <TGUI/Backend/Renderer/Software/BackendRenderTargetSoftware.hpp>
+
+namespace
+{
+    tgui::Color getPixel(const tgui::BackendRenderTargetSoftware& target, unsigned int x, unsigned int y)
+    {
+        const std::uint8_t* pixel = target.getPixels() + (y * target.getSize().x + x) * 4;
+        return {pixel[0], pixel[1], pixel[2], pixel[3]};
+    }
+}
+
+TEST_CASE("[BackendRenderTargetSoftware]")
+{
+    tgui::BackendRenderTargetSoftware target;
+    REQUIRE(target.getPixels() == nullptr);
+
+    target.setView({0, 0, 40, 30}, {0, 0, 40, 30}, {40, 30});
+    REQUIRE(target.getSize() == tgui::Vector2u{40, 30});
+    REQUIRE(target.getPixels() != nullptr);
+
+    target.setClearColor(tgui::Color::Blue);
+    target.clearScreen();
+    REQUIRE(getPixel(target, 0, 0) == tgui::Color::Blue);
+    REQUIRE(getPixel(target, 39, 29) == tgui::Color::Blue);
+
+    auto root = std::make_shared<tgui::RootContainer>();
+    root->setSize({40, 30});
+
+    SECTION("Opaque rectangle")
+    {
+        auto panel = tgui::Panel::create({10, 5});
+        panel->setPosition({5, 10});
+        panel->getRenderer()->setBackgroundColor(tgui::Color::Red);
+        root->add(panel);
+
+        target.drawGui(root);
+        REQUIRE(getPixel(target, 5, 10) == tgui::Color::Red);
+        REQUIRE(getPixel(target, 14, 14) == tgui::Color::Red);
+        REQUIRE(getPixel(target, 4, 10) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 15, 14) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 14, 15) == tgui::Color::Blue);
+    }
+
+    SECTION("Blending")
+    {
+        // The diagonal of the rectangle may not be drawn twice
+        auto panel = tgui::Panel::create({40, 30});
+        panel->getRenderer()->setBackgroundColor({255, 0, 0, 128});
+        root->add(panel);
+
+        target.drawGui(root);
+        for (unsigned int i = 0; i < 30; ++i)
+        {
+            REQUIRE(getPixel(target, i, i) == tgui::Color{128, 0, 127});
+            REQUIRE(getPixel(target, i + 10, i) == tgui::Color{128, 0, 127});
+        }
+    }
+
+    SECTION("Clipping")
+    {
+        auto panel = tgui::Panel::create({10, 10});
+        panel->setPosition({10, 10});
+        panel->getRenderer()->setBackgroundColor(tgui::Color::Transparent);
+        root->add(panel);
+
+        auto child = tgui::Panel::create({30, 30});
+        child->setPosition({-5, -5});
+        child->getRenderer()->setBackgroundColor(tgui::Color::Green);
+        panel->add(child);
+
+        target.drawGui(root);
+        REQUIRE(getPixel(target, 10, 10) == tgui::Color::Green);
+        REQUIRE(getPixel(target, 19, 19) == tgui::Color::Green);
+        REQUIRE(getPixel(target, 9, 10) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 20, 19) == tgui::Color::Blue);
+    }
+
+    SECTION("Viewport")
+    {
+        auto panel = tgui::Panel::create({20, 20});
+        panel->getRenderer()->setBackgroundColor(tgui::Color::Red);
+        root->add(panel);
+
+        target.setView({0, 0, 20, 20}, {20, 10, 10, 10}, {40, 30});
+        target.drawGui(root);
+        REQUIRE(getPixel(target, 20, 10) == tgui::Color::Red);
+        REQUIRE(getPixel(target, 29, 19) == tgui::Color::Red);
+        REQUIRE(getPixel(target, 19, 10) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 30, 10) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 20, 20) == tgui::Color::Blue);
+    }
+
+    SECTION("Render cached container")
+    {
+        auto panel = tgui::Panel::create({20, 10});
+        panel->setPosition({5, 5});
+        panel->getRenderer()->setBackgroundColor({255, 0, 0, 128});
+        root->add(panel);
+
+        auto child = tgui::Panel::create({30, 30});
+        child->setPosition({15, 5});
+        child->getRenderer()->setBackgroundColor(tgui::Color::Green);
+        panel->add(child);
+
+        REQUIRE(!panel->isRenderCached());
+        panel->setRenderCached(true);
+        REQUIRE(panel->isRenderCached());
+
+        // The result has to be the same as when drawing the container directly
+        target.drawGui(root);
+        REQUIRE(getPixel(target, 5, 5) == tgui::Color{128, 0, 127});
+        REQUIRE(getPixel(target, 14, 9) == tgui::Color{128, 0, 127});
+        REQUIRE(getPixel(target, 20, 10) == tgui::Color::Green);
+        REQUIRE(getPixel(target, 24, 14) == tgui::Color::Green);
+        REQUIRE(getPixel(target, 25, 14) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 24, 15) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 4, 5) == tgui::Color::Blue);
+
+        // Changing a child has to update the cached texture
+        child->getRenderer()->setBackgroundColor(tgui::Color::Yellow);
+        target.clearScreen();
+        target.drawGui(root);
+        REQUIRE(getPixel(target, 20, 10) == tgui::Color::Yellow);
+        REQUIRE(getPixel(target, 5, 5) == tgui::Color{128, 0, 127});
+
+        // Moving the container reuses the cached texture
+        panel->setPosition({10, 10});
+        target.clearScreen();
+        target.drawGui(root);
+        REQUIRE(getPixel(target, 10, 10) == tgui::Color{128, 0, 127});
+        REQUIRE(getPixel(target, 25, 15) == tgui::Color::Yellow);
+        REQUIRE(getPixel(target, 9, 10) == tgui::Color::Blue);
+
+        panel->setRenderCached(false);
+        target.clearScreen();
+        target.drawGui(root);
+        REQUIRE(getPixel(target, 25, 15) == tgui::Color::Yellow);
+        REQUIRE(getPixel(target, 10, 10) == tgui::Color{128, 0, 127});
+    }
+}
+#endif
@@ -25,6 +25,12 @@
 #include "Tests.hpp"
 #include <TGUI/Font.hpp>
 
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+    #include <TGUI/Backend/Font/FreeType/BackendFontFreeType.hpp>
+    #include <TGUI/Backend/Renderer/BackendText.hpp>
+    #include <thread>
+#endif
+
 TEST_CASE("[Font]")
 {
     REQUIRE(tgui::Font() == nullptr);
@@ -32,4 +38,366 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf") != nullptr);
 
     REQUIRE_THROWS_AS(tgui::Font("NonExistentFile.ttf"), tgui::Exception);
+
+    SECTION("Font cache")
+    {
+        tgui::Font::clearFontCache();
+        {
+            tgui::Font font1("resources/DejaVuSans.ttf");
+            tgui::Font font2("resources/DejaVuSans.ttf");
+            REQUIRE(font1 == font2);
+            REQUIRE(font1.getBackendFont() == font2.getBackendFont());
+
+            const tgui::Font defaultFont1 = tgui::getBackend()->createDefaultFont();
+            const tgui::Font defaultFont2 = tgui::getBackend()->createDefaultFont();
+            REQUIRE(defaultFont1 == defaultFont2);
+            REQUIRE(defaultFont1 != font1);
+
+            REQUIRE(tgui::Font::getCachedFontsCount() == 2);
+            REQUIRE(tgui::Font::purgeUnusedFonts() == 0);
+        }
+
+        // The fonts are kept in the cache until they are purged
+        REQUIRE(tgui::Font::getCachedFontsCount() == 2);
+        REQUIRE(tgui::Font::purgeUnusedFonts() == 2);
+        REQUIRE(tgui::Font::getCachedFontsCount() == 0);
+    }
+
+    SECTION("Changing a cached font")
+    {
+        tgui::Font font1("resources/DejaVuSans.ttf");
+        tgui::Font font2("resources/DejaVuSans.ttf");
+        const tgui::Font copy1 = font1;
+        REQUIRE(font1.getBackendFont() == font2.getBackendFont());
+
+        // A font gets its own backend font when one of its settings changes, other fonts loaded from the file keep theirs
+        font1.setSmooth(false);
+        REQUIRE(!font1.isSmooth());
+        REQUIRE(font2.isSmooth());
+        REQUIRE(copy1.isSmooth());
+        REQUIRE(font1.getBackendFont() != font2.getBackendFont());
+        REQUIRE(copy1.getBackendFont() == font2.getBackendFont());
+
+        // The font only detaches once
+        const auto backendFont = font1.getBackendFont();
+        font1.setSmooth(true);
+        REQUIRE(font1.getBackendFont() == backendFont);
+        REQUIRE(font1.detachBackendFont() == backendFont);
+
+        // Loading the font again still uses the shared backend font
+        REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getBackendFont() == font2.getBackendFont());
+        REQUIRE(font1.getGlyph(U'a', 20, false).advance == font2.getGlyph(U'a', 20, false).advance);
+    }
+
+    SECTION("Fonts from memory")
+    {
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory("resources/DejaVuSans.ttf", fileSize);
+        REQUIRE(fileContents);
+
+        const tgui::Font font1(fileContents.get(), fileSize);
+        const tgui::Font font2(fileContents.get(), fileSize);
+        REQUIRE(font1.getBackendFont() == font2.getBackendFont());
+
+        // The data is copied, so it doesn't have to remain valid after the font was loaded
+        std::vector<std::uint8_t> dataCopy(fileContents.get(), fileContents.get() + fileSize);
+        const tgui::Font font3(dataCopy.data(), dataCopy.size());
+        dataCopy.assign(dataCopy.size(), 0);
+        REQUIRE(font3.getBackendFont() == font1.getBackendFont());
+        REQUIRE(font3.getGlyph(U'a', 20, false).advance > 0);
+    }
+}
+
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+TEST_CASE("[BackendFontFreetype]")
+{
+    tgui::BackendFontFreetype font;
+    REQUIRE(font.loadFromFile("resources/DejaVuSans.ttf"));
+
+    SECTION("Texture uploads")
+    {
+        REQUIRE(font.getUploadedTextureBytes() == 0);
+
+        font.getGlyph(U'a', 20, false);
+        const auto texture = font.getTexture(20);
+        REQUIRE(texture->isAlphaTexture());
+        const std::size_t fullTextureBytes = std::size_t{texture->getSize().x} * texture->getSize().y; // 1 byte per pixel
+        REQUIRE(font.getUploadedTextureBytes() == fullTextureBytes);
+
+        // Nothing is uploaded when the texture didn't change
+        REQUIRE(font.getTexture(20) == texture);
+        REQUIRE(font.getUploadedTextureBytes() == fullTextureBytes);
+
+        // Only the rows containing a new glyph are uploaded, the texture itself is kept
+        font.getGlyph(U'b', 20, false);
+        REQUIRE(font.getTexture(20) == texture);
+        REQUIRE(font.getUploadedTextureBytes() > fullTextureBytes);
+        REQUIRE(font.getUploadedTextureBytes() < 2 * fullTextureBytes);
+    }
+
+    SECTION("Paged atlas")
+    {
+        REQUIRE(font.getAtlasStatistics().pages == 0);
+        REQUIRE(font.getGlyphGeneration(20) == 0);
+
+        // Every character size gets its own page
+        font.getGlyph(U'a', 20, false);
+        font.getGlyph(U'a', 30, false);
+        REQUIRE(font.getAtlasStatistics().pages == 2);
+        REQUIRE(font.getTexture(20) != font.getTexture(30));
+        REQUIRE(font.getGlyphGeneration(20) != 0);
+        REQUIRE(font.getGlyphGeneration(20) != font.getGlyphGeneration(30));
+
+        SECTION("Glyph eviction")
+        {
+            // There is only enough memory for a single extra sheet
+            font.setMaximumPageSize(128);
+            font.setMemoryBudget(font.getAtlasStatistics().bytesInUse + (128 * 128));
+            const tgui::FontGlyph glyphA = font.getGlyph(U'a', 30, false);
+            const std::uint64_t generation = font.getGlyphGeneration(30);
+            for (char32_t c = U'A'; c <= U'Z'; ++c)
+            {
+                font.getGlyph(c, 30, false);
+                font.getGlyph(static_cast<char32_t>(c - U'A' + U'a'), 30, false);
+
+                // The text containing 'a' and the page of size 20 are drawn every frame
+                font.markSheetsDrawn(30, std::uint64_t(1) << glyphA.sheet);
+                font.markSheetsDrawn(20, 1);
+            }
+
+            // The glyphs from the sheet that wasn't drawn for the longest time were removed
+            REQUIRE(font.getTexture(30)->getSize() == tgui::Vector2u{128, 256});
+            REQUIRE(font.getAtlasStatistics().pages == 2);
+            REQUIRE(font.getAtlasStatistics().sheets == 3);
+            REQUIRE(font.getAtlasStatistics().evictedGlyphs > 0);
+            REQUIRE(font.getAtlasStatistics().evictedPages == 0);
+            REQUIRE(font.getGlyphGeneration(30) != generation);
+
+            // The glyph that is drawn every frame is still at the same place
+            REQUIRE(font.getGlyph(U'a', 30, false).textureRect == glyphA.textureRect);
+        }
+
+        SECTION("Page eviction")
+        {
+            font.getTexture(30); // The page with size 20 is now the least recently used one
+            font.setMemoryBudget(font.getAtlasStatistics().bytesInUse);
+            font.getGlyph(U'a', 40, false);
+
+            const auto statistics = font.getAtlasStatistics();
+            REQUIRE(statistics.pages == 2);
+            REQUIRE(statistics.evictedPages == 1);
+            REQUIRE(statistics.bytesInUse <= font.getMemoryBudget());
+            REQUIRE(font.getGlyphGeneration(20) == 0);
+            REQUIRE(font.getGlyphGeneration(30) != 0);
+        }
+    }
+
+    SECTION("Sheets")
+    {
+        auto sharedFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(sharedFont->loadFromFile("resources/DejaVuSans.ttf"));
+        sharedFont->setMaximumPageSize(256);
+
+        // Regular and bold ASCII and Latin-1 characters don't fit in a single page of the maximum size
+        tgui::String str;
+        for (char32_t c = U' '; c <= U'~'; ++c)
+            str += c;
+        for (char32_t c = 0xA1; c <= 0xFF; ++c)
+            str += c;
+
+        tgui::BackendText regularText;
+        tgui::BackendText boldText;
+        for (tgui::BackendText* text : {&regularText, &boldText})
+        {
+            text->setFont(sharedFont);
+            text->setCharacterSize(40);
+            text->setString(str);
+        }
+        boldText.setStyle(tgui::TextStyle::Bold);
+
+        const auto regularVertices = regularText.getVertexData();
+        const auto boldVertices = boldText.getVertexData();
+        REQUIRE(regularVertices.size() == 1);
+        REQUIRE(boldVertices.size() == 1);
+
+        // Sheets are added to the page instead of evicting glyphs that are still needed
+        const auto statistics = sharedFont->getAtlasStatistics();
+        REQUIRE(statistics.pages == 1);
+        REQUIRE(statistics.sheets > 1);
+        REQUIRE(statistics.evictedGlyphs == 0);
+
+        const auto texture = sharedFont->getTexture(40);
+        REQUIRE(texture->getSize() == tgui::Vector2u{256, static_cast<unsigned int>(256 * statistics.sheets)});
+        REQUIRE(boldVertices[0].first == texture);
+
+        // Drawing the texts again doesn't change or upload anything
+        const std::size_t uploadedBytes = sharedFont->getUploadedTextureBytes();
+        const std::uint64_t generation = sharedFont->getGlyphGeneration(40);
+        REQUIRE(regularText.getVertexData()[0].first == texture);
+        REQUIRE(boldText.getVertexData()[0].second == boldVertices[0].second);
+        REQUIRE(sharedFont->getTexture(40) == texture);
+        REQUIRE(sharedFont->getUploadedTextureBytes() == uploadedBytes);
+        REQUIRE(sharedFont->getGlyphGeneration(40) == generation);
+        REQUIRE(sharedFont->getAtlasStatistics().evictedGlyphs == 0);
+    }
+
+    SECTION("Advances")
+    {
+        const std::u32string str = U"AVA To\tWa\r\nfi \u0416\u0436";
+        std::vector<float> advances(str.length());
+        std::vector<float> kernings(str.length());
+        font.getAdvances(str.data(), str.length(), 20, true, advances.data(), kernings.data());
+
+        // The results are identical to requesting the glyphs and kerning one by one
+        char32_t prevChar = 0;
+        for (std::size_t i = 0; i < str.length(); ++i)
+        {
+            if (str[i] == U'\r')
+            {
+                REQUIRE(advances[i] == 0);
+                REQUIRE(kernings[i] == 0);
+                continue;
+            }
+
+            REQUIRE(kernings[i] == font.getKerning(prevChar, str[i], 20, true));
+            if (str[i] == U'\n')
+                REQUIRE(advances[i] == 0);
+            else if (str[i] == U'\t')
+                REQUIRE(advances[i] == 4 * font.getGlyph(U' ', 20, true).advance);
+            else
+                REQUIRE(advances[i] == font.getGlyph(str[i], 20, true).advance);
+
+            prevChar = str[i];
+        }
+
+        // Kerning is applied to pairs such as "AV"
+        REQUIRE(kernings[1] < 0);
+    }
+
+    SECTION("Preloading glyphs")
+    {
+        tgui::BackendFontFreetype otherFont;
+        REQUIRE(otherFont.loadFromFile("resources/DejaVuSans.ttf"));
+
+        font.preloadGlyphs({{U' ', U'~'}}, {20, 30});
+        REQUIRE(font.getAtlasStatistics().pages == 2);
+
+        // The preloaded glyphs are identical to glyphs that are loaded one by one, and no new glyphs have to be uploaded
+        font.getTexture(20);
+        const std::size_t uploadedBytes = font.getUploadedTextureBytes();
+        for (char32_t c = U' '; c <= U'~'; ++c)
+        {
+            const tgui::FontGlyph glyph = font.getGlyph(c, 20, false);
+            const tgui::FontGlyph expectedGlyph = otherFont.getGlyph(c, 20, false);
+            REQUIRE(glyph.advance == expectedGlyph.advance);
+            REQUIRE(glyph.bounds == expectedGlyph.bounds);
+            REQUIRE(glyph.textureRect.getSize() == expectedGlyph.textureRect.getSize());
+        }
+        REQUIRE(font.getTexture(20));
+        REQUIRE(font.getUploadedTextureBytes() == uploadedBytes);
+
+        // Glyphs can be requested while other glyphs are being preloaded on another thread
+        std::thread thread([&font]{ font.preloadGlyphs({{0x400, 0x4FF}}, {24}, true); });
+        for (char32_t c = U'a'; c <= U'z'; ++c)
+            REQUIRE(font.getGlyph(c, 24, true).advance == otherFont.getGlyph(c, 24, true).advance);
+        thread.join();
+        REQUIRE(font.getGlyph(0x416, 24, true).bounds == otherFont.getGlyph(0x416, 24, true).bounds);
+    }
+
+    SECTION("Distance fields")
+    {
+        tgui::BackendFontFreetype otherFont;
+        REQUIRE(otherFont.loadFromFile("resources/DejaVuSans.ttf"));
+
+        REQUIRE(!font.isDistanceFieldEnabled());
+        font.getGlyph(U'A', 20, false);
+        font.setDistanceFieldEnabled(true);
+        REQUIRE(font.isDistanceFieldEnabled());
+        REQUIRE(font.getAtlasStatistics().pages == 0);
+
+        // All character sizes share the same glyphs and texture
+        for (unsigned int characterSize : {10, 20, 48, 100})
+        {
+            for (char32_t c = U'a'; c <= U'z'; ++c)
+            {
+                const tgui::FontGlyph glyph = font.getGlyph(c, characterSize, false);
+                const tgui::FontGlyph expectedGlyph = otherFont.getGlyph(c, characterSize, false);
+                REQUIRE(glyph.advance == expectedGlyph.advance);
+                REQUIRE(glyph.textureScale == Approx(48.f / characterSize));
+                REQUIRE(glyph.bounds.width == Approx(expectedGlyph.bounds.width).epsilon(0.05).margin(2));
+                REQUIRE(glyph.bounds.height == Approx(expectedGlyph.bounds.height).epsilon(0.05).margin(2));
+            }
+        }
+        REQUIRE(font.getAtlasStatistics().pages == 1);
+        REQUIRE(font.getAtlasStatistics().glyphs == 26);
+        REQUIRE(font.getTexture(10) == font.getTexture(100));
+        REQUIRE(font.getTexture(10)->isDistanceField());
+        REQUIRE(font.getGlyphGeneration(10) == font.getGlyphGeneration(100));
+
+        // Very small sizes are still rasterized separately
+        REQUIRE(font.getGlyph(U'a', 6, false).textureScale == 1);
+        REQUIRE(!font.getTexture(6)->isDistanceField());
+        REQUIRE(font.getAtlasStatistics().pages == 2);
+
+        font.setDistanceFieldEnabled(false);
+        REQUIRE(font.getAtlasStatistics().pages == 0);
+        REQUIRE(font.getGlyph(U'a', 20, false).bounds == otherFont.getGlyph(U'a', 20, false).bounds);
+    }
+
+    SECTION("Fallback fonts")
+    {
+        auto fallbackFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(fallbackFont->loadFromFile("resources/DejaVuSans.ttf"));
+
+        font.getGlyph(U'a', 20, false);
+        REQUIRE(font.getAtlasStatistics().pages == 1);
+
+        // Changing the fallback fonts removes the glyphs that were already loaded
+        font.setFallbackFonts({fallbackFont, nullptr});
+        REQUIRE(font.getAtlasStatistics().pages == 0);
+
+        // Characters that exist in none of the fonts are still missing
+        REQUIRE(font.hasGlyph(U'a'));
+        REQUIRE(font.hasGlyph(U'\u0416'));
+        REQUIRE(!font.hasGlyph(U'\u4E2D'));
+
+        // Glyphs from all fonts are placed in the same page
+        REQUIRE(font.getGlyph(U'\u0416', 20, false).bounds == fallbackFont->getGlyph(U'\u0416', 20, false).bounds);
+        REQUIRE(font.getGlyph(U'a', 20, false).advance == fallbackFont->getGlyph(U'a', 20, false).advance);
+        font.getGlyph(U'\u4E2D', 20, false);
+        REQUIRE(font.getAtlasStatistics().pages == 1);
+        REQUIRE(font.getAtlasStatistics().glyphs >= 3);
+    }
+
+    SECTION("Prebaked default font")
+    {
+        // The font of the tests is the default font, so all prebaked glyphs are placed in the page of a prebaked size
+        REQUIRE(font.getAtlasStatistics().glyphs == 0);
+        font.getGlyph(U'a', 13, false);
+        REQUIRE(font.getAtlasStatistics().pages == 1);
+        REQUIRE(font.getAtlasStatistics().glyphs > 95);
+
+        tgui::BackendFontFreetype::setPrebakedDefaultFontEnabled(false);
+        tgui::BackendFontFreetype otherFont;
+        REQUIRE(otherFont.loadFromFile("resources/DejaVuSans.ttf"));
+        tgui::BackendFontFreetype::setPrebakedDefaultFontEnabled(true);
+
+        // The glyphs were baked with a FreeType version that might hint them slightly differently than the one used here
+        REQUIRE(font.getLineSpacing(13) == Approx(otherFont.getLineSpacing(13)).margin(1));
+        for (const char32_t c : std::u32string{U"aAzZ09~ \u00e9\u00ff"})
+        {
+            const tgui::FontGlyph glyph = font.getGlyph(c, 13, false);
+            const tgui::FontGlyph expectedGlyph = otherFont.getGlyph(c, 13, false);
+            REQUIRE(glyph.advance == Approx(expectedGlyph.advance).margin(1));
+            REQUIRE(glyph.bounds.width == Approx(expectedGlyph.bounds.width).margin(1));
+            REQUIRE(glyph.bounds.height == Approx(expectedGlyph.bounds.height).margin(1));
+            REQUIRE(font.getKerning(U'A', c, 13, false) == Approx(otherFont.getKerning(U'A', c, 13, false)).margin(1));
+        }
+
+        // Sizes and styles that weren't prebaked are still loaded with FreeType
+        REQUIRE(font.getGlyph(U'a', 15, false).bounds == otherFont.getGlyph(U'a', 15, false).bounds);
+        REQUIRE(font.getGlyph(U'a', 13, true).bounds == otherFont.getGlyph(U'a', 13, true).bounds);
+        REQUIRE(font.getAtlasStatistics().pages == 2);
+    }
 }
+#endif
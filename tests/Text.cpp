@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Text.hpp>
+#include <TGUI/Backend/Renderer/BackendText.hpp>
 
 TEST_CASE("[Text]")
 {
@@ -139,4 +140,124 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("Glyph run cache")
+    {
+        tgui::Font font("resources/DejaVuSans.ttf");
+        tgui::BackendText::clearGlyphRunCache();
+
+        text.setFont(font);
+        text.setString("OK");
+        tgui::Text text2;
+        text2.setFont(font);
+        text2.setString("OK");
+
+        // Texts with the same properties share their vertices
+        const auto vertexData = text.getBackendText()->getVertexData();
+        REQUIRE(vertexData.size() == 1);
+        REQUIRE(text2.getBackendText()->getVertexData()[0].second == vertexData[0].second);
+        REQUIRE(text2.getSize() == text.getSize());
+
+        auto statistics = tgui::BackendText::getGlyphRunCacheStatistics();
+        REQUIRE(statistics.entries == 1);
+        REQUIRE(statistics.hits == 1);
+        REQUIRE(statistics.misses == 1);
+
+        // Changing the color of one text doesn't affect the other
+        const std::uint8_t red = (*vertexData[0].second)[0].color.red;
+        text2.setColor(tgui::Color::Red);
+        REQUIRE(text2.getBackendText()->getVertexData()[0].second != vertexData[0].second);
+        REQUIRE((*text2.getBackendText()->getVertexData()[0].second)[0].color.red == 255);
+        REQUIRE((*vertexData[0].second)[0].color.red == red);
+        REQUIRE(tgui::BackendText::getGlyphRunCacheStatistics().entries == 1);
+
+        // Texts that only differ in color reuse the laid out vertices
+        tgui::Text text4;
+        text4.setFont(font);
+        text4.setString("OK");
+        text4.setColor(tgui::Color::Green);
+        const auto vertexData4 = text4.getBackendText()->getVertexData();
+        REQUIRE(vertexData4[0].second != vertexData[0].second);
+        REQUIRE(vertexData4[0].second->size() == vertexData[0].second->size());
+        REQUIRE((*vertexData4[0].second)[0].position == (*vertexData[0].second)[0].position);
+        REQUIRE((*vertexData4[0].second)[0].color.green == 255);
+        REQUIRE((*vertexData[0].second)[0].color.red == red);
+        statistics = tgui::BackendText::getGlyphRunCacheStatistics();
+        REQUIRE(statistics.entries == 1);
+        REQUIRE(statistics.hits == 2);
+        REQUIRE(statistics.misses == 1);
+
+        // Setting the capacity to 0 disables the cache
+        tgui::BackendText::setGlyphRunCacheCapacity(0);
+        REQUIRE(tgui::BackendText::getGlyphRunCacheStatistics().entries == 0);
+        tgui::Text text3;
+        text3.setFont(font);
+        text3.setString("OK");
+        REQUIRE(text3.getBackendText()->getVertexData()[0].second != vertexData[0].second);
+        REQUIRE(tgui::BackendText::getGlyphRunCacheStatistics().entries == 0);
+        tgui::BackendText::setGlyphRunCacheCapacity(1024);
+        REQUIRE(tgui::BackendText::getGlyphRunCacheCapacity() == 1024);
+    }
+
+    SECTION("Line breaks")
+    {
+        tgui::Font font("resources/DejaVuSans.ttf");
+        const tgui::String str = "ABC DEF GHI\nJKL";
+        const float maxWidth = tgui::Text::getLineWidth("ABC DEF ", font, 20);
+        REQUIRE(tgui::Text::wordWrap(maxWidth, str, font, 20, false) == "ABC DEF \nGHI\nJKL");
+
+        std::vector<tgui::Text::WrappedLine> lines;
+        tgui::Text::findLineBreaks(lines, maxWidth, str, font, 20, false, true);
+        REQUIRE(lines.size() == 3);
+        REQUIRE(lines[0].start == 0);
+        REQUIRE(lines[0].length == 8);
+        REQUIRE(lines[0].width == Approx(maxWidth));
+        REQUIRE(lines[1].start == 8);
+        REQUIRE(lines[1].length == 3);
+        REQUIRE(lines[1].width == Approx(tgui::Text::getLineWidth("GHI", font, 20)));
+        REQUIRE(lines[2].start == 12);
+        REQUIRE(lines[2].length == 3);
+
+        // Wrapping can be continued from the start of a line
+        lines.clear();
+        tgui::Text::findLineBreaks(lines, maxWidth, str, font, 20, false, false, 8);
+        REQUIRE(lines.size() == 2);
+        REQUIRE(lines[0].start == 8);
+        REQUIRE(lines[1].start == 12);
+
+        // Without a maximum width the text is only split at newlines, a newline at the end adds an empty line
+        lines.clear();
+        tgui::Text::findLineBreaks(lines, 0, "ABC DEF\n", font, 20, false);
+        REQUIRE(lines.size() == 2);
+        REQUIRE(lines[0].length == 7);
+        REQUIRE(lines[1].start == 8);
+        REQUIRE(lines[1].length == 0);
+    }
+
+    SECTION("Character positions")
+    {
+        tgui::Font font("resources/DejaVuSans.ttf");
+        text.setFont(font);
+        text.setCharacterSize(20);
+        text.setString("AB\nCD");
+
+        const float lineSpacing = font.getLineSpacing(20);
+        REQUIRE(text.findCharacterPos(0) == tgui::Vector2f{0, 0});
+        REQUIRE(text.findCharacterPos(2).x == Approx(tgui::Text::getLineWidth("AB", font, 20)));
+        REQUIRE(text.findCharacterPos(3) == tgui::Vector2f{0, lineSpacing});
+        REQUIRE(text.findCharacterPos(10) == text.findCharacterPos(5));
+
+        // The index closest to the position on the line is returned
+        REQUIRE(text.findCharacterIndex({-5, -5}) == 0);
+        REQUIRE(text.findCharacterIndex({text.findCharacterPos(1).x - 1, 0}) == 1);
+        REQUIRE(text.findCharacterIndex({text.findCharacterPos(1).x + 1, 0}) == 1);
+        REQUIRE(text.findCharacterIndex({1000, 0}) == 2);
+        REQUIRE(text.findCharacterIndex({0, lineSpacing * 1.5f}) == 3);
+        REQUIRE(text.findCharacterIndex({1000, 1000}) == 5);
+
+        // The positions are calculated again when the text changes
+        text.setString("ABC");
+        REQUIRE(text.findCharacterIndex({1000, 0}) == 3);
+        REQUIRE(text.findCharacterPos(3).x == Approx(tgui::Text::getLineWidth("ABC", font, 20)));
+    }
 }
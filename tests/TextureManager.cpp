@@ -26,6 +26,9 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
+#include <TGUI/Loading/ImageLoader.hpp>
+#include <TGUI/Backend/Renderer/BackendTexture.hpp>
+#include <cstring>
 
 TEST_CASE("[TextureManager]")
 {
@@ -56,3 +59,52 @@ TEST_CASE("[TextureManager]")
 
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData3));
 }
+
+TEST_CASE("[TextureManager] Atlas")
+{
+    REQUIRE(!tgui::TextureManager::isAtlasEnabled());
+    tgui::TextureManager::setAtlasEnabled(true);
+    REQUIRE(tgui::TextureManager::isAtlasEnabled());
+
+    {
+        tgui::Texture texture1{"resources/CheckBox1.png", {}, {1, 2, 3, 4}};
+        tgui::Texture texture2{"resources/CheckBox2.png"};
+        tgui::Texture texture3{"resources/CheckBox2.png", {}, {}, false};
+        REQUIRE(texture1.getData()->backendTexture == texture2.getData()->backendTexture);
+        REQUIRE(texture1.getData()->backendTexture != texture3.getData()->backendTexture);
+        REQUIRE(texture1.getData()->atlasRect != tgui::UIntRect{});
+        REQUIRE(texture1.getData()->atlasRect != texture2.getData()->atlasRect);
+
+        // The part rect and middle rect don't change when the image is placed in an atlas
+        REQUIRE(texture1.getPartRect() == tgui::UIntRect{{0, 0}, texture1.getData()->atlasRect.getSize()});
+        REQUIRE(texture1.getMiddleRect() == tgui::UIntRect(1, 2, 3, 4));
+        REQUIRE(texture1.getImageSize() == texture1.getData()->atlasRect.getSize());
+
+        // Adding an image to a page doesn't change the pixels of the images that were already on it
+        for (const auto& texture : {texture1, texture2})
+        {
+            tgui::Vector2u imageSize;
+            const auto imagePixels = tgui::ImageLoader::loadFromFile(texture.getId(), imageSize);
+            const auto& atlasRect = texture.getData()->atlasRect;
+            const std::uint8_t* pagePixels = texture.getData()->backendTexture->getPixels();
+            const unsigned int pageWidth = texture.getData()->backendTexture->getSize().x;
+            REQUIRE(atlasRect.getSize() == imageSize);
+            for (unsigned int y = 0; y < imageSize.y; ++y)
+            {
+                REQUIRE(std::memcmp(&pagePixels[((atlasRect.top + y) * pageWidth + atlasRect.left) * 4],
+                                    &imagePixels[y * imageSize.x * 4], imageSize.x * 4) == 0);
+            }
+        }
+
+        const auto stats = tgui::TextureManager::getAtlasStatistics();
+        REQUIRE(stats.pages == 2);
+        REQUIRE(stats.images == 3);
+        REQUIRE(stats.fillRatio > 0);
+        REQUIRE(stats.fillRatio < 1);
+    }
+
+    REQUIRE(tgui::TextureManager::getAtlasStatistics().pages == 0);
+    REQUIRE(tgui::TextureManager::getAtlasStatistics().images == 0);
+
+    tgui::TextureManager::setAtlasEnabled(false);
+}
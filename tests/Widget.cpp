@@ -537,6 +537,129 @@ TEST_CASE("[Widget]")
 
             TEST_DRAW("OriginScaleRotation.png")
         }
+
+        SECTION("Retained mode")
+        {
+            auto panel = tgui::Panel::create({200, 100});
+            auto button = tgui::Button::create("Retained");
+            panel->add(button);
+
+            TEST_DRAW_INIT(200, 100, panel)
+
+            REQUIRE(!gui.isRetainedModeEnabled());
+            gui.setRetainedModeEnabled(true);
+            REQUIRE(gui.isRetainedModeEnabled());
+
+            // The first draws record the commands (and may still add glyphs to the font texture)
+            gui.draw();
+            gui.draw();
+
+            // Nothing changed, so nothing has to be recorded again
+            gui.draw();
+            REQUIRE(gui.getRetainedModeStatistics().cacheMisses == 0);
+
+            // Changing the button only requires recording the button again
+            button->setText("Changed");
+            gui.draw();
+            REQUIRE(gui.getRetainedModeStatistics().cacheMisses == 1);
+
+            gui.setRetainedModeEnabled(false);
+        }
+
+        SECTION("Partial redraw")
+        {
+            auto panel = tgui::Panel::create({200, 100});
+            auto button = tgui::Button::create("Partial");
+            button->setPosition({10, 10});
+            panel->add(button);
+
+            auto label = tgui::Label::create("Label");
+            label->setPosition({120, 60});
+            panel->add(label);
+
+            TEST_DRAW_INIT(200, 100, panel)
+
+            // Checks whether an area of the gui (in view coordinates) lies entirely inside the damaged rectangles
+            const auto isAreaDamaged = [&gui](tgui::FloatRect area){
+                const tgui::FloatRect view = gui.getView().getRect();
+                const tgui::FloatRect viewport = gui.getViewport().getRect();
+                for (unsigned int x = 0; x <= 4; ++x)
+                {
+                    for (unsigned int y = 0; y <= 4; ++y)
+                    {
+                        const tgui::Vector2f point{viewport.left + (area.left + area.width * x / 4.f - view.left) * viewport.width / view.width,
+                                                   viewport.top + (area.top + area.height * y / 4.f - view.top) * viewport.height / view.height};
+                        bool pointDamaged = false;
+                        for (const auto& rect : gui.getDamagedRects())
+                        {
+                            if ((point.x >= rect.left) && (point.x <= rect.left + rect.width)
+                             && (point.y >= rect.top) && (point.y <= rect.top + rect.height))
+                                pointDamaged = true;
+                        }
+
+                        if (!pointDamaged)
+                            return false;
+                    }
+                }
+                return true;
+            };
+
+            REQUIRE(!gui.isPartialRedrawEnabled());
+            gui.setPartialRedrawEnabled(true);
+            REQUIRE(gui.isPartialRedrawEnabled());
+            REQUIRE(gui.getBackBufferAge() == 1);
+
+            // The first draw after enabling partial redraw has to draw everything
+            gui.draw();
+            REQUIRE(gui.getDamagedRects().size() == 1);
+            REQUIRE(isAreaDamaged(gui.getView().getRect()));
+
+            // Nothing changed, so nothing has to be drawn
+            gui.draw();
+            REQUIRE(gui.getDamagedRects().empty());
+
+            // Both the old and the new area of the button have to be redrawn when it changes size
+            const tgui::FloatRect oldButtonRect{button->getAbsolutePosition(), button->getSize()};
+            button->setText("Changed caption");
+            REQUIRE(button->getSize().x > oldButtonRect.width);
+            gui.draw();
+            REQUIRE(!gui.getDamagedRects().empty());
+            REQUIRE(isAreaDamaged(oldButtonRect));
+            REQUIRE(isAreaDamaged({button->getAbsolutePosition(), button->getSize()}));
+            REQUIRE(!isAreaDamaged({label->getAbsolutePosition(), label->getSize()}));
+
+            gui.draw();
+            REQUIRE(gui.getDamagedRects().empty());
+
+            // The area that a widget is moved away from has to be redrawn as well
+            const tgui::FloatRect oldLabelRect{label->getAbsolutePosition(), label->getSize()};
+            label->setPosition({120, 75});
+            gui.draw();
+            REQUIRE(isAreaDamaged(oldLabelRect));
+            REQUIRE(isAreaDamaged({label->getAbsolutePosition(), label->getSize()}));
+            REQUIRE(!isAreaDamaged({button->getAbsolutePosition(), button->getSize()}));
+
+            // When the back buffer contains an older frame, the areas that changed since that frame are also redrawn
+            gui.setBackBufferAge(2);
+            button->setPosition({10, 20});
+            gui.draw();
+            REQUIRE(isAreaDamaged(oldLabelRect));
+            REQUIRE(isAreaDamaged({button->getAbsolutePosition(), button->getSize()}));
+
+            // Everything is redrawn when the contents of the back buffer are unknown
+            gui.setBackBufferAge(0);
+            label->setText("Text");
+            gui.draw();
+            REQUIRE(gui.getDamagedRects().size() == 1);
+            REQUIRE(isAreaDamaged(gui.getView().getRect()));
+
+            // Nothing is drawn when nothing changed, regardless of the age of the back buffer
+            gui.draw();
+            REQUIRE(gui.getDamagedRects().empty());
+
+            gui.setBackBufferAge(1);
+            gui.setPartialRedrawEnabled(false);
+        }
     }
 
     SECTION("Bug Fixes")
@@ -26,6 +26,14 @@
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Widgets/TextArea.hpp>
 
+#if TGUI_HAS_RENDERER_BACKEND_SOFTWARE && TGUI_HAS_FONT_BACKEND_FREETYPE
+    #include <TGUI/Backend/Renderer/Software/BackendRendererSoftware.hpp>
+    #include <TGUI/Backend/Renderer/Software/BackendRenderTargetSoftware.hpp>
+    #include <TGUI/Backend/Font/FreeType/BackendFontFreeType.hpp>
+    #include <TGUI/Widgets/Group.hpp>
+    #include <cstring>
+#endif
+
 namespace
 {
     tgui::Event::KeyEvent createKeyEvent(tgui::Event::KeyboardKey key, bool control, bool shift)
@@ -373,6 +381,134 @@ TEST_CASE("[TextArea]")
                 REQUIRE(textArea->getText() == "ABCDEFGHIJ\nLMNOPQRSTUVWXYZ");
             }
 
+            SECTION("Editing word-wrapped text")
+            {
+                textArea->setText("ABC DEF GHI\nJKL MNO PQR\nSTU VWX YZ");
+                auto textArea2 = tgui::TextArea::create();
+                textArea2->setSize(textArea->getSize());
+                textArea2->setTextSize(textArea->getTextSize());
+
+                // Typing in the middle of a paragraph word-wraps the lines in the same way as setText does
+                textArea->setCaretPosition(4);
+                for (const char32_t key : tgui::String("XYZ XYZ XYZ "))
+                    textArea->textEntered(key);
+                REQUIRE(textArea->getText() == "ABC XYZ XYZ XYZ DEF GHI\nJKL MNO PQR\nSTU VWX YZ");
+                REQUIRE(textArea->getCaretPosition() == 16);
+
+                textArea2->setText(textArea->getText());
+                REQUIRE(textArea->getLinesCount() == textArea2->getLinesCount());
+
+                // Removing a newline merges the paragraphs
+                textArea->setCaretPosition(23);
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Delete, false, false));
+                REQUIRE(textArea->getText() == "ABC XYZ XYZ XYZ DEF GHIJKL MNO PQR\nSTU VWX YZ");
+                REQUIRE(textArea->getCaretPosition() == 23);
+
+                textArea2->setText(textArea->getText());
+                REQUIRE(textArea->getLinesCount() == textArea2->getLinesCount());
+
+                // Removing a word can move the words behind it back to a previous line
+                textArea->setSelectedText(4, 16);
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Backspace, false, false));
+                REQUIRE(textArea->getText() == "ABC DEF GHIJKL MNO PQR\nSTU VWX YZ");
+                REQUIRE(textArea->getCaretPosition() == 4);
+
+                textArea2->setText(textArea->getText());
+                REQUIRE(textArea->getLinesCount() == textArea2->getLinesCount());
+            }
+
+            SECTION("Editing at different places")
+            {
+                // The lines behind an edit are only moved once text is changed at another place, before or behind it
+                textArea->setText("1\n22\n333\n4444\n55555\n666666");
+
+                textArea->setCaretPosition(4);
+                textArea->textEntered('A');
+                REQUIRE(textArea->getText() == "1\n22A\n333\n4444\n55555\n666666");
+
+                textArea->setCaretPosition(20);
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Backspace, false, false));
+                REQUIRE(textArea->getText() == "1\n22A\n333\n4444\n5555\n666666");
+                REQUIRE(textArea->getCaretPosition() == 19);
+
+                textArea->setCaretPosition(2);
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Delete, false, false));
+                REQUIRE(textArea->getText() == "1\n2A\n333\n4444\n5555\n666666");
+                REQUIRE(textArea->getCaretPosition() == 2);
+
+                textArea->setSelectedText(9, 18);
+                REQUIRE(textArea->getSelectedText() == "4444\n5555");
+
+                textArea->setCaretPosition(14);
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Down, false, false));
+                REQUIRE(textArea->getCaretPosition() == 19);
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Up, false, false));
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Up, false, false));
+                REQUIRE(textArea->getCaretPosition() == 9);
+
+                // Adding a line between the moved lines
+                textArea->setCaretPosition(11);
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Enter, false, false));
+                REQUIRE(textArea->getText() == "1\n2A\n333\n44\n44\n5555\n666666");
+                REQUIRE(textArea->getLinesCount() == 7);
+
+                textArea->setCaretPosition(textArea->getText().length());
+                textArea->textEntered('B');
+                REQUIRE(textArea->getText() == "1\n2A\n333\n44\n44\n5555\n666666B");
+
+                textArea->setSelectedText(12, 27);
+                REQUIRE(textArea->getSelectedText() == "44\n5555\n666666B");
+
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Home, true, false));
+                REQUIRE(textArea->getCaretPosition() == 0);
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::End, true, true));
+                REQUIRE(textArea->getSelectedText() == textArea->getText());
+            }
+
+            SECTION("Editing text with horizontal scrollbar")
+            {
+                textArea->setHorizontalScrollbarPolicy(tgui::Scrollbar::Policy::Always);
+                textArea->setText("ABC\nDEFGHIJKLMNOPQRSTUVWXYZ\nABC");
+                auto textArea2 = tgui::TextArea::create();
+                textArea2->setSize(textArea->getSize());
+                textArea2->setTextSize(textArea->getTextSize());
+                textArea2->setHorizontalScrollbarPolicy(tgui::Scrollbar::Policy::Always);
+
+                // The scrollbar can be moved as far as the longest line requires
+                const auto getMaxScrollbarValue = [](const tgui::TextArea::Ptr& widget){
+                    widget->setHorizontalScrollbarValue(100000);
+                    return widget->getHorizontalScrollbarValue();
+                };
+
+                // Typing makes the first line the longest one
+                textArea->setCaretPosition(3);
+                for (const char32_t key : tgui::String("ABCDEFGHIJKLMNOPQRSTUVWXYZ"))
+                    textArea->textEntered(key);
+
+                textArea2->setText(textArea->getText());
+                REQUIRE(getMaxScrollbarValue(textArea) > 0);
+                REQUIRE(getMaxScrollbarValue(textArea) == getMaxScrollbarValue(textArea2));
+
+                // Removing the longest line makes the second line the longest one again
+                textArea->setSelectedText(0, 30);
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Backspace, false, false));
+                REQUIRE(textArea->getText() == "DEFGHIJKLMNOPQRSTUVWXYZ\nABC");
+
+                textArea2->setText(textArea->getText());
+                REQUIRE(getMaxScrollbarValue(textArea) > 0);
+                REQUIRE(getMaxScrollbarValue(textArea) == getMaxScrollbarValue(textArea2));
+
+                // Splitting the longest line in two makes the scrollbar shorter
+                textArea->setCaretPosition(12);
+                textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Enter, false, false));
+                REQUIRE(textArea->getText() == "DEFGHIJKLMNO\nPQRSTUVWXYZ\nABC");
+
+                const unsigned int maxValueBeforeSplit = getMaxScrollbarValue(textArea2);
+                textArea2->setText(textArea->getText());
+                REQUIRE(getMaxScrollbarValue(textArea) < maxValueBeforeSplit);
+                REQUIRE(getMaxScrollbarValue(textArea) == getMaxScrollbarValue(textArea2));
+            }
+
             SECTION("Copy and Paste")
             {
                 for (unsigned int i = 0; i < 3; ++i)
@@ -672,6 +808,151 @@ TEST_CASE("[TextArea]")
         }
     }
 
+#if TGUI_HAS_RENDERER_BACKEND_SOFTWARE && TGUI_HAS_FONT_BACKEND_FREETYPE
+    SECTION("Draw long text")
+    {
+        // The text area only keeps the lines near the visible area in its texts. To verify that scrolling and selecting
+        // doesn't change what is displayed, the result is compared with a text area that is large enough to contain all lines.
+        // Both are drawn in memory, which requires all textures to be created by the software renderer.
+        struct SoftwareRendererScope
+        {
+            SoftwareRendererScope() :
+                oldRenderer(tgui::getBackend()->getRenderer())
+            {
+                tgui::getBackend()->setRenderer(std::make_shared<tgui::BackendRendererSoftware>());
+            }
+
+            ~SoftwareRendererScope()
+            {
+                tgui::getBackend()->setRenderer(oldRenderer);
+            }
+
+            std::shared_ptr<tgui::BackendRenderer> oldRenderer;
+        } rendererScope;
+
+        auto backendFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(backendFont->loadFromFile("resources/DejaVuSans.ttf"));
+        const tgui::Font font(backendFont, "resources/DejaVuSans.ttf");
+
+        tgui::String text;
+        std::vector<std::size_t> lineStarts;
+        for (unsigned int i = 0; i < 60; ++i)
+        {
+            lineStarts.push_back(text.length());
+            text += "Line " + tgui::String(i) + "\n";
+        }
+
+        const auto createTextArea = [&](tgui::Vector2f size){
+            auto widget = tgui::TextArea::create();
+            widget->getRenderer()->setFont(font);
+            widget->getRenderer()->setBorders(0);
+            widget->getRenderer()->setPadding(0);
+            widget->getRenderer()->setScrollbarWidth(16);
+            widget->setVerticalScrollbarPolicy(tgui::Scrollbar::Policy::Always);
+            widget->setTextSize(16);
+            widget->setSize(size);
+            widget->setText(text);
+            return widget;
+        };
+
+        auto scrolledTextArea = createTextArea({200, 100});
+
+        tgui::BackendRenderTargetSoftware target;
+        target.setView({0, 0, 400, 150}, {0, 0, 400, 150}, {400, 150});
+
+        auto root = std::make_shared<tgui::RootContainer>();
+        root->setSize({400, 150});
+        root->add(scrolledTextArea);
+
+        // Draws the text area on the left and the same view of a text area that contains all lines on the right
+        const auto compareWithFullText = [&](std::size_t selectionStart, std::size_t selectionEnd){
+            const tgui::Vector2f size = scrolledTextArea->getSize();
+
+            auto fullTextArea = createTextArea({size.x, 2000});
+            fullTextArea->setSelectedText(selectionStart, selectionEnd);
+            fullTextArea->setPosition({0, -static_cast<float>(scrolledTextArea->getVerticalScrollbarValue())});
+
+            auto group = tgui::Group::create(size);
+            group->setPosition({200, 0});
+            group->add(fullTextArea);
+            root->add(group);
+
+            target.clearScreen();
+            target.drawGui(root);
+            root->remove(group);
+
+            // The scrollbars are not compared, only the area containing the text
+            unsigned int differentPixels = 0;
+            const std::uint8_t* pixels = target.getPixels();
+            for (unsigned int y = 0; y < static_cast<unsigned int>(size.y); ++y)
+            {
+                for (unsigned int x = 0; x < static_cast<unsigned int>(size.x) - 16; ++x)
+                {
+                    if (std::memcmp(pixels + (y * 400 + x) * 4, pixels + (y * 400 + 200 + x) * 4, 4) != 0)
+                        ++differentPixels;
+                }
+            }
+            REQUIRE(differentPixels == 0);
+        };
+
+        const auto selectAndCompare = [&](std::size_t selectionStart, std::size_t selectionEnd, unsigned int scrollbarValue){
+            scrolledTextArea->setSelectedText(selectionStart, selectionEnd);
+            scrolledTextArea->setVerticalScrollbarValue(scrollbarValue);
+            compareWithFullText(selectionStart, selectionEnd);
+        };
+
+        SECTION("No selection")
+        {
+            selectAndCompare(0, 0, 0);
+            selectAndCompare(0, 0, 500);
+            REQUIRE(scrolledTextArea->getVerticalScrollbarValue() == 500);
+            selectAndCompare(0, 0, 480);
+            selectAndCompare(0, 0, 2000);
+            REQUIRE(scrolledTextArea->getVerticalScrollbarValue() > 1000);
+        }
+
+        SECTION("Selection starts above and ends below the visible lines")
+        {
+            selectAndCompare(lineStarts[5] + 2, lineStarts[50] + 3, 500);
+            selectAndCompare(lineStarts[50] + 3, lineStarts[5] + 2, 500);
+            selectAndCompare(lineStarts[5] + 2, lineStarts[50] + 3, 2000);
+        }
+
+        SECTION("Selection inside the visible lines")
+        {
+            const unsigned int scrollbarValue = 500;
+            scrolledTextArea->setVerticalScrollbarValue(scrollbarValue);
+
+            // Line 28 is visible, while lines 10 and 45 lie outside the lines that are kept in the texts
+            selectAndCompare(lineStarts[27] + 2, lineStarts[29] + 4, scrollbarValue);
+            selectAndCompare(lineStarts[28] + 1, lineStarts[28] + 5, scrollbarValue);
+            selectAndCompare(lineStarts[28] + 1, lineStarts[45] + 5, scrollbarValue);
+            selectAndCompare(lineStarts[10] + 1, lineStarts[28] + 5, scrollbarValue);
+            selectAndCompare(lineStarts[57] + 2, lineStarts[59] + 3, 2000);
+        }
+
+        SECTION("Selection outside the texts")
+        {
+            selectAndCompare(lineStarts[2] + 2, lineStarts[8] + 3, 500);
+            selectAndCompare(lineStarts[45] + 1, lineStarts[50] + 5, 500);
+            selectAndCompare(lineStarts[3] + 1, lineStarts[3] + 4, 2000);
+        }
+
+        SECTION("Resize")
+        {
+            selectAndCompare(lineStarts[5] + 2, lineStarts[50] + 3, 500);
+
+            scrolledTextArea->setSize({200, 150});
+            compareWithFullText(lineStarts[5] + 2, lineStarts[50] + 3);
+
+            scrolledTextArea->setSize({200, 50});
+            compareWithFullText(lineStarts[5] + 2, lineStarts[50] + 3);
+
+            selectAndCompare(lineStarts[5] + 2, lineStarts[50] + 3, 2000);
+        }
+    }
+#endif
+
     SECTION("Bug Fixes")
     {
         SECTION("ctrl+alt+A should not act as ctrl+A (https://github.com/texus/TGUI/issues/43)")
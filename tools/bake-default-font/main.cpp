@@ -0,0 +1,250 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backend/Font/FreeType/BackendFontFreeType.hpp>
+#include <TGUI/DefaultFont.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// tgui-default-font-baker rasterizes the printable ASCII and Latin-1 characters of the default font with FreeType and
+// writes them, together with their metrics and the kerning between ASCII characters, to a header file. The FreeType font
+// backend copies these glyphs into its atlas instead of loading them when a font with the same data is used.
+//
+// The tgui-bake-default-font target runs this program to regenerate include/TGUI/DefaultFontAtlas.hpp.
+//
+// Usage: tgui-default-font-baker output-file [character sizes...]
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Character sizes that are baked when no sizes are passed on the command line (13 is the default text size)
+    const std::vector<unsigned int> defaultCharacterSizes = {12, 13, 14, 16, 18};
+
+    // Ranges of code points for which the glyphs are rasterized, the metrics are stored for all code points below 256
+    const std::vector<std::pair<char32_t, char32_t>> bakedRanges = {{U' ', U'~'}, {0xA0, 0xFF}};
+
+    // Amount of bytes in the header of the font file that are compared to recognize the default font
+    const std::size_t fileHeaderSize = 256;
+
+    template <typename T>
+    void writeArray(std::ostream& out, const std::vector<T>& values)
+    {
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            out << static_cast<int>(values[i]) << ',';
+            if ((i % 64 == 63) || (i + 1 == values.size()))
+                out << '\n';
+        }
+    }
+
+    std::string formatFloat(float value)
+    {
+        std::ostringstream stream;
+        stream << std::setprecision(9) << value;
+        std::string str = stream.str();
+        if (str.find_first_of(".e") == std::string::npos)
+            str += ".0";
+        return str + 'f';
+    }
+
+    // Derives from the font backend to access the FreeType objects and the functions that load the glyphs
+    class DefaultFontBaker : public tgui::BackendFontFreetype
+    {
+    public:
+
+        bool bake(const std::vector<unsigned int>& characterSizes, std::ostream& out)
+        {
+            setPrebakedDefaultFontEnabled(false);
+            if (!loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
+                return false;
+
+            out << "// Glyphs of the default font (DejaVu Sans) that were rasterized with FreeType in advance.\n"
+                << "// The glyphs are derived from the font and thus fall under the license that can be found in DefaultFont.hpp.\n"
+                << "//\n"
+                << "// This file is generated by the tgui-bake-default-font target, don't edit it manually.\n"
+                << "\n"
+                << "#ifndef TGUI_DEFAULT_FONT_ATLAS_HPP\n"
+                << "#define TGUI_DEFAULT_FONT_ATLAS_HPP\n"
+                << "\n"
+                << "#include <cstddef>\n"
+                << "\n"
+                << "namespace tgui\n"
+                << "{\n"
+                << "namespace defaultFontAtlas\n"
+                << "{\n"
+                << "    struct GlyphMetrics\n"
+                << "    {\n"
+                << "        short          advance;    //!< Offset to move horizontally to the next character\n"
+                << "        short          lsbDelta;   //!< Left offset after forced autohint\n"
+                << "        short          rsbDelta;   //!< Right offset after forced autohint\n"
+                << "        unsigned short glyphIndex; //!< Index of the glyph in the font (0 when the font doesn't contain the character)\n"
+                << "    };\n"
+                << "\n"
+                << "    struct GlyphBitmap\n"
+                << "    {\n"
+                << "        char32_t       codePoint;    //!< Character of which this is the bitmap\n"
+                << "        short          left;         //!< Left position of the bitmap, relative to the pen position\n"
+                << "        short          top;          //!< Top position of the bitmap, relative to the baseline\n"
+                << "        unsigned short width;        //!< Width of the bitmap\n"
+                << "        unsigned short height;       //!< Height of the bitmap\n"
+                << "        unsigned int   pixelsOffset; //!< Index of the first alpha value of the bitmap in the pixels array\n"
+                << "    };\n"
+                << "\n"
+                << "    struct CharacterSize\n"
+                << "    {\n"
+                << "        unsigned int         characterSize;      //!< Character size for which the glyphs were rasterized\n"
+                << "        float                lineSpacing;        //!< Line spacing at this character size\n"
+                << "        float                underlinePosition;  //!< Offset of the underline below the baseline\n"
+                << "        float                underlineThickness; //!< Thickness of the underline\n"
+                << "        const GlyphMetrics*  metrics;            //!< Metrics of the first 256 code points, indexed by code point\n"
+                << "        const GlyphBitmap*   glyphs;             //!< Rasterized glyphs, in the order in which they are placed in the atlas\n"
+                << "        std::size_t          glyphCount;         //!< Amount of rasterized glyphs\n"
+                << "        const unsigned char* pixels;             //!< Alpha values of all rasterized glyphs\n"
+                << "        const signed char*   asciiKerning;       //!< Kerning of every pair of ASCII characters (128x128 values)\n"
+                << "    };\n"
+                << "\n"
+                << "    // The prebaked glyphs are only used for a font of which the size and header match the font that was baked\n"
+                << "    static const std::size_t fontFileSize = " << sizeof(defaultFontBytes) << ";\n"
+                << "    static const unsigned char fontFileHeader[" << fileHeaderSize << "] = {\n";
+            writeArray(out, std::vector<unsigned char>(defaultFontBytes, defaultFontBytes + fileHeaderSize));
+            out << "    };\n";
+
+            for (const unsigned int characterSize : characterSizes)
+                bakeCharacterSize(characterSize, out);
+
+            out << "\n"
+                << "    static const CharacterSize characterSizes[] = {\n";
+            for (const unsigned int characterSize : characterSizes)
+            {
+                const unsigned int s = characterSize;
+                out << "        {" << s << ", " << formatFloat(getLineSpacing(s)) << ", " << formatFloat(getUnderlinePosition(s))
+                    << ", " << formatFloat(getUnderlineThickness(s)) << ", metrics" << s << ", glyphs" << s << ", sizeof(glyphs" << s
+                    << ") / sizeof(GlyphBitmap), pixels" << s << ", asciiKerning" << s << "},\n";
+            }
+            out << "    };\n"
+                << "}\n"
+                << "}\n"
+                << "\n"
+                << "#endif // TGUI_DEFAULT_FONT_ATLAS_HPP\n";
+            return true;
+        }
+
+    private:
+
+        void bakeCharacterSize(unsigned int characterSize, std::ostream& out)
+        {
+            MetricsTable& table = getMetricsTable(characterSize, false);
+
+            out << "\n"
+                << "    static const GlyphMetrics metrics" << characterSize << "[256] = {\n";
+            for (char32_t codePoint = 0; codePoint < 256; ++codePoint)
+            {
+                const GlyphMetrics& metrics = getGlyphMetrics(table, codePoint, false);
+                out << "        {" << metrics.advance << ", " << metrics.lsbDelta << ", " << metrics.rsbDelta << ", "
+                    << metrics.glyphIndex << "},\n";
+            }
+            out << "    };\n";
+
+            std::vector<unsigned char> pixels;
+            std::ostringstream glyphsStream;
+            for (const auto& range : bakedRanges)
+            {
+                for (char32_t codePoint = range.first; codePoint <= range.second; ++codePoint)
+                {
+                    RasterizedGlyph rasterizedGlyph;
+                    if (!rasterizeGlyph(m_library, m_face, m_stroker, codePoint, characterSize, false, 0, rasterizedGlyph))
+                        continue;
+
+                    const tgui::FloatRect& bounds = rasterizedGlyph.glyph.bounds;
+                    glyphsStream << "        {" << static_cast<unsigned int>(codePoint) << ", " << bounds.left << ", " << bounds.top
+                                 << ", " << rasterizedGlyph.width << ", " << rasterizedGlyph.height << ", " << pixels.size() << "},\n";
+                    pixels.insert(pixels.end(), rasterizedGlyph.pixels.begin(), rasterizedGlyph.pixels.end());
+                }
+            }
+
+            out << "    static const GlyphBitmap glyphs" << characterSize << "[] = {\n"
+                << glyphsStream.str()
+                << "    };\n"
+                << "    static const unsigned char pixels" << characterSize << "[] = {\n";
+            writeArray(out, pixels);
+            out << "    };\n";
+
+            std::vector<signed char> asciiKerning;
+            for (char32_t first = 0; first < 128; ++first)
+            {
+                for (char32_t second = 0; second < 128; ++second)
+                    asciiKerning.push_back(static_cast<signed char>(getCachedKerning(table, first, second, false)));
+            }
+
+            out << "    static const signed char asciiKerning" << characterSize << "[128 * 128] = {\n";
+            writeArray(out, asciiKerning);
+            out << "    };\n";
+        }
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: tgui-default-font-baker output-file [character sizes...]\n";
+        return 1;
+    }
+
+    std::vector<unsigned int> characterSizes;
+    for (int i = 2; i < argc; ++i)
+        characterSizes.push_back(static_cast<unsigned int>(std::max(1, std::atoi(argv[i]))));
+    if (characterSizes.empty())
+        characterSizes = defaultCharacterSizes;
+
+    std::ostringstream out;
+    DefaultFontBaker baker;
+    if (!baker.bake(characterSizes, out))
+    {
+        std::cerr << "Failed to load the default font\n";
+        return 1;
+    }
+
+    std::ofstream file(argv[1], std::ios::binary);
+    file << out.str();
+    if (!file)
+    {
+        std::cerr << "Failed to write to '" << argv[1] << "'\n";
+        return 1;
+    }
+
+    return 0;
+}